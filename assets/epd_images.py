@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+@file epd_images.py
+@brief Packs the EPD images for the firmware
+
+The images are kept as 1 bit PBM files (P4) in assets/epd. Each image is
+packed with PackBits and written to src/RAK14000_images.cpp as a const
+epd_image_t. The unpacked size and a FNV-1a hash of every image are written
+to native/bench/bench_images.h, the host benchmark checks the decoder with them.
+
+Run from the project folder:
+    python3 assets/epd_images.py
+
+To create the PBM files from a C source with unpacked arrays:
+    python3 assets/epd_images.py --extract <file.cpp>
+"""
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PBM_DIR = os.path.join(ROOT, "assets", "epd")
+SOURCE = os.path.join(ROOT, "src", "RAK14000_images.cpp")
+BENCH = os.path.join(ROOT, "native", "bench", "bench_images.h")
+
+# Name, width and height of the images, in the order they are written
+IMAGES = [
+    ("good_air", 248, 248),
+    ("bad_air", 248, 248),
+    ("worried_air", 248, 248),
+    ("rak_img", 184, 56),
+    ("celsius_img", 32, 32),
+    ("humidity_img", 32, 32),
+    ("co2_img", 32, 32),
+    ("barometer_img", 32, 32),
+    ("voc_img", 32, 32),
+    ("pm_img", 32, 32),
+    ("built_img", 126, 66),
+    ("wisblock_img", 128, 72),
+]
+
+
+def packbits(data):
+    """Pack bytes with PackBits, runs of 3 or more bytes are repeated"""
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:128]
+
+    idx = 0
+    while idx < len(data):
+        end = idx
+        while end < len(data) and data[end] == data[idx] and end - idx < 128:
+            end += 1
+        run = end - idx
+        if run >= 3 or (run == 2 and not literal):
+            flush()
+            out.append((257 - run) & 0xFF)
+            out.append(data[idx])
+            idx = end
+        else:
+            literal.append(data[idx])
+            idx += 1
+            if len(literal) == 128:
+                flush()
+    flush()
+    return bytes(out)
+
+
+def unpackbits(data, size):
+    """Unpack PackBits data, used to check the packed image"""
+    out = bytearray()
+    idx = 0
+    while len(out) < size:
+        header = data[idx]
+        idx += 1
+        if header < 128:
+            out.extend(data[idx:idx + header + 1])
+            idx += header + 1
+        elif header > 128:
+            out.extend(bytes([data[idx]]) * (257 - header))
+            idx += 1
+    return bytes(out[:size])
+
+
+def fnv1a(data):
+    """FNV-1a hash, same as in the host benchmark"""
+    value = 2166136261
+    for byte in data:
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def read_pbm(name, width, height):
+    """Read a P4 PBM file, rows are padded to full bytes"""
+    with open(os.path.join(PBM_DIR, name + ".pbm"), "rb") as pbm:
+        content = pbm.read()
+    header = re.match(rb"P4\s+(?:#[^\n]*\n\s*)*(\d+)\s+(\d+)\s", content)
+    if header is None or (int(header.group(1)), int(header.group(2))) != (width, height):
+        sys.exit("%s.pbm: expected a %d x %d P4 file" % (name, width, height))
+    data = content[header.end():]
+    size = (width + 7) // 8 * height
+    if len(data) < size:
+        sys.exit("%s.pbm: file is too short" % name)
+    return data[:size]
+
+
+def extract(source):
+    """Write the unpacked arrays of a C source as PBM files"""
+    with open(source) as src:
+        text = src.read()
+    os.makedirs(PBM_DIR, exist_ok=True)
+    for name, width, height in IMAGES:
+        array = re.search(r"unsigned char %s\[\d*\] = \{(.*?)\};" % name, text, re.S)
+        if array is None:
+            sys.exit("%s not found in %s" % (name, source))
+        data = bytes(int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", array.group(1)))
+        size = (width + 7) // 8 * height
+        with open(os.path.join(PBM_DIR, name + ".pbm"), "wb") as pbm:
+            pbm.write(b"P4\n%d %d\n" % (width, height))
+            pbm.write(data[:size])
+        print("%-14s %4d x %3d  %5d bytes" % (name, width, height, size))
+
+
+def c_array(data):
+    """Format bytes as lines of a C array"""
+    lines = []
+    for idx in range(0, len(data), 12):
+        lines.append("\t" + ", ".join("0x%02X" % byte for byte in data[idx:idx + 12]) + ",")
+    lines[-1] = lines[-1][:-1]
+    return "\n".join(lines)
+
+
+def generate():
+    """Write the packed images and the reference values for the benchmark"""
+    source = ['''/**
+ * @file RAK14000_images.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief PackBits compressed images for the EPD display
+ *        Written by assets/epd_images.py from the PBM files in assets/epd, do not edit
+ * @version 0.1
+ * @date 2022-06-25
+ *
+ * @copyright Copyright (c) 2022
+ * Images cortesy of <a href="https://www.flaticon.com/free-icons" title="Freepik - Flaticon">Icons created by Freepik - Flaticon</a>
+ */
+#include "RAK14000_image.h"
+''']
+    bench = ['''/**
+ * @file bench_images.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Unpacked size and FNV-1a hash of the EPD images
+ *        Written by assets/epd_images.py from the PBM files in assets/epd, do not edit
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "RAK14000_image.h"
+
+/** Reference values of an image */
+struct bench_image_s
+{
+	const epd_image_t *image;
+	const char *name;
+	uint16_t bytes;
+	uint32_t hash;
+};
+
+static const bench_image_s bench_images[] = {''']
+    raw_total = 0
+    packed_total = 0
+    for name, width, height in IMAGES:
+        data = read_pbm(name, width, height)
+        packed = packbits(data)
+        if unpackbits(packed, len(data)) != data:
+            sys.exit("%s: packed image does not match" % name)
+        raw_total += len(data)
+        packed_total += len(packed)
+        source.append('''
+/** %s %d x %d, %d bytes packed to %d bytes */
+static const uint8_t %s_data[] = {
+%s};
+const epd_image_t %s = {%s_data, %d, %d, %d};
+''' % (name, width, height, len(data), len(packed), name, c_array(packed), name, name, len(packed), width, height))
+        bench.append('\t{&%s, "%s", %d, 0x%08X},' % (name, name, len(data), fnv1a(data)))
+        print("%-14s %4d x %3d  %5d -> %5d bytes" % (name, width, height, len(data), len(packed)))
+    bench.append("};\n")
+    print("total                     %5d -> %5d bytes" % (raw_total, packed_total))
+
+    with open(SOURCE, "w", newline="\r\n") as out:
+        out.write("".join(source))
+    with open(BENCH, "w") as out:
+        out.write("\n".join(bench))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 3 and sys.argv[1] == "--extract":
+        extract(sys.argv[2])
+    else:
+        generate()
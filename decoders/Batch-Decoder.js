@@ -0,0 +1,67 @@
+/**
+ * Decoder for batched uplinks, selected with AT+BATCH=<samples per uplink>
+ *
+ * Frame format
+ *  Byte 0              0xB1 format ID
+ *  Byte 1              Flags, bit 0 set if the time is from the RTC (seconds since 1970), otherwise uptime in seconds
+ *  Byte 2              Number of records
+ *  Byte 3 to 6         Time of the first record, MSB first
+ *  Records
+ *   2 bytes            Seconds since the previous record, MSB first, 0 for the first record
+ *   1 byte             Size of the sample
+ *   Sample             Cayenne LPP or compact payload
+ *
+ * The samples are decoded with lppDecode() from one of the Ext-LPP decoders
+ * and compactDecode() from Compact-Payload-Decoder.js.
+ * Copy both functions into the same decoder script as this file.
+ */
+
+// batchDecode splits a frame into samples, each one with its time and the decoded values
+function batchDecode(bytes) {
+
+	if ((bytes.length < 7) || (bytes[0] != 0xB1)) {
+		throw 'Not a batch frame!';
+	}
+
+	var from_rtc = (bytes[1] & 0x01) != 0;
+	var count = bytes[2];
+	var time = ((bytes[3] << 24) >>> 0) + (bytes[4] << 16) + (bytes[5] << 8) + bytes[6];
+
+	var samples = [];
+	var i = 7;
+	for (var record = 0; record < count; record++) {
+		if (i + 3 > bytes.length)
+			throw 'Frame too short!';
+		time += (bytes[i] << 8) + bytes[i + 1];
+		var size = bytes[i + 2];
+		var sample = bytes.slice(i + 3, i + 3 + size);
+		i += 3 + size;
+
+		var values = sample[0] == 0xC1 ? compactDecode(sample) : lppDecode(sample);
+		samples.push({
+			'time': from_rtc ? new Date(time * 1000).toISOString() : time,
+			'values': values
+		});
+	}
+
+	return samples;
+}
+
+// Flat output of one sample, like the Cayenne LPP decoder
+function flatSample(sample) {
+	var response = { 'time': sample['time'] };
+	sample['values'].forEach(function (field) {
+		response[field['name'] + '_' + field['channel']] = field['value'];
+	});
+	return response;
+}
+
+// To use with Chirpstack
+function Decode(fPort, bytes, variables) {
+	return { data: { samples: batchDecode(bytes).map(flatSample) } };
+}
+
+// To use with TTN
+function Decoder(bytes, port) {
+	return { data: { samples: batchDecode(bytes).map(flatSample) } };
+}
@@ -0,0 +1,99 @@
+/**
+ * Decoder for the compact payload, selected with AT+PAYLOAD=1
+ *
+ * Packet format
+ *  Byte 0              0xC1 format ID
+ *  Byte 1 to 3         Bitmap, MSB of byte 1 is the first schema entry
+ *  Following bytes     Bit fields of the values marked in the bitmap, MSB first, in schema order
+ *
+ * value = bit field * step + min
+ *
+ * The schema must match compact_schema[] in src/wisblock_compact.cpp
+ * The output uses the same names as the Cayenne LPP decoders, e.g. temperature_3
+ * Packets that do not start with 0xC1 are Cayenne LPP packets, use one of the Ext-LPP decoders for them
+ */
+
+// compactDecode decodes an array of bytes into an array of ojects,
+// each one with the channel, the data type and the value.
+function compactDecode(bytes) {
+
+	var schema = [
+		{ 'channel': 1, 'type': 116, 'name': 'voltage', 'bits': 8, 'min': 0, 'step': 0.02 },
+		{ 'channel': 2, 'type': 104, 'name': 'humidity', 'bits': 7, 'min': 0, 'step': 1 },
+		{ 'channel': 3, 'type': 103, 'name': 'temperature', 'bits': 11, 'min': -40, 'step': 0.1 },
+		{ 'channel': 4, 'type': 115, 'name': 'barometer', 'bits': 14, 'min': 300, 'step': 0.1 },
+		{ 'channel': 5, 'type': 101, 'name': 'illuminance', 'bits': 16, 'min': 0, 'step': 1 },
+		{ 'channel': 6, 'type': 104, 'name': 'humidity', 'bits': 7, 'min': 0, 'step': 1 },
+		{ 'channel': 7, 'type': 103, 'name': 'temperature', 'bits': 11, 'min': -40, 'step': 0.1 },
+		{ 'channel': 8, 'type': 115, 'name': 'barometer', 'bits': 14, 'min': 300, 'step': 0.1 },
+		{ 'channel': 9, 'type': 2, 'name': 'analog_in', 'bits': 9, 'min': 0, 'step': 1 },
+		{ 'channel': 15, 'type': 101, 'name': 'illuminance', 'bits': 16, 'min': 0, 'step': 1 },
+		{ 'channel': 16, 'type': 138, 'name': 'voc', 'bits': 9, 'min': 0, 'step': 1 },
+		{ 'channel': 27, 'type': 2, 'name': 'analog_in', 'bits': 11, 'min': 0, 'step': 0.01 },
+		{ 'channel': 28, 'type': 101, 'name': 'illuminance', 'bits': 16, 'min': 0, 'step': 1 },
+		{ 'channel': 35, 'type': 125, 'name': 'concentration', 'bits': 14, 'min': 0, 'step': 1 },
+		{ 'channel': 36, 'type': 103, 'name': 'temperature', 'bits': 11, 'min': -40, 'step': 0.1 },
+		{ 'channel': 37, 'type': 104, 'name': 'humidity', 'bits': 7, 'min': 0, 'step': 1 },
+		{ 'channel': 40, 'type': 138, 'name': 'voc', 'bits': 10, 'min': 0, 'step': 1 },
+		{ 'channel': 41, 'type': 138, 'name': 'voc', 'bits': 10, 'min': 0, 'step': 1 },
+		{ 'channel': 42, 'type': 138, 'name': 'voc', 'bits': 10, 'min': 0, 'step': 1 },
+	];
+
+	var bitmap_size = 3;
+
+	if ((bytes.length < 1 + bitmap_size) || (bytes[0] != 0xC1)) {
+		throw 'Not a compact payload!';
+	}
+
+	var bit_pos = (1 + bitmap_size) * 8;
+
+	function readBits(bits) {
+		var value = 0;
+		for (var i = 0; i < bits; i++) {
+			if ((bit_pos >> 3) >= bytes.length)
+				throw 'Payload too short!';
+			value = (value * 2) + ((bytes[bit_pos >> 3] >> (7 - (bit_pos & 7))) & 1);
+			bit_pos++;
+		}
+		return value;
+	}
+
+	var sensors = [];
+	for (var field = 0; field < schema.length; field++) {
+		if ((bytes[1 + (field >> 3)] & (0x80 >> (field & 7))) == 0)
+			continue;
+
+		var entry = schema[field];
+		var value = readBits(entry.bits) * entry.step + entry.min;
+
+		sensors.push({
+			'channel': entry.channel,
+			'type': entry.type,
+			'name': entry.name,
+			// Remove rounding errors of the step
+			'value': Math.round(value * 100) / 100
+		});
+	}
+
+	return sensors;
+}
+
+// To use with Chirpstack
+function Decode(fPort, bytes, variables) {
+	// flat output (like the Cayenne LPP decoder):
+	var response = {};
+	compactDecode(bytes).forEach(function (field) {
+		response[field['name'] + '_' + field['channel']] = field['value'];
+	});
+	return { data: response };
+}
+
+// To use with TTN
+function Decoder(bytes, port) {
+	// flat output (like the Cayenne LPP decoder):
+	var response = {};
+	compactDecode(bytes).forEach(function (field) {
+		response[field['name'] + '_' + field['channel']] = field['value'];
+	});
+	return { data: response };
+}
@@ -0,0 +1,52 @@
+/**
+ * Decoder for the history dump on fPort 4, requested with the downlink AA 5B <history channel> <range>
+ *
+ * Frame format
+ *  Byte 0              0xD1 format ID
+ *  Byte 1              History channel, 0 = VOC, 1 = temperature, 2 = humidity, 3 = pressure, 4 = CO2, 5 = PM1.0, 6 = PM2.5, 7 = PM10
+ *  Byte 2              Range, 0 = last values, 1 = hourly means, 2 = daily means
+ *  Byte 3 to 4         Scale, MSB first
+ *  Byte 5              Number of values
+ *  Values              2 bytes each, signed, MSB first, oldest value first, value = raw / scale
+ */
+
+// historyDecode returns the channel name, the range and the values
+function historyDecode(bytes) {
+
+	var channels = ['voc', 'temperature', 'humidity', 'barometer', 'co2', 'pm1_0', 'pm2_5', 'pm10'];
+	var ranges = ['values', 'hours', 'days'];
+
+	if ((bytes.length < 6) || (bytes[0] != 0xD1)) {
+		throw 'Not a history dump!';
+	}
+
+	var scale = (bytes[3] << 8) + bytes[4];
+	var count = bytes[5];
+	if (bytes.length < 6 + 2 * count) {
+		throw 'Frame too short!';
+	}
+
+	var values = [];
+	for (var i = 0; i < count; i++) {
+		var raw = (bytes[6 + 2 * i] << 8) + bytes[7 + 2 * i];
+		if (raw > 0x7FFF)
+			raw -= 0x10000;
+		values.push(raw / scale);
+	}
+
+	return {
+		'channel': channels[bytes[1]] || bytes[1],
+		'range': ranges[bytes[2]] || bytes[2],
+		'values': values
+	};
+}
+
+// To use with Chirpstack
+function Decode(fPort, bytes, variables) {
+	return { data: historyDecode(bytes) };
+}
+
+// To use with TTN
+function Decoder(bytes, port) {
+	return { data: historyDecode(bytes) };
+}
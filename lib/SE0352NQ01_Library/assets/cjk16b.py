@@ -4407,38 +4407,71 @@ def displayChar(x):
   pattern = re.sub("0", " ", pattern)
   print(pattern)
 
+def sparseEntries():
+  # (codepoint, offset) of every glyph, sorted by codepoint
+  return [(ifb(_mvsp[i:]), ifb(_mvsp[i + 2:])) for i in range(0, len(_mvsp), 4)]
+
+def directIndex():
+  # Two level index: the page of 256 codepoints selects a slot, 8 words of
+  # 32 bits per slot have a bit set for every codepoint with a glyph. The
+  # rank of a word is the number of glyphs before it, the glyph number is
+  # the rank plus the bits set below the codepoint in its word.
+  entries = sparseEntries()
+  pages = [0xff] * 256
+  bits = []
+  ranks = []
+  for ch, offs in entries:
+    page = ch >> 8
+    if pages[page] == 0xff:
+      pages[page] = len(bits) // 8
+      bits += [0] * 8
+      ranks += [0] * 8
+    bits[pages[page] * 8 + ((ch >> 5) & 7)] |= 1 << (ch & 31)
+  count = 0
+  for word in range(len(bits)):
+    ranks[word] = count
+    count += bin(bits[word]).count('1')
+  offsets = [offs for ch, offs in entries]
+  # Check the index against the sparse table
+  for ch, offs in entries:
+    slot, word = pages[ch >> 8], (ch >> 5) & 7
+    mask = bits[slot * 8 + word] & ((1 << (ch & 31)) - 1)
+    assert offsets[ranks[slot * 8 + word] + bin(mask).count('1')] == offs
+  return pages, bits, ranks, offsets
+
+def writeArray(f, decl, values, fmt, perLine):
+  f.write(decl + " PROGMEM = {\n  ")
+  for i in range(0, len(values) - 1):
+    f.write(fmt.format(values[i]) + ",")
+    f.write("\n  " if (i + 1) % perLine == 0 else " ")
+  f.write(fmt.format(values[-1]) + "\n};\n")
+
+def writeHeader(name, prefix):
+  pages, bits, ranks, offsets = directIndex()
+  with open(name, 'w') as f:
+    ln = len(_mvfont)
+    print(f"len(_mvfont) = {ln}")
+    f.write(f"uint16_t {prefix}Len = {ln};\n\n")
+    writeArray(f, f"const unsigned char {prefix}font[]", _mvfont, "0x{:02x}", 16)
+    ln = len(_mvsp)
+    print(f"len(_mvsp) = {ln}")
+    writeArray(f, f"const unsigned char {prefix}sparse[]", _mvsp, "0x{:02x}", 16)
+    f.write(f"\nuint16_t {prefix}SparseLen = {ln};\n")
+    f.write(f"uint8_t {prefix}Height = {height()};\n\n")
+    ln = len(pages) + len(bits) * 4 + len(ranks) * 2 + len(offsets) * 2
+    print(f"direct index = {ln} bytes, {len(bits) // 8} pages")
+    f.write(f"// Direct index, {ln} bytes, see CJKfont in SE0352NQ01.h\n")
+    writeArray(f, f"const uint8_t {prefix}pages[]", pages, "0x{:02x}", 16)
+    writeArray(f, f"const uint32_t {prefix}bits[]", bits, "0x{:08x}", 8)
+    writeArray(f, f"const uint16_t {prefix}ranks[]", ranks, "{}", 16)
+    writeArray(f, f"const uint16_t {prefix}offsets[]", offsets, "0x{:04x}", 16)
+    f.write(f"\nconst CJKfont {prefix} = {{{prefix}font, {prefix}pages, {prefix}bits, {prefix}ranks, {prefix}offsets, {height()}}};\n")
+
 import re, sys
 if __name__ == "__main__":
   print("Displaying 한")
   displayChar("한") # It will display ?
   print("Displaying "+chr(0x7CA4))
   displayChar(chr(0x7CA4))
-  ln = len(_mvfont)
-  print(f"len(_mvfont) = {ln}")
-  with open('CJK16ptB.h', 'w') as f:
-    f.write(f"uint16_t CJK16ptBLen = {ln};\n\n")
-    f.write("const unsigned char CJK16ptBfont[] PROGMEM = {\n  ")
-    bCount = 0
-    for i in range(0, ln-1):
-      f.write("0x"+format(_mvfont[i], "02x")+",")
-      bCount += 1
-      if bCount % 16 ==0:
-        f.write("\n  ")
-      else:
-        f.write(" ")
-    f.write("0x"+format(_mvfont[ln-1], "02x")+"\n};\n")
-    f.write("const unsigned char CJK16ptBsparse[] PROGMEM = {\n  ")
-    bCount = 0
-    ln = len(_mvsp)
-    print(f"len(_mvsp) = {ln}")
-    for i in range(0, ln-1):
-      f.write("0x"+format(_mvsp[i], "02x")+",")
-      bCount += 1
-      if bCount % 16 ==0:
-        f.write("\n  ")
-      else:
-        f.write(" ")
-    f.write("0x"+format(_mvsp[ln-1], "02x")+"\n};\n")
-    f.write(f"\nuint16_t CJK16ptBSparseLen = {ln};\n\n")
-    f.write(f"\nuint8_t CJK16ptBHeight = 12;\n\n")
-  f.close()
+  header = sys.argv[1] if len(sys.argv) > 1 else 'CJK16ptB.h'
+  writeHeader(header, 'CJK16ptB')
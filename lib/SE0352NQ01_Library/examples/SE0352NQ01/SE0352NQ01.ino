@@ -24,8 +24,8 @@ void partialDemo() {
   Serial.println("partialRefresh 0");
   SE0352.fillCircle(300, 200, 30, 0, frame);
   uint16_t zhongwenyekeyi[] = {0x4e2d, 0x6587, 0x4E5F, 0x53EF, 0x4EE5}; // 中文也可以
-  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 20, CJK16ptBfont, CJK16ptBsparse, CJK16ptBSparseLen, CJK16ptBHeight, 0, frame);
-  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 223, CJK16ptBfont, CJK16ptBsparse, CJK16ptBSparseLen, CJK16ptBHeight, 0, frame);
+  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 20, CJK16ptB, 0, frame);
+  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 223, CJK16ptB, 0, frame);
   for (uint8_t z = 0; z < 5; z++) {
     digitalWrite(PIN_LED2, HIGH);
     SE0352.partialRefresh(z * 16, 16, z * 16 + 15, 39, 0, frame);
@@ -62,11 +62,11 @@ void textDemo() {
   Serial.write('.');
   SE0352.drawUnicode(zhongwenyekeyi, 5, 40, 200, CJK14ptfont, CJK14ptsparse, CJK14ptSparseLen, CJK14ptHeight, 0, frame);
   Serial.write('.');
-  SE0352.drawUnicode(zhongwenyekeyi, 5, 40, 160, CJK16ptBfont, CJK16ptBsparse, CJK16ptBSparseLen, CJK16ptBHeight, 0, frame);
+  SE0352.drawUnicode(zhongwenyekeyi, 5, 40, 160, CJK16ptB, 0, frame);
   Serial.write('.');
   SE0352.drawUnicode(zhongwenyekeyi, 5, 40, 45, CJK14ptfont, CJK14ptsparse, CJK14ptSparseLen, CJK14ptHeight, 2, frame);
   Serial.write('.');
-  SE0352.drawUnicode(zhongwenyekeyi, 5, 40, 65, CJK16ptBfont, CJK16ptBsparse, CJK16ptBSparseLen, CJK16ptBHeight, 2, frame);
+  SE0352.drawUnicode(zhongwenyekeyi, 5, 40, 65, CJK16ptB, 2, frame);
   SE0352.send(frame);
   SE0352.refresh();
   Serial.println(" done!");
@@ -1,6 +1,6 @@
 uint16_t CJK16ptBLen = 62016;
 
-unsigned char CJK16ptBfont[] PROGMEM = {
+const unsigned char CJK16ptBfont[] PROGMEM = {
   0x09, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x63, 0x00, 0x03, 0x00, 0x07, 0x00,
   0x0e, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x63, 0x00, 0x03, 0x00,
@@ -3878,7 +3878,7 @@ unsigned char CJK16ptBfont[] PROGMEM = {
   0x01, 0x80, 0x1f, 0xf8, 0x18, 0x18, 0x1f, 0xf8, 0x1f, 0xf8, 0x18, 0x18, 0x1f, 0xf8, 0x20, 0x04,
   0x3f, 0xfc, 0x3f, 0xfc, 0x31, 0x8c, 0x0e, 0x70, 0x7f, 0xfe, 0x0c, 0x20, 0x38, 0x20, 0x30, 0x20
 };
-unsigned char CJK16ptBsparse[] PROGMEM = {
+const unsigned char CJK16ptBsparse[] PROGMEM = {
   0x3f, 0x00, 0x22, 0x00, 0x00, 0x4e, 0x44, 0x00, 0x01, 0x4e, 0x66, 0x00, 0x03, 0x4e, 0x88, 0x00,
   0x07, 0x4e, 0xaa, 0x00, 0x08, 0x4e, 0xcc, 0x00, 0x09, 0x4e, 0xee, 0x00, 0x0a, 0x4e, 0x10, 0x01,
   0x0b, 0x4e, 0x32, 0x01, 0x0d, 0x4e, 0x54, 0x01, 0x0e, 0x4e, 0x76, 0x01, 0x11, 0x4e, 0x98, 0x01,
@@ -4339,3 +4339,262 @@ unsigned char CJK16ptBsparse[] PROGMEM = {
 
 uint16_t CJK16ptBSparseLen = 7292;
 uint8_t CJK16ptBHeight = 16;
+
+// Direct index, 7646 bytes, see CJKfont in SE0352NQ01.h
+const uint8_t CJK16ptBpages[] PROGMEM = {
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12,
+  0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22,
+  0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32,
+  0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42,
+  0x43, 0x44, 0xff, 0xff, 0xff, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0xff, 0xff, 0x4c, 0x4d,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+const uint32_t CJK16ptBbits[] PROGMEM = {
+  0x00000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x03526f8b, 0x0b052410, 0xe340c928, 0x000a0000, 0x08365b40, 0x04007852, 0x03d06cc3, 0xa8c10038,
+  0x0683a002, 0x11518000, 0x1a28e040, 0x80080209, 0x28002810, 0x80204000, 0x21800408, 0x0002c002,
+  0x87042000, 0x00000042, 0x14008080, 0x00c00020, 0x00002020, 0x08041000, 0x04008000, 0x08200000,
+  0x00000000, 0x80000000, 0x04102b7a, 0x19fa3920, 0x02043020, 0x00ed1011, 0x20028240, 0x04482003,
+  0x218604c9, 0x0dc14a10, 0x00402408, 0x00048620, 0x88000100, 0x00020e09, 0x00040280, 0xc4000010,
+  0x02c00061, 0x0e000401, 0x1480058a, 0x01bb0083, 0x85000204, 0x08000140, 0x0ad03f04, 0x01cddd79,
+  0x480b7718, 0x13309bc0, 0x00000541, 0x30080104, 0x00019000, 0x210a1000, 0x00002113, 0x00042520,
+  0x00010280, 0x0002c000, 0x00000450, 0x00000040, 0x31000694, 0x00000000, 0x00080000, 0x20000000,
+  0x00000200, 0x00120000, 0x00000000, 0x00000100, 0x00000000, 0x10800000, 0x48000400, 0x24012001,
+  0x80000100, 0x40010108, 0x80038481, 0x00000042, 0x0000080c, 0x00004000, 0x80004800, 0x06000000,
+  0x00000044, 0x00200412, 0x41121000, 0x00000800, 0x40080008, 0x00000100, 0x00000002, 0x00094810,
+  0x9460a000, 0x03024e80, 0x00908280, 0x23580020, 0x02400014, 0x0a000120, 0x101b0800, 0x88000120,
+  0x0100000a, 0x00000000, 0x04000040, 0x00000000, 0x00000000, 0x00000000, 0x00001006, 0x00000200,
+  0x00000000, 0x00000000, 0xa1b10000, 0x00000258, 0x37809baa, 0x8279001c, 0x800410d0, 0x85000100,
+  0x04428452, 0xf5020010, 0x40220d21, 0x00028003, 0x00100000, 0x01002200, 0x00000000, 0x00010002,
+  0x00400080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0x409643e2,
+  0x2140104c, 0x21006000, 0x00200020, 0x995c0000, 0x12a08410, 0x018020c0, 0x00000600, 0x04400000,
+  0x8028841d, 0x04028040, 0x00080000, 0x12020204, 0x00850933, 0x00804402, 0x03803028, 0x20200801,
+  0x30644000, 0x000005a1, 0x00050800, 0x0001a304, 0x80100210, 0x10040149, 0x10220420, 0x02090181,
+  0x84008302, 0x80000080, 0x00205100, 0x00010184, 0x00000000, 0x00000000, 0x00000004, 0x00000000,
+  0x04470000, 0x80100400, 0x091e6883, 0xc240e008, 0x09e80411, 0x32221800, 0x19553260, 0xd0181000,
+  0x00420286, 0x24008500, 0x0021c240, 0x00804080, 0x01049301, 0x000003a5, 0x00058200, 0x00102402,
+  0x50008000, 0x04003000, 0x01100000, 0x01000280, 0x40260080, 0x00002010, 0x00002000, 0x00000040,
+  0x00000001, 0xca408000, 0x42028120, 0x0015100c, 0x12820080, 0x2201a0b0, 0x00808822, 0x040213e5,
+  0x8008d044, 0x10008121, 0x04041808, 0x0450c100, 0x00c20000, 0x00104000, 0x00000000, 0xc0140000,
+  0xa8802b01, 0x24321d00, 0x9003c048, 0xc0018023, 0x30a10012, 0x00408000, 0x10198010, 0x801a0000,
+  0x00800000, 0x33000402, 0x0003114c, 0x00400008, 0x00000022, 0x00098144, 0x04242a00, 0x00204000,
+  0x00042020, 0x00000000, 0x04000000, 0x10000000, 0x10000044, 0x00100100, 0x00010000, 0x20000000,
+  0x00000000, 0x00000402, 0x01000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x4404008b, 0x00001280, 0x0800047c, 0x00400c08, 0x80200000, 0x0814a020, 0x00008800,
+  0x00128000, 0x01100080, 0x80800006, 0x20000401, 0x82000308, 0xcb080802, 0x08200610, 0x08090526,
+  0x40840802, 0x68040420, 0x02000022, 0x01904600, 0x08001304, 0x00040000, 0x01000800, 0x0a820002,
+  0x00800020, 0x0110820b, 0x00400000, 0xc0000000, 0x10010200, 0x00000400, 0x04120800, 0x00100000,
+  0x00108044, 0x00000801, 0x10000000, 0x00004000, 0x00000000, 0x00000002, 0x00000001, 0x00000000,
+  0x00000000, 0x00000000, 0x00001000, 0x40618800, 0x00244600, 0x03006000, 0x81000100, 0x00000010,
+  0x00000000, 0x00410040, 0x00005000, 0x00004090, 0x80100410, 0x00000000, 0x00200008, 0x00000020,
+  0x00000040, 0x23401400, 0x0a001180, 0x02040284, 0x00000002, 0x02409000, 0x00810014, 0x11003003,
+  0x18000000, 0x40104c00, 0x00000000, 0x00000000, 0x00000a80, 0x08000200, 0x00002000, 0x00002001,
+  0x00000048, 0x00100000, 0x40000000, 0x00000000, 0x00000008, 0x00000000, 0x10000000, 0x00400048,
+  0x95000000, 0x088f0300, 0x12009000, 0x00000420, 0x00028040, 0x50040810, 0x082400a0, 0x00010000,
+  0x00000000, 0x00000040, 0x00000000, 0x68000000, 0x000000d4, 0x00004000, 0x88c40540, 0x51144000,
+  0x80000a02, 0x10008101, 0x08000001, 0x0000100a, 0x00004000, 0x00000080, 0x08000000, 0x00086220,
+  0x00103000, 0x00100000, 0x00000000, 0x00005000, 0x00827000, 0x00010080, 0x00000002, 0x00000100,
+  0x00000000, 0x54000000, 0x60400000, 0x00000120, 0x00008002, 0x68000000, 0x81062803, 0x08010290,
+  0x00006801, 0x98000001, 0x00800000, 0x84500000, 0x0082001a, 0x00000000, 0x82000800, 0x8200a021,
+  0x08120800, 0x00001140, 0x20570a00, 0x02000000, 0x00800000, 0x00022002, 0x00000080, 0x00000000,
+  0x00000000, 0x00000000, 0x00002000, 0x08080000, 0x01840200, 0x40024030, 0x80600400, 0x08000001,
+  0x00000000, 0x00008805, 0x00000000, 0x00004000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x05000000, 0x00030000, 0x00004600, 0x40004400, 0x20000012, 0x00000022, 0x18000001,
+  0x00a1302b, 0x28080000, 0x04000000, 0x00000000, 0x24001240, 0x04048236, 0x40401048, 0x21480002,
+  0x04400644, 0x40020000, 0x00110400, 0x82010020, 0x38008401, 0x00000100, 0x00000004, 0x00182408,
+  0xc0043020, 0x02001400, 0x01000080, 0x00048000, 0x20040000, 0x220a1040, 0x00800000, 0x02020060,
+  0x0000403c, 0x00400800, 0x00050200, 0x00800008, 0x00000000, 0x00000800, 0x10001400, 0x00000001,
+  0x00003010, 0x20000000, 0x08800000, 0x0022100a, 0x12000000, 0x01000000, 0x00000010, 0x00001000,
+  0x00020000, 0x20001000, 0x00000200, 0x00000000, 0x00000010, 0x00008400, 0x00008000, 0x00000000,
+  0x00000000, 0x00000000, 0x04004000, 0x22000800, 0x00200400, 0x00000000, 0x0a000880, 0x40004000,
+  0x11080004, 0x08000002, 0x00000000, 0x00500000, 0x00002000, 0x04000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000004, 0x00801001, 0x0001090a, 0x10402800, 0x00000800, 0x02200026, 0x02080000,
+  0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000042, 0x00000000, 0x00040000, 0x00000048,
+  0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00080200, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00800000, 0x00000040, 0x00000402, 0x00001000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00d10010, 0x80000422, 0x00080008, 0xa0021000, 0x00288500,
+  0x00008000, 0x00000404, 0x00000110, 0x00040000, 0x00000002, 0x04001800, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd8000000, 0x40030108, 0x00134122, 0x22810800,
+  0xa491804f, 0x10004005, 0x00082080, 0x80206028, 0x00000001, 0x00000408, 0x00004400, 0x20000100,
+  0x02000000, 0x00000000, 0x00042000, 0x01801000, 0x00040a00, 0x00000000, 0x0002f080, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100,
+  0x00000000, 0x881c0000, 0x00012010, 0x00e00416, 0x12108040, 0x00400000, 0x00200073, 0x02c00500,
+  0x50000281, 0x01040000, 0x42040000, 0x00000205, 0x00000800, 0x00002001, 0x00000000, 0x00280000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000,
+  0x00010000, 0x00000000, 0x00000000, 0x00000000, 0x02400000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x01000000, 0x00000000,
+  0x00000000, 0x10000000, 0x00100014, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x08000040, 0x01024010, 0x00000000,
+  0x00080000, 0x08000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+const uint16_t CJK16ptBranks[] PROGMEM = {
+  0, 0, 1, 1, 1, 1, 1, 1, 1, 16, 24, 36, 38, 49, 57, 70,
+  79, 87, 93, 102, 107, 112, 115, 120, 124, 130, 132, 136, 139, 141, 144, 146,
+  148, 148, 149, 160, 174, 179, 188, 193, 199, 209, 219, 223, 228, 231, 237, 240,
+  244, 250, 255, 263, 273, 278, 281, 293, 310, 323, 335, 339, 344, 347, 352, 357,
+  362, 365, 368, 371, 372, 380, 380, 381, 382, 383, 385, 385, 386, 386, 388, 391,
+  396, 398, 402, 409, 411, 414, 415, 418, 420, 422, 426, 431, 432, 435, 436, 437,
+  442, 449, 457, 462, 469, 473, 477, 483, 487, 490, 490, 492, 492, 492, 492, 495,
+  496, 496, 496, 503, 507, 522, 532, 538, 542, 550, 558, 566, 570, 571, 574, 574,
+  576, 578, 578, 578, 578, 578, 578, 580, 592, 599, 603, 605, 613, 620, 625, 627,
+  629, 638, 642, 643, 648, 657, 661, 668, 672, 678, 683, 686, 692, 696, 702, 707,
+  713, 719, 721, 725, 729, 729, 729, 730, 730, 735, 738, 750, 758, 767, 774, 786,
+  792, 798, 803, 809, 812, 819, 825, 829, 833, 836, 839, 841, 844, 849, 851, 852,
+  853, 854, 860, 866, 872, 877, 885, 890, 900, 907, 912, 917, 923, 926, 928, 928,
+  932, 941, 950, 958, 965, 972, 974, 980, 984, 985, 991, 998, 1000, 1002, 1008, 1014,
+  1016, 1019, 1019, 1020, 1021, 1024, 1026, 1027, 1028, 1028, 1030, 1031, 1032, 1032, 1032, 1032,
+  1032, 1032, 1039, 1042, 1049, 1053, 1055, 1061, 1063, 1066, 1069, 1073, 1076, 1081, 1089, 1094,
+  1102, 1107, 1113, 1116, 1122, 1127, 1128, 1130, 1135, 1137, 1144, 1145, 1147, 1150, 1151, 1155,
+  1156, 1160, 1162, 1163, 1164, 1164, 1165, 1166, 1166, 1166, 1166, 1167, 1173, 1178, 1182, 1185,
+  1186, 1186, 1189, 1191, 1194, 1198, 1198, 1200, 1201, 1202, 1208, 1213, 1218, 1219, 1223, 1227,
+  1233, 1235, 1240, 1240, 1240, 1243, 1245, 1246, 1248, 1250, 1251, 1252, 1252, 1253, 1253, 1254,
+  1257, 1261, 1269, 1273, 1275, 1278, 1283, 1288, 1289, 1289, 1290, 1290, 1293, 1297, 1298, 1306,
+  1312, 1316, 1320, 1322, 1325, 1326, 1327, 1328, 1333, 1336, 1337, 1337, 1339, 1344, 1346, 1347,
+  1348, 1348, 1351, 1354, 1356, 1358, 1361, 1369, 1374, 1378, 1382, 1383, 1387, 1392, 1392, 1395,
+  1401, 1405, 1408, 1416, 1417, 1418, 1421, 1422, 1422, 1422, 1422, 1423, 1425, 1429, 1434, 1438,
+  1440, 1440, 1444, 1444, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1446, 1446, 1446, 1446, 1446,
+  1446, 1446, 1448, 1450, 1453, 1456, 1459, 1461, 1464, 1473, 1476, 1477, 1477, 1482, 1490, 1495,
+  1500, 1506, 1508, 1511, 1515, 1521, 1522, 1523, 1528, 1534, 1537, 1539, 1541, 1543, 1549, 1550,
+  1554, 1559, 1561, 1564, 1566, 1566, 1567, 1570, 1571, 1574, 1575, 1577, 1582, 1584, 1585, 1586,
+  1587, 1588, 1590, 1591, 1591, 1592, 1594, 1595, 1595, 1595, 1595, 1597, 1600, 1602, 1602, 1606,
+  1608, 1612, 1614, 1614, 1616, 1617, 1618, 1618, 1618, 1618, 1619, 1622, 1627, 1631, 1632, 1637,
+  1639, 1639, 1639, 1639, 1640, 1642, 1642, 1643, 1645, 1646, 1646, 1646, 1646, 1648, 1648, 1648,
+  1648, 1648, 1648, 1648, 1649, 1649, 1649, 1649, 1649, 1649, 1650, 1651, 1653, 1654, 1654, 1654,
+  1654, 1654, 1654, 1654, 1659, 1663, 1665, 1669, 1674, 1675, 1677, 1679, 1680, 1681, 1684, 1684,
+  1684, 1684, 1684, 1684, 1684, 1688, 1693, 1700, 1705, 1717, 1721, 1724, 1730, 1731, 1733, 1735,
+  1737, 1738, 1738, 1740, 1743, 1746, 1746, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752,
+  1753, 1753, 1758, 1761, 1768, 1773, 1774, 1780, 1785, 1790, 1792, 1795, 1798, 1799, 1801, 1801,
+  1803, 1803, 1803, 1803, 1803, 1803, 1803, 1804, 1804, 1805, 1805, 1805, 1805, 1807, 1807, 1807,
+  1807, 1807, 1807, 1807, 1807, 1807, 1808, 1809, 1809, 1809, 1810, 1813, 1813, 1813, 1813, 1813,
+  1813, 1813, 1813, 1813, 1814, 1814, 1816, 1820, 1820, 1821, 1823, 1823, 1823, 1823, 1823, 1823
+};
+const uint16_t CJK16ptBoffsets[] PROGMEM = {
+  0x0022, 0x0044, 0x0066, 0x0088, 0x00aa, 0x00cc, 0x00ee, 0x0110, 0x0132, 0x0154, 0x0176, 0x0198, 0x01ba, 0x01dc, 0x01fe, 0x0220,
+  0x0242, 0x0264, 0x0286, 0x02a8, 0x02ca, 0x02ec, 0x030e, 0x0330, 0x0352, 0x0374, 0x0396, 0x03b8, 0x03da, 0x03fc, 0x041e, 0x0440,
+  0x0462, 0x0484, 0x04a6, 0x04c8, 0x04ea, 0x050c, 0x052e, 0x0550, 0x0572, 0x0594, 0x05b6, 0x05d8, 0x05fa, 0x061c, 0x063e, 0x0660,
+  0x0682, 0x06a4, 0x06c6, 0x06e8, 0x070a, 0x072c, 0x074e, 0x0770, 0x0792, 0x07b4, 0x07d6, 0x07f8, 0x081a, 0x083c, 0x085e, 0x0880,
+  0x08a2, 0x08c4, 0x08e6, 0x0908, 0x092a, 0x094c, 0x096e, 0x0990, 0x09b2, 0x09d4, 0x09f6, 0x0a18, 0x0a3a, 0x0a5c, 0x0a7e, 0x0aa0,
+  0x0ac2, 0x0ae4, 0x0b06, 0x0b28, 0x0b4a, 0x0b6c, 0x0b8e, 0x0bb0, 0x0bd2, 0x0bf4, 0x0c16, 0x0c38, 0x0c5a, 0x0c7c, 0x0c9e, 0x0cc0,
+  0x0ce2, 0x0d04, 0x0d26, 0x0d48, 0x0d6a, 0x0d8c, 0x0dae, 0x0dd0, 0x0df2, 0x0e14, 0x0e36, 0x0e58, 0x0e7a, 0x0e9c, 0x0ebe, 0x0ee0,
+  0x0f02, 0x0f24, 0x0f46, 0x0f68, 0x0f8a, 0x0fac, 0x0fce, 0x0ff0, 0x1012, 0x1034, 0x1056, 0x1078, 0x109a, 0x10bc, 0x10de, 0x1100,
+  0x1122, 0x1144, 0x1166, 0x1188, 0x11aa, 0x11cc, 0x11ee, 0x1210, 0x1232, 0x1254, 0x1276, 0x1298, 0x12ba, 0x12dc, 0x12fe, 0x1320,
+  0x1342, 0x1364, 0x1386, 0x13a8, 0x13ca, 0x13ec, 0x140e, 0x1430, 0x1452, 0x1474, 0x1496, 0x14b8, 0x14da, 0x14fc, 0x151e, 0x1540,
+  0x1562, 0x1584, 0x15a6, 0x15c8, 0x15ea, 0x160c, 0x162e, 0x1650, 0x1672, 0x1694, 0x16b6, 0x16d8, 0x16fa, 0x171c, 0x173e, 0x1760,
+  0x1782, 0x17a4, 0x17c6, 0x17e8, 0x180a, 0x182c, 0x184e, 0x1870, 0x1892, 0x18b4, 0x18d6, 0x18f8, 0x191a, 0x193c, 0x195e, 0x1980,
+  0x19a2, 0x19c4, 0x19e6, 0x1a08, 0x1a2a, 0x1a4c, 0x1a6e, 0x1a90, 0x1ab2, 0x1ad4, 0x1af6, 0x1b18, 0x1b3a, 0x1b5c, 0x1b7e, 0x1ba0,
+  0x1bc2, 0x1be4, 0x1c06, 0x1c28, 0x1c4a, 0x1c6c, 0x1c8e, 0x1cb0, 0x1cd2, 0x1cf4, 0x1d16, 0x1d38, 0x1d5a, 0x1d7c, 0x1d9e, 0x1dc0,
+  0x1de2, 0x1e04, 0x1e26, 0x1e48, 0x1e6a, 0x1e8c, 0x1eae, 0x1ed0, 0x1ef2, 0x1f14, 0x1f36, 0x1f58, 0x1f7a, 0x1f9c, 0x1fbe, 0x1fe0,
+  0x2002, 0x2024, 0x2046, 0x2068, 0x208a, 0x20ac, 0x20ce, 0x20f0, 0x2112, 0x2134, 0x2156, 0x2178, 0x219a, 0x21bc, 0x21de, 0x2200,
+  0x2222, 0x2244, 0x2266, 0x2288, 0x22aa, 0x22cc, 0x22ee, 0x2310, 0x2332, 0x2354, 0x2376, 0x2398, 0x23ba, 0x23dc, 0x23fe, 0x2420,
+  0x2442, 0x2464, 0x2486, 0x24a8, 0x24ca, 0x24ec, 0x250e, 0x2530, 0x2552, 0x2574, 0x2596, 0x25b8, 0x25da, 0x25fc, 0x261e, 0x2640,
+  0x2662, 0x2684, 0x26a6, 0x26c8, 0x26ea, 0x270c, 0x272e, 0x2750, 0x2772, 0x2794, 0x27b6, 0x27d8, 0x27fa, 0x281c, 0x283e, 0x2860,
+  0x2882, 0x28a4, 0x28c6, 0x28e8, 0x290a, 0x292c, 0x294e, 0x2970, 0x2992, 0x29b4, 0x29d6, 0x29f8, 0x2a1a, 0x2a3c, 0x2a5e, 0x2a80,
+  0x2aa2, 0x2ac4, 0x2ae6, 0x2b08, 0x2b2a, 0x2b4c, 0x2b6e, 0x2b90, 0x2bb2, 0x2bd4, 0x2bf6, 0x2c18, 0x2c3a, 0x2c5c, 0x2c7e, 0x2ca0,
+  0x2cc2, 0x2ce4, 0x2d06, 0x2d28, 0x2d4a, 0x2d6c, 0x2d8e, 0x2db0, 0x2dd2, 0x2df4, 0x2e16, 0x2e38, 0x2e5a, 0x2e7c, 0x2e9e, 0x2ec0,
+  0x2ee2, 0x2f04, 0x2f26, 0x2f48, 0x2f6a, 0x2f8c, 0x2fae, 0x2fd0, 0x2ff2, 0x3014, 0x3036, 0x3058, 0x307a, 0x309c, 0x30be, 0x30e0,
+  0x3102, 0x3124, 0x3146, 0x3168, 0x318a, 0x31ac, 0x31ce, 0x31f0, 0x3212, 0x3234, 0x3256, 0x3278, 0x329a, 0x32bc, 0x32de, 0x3300,
+  0x3322, 0x3344, 0x3366, 0x3388, 0x33aa, 0x33cc, 0x33ee, 0x3410, 0x3432, 0x3454, 0x3476, 0x3498, 0x34ba, 0x34dc, 0x34fe, 0x3520,
+  0x3542, 0x3564, 0x3586, 0x35a8, 0x35ca, 0x35ec, 0x360e, 0x3630, 0x3652, 0x3674, 0x3696, 0x36b8, 0x36da, 0x36fc, 0x371e, 0x3740,
+  0x3762, 0x3784, 0x37a6, 0x37c8, 0x37ea, 0x380c, 0x382e, 0x3850, 0x3872, 0x3894, 0x38b6, 0x38d8, 0x38fa, 0x391c, 0x393e, 0x3960,
+  0x3982, 0x39a4, 0x39c6, 0x39e8, 0x3a0a, 0x3a2c, 0x3a4e, 0x3a70, 0x3a92, 0x3ab4, 0x3ad6, 0x3af8, 0x3b1a, 0x3b3c, 0x3b5e, 0x3b80,
+  0x3ba2, 0x3bc4, 0x3be6, 0x3c08, 0x3c2a, 0x3c4c, 0x3c6e, 0x3c90, 0x3cb2, 0x3cd4, 0x3cf6, 0x3d18, 0x3d3a, 0x3d5c, 0x3d7e, 0x3da0,
+  0x3dc2, 0x3de4, 0x3e06, 0x3e28, 0x3e4a, 0x3e6c, 0x3e8e, 0x3eb0, 0x3ed2, 0x3ef4, 0x3f16, 0x3f38, 0x3f5a, 0x3f7c, 0x3f9e, 0x3fc0,
+  0x3fe2, 0x4004, 0x4026, 0x4048, 0x406a, 0x408c, 0x40ae, 0x40d0, 0x40f2, 0x4114, 0x4136, 0x4158, 0x417a, 0x419c, 0x41be, 0x41e0,
+  0x4202, 0x4224, 0x4246, 0x4268, 0x428a, 0x42ac, 0x42ce, 0x42f0, 0x4312, 0x4334, 0x4356, 0x4378, 0x439a, 0x43bc, 0x43de, 0x4400,
+  0x4422, 0x4444, 0x4466, 0x4488, 0x44aa, 0x44cc, 0x44ee, 0x4510, 0x4532, 0x4554, 0x4576, 0x4598, 0x45ba, 0x45dc, 0x45fe, 0x4620,
+  0x4642, 0x4664, 0x4686, 0x46a8, 0x46ca, 0x46ec, 0x470e, 0x4730, 0x4752, 0x4774, 0x4796, 0x47b8, 0x47da, 0x47fc, 0x481e, 0x4840,
+  0x4862, 0x4884, 0x48a6, 0x48c8, 0x48ea, 0x490c, 0x492e, 0x4950, 0x4972, 0x4994, 0x49b6, 0x49d8, 0x49fa, 0x4a1c, 0x4a3e, 0x4a60,
+  0x4a82, 0x4aa4, 0x4ac6, 0x4ae8, 0x4b0a, 0x4b2c, 0x4b4e, 0x4b70, 0x4b92, 0x4bb4, 0x4bd6, 0x4bf8, 0x4c1a, 0x4c3c, 0x4c5e, 0x4c80,
+  0x4ca2, 0x4cc4, 0x4ce6, 0x4d08, 0x4d2a, 0x4d4c, 0x4d6e, 0x4d90, 0x4db2, 0x4dd4, 0x4df6, 0x4e18, 0x4e3a, 0x4e5c, 0x4e7e, 0x4ea0,
+  0x4ec2, 0x4ee4, 0x4f06, 0x4f28, 0x4f4a, 0x4f6c, 0x4f8e, 0x4fb0, 0x4fd2, 0x4ff4, 0x5016, 0x5038, 0x505a, 0x507c, 0x509e, 0x50c0,
+  0x50e2, 0x5104, 0x5126, 0x5148, 0x516a, 0x518c, 0x51ae, 0x51d0, 0x51f2, 0x5214, 0x5236, 0x5258, 0x527a, 0x529c, 0x52be, 0x52e0,
+  0x5302, 0x5324, 0x5346, 0x5368, 0x538a, 0x53ac, 0x53ce, 0x53f0, 0x5412, 0x5434, 0x5456, 0x5478, 0x549a, 0x54bc, 0x54de, 0x5500,
+  0x5522, 0x5544, 0x5566, 0x5588, 0x55aa, 0x55cc, 0x55ee, 0x5610, 0x5632, 0x5654, 0x5676, 0x5698, 0x56ba, 0x56dc, 0x56fe, 0x5720,
+  0x5742, 0x5764, 0x5786, 0x57a8, 0x57ca, 0x57ec, 0x580e, 0x5830, 0x5852, 0x5874, 0x5896, 0x58b8, 0x58da, 0x58fc, 0x591e, 0x5940,
+  0x5962, 0x5984, 0x59a6, 0x59c8, 0x59ea, 0x5a0c, 0x5a2e, 0x5a50, 0x5a72, 0x5a94, 0x5ab6, 0x5ad8, 0x5afa, 0x5b1c, 0x5b3e, 0x5b60,
+  0x5b82, 0x5ba4, 0x5bc6, 0x5be8, 0x5c0a, 0x5c2c, 0x5c4e, 0x5c70, 0x5c92, 0x5cb4, 0x5cd6, 0x5cf8, 0x5d1a, 0x5d3c, 0x5d5e, 0x5d80,
+  0x5da2, 0x5dc4, 0x5de6, 0x5e08, 0x5e2a, 0x5e4c, 0x5e6e, 0x5e90, 0x5eb2, 0x5ed4, 0x5ef6, 0x5f18, 0x5f3a, 0x5f5c, 0x5f7e, 0x5fa0,
+  0x5fc2, 0x5fe4, 0x6006, 0x6028, 0x604a, 0x606c, 0x608e, 0x60b0, 0x60d2, 0x60f4, 0x6116, 0x6138, 0x615a, 0x617c, 0x619e, 0x61c0,
+  0x61e2, 0x6204, 0x6226, 0x6248, 0x626a, 0x628c, 0x62ae, 0x62d0, 0x62f2, 0x6314, 0x6336, 0x6358, 0x637a, 0x639c, 0x63be, 0x63e0,
+  0x6402, 0x6424, 0x6446, 0x6468, 0x648a, 0x64ac, 0x64ce, 0x64f0, 0x6512, 0x6534, 0x6556, 0x6578, 0x659a, 0x65bc, 0x65de, 0x6600,
+  0x6622, 0x6644, 0x6666, 0x6688, 0x66aa, 0x66cc, 0x66ee, 0x6710, 0x6732, 0x6754, 0x6776, 0x6798, 0x67ba, 0x67dc, 0x67fe, 0x6820,
+  0x6842, 0x6864, 0x6886, 0x68a8, 0x68ca, 0x68ec, 0x690e, 0x6930, 0x6952, 0x6974, 0x6996, 0x69b8, 0x69da, 0x69fc, 0x6a1e, 0x6a40,
+  0x6a62, 0x6a84, 0x6aa6, 0x6ac8, 0x6aea, 0x6b0c, 0x6b2e, 0x6b50, 0x6b72, 0x6b94, 0x6bb6, 0x6bd8, 0x6bfa, 0x6c1c, 0x6c3e, 0x6c60,
+  0x6c82, 0x6ca4, 0x6cc6, 0x6ce8, 0x6d0a, 0x6d2c, 0x6d4e, 0x6d70, 0x6d92, 0x6db4, 0x6dd6, 0x6df8, 0x6e1a, 0x6e3c, 0x6e5e, 0x6e80,
+  0x6ea2, 0x6ec4, 0x6ee6, 0x6f08, 0x6f2a, 0x6f4c, 0x6f6e, 0x6f90, 0x6fb2, 0x6fd4, 0x6ff6, 0x7018, 0x703a, 0x705c, 0x707e, 0x70a0,
+  0x70c2, 0x70e4, 0x7106, 0x7128, 0x714a, 0x716c, 0x718e, 0x71b0, 0x71d2, 0x71f4, 0x7216, 0x7238, 0x725a, 0x727c, 0x729e, 0x72c0,
+  0x72e2, 0x7304, 0x7326, 0x7348, 0x736a, 0x738c, 0x73ae, 0x73d0, 0x73f2, 0x7414, 0x7436, 0x7458, 0x747a, 0x749c, 0x74be, 0x74e0,
+  0x7502, 0x7524, 0x7546, 0x7568, 0x758a, 0x75ac, 0x75ce, 0x75f0, 0x7612, 0x7634, 0x7656, 0x7678, 0x769a, 0x76bc, 0x76de, 0x7700,
+  0x7722, 0x7744, 0x7766, 0x7788, 0x77aa, 0x77cc, 0x77ee, 0x7810, 0x7832, 0x7854, 0x7876, 0x7898, 0x78ba, 0x78dc, 0x78fe, 0x7920,
+  0x7942, 0x7964, 0x7986, 0x79a8, 0x79ca, 0x79ec, 0x7a0e, 0x7a30, 0x7a52, 0x7a74, 0x7a96, 0x7ab8, 0x7ada, 0x7afc, 0x7b1e, 0x7b40,
+  0x7b62, 0x7b84, 0x7ba6, 0x7bc8, 0x7bea, 0x7c0c, 0x7c2e, 0x7c50, 0x7c72, 0x7c94, 0x7cb6, 0x7cd8, 0x7cfa, 0x7d1c, 0x7d3e, 0x7d60,
+  0x7d82, 0x7da4, 0x7dc6, 0x7de8, 0x7e0a, 0x7e2c, 0x7e4e, 0x7e70, 0x7e92, 0x7eb4, 0x7ed6, 0x7ef8, 0x7f1a, 0x7f3c, 0x7f5e, 0x7f80,
+  0x7fa2, 0x7fc4, 0x7fe6, 0x8008, 0x802a, 0x804c, 0x806e, 0x8090, 0x80b2, 0x80d4, 0x80f6, 0x8118, 0x813a, 0x815c, 0x817e, 0x81a0,
+  0x81c2, 0x81e4, 0x8206, 0x8228, 0x824a, 0x826c, 0x828e, 0x82b0, 0x82d2, 0x82f4, 0x8316, 0x8338, 0x835a, 0x837c, 0x839e, 0x83c0,
+  0x83e2, 0x8404, 0x8426, 0x8448, 0x846a, 0x848c, 0x84ae, 0x84d0, 0x84f2, 0x8514, 0x8536, 0x8558, 0x857a, 0x859c, 0x85be, 0x85e0,
+  0x8602, 0x8624, 0x8646, 0x8668, 0x868a, 0x86ac, 0x86ce, 0x86f0, 0x8712, 0x8734, 0x8756, 0x8778, 0x879a, 0x87bc, 0x87de, 0x8800,
+  0x8822, 0x8844, 0x8866, 0x8888, 0x88aa, 0x88cc, 0x88ee, 0x8910, 0x8932, 0x8954, 0x8976, 0x8998, 0x89ba, 0x89dc, 0x89fe, 0x8a20,
+  0x8a42, 0x8a64, 0x8a86, 0x8aa8, 0x8aca, 0x8aec, 0x8b0e, 0x8b30, 0x8b52, 0x8b74, 0x8b96, 0x8bb8, 0x8bda, 0x8bfc, 0x8c1e, 0x8c40,
+  0x8c62, 0x8c84, 0x8ca6, 0x8cc8, 0x8cea, 0x8d0c, 0x8d2e, 0x8d50, 0x8d72, 0x8d94, 0x8db6, 0x8dd8, 0x8dfa, 0x8e1c, 0x8e3e, 0x8e60,
+  0x8e82, 0x8ea4, 0x8ec6, 0x8ee8, 0x8f0a, 0x8f2c, 0x8f4e, 0x8f70, 0x8f92, 0x8fb4, 0x8fd6, 0x8ff8, 0x901a, 0x903c, 0x905e, 0x9080,
+  0x90a2, 0x90c4, 0x90e6, 0x9108, 0x912a, 0x914c, 0x916e, 0x9190, 0x91b2, 0x91d4, 0x91f6, 0x9218, 0x923a, 0x925c, 0x927e, 0x92a0,
+  0x92c2, 0x92e4, 0x9306, 0x9328, 0x934a, 0x936c, 0x938e, 0x93b0, 0x93d2, 0x93f4, 0x9416, 0x9438, 0x945a, 0x947c, 0x949e, 0x94c0,
+  0x94e2, 0x9504, 0x9526, 0x9548, 0x956a, 0x958c, 0x95ae, 0x95d0, 0x95f2, 0x9614, 0x9636, 0x9658, 0x967a, 0x969c, 0x96be, 0x96e0,
+  0x9702, 0x9724, 0x9746, 0x9768, 0x978a, 0x97ac, 0x97ce, 0x97f0, 0x9812, 0x9834, 0x9856, 0x9878, 0x989a, 0x98bc, 0x98de, 0x9900,
+  0x9922, 0x9944, 0x9966, 0x9988, 0x99aa, 0x99cc, 0x99ee, 0x9a10, 0x9a32, 0x9a54, 0x9a76, 0x9a98, 0x9aba, 0x9adc, 0x9afe, 0x9b20,
+  0x9b42, 0x9b64, 0x9b86, 0x9ba8, 0x9bca, 0x9bec, 0x9c0e, 0x9c30, 0x9c52, 0x9c74, 0x9c96, 0x9cb8, 0x9cda, 0x9cfc, 0x9d1e, 0x9d40,
+  0x9d62, 0x9d84, 0x9da6, 0x9dc8, 0x9dea, 0x9e0c, 0x9e2e, 0x9e50, 0x9e72, 0x9e94, 0x9eb6, 0x9ed8, 0x9efa, 0x9f1c, 0x9f3e, 0x9f60,
+  0x9f82, 0x9fa4, 0x9fc6, 0x9fe8, 0xa00a, 0xa02c, 0xa04e, 0xa070, 0xa092, 0xa0b4, 0xa0d6, 0xa0f8, 0xa11a, 0xa13c, 0xa15e, 0xa180,
+  0xa1a2, 0xa1c4, 0xa1e6, 0xa208, 0xa22a, 0xa24c, 0xa26e, 0xa290, 0xa2b2, 0xa2d4, 0xa2f6, 0xa318, 0xa33a, 0xa35c, 0xa37e, 0xa3a0,
+  0xa3c2, 0xa3e4, 0xa406, 0xa428, 0xa44a, 0xa46c, 0xa48e, 0xa4b0, 0xa4d2, 0xa4f4, 0xa516, 0xa538, 0xa55a, 0xa57c, 0xa59e, 0xa5c0,
+  0xa5e2, 0xa604, 0xa626, 0xa648, 0xa66a, 0xa68c, 0xa6ae, 0xa6d0, 0xa6f2, 0xa714, 0xa736, 0xa758, 0xa77a, 0xa79c, 0xa7be, 0xa7e0,
+  0xa802, 0xa824, 0xa846, 0xa868, 0xa88a, 0xa8ac, 0xa8ce, 0xa8f0, 0xa912, 0xa934, 0xa956, 0xa978, 0xa99a, 0xa9bc, 0xa9de, 0xaa00,
+  0xaa22, 0xaa44, 0xaa66, 0xaa88, 0xaaaa, 0xaacc, 0xaaee, 0xab10, 0xab32, 0xab54, 0xab76, 0xab98, 0xabba, 0xabdc, 0xabfe, 0xac20,
+  0xac42, 0xac64, 0xac86, 0xaca8, 0xacca, 0xacec, 0xad0e, 0xad30, 0xad52, 0xad74, 0xad96, 0xadb8, 0xadda, 0xadfc, 0xae1e, 0xae40,
+  0xae62, 0xae84, 0xaea6, 0xaec8, 0xaeea, 0xaf0c, 0xaf2e, 0xaf50, 0xaf72, 0xaf94, 0xafb6, 0xafd8, 0xaffa, 0xb01c, 0xb03e, 0xb060,
+  0xb082, 0xb0a4, 0xb0c6, 0xb0e8, 0xb10a, 0xb12c, 0xb14e, 0xb170, 0xb192, 0xb1b4, 0xb1d6, 0xb1f8, 0xb21a, 0xb23c, 0xb25e, 0xb280,
+  0xb2a2, 0xb2c4, 0xb2e6, 0xb308, 0xb32a, 0xb34c, 0xb36e, 0xb390, 0xb3b2, 0xb3d4, 0xb3f6, 0xb418, 0xb43a, 0xb45c, 0xb47e, 0xb4a0,
+  0xb4c2, 0xb4e4, 0xb506, 0xb528, 0xb54a, 0xb56c, 0xb58e, 0xb5b0, 0xb5d2, 0xb5f4, 0xb616, 0xb638, 0xb65a, 0xb67c, 0xb69e, 0xb6c0,
+  0xb6e2, 0xb704, 0xb726, 0xb748, 0xb76a, 0xb78c, 0xb7ae, 0xb7d0, 0xb7f2, 0xb814, 0xb836, 0xb858, 0xb87a, 0xb89c, 0xb8be, 0xb8e0,
+  0xb902, 0xb924, 0xb946, 0xb968, 0xb98a, 0xb9ac, 0xb9ce, 0xb9f0, 0xba12, 0xba34, 0xba56, 0xba78, 0xba9a, 0xbabc, 0xbade, 0xbb00,
+  0xbb22, 0xbb44, 0xbb66, 0xbb88, 0xbbaa, 0xbbcc, 0xbbee, 0xbc10, 0xbc32, 0xbc54, 0xbc76, 0xbc98, 0xbcba, 0xbcdc, 0xbcfe, 0xbd20,
+  0xbd42, 0xbd64, 0xbd86, 0xbda8, 0xbdca, 0xbdec, 0xbe0e, 0xbe30, 0xbe52, 0xbe74, 0xbe96, 0xbeb8, 0xbeda, 0xbefc, 0xbf1e, 0xbf40,
+  0xbf62, 0xbf84, 0xbfa6, 0xbfc8, 0xbfea, 0xc00c, 0xc02e, 0xc050, 0xc072, 0xc094, 0xc0b6, 0xc0d8, 0xc0fa, 0xc11c, 0xc13e, 0xc160,
+  0xc182, 0xc1a4, 0xc1c6, 0xc1e8, 0xc20a, 0xc22c, 0xc24e, 0xc270, 0xc292, 0xc2b4, 0xc2d6, 0xc2f8, 0xc31a, 0xc33c, 0xc35e, 0xc380,
+  0xc3a2, 0xc3c4, 0xc3e6, 0xc408, 0xc42a, 0xc44c, 0xc46e, 0xc490, 0xc4b2, 0xc4d4, 0xc4f6, 0xc518, 0xc53a, 0xc55c, 0xc57e, 0xc5a0,
+  0xc5c2, 0xc5e4, 0xc606, 0xc628, 0xc64a, 0xc66c, 0xc68e, 0xc6b0, 0xc6d2, 0xc6f4, 0xc716, 0xc738, 0xc75a, 0xc77c, 0xc79e, 0xc7c0,
+  0xc7e2, 0xc804, 0xc826, 0xc848, 0xc86a, 0xc88c, 0xc8ae, 0xc8d0, 0xc8f2, 0xc914, 0xc936, 0xc958, 0xc97a, 0xc99c, 0xc9be, 0xc9e0,
+  0xca02, 0xca24, 0xca46, 0xca68, 0xca8a, 0xcaac, 0xcace, 0xcaf0, 0xcb12, 0xcb34, 0xcb56, 0xcb78, 0xcb9a, 0xcbbc, 0xcbde, 0xcc00,
+  0xcc22, 0xcc44, 0xcc66, 0xcc88, 0xccaa, 0xcccc, 0xccee, 0xcd10, 0xcd32, 0xcd54, 0xcd76, 0xcd98, 0xcdba, 0xcddc, 0xcdfe, 0xce20,
+  0xce42, 0xce64, 0xce86, 0xcea8, 0xceca, 0xceec, 0xcf0e, 0xcf30, 0xcf52, 0xcf74, 0xcf96, 0xcfb8, 0xcfda, 0xcffc, 0xd01e, 0xd040,
+  0xd062, 0xd084, 0xd0a6, 0xd0c8, 0xd0ea, 0xd10c, 0xd12e, 0xd150, 0xd172, 0xd194, 0xd1b6, 0xd1d8, 0xd1fa, 0xd21c, 0xd23e, 0xd260,
+  0xd282, 0xd2a4, 0xd2c6, 0xd2e8, 0xd30a, 0xd32c, 0xd34e, 0xd370, 0xd392, 0xd3b4, 0xd3d6, 0xd3f8, 0xd41a, 0xd43c, 0xd45e, 0xd480,
+  0xd4a2, 0xd4c4, 0xd4e6, 0xd508, 0xd52a, 0xd54c, 0xd56e, 0xd590, 0xd5b2, 0xd5d4, 0xd5f6, 0xd618, 0xd63a, 0xd65c, 0xd67e, 0xd6a0,
+  0xd6c2, 0xd6e4, 0xd706, 0xd728, 0xd74a, 0xd76c, 0xd78e, 0xd7b0, 0xd7d2, 0xd7f4, 0xd816, 0xd838, 0xd85a, 0xd87c, 0xd89e, 0xd8c0,
+  0xd8e2, 0xd904, 0xd926, 0xd948, 0xd96a, 0xd98c, 0xd9ae, 0xd9d0, 0xd9f2, 0xda14, 0xda36, 0xda58, 0xda7a, 0xda9c, 0xdabe, 0xdae0,
+  0xdb02, 0xdb24, 0xdb46, 0xdb68, 0xdb8a, 0xdbac, 0xdbce, 0xdbf0, 0xdc12, 0xdc34, 0xdc56, 0xdc78, 0xdc9a, 0xdcbc, 0xdcde, 0xdd00,
+  0xdd22, 0xdd44, 0xdd66, 0xdd88, 0xddaa, 0xddcc, 0xddee, 0xde10, 0xde32, 0xde54, 0xde76, 0xde98, 0xdeba, 0xdedc, 0xdefe, 0xdf20,
+  0xdf42, 0xdf64, 0xdf86, 0xdfa8, 0xdfca, 0xdfec, 0xe00e, 0xe030, 0xe052, 0xe074, 0xe096, 0xe0b8, 0xe0da, 0xe0fc, 0xe11e, 0xe140,
+  0xe162, 0xe184, 0xe1a6, 0xe1c8, 0xe1ea, 0xe20c, 0xe22e, 0xe250, 0xe272, 0xe294, 0xe2b6, 0xe2d8, 0xe2fa, 0xe31c, 0xe33e, 0xe360,
+  0xe382, 0xe3a4, 0xe3c6, 0xe3e8, 0xe40a, 0xe42c, 0xe44e, 0xe470, 0xe492, 0xe4b4, 0xe4d6, 0xe4f8, 0xe51a, 0xe53c, 0xe55e, 0xe580,
+  0xe5a2, 0xe5c4, 0xe5e6, 0xe608, 0xe62a, 0xe64c, 0xe66e, 0xe690, 0xe6b2, 0xe6d4, 0xe6f6, 0xe718, 0xe73a, 0xe75c, 0xe77e, 0xe7a0,
+  0xe7c2, 0xe7e4, 0xe806, 0xe828, 0xe84a, 0xe86c, 0xe88e, 0xe8b0, 0xe8d2, 0xe8f4, 0xe916, 0xe938, 0xe95a, 0xe97c, 0xe99e, 0xe9c0,
+  0xe9e2, 0xea04, 0xea26, 0xea48, 0xea6a, 0xea8c, 0xeaae, 0xead0, 0xeaf2, 0xeb14, 0xeb36, 0xeb58, 0xeb7a, 0xeb9c, 0xebbe, 0xebe0,
+  0xec02, 0xec24, 0xec46, 0xec68, 0xec8a, 0xecac, 0xecce, 0xecf0, 0xed12, 0xed34, 0xed56, 0xed78, 0xed9a, 0xedbc, 0xedde, 0xee00,
+  0xee22, 0xee44, 0xee66, 0xee88, 0xeeaa, 0xeecc, 0xeeee, 0xef10, 0xef32, 0xef54, 0xef76, 0xef98, 0xefba, 0xefdc, 0xeffe, 0xf020,
+  0xf042, 0xf064, 0xf086, 0xf0a8, 0xf0ca, 0xf0ec, 0xf10e, 0xf130, 0xf152, 0xf174, 0xf196, 0xf1b8, 0xf1da, 0xf1fc, 0xf21e
+};
+
+const CJKfont CJK16ptB = {CJK16ptBfont, CJK16ptBpages, CJK16ptBbits, CJK16ptBranks, CJK16ptBoffsets, 16};
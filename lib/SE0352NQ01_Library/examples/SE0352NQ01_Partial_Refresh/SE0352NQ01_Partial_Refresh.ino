@@ -32,8 +32,8 @@ void setup() {
   Serial.println("partialRefresh 0");
   SE0352.fillCircle(300, 200, 30, 0, frame);
   uint16_t zhongwenyekeyi[] = {0x4e2d, 0x6587, 0x4E5F, 0x53EF, 0x4EE5}; // 中文也可以
-  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 20, CJK16ptBfont, CJK16ptBsparse, CJK16ptBSparseLen, CJK16ptBHeight, 0, frame);
-  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 223, CJK16ptBfont, CJK16ptBsparse, CJK16ptBSparseLen, CJK16ptBHeight, 0, frame);
+  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 20, CJK16ptB, 0, frame);
+  SE0352.drawUnicode(zhongwenyekeyi, 5, 0, 223, CJK16ptB, 0, frame);
   for (uint8_t z = 0; z < 5; z++) {
     digitalWrite(PIN_LED2, HIGH);
     SE0352.partialRefresh(z * 16, 16, z * 16 + 15, 39, 0, frame);
@@ -1,5 +1,16 @@
 #include "SE0352NQ01.h"
 
+/*
+  Calls a method of the framebuffer view for the rotation, does nothing for an invalid rotation.
+*/
+#define SE0352_VIEW(rotation, buffer, call) \
+  switch (rotation) { \
+    case 0: SE0352View<0>(buffer).call; break; \
+    case 1: SE0352View<1>(buffer).call; break; \
+    case 2: SE0352View<2>(buffer).call; break; \
+    case 3: SE0352View<3>(buffer).call; break; \
+  }
+
 /*
   @brief Initializes the EPD
   @param None
@@ -15,7 +26,12 @@ SE0352NQ01::SE0352NQ01() {
   pinMode(SCK_Pin, OUTPUT);
   pinMode(SDI_Pin, OUTPUT);
   EPD_Reset();
+  // The constructor runs before setup(), the init is bit-banged
+  // and the SPI peripheral is started with the first transfer after it
   EPD_init(); // EPD init
+#ifndef SE0352_SOFT_SPI
+  hwSPI = true;
+#endif
 }
 
 /*
@@ -164,38 +180,16 @@ void SE0352NQ01::sleep(void) {
   @return nothing
 */
 void SE0352NQ01::lut_5S(void) {
-  unsigned int count;
-  EPD_W21_WriteCMD(0x20); // vcom
-  for (count = 0; count < 56; count++) {
-    EPD_W21_WriteDATA(lut_vcom[count]);
-  }
-  EPD_W21_WriteCMD(0x21); // red not used
-  for (count = 0; count < 42; count++) {
-    EPD_W21_WriteDATA(lut_ww[count]);
-  }
-  EPD_W21_WriteCMD(0x24); // wb w
-  for (count = 0; count < 56; count++) {
-    EPD_W21_WriteDATA(lut_bb[count]);
-  }
+  EPD_W21_WriteLUT(0x20, lut_vcom, sizeof(lut_vcom), 56); // vcom
+  EPD_W21_WriteLUT(0x21, lut_ww, sizeof(lut_ww), 42); // red not used
+  EPD_W21_WriteLUT(0x24, lut_bb, sizeof(lut_bb), 56); // wb w
   if (LUT_Flag == 0) {
-    EPD_W21_WriteCMD(0x22); // bb b
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_bw[count]);
-    }
-    EPD_W21_WriteCMD(0x23); // bw r
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_wb[count]);
-    }
+    EPD_W21_WriteLUT(0x22, lut_bw, sizeof(lut_bw), 56); // bb b
+    EPD_W21_WriteLUT(0x23, lut_wb, sizeof(lut_wb), 56); // bw r
     LUT_Flag = 1;
   } else {
-    EPD_W21_WriteCMD(0x23); // bb b
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_bw[count]);
-    }
-    EPD_W21_WriteCMD(0x22); // bw r
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_wb[count]);
-    }
+    EPD_W21_WriteLUT(0x23, lut_bw, sizeof(lut_bw), 56); // bb b
+    EPD_W21_WriteLUT(0x22, lut_wb, sizeof(lut_wb), 56); // bw r
     LUT_Flag = 0;
   }
 }
@@ -209,38 +203,16 @@ void SE0352NQ01::lut_GC(void) {
   /*
       It is recommended to call GC waveform to refresh the screen for normal use.
   */
-  unsigned int count;
-  EPD_W21_WriteCMD(0x20); // vcom
-  for (count = 0; count < 56; count++) {
-    EPD_W21_WriteDATA(lut_R20_GC[count]);
-  }
-  EPD_W21_WriteCMD(0x21); // red not use
-  for (count = 0; count < 42; count++) {
-    EPD_W21_WriteDATA(lut_R21_GC[count]);
-  }
-  EPD_W21_WriteCMD(0x24); // bb b
-  for (count = 0; count < 56; count++) {
-    EPD_W21_WriteDATA(lut_R24_GC[count]);
-  }
+  EPD_W21_WriteLUT(0x20, lut_R20_GC, sizeof(lut_R20_GC), 56); // vcom
+  EPD_W21_WriteLUT(0x21, lut_R21_GC, sizeof(lut_R21_GC), 42); // red not use
+  EPD_W21_WriteLUT(0x24, lut_R24_GC, sizeof(lut_R24_GC), 56); // bb b
   if (LUT_Flag == 0) {
-    EPD_W21_WriteCMD(0x22); // bw r
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R22_GC[count]);
-    }
-    EPD_W21_WriteCMD(0x23); // wb w
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R23_GC[count]);
-    }
+    EPD_W21_WriteLUT(0x22, lut_R22_GC, sizeof(lut_R22_GC), 56); // bw r
+    EPD_W21_WriteLUT(0x23, lut_R23_GC, sizeof(lut_R23_GC), 56); // wb w
     LUT_Flag = 1;
   } else {
-    EPD_W21_WriteCMD(0x22); // bw r
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R23_GC[count]);
-    }
-    EPD_W21_WriteCMD(0x23); // wb w
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R22_GC[count]);
-    }
+    EPD_W21_WriteLUT(0x22, lut_R23_GC, sizeof(lut_R23_GC), 56); // bw r
+    EPD_W21_WriteLUT(0x23, lut_R22_GC, sizeof(lut_R22_GC), 56); // wb w
     LUT_Flag = 0;
   }
 }
@@ -255,38 +227,16 @@ void SE0352NQ01::lut_DU(void) {
       If you use DU waveform to refresh the screen too many times, there will be low shadows.
       It is recommended to use GC waveform to refresh the screen every 5~10 times after calling DU waveform.
   */
-  unsigned int count;
-  EPD_W21_WriteCMD(0x20); // vcom
-  for (count = 0; count < 56; count++) {
-    EPD_W21_WriteDATA(lut_R20_DU[count]);
-  }
-  EPD_W21_WriteCMD(0x21); // red not use
-  for (count = 0; count < 42; count++) {
-    EPD_W21_WriteDATA(lut_R21_DU[count]);
-  }
-  EPD_W21_WriteCMD(0x24); // bb b
-  for (count = 0; count < 56; count++) {
-    EPD_W21_WriteDATA(lut_R24_DU[count]);
-  }
+  EPD_W21_WriteLUT(0x20, lut_R20_DU, sizeof(lut_R20_DU), 56); // vcom
+  EPD_W21_WriteLUT(0x21, lut_R21_DU, sizeof(lut_R21_DU), 42); // red not use
+  EPD_W21_WriteLUT(0x24, lut_R24_DU, sizeof(lut_R24_DU), 56); // bb b
   if (LUT_Flag == 0) {
-    EPD_W21_WriteCMD(0x22); // bw r
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R22_DU[count]);
-    }
-    EPD_W21_WriteCMD(0x23); // wb w
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R23_DU[count]);
-    }
+    EPD_W21_WriteLUT(0x22, lut_R22_DU, sizeof(lut_R22_DU), 56); // bw r
+    EPD_W21_WriteLUT(0x23, lut_R23_DU, sizeof(lut_R23_DU), 56); // wb w
     LUT_Flag = 1;
   } else {
-    EPD_W21_WriteCMD(0x22); // bw r
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R23_DU[count]);
-    }
-    EPD_W21_WriteCMD(0x23); // wb w
-    for (count = 0; count < 56; count++) {
-      EPD_W21_WriteDATA(lut_R22_DU[count]);
-    }
+    EPD_W21_WriteLUT(0x22, lut_R23_DU, sizeof(lut_R23_DU), 56); // bw r
+    EPD_W21_WriteLUT(0x23, lut_R22_DU, sizeof(lut_R22_DU), 56); // wb w
     LUT_Flag = 0;
   }
 }
@@ -317,12 +267,8 @@ void SE0352NQ01::send_DU(uint8_t* picData) {
   @return nothing
 */
 void SE0352NQ01::PIC_display1(uint8_t* picData) {
-  unsigned int i;
   EPD_W21_WriteCMD(0x13); // Transfer new data
-  for (i = 0; i < (Gate_Pixel * Source_Pixel / 8); i++) {
-    EPD_W21_WriteDATA(*picData);
-    picData++;
-  }
+  EPD_W21_WriteDATA(picData, Gate_Pixel * Source_Pixel / 8);
 }
 
 /*
@@ -341,22 +287,16 @@ void SE0352NQ01::fillScreen(uint8_t NUM) {
   @return nothing
 */
 void SE0352NQ01::PIC_display(uint8_t NUM) {
-  unsigned int row, column;
+  unsigned int column;
+  uint8_t row[Source_Pixel / 8];
   EPD_W21_WriteCMD(0x13); // Transfer new data
+  if (NUM != PIC_WHITE && NUM != PIC_BLACK) return;
+  memset(row, NUM, sizeof(row));
+  EPD_W21_Begin(1);
   for (column = 0; column < Gate_Pixel; column++) {
-    for (row = 0; row < Source_Pixel / 8; row++) {
-      switch (NUM) {
-        case PIC_WHITE:
-          EPD_W21_WriteDATA(0xFF);
-          break;
-        case PIC_BLACK:
-          EPD_W21_WriteDATA(0x00);
-          break;
-        default:
-          break;
-      }
-    }
+    EPD_W21_Transfer(row, sizeof(row));
   }
+  EPD_W21_End();
 }
 
 /*
@@ -414,16 +354,72 @@ void SE0352NQ01::SPI_Write(uint8_t value) {
 }
 
 /*
-  @brief Sends a command to the EPD via SPI.
-  @param value
+  @brief Starts a transfer, asserts CS once for the whole burst.
+  @param data 0 for a command, 1 for data
   @return nothing
 */
-void SE0352NQ01::EPD_W21_WriteCMD(uint8_t command) {
+void SE0352NQ01::EPD_W21_Begin(uint8_t data) {
+#ifndef SE0352_SOFT_SPI
+  if (hwSPI) {
+    if (!spiStarted) {
+      SPI.begin();
+      spiStarted = true;
+    }
+    SPI.beginTransaction(SPISettings(SE0352_SPI_FREQ, MSBFIRST, SPI_MODE0));
+  }
+#endif
+  if (data) EPD_W21_DC_1; // data write
+  else EPD_W21_DC_0; // command write
   EPD_W21_CS_0;
-  EPD_W21_DC_0; // command write
-  SPI_Write(command);
+}
+
+/*
+  @brief Sends bytes inside a transfer.
+  @param data bytes to send, in RAM with EasyDMA
+  @param len number of bytes
+  @return nothing
+*/
+void SE0352NQ01::EPD_W21_Transfer(const uint8_t *data, uint16_t len) {
+#ifndef SE0352_SOFT_SPI
+  if (hwSPI) {
+#ifdef NRF52_SERIES
+    // One EasyDMA transfer, nothing is received
+    SPI.transfer(data, NULL, len);
+#else
+    for (uint16_t i = 0; i < len; i++) SPI.transfer(data[i]);
+#endif
+    return;
+  }
+#endif
+  for (uint16_t i = 0; i < len; i++) SPI_Write(data[i]);
+}
+
+/*
+  @brief Ends a transfer, releases CS.
+  @param None
+  @return nothing
+*/
+void SE0352NQ01::EPD_W21_End(void) {
   EPD_W21_CS_1;
   EPD_W21_DC_1;
+#ifndef SE0352_SOFT_SPI
+  if (hwSPI) {
+    SPI.endTransaction();
+    return;
+  }
+#endif
+  EPD_W21_MOSI_0;
+}
+
+/*
+  @brief Sends a command to the EPD via SPI.
+  @param value
+  @return nothing
+*/
+void SE0352NQ01::EPD_W21_WriteCMD(uint8_t command) {
+  EPD_W21_Begin(0);
+  EPD_W21_Transfer(&command, 1);
+  EPD_W21_End();
 }
 
 /*
@@ -432,13 +428,38 @@ void SE0352NQ01::EPD_W21_WriteCMD(uint8_t command) {
   @return nothing
 */
 void SE0352NQ01::EPD_W21_WriteDATA(uint8_t data) {
-  EPD_W21_MOSI_0;
-  EPD_W21_CS_0;
-  EPD_W21_DC_1; // data write
-  SPI_Write(data);
-  EPD_W21_CS_1;
-  EPD_W21_DC_1;
-  EPD_W21_MOSI_0;
+  EPD_W21_Begin(1);
+  EPD_W21_Transfer(&data, 1);
+  EPD_W21_End();
+}
+
+/*
+  @brief Sends a block of data to the EPD via SPI, with one CS assertion.
+  @param data bytes to send, in RAM with EasyDMA
+  @param len number of bytes
+  @return nothing
+*/
+void SE0352NQ01::EPD_W21_WriteDATA(const uint8_t *data, uint16_t len) {
+  EPD_W21_Begin(1);
+  EPD_W21_Transfer(data, len);
+  EPD_W21_End();
+}
+
+/*
+  @brief Sends a LUT command and its table. The table is copied to RAM for EasyDMA,
+  tables shorter than the register are padded with 0.
+  @param command LUT register
+  @param lut table
+  @param lutLen size of the table
+  @param len size of the LUT register, 56 bytes max
+  @return nothing
+*/
+void SE0352NQ01::EPD_W21_WriteLUT(uint8_t command, const uint8_t *lut, uint8_t lutLen, uint8_t len) {
+  uint8_t data[56];
+  memset(data, 0, len);
+  memcpy(data, lut, lutLen < len ? lutLen : len);
+  EPD_W21_WriteCMD(command);
+  EPD_W21_WriteDATA(data, len);
 }
 
 /*
@@ -451,15 +472,7 @@ void SE0352NQ01::EPD_W21_WriteDATA(uint8_t data) {
   @return nothing
 */
 void SE0352NQ01::drawHLine(uint16_t x0, uint16_t y0, uint16_t x1, uint8_t rotation, uint8_t *buffer) {
-  uint16_t x2, x3;
-  if (x0 > x1) {
-    x2 = x1; x3 = x0 + 1;
-  } else {
-    x2 = x0; x3 = x1 + 1;
-  }
-  for (int16_t x = x2; x < x3; x++) {
-    setPixel(x, y0, rotation, buffer);
-  }
+  SE0352_VIEW(rotation, buffer, drawHLine(x0, x1, y0, PIC_BLACK));
 }
 
 /*
@@ -472,15 +485,7 @@ void SE0352NQ01::drawHLine(uint16_t x0, uint16_t y0, uint16_t x1, uint8_t rotati
   @return nothing
 */
 void SE0352NQ01::drawVLine(uint16_t x0, uint16_t y0, uint16_t y1, uint8_t rotation, uint8_t *buffer) {
-  uint16_t y2, y3;
-  if (y0 > y1) {
-    y2 = y1; y3 = y0 + 1;
-  } else {
-    y2 = y0; y3 = y1 + 1;
-  }
-  for (int16_t y = y2; y < y3; y++) {
-    setPixel(x0, y, rotation, buffer);
-  }
+  SE0352_VIEW(rotation, buffer, drawVLine(x0, y0, y1, PIC_BLACK));
 }
 
 /*
@@ -506,7 +511,7 @@ void SE0352NQ01::drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ui
   }
   if (y0 == y1) {
     // horizontal line
-    drawVLine(x0, y0, x1, rotation, buffer);
+    drawHLine(x0, y0, x1, rotation, buffer);
     return;
   }
   uint16_t x2, x3, y2, y3;
@@ -609,21 +614,7 @@ void SE0352NQ01::drawCircle(uint16_t xc, uint16_t yc, uint16_t r, uint8_t rotati
   @return nothing
 */
 void SE0352NQ01::drawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer) {
-  uint16_t fx0, fx1, fy0, fy1;
-  if (x1 > x0) {
-    fx0 = x1; fx1 = x0;
-  } else {
-    fx1 = x1; fx0 = x0;
-  }
-  if (y1 > y0) {
-    fy0 = y1; fy1 = y0;
-  } else {
-    fy1 = y1; fy0 = y0;
-  }
-  drawHLine(fx0, fy0, fx1, rotation, buffer);
-  drawHLine(fx0, fy1, fx1, rotation, buffer);
-  drawVLine(fx0, fy0, fy1, rotation, buffer);
-  drawVLine(fx1, fy0, fy1, rotation, buffer);
+  SE0352_VIEW(rotation, buffer, drawRect(x0, y0, x1, y1, PIC_BLACK));
 }
 
 /*
@@ -637,22 +628,7 @@ void SE0352NQ01::drawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, ui
   @return nothing
 */
 void SE0352NQ01::clearRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer) {
-  uint16_t fx0, fx1, fy0, fy1, x, y;
-  if (x1 < x0) {
-    fx0 = x1; fx1 = x0 + 1;
-  } else {
-    fx1 = x1 + 1; fx0 = x0;
-  }
-  if (y1 < y0) {
-    fy0 = y1; fy1 = y0 + 1;
-  } else {
-    fy1 = y1 + 1; fy0 = y0;
-  }
-  for (y = fy0; y < fy1; y++) {
-    for (x = fx0; x < fx1; x++) {
-      clearPixel(x, y, rotation, buffer);
-    }
-  }
+  SE0352_VIEW(rotation, buffer, fillRect(x0, y0, x1, y1, PIC_WHITE));
 }
 
 /*
@@ -666,20 +642,7 @@ void SE0352NQ01::clearRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, u
   @return nothing
 */
 void SE0352NQ01::fillRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer) {
-  uint16_t fx0, fx1, fy0, fy1, x, y;
-  if (x1 < x0) {
-    fx0 = x1; fx1 = x0 + 1;
-  } else {
-    fx1 = x1 + 1; fx0 = x0;
-  }
-  if (y1 < y0) {
-    fy0 = y1; fy1 = y0 + 1;
-  } else {
-    fy1 = y1 + 1; fy0 = y0;
-  }
-  for (y = fy0; y < fy1; y++) {
-    drawHLine(fx0, y, fx1, rotation, buffer);
-  }
+  SE0352_VIEW(rotation, buffer, fillRect(x0, y0, x1, y1, PIC_BLACK));
 }
 
 /*
@@ -705,24 +668,7 @@ void SE0352NQ01::drawPolygon(uint16_t *points, uint16_t len, uint8_t rotation, u
   @return nothing
 */
 void SE0352NQ01::clearPixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer) {
-  uint16_t x0, y0;
-  if (rotation == 0) {
-    x0 = y;
-    y0 = 359 - x;
-  } else if (rotation == 2) {
-    x0 = 239 - y;
-    y0 = x;
-  } else if (rotation == 1) {
-    x0 = x;
-    y0 = y;
-  } else if (rotation == 3) {
-    x0 = 239 - x;
-    y0 = 359 - y;
-  }
-  uint16_t bytePos = y0 * 30 + x0 / 8;
-  uint8_t n = (x0 % 8); // (7 - (x % 8));
-  uint8_t bf = buffer[bytePos];
-  buffer[bytePos] = bf | (1 << (7 - n));
+  SE0352_VIEW(rotation, buffer, clearPixel(x, y));
 }
 
 /*
@@ -734,29 +680,7 @@ void SE0352NQ01::clearPixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *b
   @return nothing
 */
 void SE0352NQ01::setPixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer) {
-  uint8_t anders[8] = {
-    0b01111111, 0b10111111, 0b11011111, 0b11101111,
-    0b11110111, 0b11111011, 0b11111101, 0b11111110
-  };
-  uint16_t x0, y0;
-  if (rotation == 0) {
-    x0 = y;
-    y0 = 359 - x;
-  } else if (rotation == 2) {
-    x0 = 239 - y;
-    y0 = x;
-  } else if (rotation == 1) {
-    x0 = x;
-    y0 = y;
-  } else if (rotation == 3) {
-    x0 = 239 - x;
-    y0 = 359 - y;
-  }
-  uint16_t bytePos = y0 * 30 + x0 / 8;
-  uint8_t n = (x0 % 8); // (7 - (x % 8));
-  uint8_t bf = buffer[bytePos];
-  uint8_t af = bf & anders[n];
-  buffer[bytePos] = af;
+  SE0352_VIEW(rotation, buffer, setPixel(x, y));
 }
 
 /*
@@ -765,34 +689,16 @@ void SE0352NQ01::setPixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buf
   @param y y-position
   @param rotation 0 / 2 landscape, 1 / 3 portrait
   @param buffer the 10,800-byte buffer you are drawing to
-  @return colour
+  @return colour, PIC_BLACK outside of the screen
 */
-
 uint8_t SE0352NQ01::getPixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer) {
-  uint8_t anders[8] = {
-    0b10000000, 0b01000000, 0b00100000, 0b00010000,
-    0b00001000, 0b00000100, 0b00000010, 0b00000001
-  };
-  uint16_t x0, y0;
-  if (rotation == 0) {
-    x0 = y;
-    y0 = 359 - x;
-  } else if (rotation == 2) {
-    x0 = 239 - y;
-    y0 = x;
-  } else if (rotation == 1) {
-    x0 = x;
-    y0 = y;
-  } else if (rotation == 3) {
-    x0 = 239 - x;
-    y0 = 359 - y;
+  switch (rotation) {
+    case 0: return SE0352View<0>(buffer).getPixel(x, y);
+    case 1: return SE0352View<1>(buffer).getPixel(x, y);
+    case 2: return SE0352View<2>(buffer).getPixel(x, y);
+    case 3: return SE0352View<3>(buffer).getPixel(x, y);
   }
-  uint16_t bytePos = y0 * 30 + x0 / 8;
-  uint8_t n = (x0 % 8); // (7 - (x % 8));
-  uint8_t bf = buffer[bytePos];
-  uint8_t af = bf & anders[n];
-  if (af == 0) return PIC_BLACK;
-  else return PIC_WHITE;
+  return PIC_BLACK;
 }
 
 /*
@@ -904,40 +810,7 @@ void SE0352NQ01::drawBitmap(
   int8_t xOffset, int8_t yOffset, uint16_t bitmapOffset,
   uint8_t *buffer, uint8_t *bitmap, uint8_t rotation
 ) {
-  uint8_t anders[8] = {
-    0b01111111, 0b10111111, 0b11011111, 0b11101111,
-    0b11110111, 0b11111011, 0b11111101, 0b11111110
-  };
-  for (uint16_t y = 0; y < height; y++) {
-    for (uint16_t x = 0; x < width; x++) {
-      uint16_t bitIndex = x + width * y;
-      uint16_t myByte = bitIndex >> 3;
-      uint16_t bitMask = 0x80 >> (bitIndex & 7);
-      uint8_t c = bitmap[myByte + bitmapOffset];
-      if (c & bitMask) {
-        // Set bit
-        uint16_t x0, y0;
-        if (rotation == 0) {
-          x0 = (posY + yOffset + y);
-          y0 = 359 - (posX + x + xOffset);
-        } else if (rotation == 2) {
-          x0 = 239 - (posY + yOffset + y);
-          y0 = (posX + x + xOffset);
-        } else if (rotation == 1) {
-          x0 = (posX + x + xOffset);
-          y0 = (posY + yOffset + y);
-        } else if (rotation == 3) {
-          x0 = 239 - (posX + x + xOffset);
-          y0 = 359 - (posY + yOffset + y);
-        }
-        uint16_t bytePos = y0 * 30 + x0 / 8;
-        uint8_t n = (x0 % 8); // (7 - (x % 8));
-        uint8_t bf = buffer[bytePos];
-        uint8_t af = bf & anders[n];
-        buffer[bytePos] = af;
-      }
-    }
-  }
+  SE0352_VIEW(rotation, buffer, drawBitmap(posX + xOffset, posY + yOffset, width, height, bitmap + bitmapOffset));
 }
 
 /*
@@ -1004,6 +877,7 @@ uint16_t SE0352NQ01::strWidth(char *myStr, GFXfont myFont) {
 
 /*
   @brief Draws a Unicode string. Mostly Chinese for now.
+         Characters without a glyph are drawn with the first glyph of the font.
   @param myStr String as character array
   @param posX Start x position
   @param posY Start y position
@@ -1018,77 +892,160 @@ uint16_t SE0352NQ01::strWidth(char *myStr, GFXfont myFont) {
 void SE0352NQ01::drawUnicode(
   uint16_t *myStr, uint8_t len,
   uint16_t posX, uint16_t posY,
-  uint8_t *myFont, uint8_t *myIndex,
+  const uint8_t *myFont, const uint8_t *myIndex,
   uint16_t myIndexLen, uint8_t charHeight,
   uint8_t rotation, uint8_t* buffer) {
   for (uint8_t zw = 0; zw < len; zw++) {
-    get_ch2(myStr[zw], myIndex, myIndexLen, myFont, charHeight);
-    uint8_t ln = (next_offs - doff);
-    uint8_t w = ln * 8 / myHeight;
-    drawBitmap(w, myHeight, posX, posY, 0, 0, doff, buffer, myFont, rotation);
-    posX += w;
-#ifdef SHOW_OFF_SE0352
-    uint8_t lCount = 0;
-    for (uint16_t i = doff; i < next_offs; i++) {
-      uint8_t c = myFont[i], mask = 0b10000000;
-      for (uint8_t x = 0; x < 8; x++) {
-        uint8_t mask = 1 << (7 - x);
-        uint8_t rslt = c & mask;
-        if (rslt != 0) Serial.write('*');
-        else Serial.write(' ');
-        lCount += 1;
-        mask = mask >> 1;
-        if (lCount == w) {
-          Serial.write('\n');
-          lCount = 0;
-        }
-      }
+    CJKglyph *glyph = findGlyph(myStr[zw], myFont);
+    if (glyph == NULL) {
+      glyph = loadGlyph(myStr[zw], myFont, glyphOffset(myStr[zw], myIndex, myIndexLen), charHeight);
     }
-    Serial.write('\n');
-#endif
+    posX += drawGlyph(glyph, posX, posY, rotation, buffer);
+  }
+}
+
+/*
+  @brief Draws a Unicode string with a font written by assets/cjk16b.py.
+         Characters without a glyph are drawn with the first glyph of the font.
+  @param myStr String as character array
+  @param posX Start x position
+  @param posY Start y position
+  @param myFont font with the direct index
+  @param rotation Screen rotation to use
+  @param buffer Buffer to draw string to
+  @return nothing
+*/
+void SE0352NQ01::drawUnicode(
+  uint16_t *myStr, uint8_t len,
+  uint16_t posX, uint16_t posY,
+  const CJKfont &myFont, uint8_t rotation, uint8_t* buffer) {
+  for (uint8_t zw = 0; zw < len; zw++) {
+    CJKglyph *glyph = findGlyph(myStr[zw], myFont.font);
+    if (glyph == NULL) {
+      glyph = loadGlyph(myStr[zw], myFont.font, glyphOffset(myStr[zw], myFont), myFont.height);
+    }
+    posX += drawGlyph(glyph, posX, posY, rotation, buffer);
   }
 }
 
-uint16_t SE0352NQ01::bs(const uint8_t *lst, uint16_t sparseLen, uint16_t val) {
+/*
+  @brief Looks up a glyph in the sparse index, a sorted list of codepoint and offset pairs.
+  @param ch Codepoint
+  @param sparse sparse index
+  @param sparseLen Length of the sparse index in bytes
+  @return uint16_t Offset of the glyph in the font, 0 (the first glyph) if there is none.
+*/
+uint16_t SE0352NQ01::glyphOffset(uint16_t ch, const uint8_t *sparse, uint16_t sparseLen) {
   uint16_t low = 0;
-  uint16_t high = (sparseLen / 4);
-  uint8_t count = 0;
-  while (count < 30) {
+  uint16_t high = sparseLen / 4;
+  while (low < high) {
     uint16_t m = (high - low) / 2 + low;
-    uint16_t pos = m * 4;
-    uint16_t v = lst[pos] | (lst[pos + 1] << 8);
-    if (v == val) {
-      v = lst[pos + 2] | (lst[pos + 3] << 8);
-      return v;
+    const uint8_t *entry = sparse + m * 4;
+    uint16_t v = entry[0] | (entry[1] << 8);
+    if (v == ch) {
+      return entry[2] | (entry[3] << 8);
     }
-    if (low > high) {
-      Serial.println("Stopping here...");
-      return 0;
-    }
-    if (v < val) {
+    if (v < ch) {
       low = m + 1;
     } else {
-      high = m - 1;
+      high = m;
     }
-    count += 1;
   }
   return 0;
 }
 
-void SE0352NQ01::get_ch2(uint16_t ch, const uint8_t* sparse, uint16_t sparseLen, uint8_t* myFont, uint8_t fHeight) {
-  myWidth = 0;
-  next_offs = 0;
-  next_offs = 0;
-  myHeight = 0;
-  doff = bs(sparse, sparseLen, ch);
-  if (doff == 0) {
-    Serial.println("doff is null. Aborting...");
-    return;
+/*
+  @brief Looks up a glyph in the direct index of a font.
+  @param ch Codepoint
+  @param myFont font with the direct index
+  @return uint16_t Offset of the glyph in the font, 0 (the first glyph) if there is none.
+*/
+uint16_t SE0352NQ01::glyphOffset(uint16_t ch, const CJKfont &myFont) {
+  uint8_t slot = myFont.pages[ch >> 8];
+  if (slot == 0xFF) return 0;
+  uint16_t word = slot * 8 + ((ch >> 5) & 7);
+  uint32_t bit = (uint32_t)1 << (ch & 31);
+  uint32_t bits = myFont.bits[word];
+  if ((bits & bit) == 0) return 0;
+  return myFont.offsets[myFont.ranks[word] + __builtin_popcount(bits & (bit - 1))];
+}
+
+/*
+  @brief Looks up a glyph in the glyph cache.
+  @param ch Codepoint
+  @param myFont font of the glyph
+  @return CJKglyph* cached glyph, NULL if it is not cached
+*/
+CJKglyph *SE0352NQ01::findGlyph(uint16_t ch, const uint8_t *myFont) {
+  for (uint8_t i = 0; i < SE0352_CJK_CACHE; i++) {
+    CJKglyph *glyph = &glyphCache[i];
+    if (glyph->ch == ch && glyph->font == myFont) {
+      glyph->used = ++glyphClock;
+      return glyph;
+    }
   }
-  myWidth = myFont[doff] | (myFont[doff + 1] << 8);
-  doff += 2;
-  next_offs = doff + ((myWidth - 1) / 8 + 1) * fHeight;
-  myHeight = fHeight;
+  return NULL;
+}
+
+/*
+  @brief Loads a glyph into the cache, replacing the glyph used longest ago.
+  @param ch Codepoint
+  @param myFont font of the glyph
+  @param offset Offset of the glyph in the font
+  @param charHeight Character height in pixel
+  @return CJKglyph* cached glyph
+*/
+CJKglyph *SE0352NQ01::loadGlyph(uint16_t ch, const uint8_t *myFont, uint16_t offset, uint8_t charHeight) {
+  CJKglyph *glyph = &glyphCache[0];
+  for (uint8_t i = 1; i < SE0352_CJK_CACHE; i++) {
+    if (glyphCache[i].used < glyph->used) glyph = &glyphCache[i];
+  }
+  uint16_t width = myFont[offset] | (myFont[offset + 1] << 8);
+  uint16_t bytes = ((width - 1) / 8 + 1) * charHeight;
+  glyph->font = myFont;
+  glyph->ch = ch;
+  glyph->width = ((width - 1) / 8 + 1) * 8;
+  glyph->height = charHeight;
+  glyph->used = ++glyphClock;
+  if (bytes <= SE0352_CJK_ROWS) {
+    memcpy(glyph->rows, myFont + offset + 2, bytes);
+    glyph->bitmap = glyph->rows;
+  } else {
+    glyph->bitmap = myFont + offset + 2;
+  }
+  return glyph;
+}
+
+/*
+  @brief Draws a cached glyph.
+  @param glyph cached glyph
+  @param posX top left corner x-position
+  @param posY top left corner y-position
+  @param rotation Screen rotation to use
+  @param buffer Buffer to draw the glyph to
+  @return uint8_t Width of the glyph in pixel.
+*/
+uint8_t SE0352NQ01::drawGlyph(CJKglyph *glyph, uint16_t posX, uint16_t posY, uint8_t rotation, uint8_t *buffer) {
+  SE0352_VIEW(rotation, buffer, drawBitmap(posX, posY, glyph->width, glyph->height, glyph->bitmap));
+#ifdef SHOW_OFF_SE0352
+  uint8_t lCount = 0;
+  for (uint16_t i = 0; i < glyph->width / 8 * glyph->height; i++) {
+    uint8_t c = glyph->bitmap[i];
+    for (uint8_t x = 0; x < 8; x++) {
+      uint8_t mask = 1 << (7 - x);
+      uint8_t rslt = c & mask;
+      if (rslt != 0) Serial.write('*');
+      else Serial.write(' ');
+      lCount += 1;
+      if (lCount == glyph->width) {
+        Serial.write('\n');
+        lCount = 0;
+      }
+    }
+  }
+  Serial.write('\n');
+#endif
+  return glyph->width;
 }
 
 /*
@@ -1169,13 +1126,13 @@ void SE0352NQ01::partialRefresh(
   SE0352.EPD_W21_WriteDATA(py11); // VRED
   SE0352.EPD_W21_WriteDATA(0x01);
   SE0352.EPD_W21_WriteCMD(0x13);
-  for (uint16_t y = y0; y <= y1; y++) {
-    // rows
-    for (uint16_t x = x0; x <= x1; x += 8) {
-      // cols / 8 bits
-      uint16_t btPos = y * 30 + (x / 8);
-      SE0352.EPD_W21_WriteDATA(buffer[btPos]);
+  if (x0 <= x1) {
+    // One burst, one transfer per row of x0 / 8 to x1 / 8
+    SE0352.EPD_W21_Begin(1);
+    for (uint16_t y = y0; y <= y1; y++) {
+      SE0352.EPD_W21_Transfer(&buffer[y * 30 + (x0 / 8)], (x1 - x0) / 8 + 1);
     }
+    SE0352.EPD_W21_End();
   }
   SE0352.lut_GC();
   SE0352.refresh();
@@ -1,6 +1,19 @@
 #include <Arduino.h>
 #include <stdint.h>
 
+/*
+  SPI transport
+  By default the EPD is driven by the hardware SPI, on nRF52 the data bursts are sent with EasyDMA.
+  Buffers sent with EasyDMA must be in RAM.
+  Build with -DSE0352_SOFT_SPI to bit-bang the pins instead.
+*/
+#ifndef SE0352_SOFT_SPI
+#include <SPI.h>
+#ifndef SE0352_SPI_FREQ
+#define SE0352_SPI_FREQ 8000000
+#endif
+#endif
+
 typedef struct {
   uint16_t bitmapOffset;
   uint8_t width;
@@ -18,6 +31,43 @@ typedef struct {
   uint8_t yAdvance;
 } GFXfont;
 
+/*
+  Chinese font with a direct index, written by assets/cjk16b.py
+  The page of a codepoint (ch >> 8) selects a slot, 0xFF if the page has no glyph.
+  A slot has 8 words of 32 bits, with a bit set for every codepoint that has a glyph.
+  The glyph number is the rank of the word plus the bits set below the codepoint.
+*/
+typedef struct {
+  const uint8_t *font;     // Glyphs, the width (uint16_t LE) followed by the rows
+  const uint8_t *pages;    // Slot of each page of 256 codepoints
+  const uint32_t *bits;    // 8 words per slot
+  const uint16_t *ranks;   // Number of glyphs before each word
+  const uint16_t *offsets; // Offset of each glyph in font
+  uint8_t height;
+} CJKfont;
+
+/*
+  Glyph cache
+  The last SE0352_CJK_CACHE Chinese glyphs are kept in RAM, the glyph used longest ago is replaced.
+  Glyphs of up to SE0352_CJK_ROWS bytes are copied, larger glyphs are drawn from the font.
+*/
+#ifndef SE0352_CJK_CACHE
+#define SE0352_CJK_CACHE 16
+#endif
+#ifndef SE0352_CJK_ROWS
+#define SE0352_CJK_ROWS 32
+#endif
+
+typedef struct {
+  const uint8_t *font;   // Font of the glyph, NULL if the entry is free
+  const uint8_t *bitmap; // Rows of the glyph, in rows or in the font
+  uint32_t used;         // Time of the last use
+  uint16_t ch;
+  uint8_t width;         // Width padded to full bytes
+  uint8_t height;
+  uint8_t rows[SE0352_CJK_ROWS];
+} CJKglyph;
+
 #define Source_Pixel 240
 #define Gate_Pixel 360
 
@@ -31,6 +81,8 @@ typedef struct {
 
 #define PIC_WHITE 0xFF
 #define PIC_BLACK 0x00
+
+#include "SE0352NQ01_view.h"
 // EPD
 #define EPD_W21_MOSI_0 digitalWrite(SDI_Pin, LOW)
 #define EPD_W21_MOSI_1 digitalWrite(SDI_Pin, HIGH)
@@ -56,7 +108,10 @@ class SE0352NQ01 {
     //void drawString(char *, uint16_t, uint16_t, GFXfont, uint8_t, uint8_t*);
     uint16_t drawString(char *, uint16_t, uint16_t, GFXfont, uint8_t, uint8_t*);
     uint16_t strWidth(char *, GFXfont);
-    void drawUnicode(uint16_t*, uint8_t, uint16_t, uint16_t, uint8_t*, uint8_t*, uint16_t, uint8_t, uint8_t, uint8_t*);
+    void drawUnicode(uint16_t*, uint8_t, uint16_t, uint16_t, const uint8_t*, const uint8_t*, uint16_t, uint8_t, uint8_t, uint8_t*);
+    void drawUnicode(uint16_t*, uint8_t, uint16_t, uint16_t, const CJKfont &, uint8_t, uint8_t*);
+    uint16_t glyphOffset(uint16_t, const uint8_t*, uint16_t);
+    uint16_t glyphOffset(uint16_t, const CJKfont &);
     void drawBitmap(uint8_t, uint8_t, uint16_t, uint16_t, int8_t, int8_t, uint16_t, uint8_t *, uint8_t *, uint8_t);
     void drawBitmap(uint8_t, uint8_t, uint16_t, uint16_t, uint8_t *, uint8_t *, uint8_t);
     void setPixel(uint16_t, uint16_t, uint8_t, uint8_t *);
@@ -88,13 +143,19 @@ class SE0352NQ01 {
     void DELAY_S(unsigned int delaytime);
     void DELAY_M(unsigned int delaytime);
     void SPI_Write(uint8_t);
-    void get_ch2(uint16_t, const uint8_t*, uint16_t, uint8_t*, uint8_t);
-    uint16_t bs(const uint8_t *, uint16_t, uint16_t);
+    CJKglyph *findGlyph(uint16_t, const uint8_t*);
+    CJKglyph *loadGlyph(uint16_t, const uint8_t*, uint16_t, uint8_t);
+    uint8_t drawGlyph(CJKglyph *, uint16_t, uint16_t, uint8_t, uint8_t*);
     void drawFillCircle(uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *, uint8_t);
     void drawCirclePoints(uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
     void fillCirclePoints(uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
     void EPD_W21_WriteCMD(uint8_t);
     void EPD_W21_WriteDATA(uint8_t);
+    void EPD_W21_WriteDATA(const uint8_t*, uint16_t);
+    void EPD_W21_WriteLUT(uint8_t, const uint8_t*, uint8_t, uint8_t);
+    void EPD_W21_Begin(uint8_t);
+    void EPD_W21_Transfer(const uint8_t*, uint16_t);
+    void EPD_W21_End(void);
 
     // LUT
     void lut_DU(void);
@@ -102,7 +163,12 @@ class SE0352NQ01 {
     void lut_5S(void);
     unsigned long LUT_Flag = 0;
 
-    uint16_t doff, next_offs, myHeight, myWidth;
+    // Hardware SPI is used after the init in the constructor
+    bool hwSPI = false;
+    bool spiStarted = false;
+
+    CJKglyph glyphCache[SE0352_CJK_CACHE] = {};
+    uint32_t glyphClock = 0;
 };
 
 // full screen update LUT
@@ -0,0 +1,264 @@
+#ifndef SE0352NQ01_VIEW_H
+#define SE0352NQ01_VIEW_H
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+  Framebuffer view for one rotation.
+  The buffer is stored in portrait 1 orientation: Gate_Pixel rows of Source_Pixel / 8 bytes,
+  the MSB is the leftmost pixel, a cleared bit is black.
+  The rotation is a template parameter, so the mapping of the coordinates is resolved at compile time.
+  Lines and rectangles are mapped to a rectangle in the buffer and filled byte by byte,
+  the bytes between the first and the last byte of a row with memset.
+  Bitmaps are copied a byte at a time, for rotation 0 and 2 in blocks of 8 x 8 pixels that are transposed.
+  Pixels outside of the screen are ignored, getPixel returns PIC_BLACK for them.
+*/
+template <uint8_t ROTATION>
+class SE0352View {
+  public:
+    static const uint16_t width = (ROTATION == 0 || ROTATION == 2) ? Gate_Pixel : Source_Pixel;
+    static const uint16_t height = (ROTATION == 0 || ROTATION == 2) ? Source_Pixel : Gate_Pixel;
+    static const uint16_t rowBytes = Source_Pixel / 8;
+
+    SE0352View(uint8_t *buffer) : buffer(buffer) {}
+
+    /*
+      @brief Sets (ie to black) a pixel
+      @param x x-position
+      @param y y-position
+      @return nothing
+    */
+    void setPixel(uint16_t x, uint16_t y) {
+      if (x >= width || y >= height) return;
+      buffer[row(x, y) * rowBytes + col(x, y) / 8] &= ~(0x80 >> (col(x, y) & 7));
+    }
+
+    /*
+      @brief Clears (ie set to white) a pixel
+      @param x x-position
+      @param y y-position
+      @return nothing
+    */
+    void clearPixel(uint16_t x, uint16_t y) {
+      if (x >= width || y >= height) return;
+      buffer[row(x, y) * rowBytes + col(x, y) / 8] |= 0x80 >> (col(x, y) & 7);
+    }
+
+    /*
+      @brief returns the colour of a pixel
+      @param x x-position
+      @param y y-position
+      @return PIC_BLACK or PIC_WHITE, PIC_BLACK outside of the screen
+    */
+    uint8_t getPixel(uint16_t x, uint16_t y) const {
+      if (x >= width || y >= height) return PIC_BLACK;
+      if (buffer[row(x, y) * rowBytes + col(x, y) / 8] & (0x80 >> (col(x, y) & 7))) return PIC_WHITE;
+      return PIC_BLACK;
+    }
+
+    /*
+      @brief Draws a horizontal line, x0 and x1 included, in any order.
+      @param x0 start, x position
+      @param x1 end, x position
+      @param y y position
+      @param color PIC_BLACK or PIC_WHITE
+      @return nothing
+    */
+    void drawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint8_t color) {
+      fillRect(x0, y, x1, y, color);
+    }
+
+    /*
+      @brief Draws a vertical line, y0 and y1 included, in any order.
+      @param x x position
+      @param y0 start, y position
+      @param y1 end, y position
+      @param color PIC_BLACK or PIC_WHITE
+      @return nothing
+    */
+    void drawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint8_t color) {
+      fillRect(x, y0, x, y1, color);
+    }
+
+    /*
+      @brief Draws the outline of a rectangle, corners included, in any order.
+      @param x0, y0 first corner
+      @param x1, y1 opposite corner
+      @param color PIC_BLACK or PIC_WHITE
+      @return nothing
+    */
+    void drawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t color) {
+      fillRect(x0, y0, x1, y0, color);
+      fillRect(x0, y1, x1, y1, color);
+      fillRect(x0, y0, x0, y1, color);
+      fillRect(x1, y0, x1, y1, color);
+    }
+
+    /*
+      @brief Fills a rectangle, corners included, in any order.
+      @param x0, y0 first corner
+      @param x1, y1 opposite corner
+      @param color PIC_BLACK or PIC_WHITE
+      @return nothing
+    */
+    void fillRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t color) {
+      if (x0 > x1) { uint16_t t = x0; x0 = x1; x1 = t; }
+      if (y0 > y1) { uint16_t t = y0; y0 = y1; y1 = t; }
+      if (x0 >= width || y0 >= height) return;
+      if (x1 >= width) x1 = width - 1;
+      if (y1 >= height) y1 = height - 1;
+      uint16_t c0 = col(x0, y0), c1 = col(x1, y1);
+      uint16_t r0 = row(x0, y0), r1 = row(x1, y1);
+      fillBuffer(c0 < c1 ? c0 : c1, r0 < r1 ? r0 : r1, c0 < c1 ? c1 : c0, r0 < r1 ? r1 : r0, color);
+    }
+
+    /*
+      @brief Draws the set bits of a bitmap in black, the clear bits are not drawn.
+      The rows are not padded: pixel x, y of the bitmap is bit x + w * y, MSB first.
+      A bitmap that crosses the edge of the screen is drawn pixel by pixel.
+      @param x, y top left corner, can be outside of the screen
+      @param w, h size of the bitmap
+      @param bitmap bitmap data
+      @return nothing
+    */
+    void drawBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t *bitmap) {
+      if (w == 0 || h == 0) return;
+      if (x < 0 || y < 0 || x + w > width || y + h > height) {
+        for (uint16_t by = 0; by < h; by++) {
+          for (uint16_t bx = 0; bx < w; bx++) {
+            uint16_t bit = bx + w * by;
+            if (bitmap[bit >> 3] & (0x80 >> (bit & 7))) setPixel(x + bx, y + by);
+          }
+        }
+        return;
+      }
+      uint8_t lines[8][32];
+      if (ROTATION == 1 || ROTATION == 3) {
+        // A bitmap row is a row of the buffer, in reverse for rotation 3
+        for (uint16_t by = 0; by < h; by++) {
+          getBits(bitmap, by * w, w, lines[0]);
+          if (ROTATION == 3) reverseBits(lines[0], w);
+          uint16_t c = ROTATION == 1 ? col(x, y + by) : col(x + w - 1, y + by);
+          for (uint16_t idx = 0; idx < (w + 7) / 8; idx++) {
+            blitBits(row(x, y + by), c + idx * 8, lines[0][idx], w - idx * 8 < 8 ? w - idx * 8 : 8);
+          }
+        }
+        return;
+      }
+      // A bitmap column is a row of the buffer, in reverse for rotation 2
+      for (uint16_t by = 0; by < h; by += 8) {
+        uint8_t n = h - by < 8 ? h - by : 8;
+        for (uint8_t idx = 0; idx < 8; idx++) {
+          if (idx < n) getBits(bitmap, (by + idx) * w, w, lines[idx]);
+          else memset(lines[idx], 0, sizeof(lines[idx]));
+        }
+        for (uint16_t bx = 0; bx < w; bx += 8) {
+          uint8_t block[8];
+          transpose(lines, bx / 8, block);
+          for (uint8_t idx = 0; idx < 8 && bx + idx < w; idx++) {
+            if (block[idx] == 0) continue;
+            if (ROTATION == 0) blitBits(row(x + bx + idx, y + by), col(x + bx + idx, y + by), block[idx], n);
+            else blitBits(row(x + bx + idx, y + by), col(x + bx + idx, y + by + n - 1), reverse(block[idx]) << (8 - n), n);
+          }
+        }
+      }
+    }
+
+  private:
+    /* Column in the buffer */
+    static uint16_t col(uint16_t x, uint16_t y) {
+      return ROTATION == 0 ? y : ROTATION == 2 ? Source_Pixel - 1 - y : ROTATION == 1 ? x : Source_Pixel - 1 - x;
+    }
+
+    /* Row in the buffer */
+    static uint16_t row(uint16_t x, uint16_t y) {
+      return ROTATION == 0 ? Gate_Pixel - 1 - x : ROTATION == 2 ? x : ROTATION == 1 ? y : Gate_Pixel - 1 - y;
+    }
+
+    /* Fills the columns c0 to c1 of the rows r0 to r1 of the buffer */
+    void fillBuffer(uint16_t c0, uint16_t r0, uint16_t c1, uint16_t r1, uint8_t color) {
+      uint8_t *line = buffer + r0 * rowBytes + c0 / 8;
+      uint8_t first = 0xFF >> (c0 & 7);
+      uint8_t last = 0xFF << (7 - (c1 & 7));
+      uint16_t bytes = c1 / 8 - c0 / 8;
+      if (bytes == 0) first &= last;
+      for (uint16_t r = r0; r <= r1; r++, line += rowBytes) {
+        if (color == PIC_BLACK) {
+          line[0] &= ~first;
+          if (bytes == 0) continue;
+          memset(line + 1, PIC_BLACK, bytes - 1);
+          line[bytes] &= ~last;
+        } else {
+          line[0] |= first;
+          if (bytes == 0) continue;
+          memset(line + 1, PIC_WHITE, bytes - 1);
+          line[bytes] |= last;
+        }
+      }
+    }
+
+    /* Clears the buffer bits of the set bits, bits has n valid bits from the MSB */
+    void blitBits(uint16_t r, uint16_t c, uint8_t bits, uint8_t n) {
+      uint8_t *line = buffer + r * rowBytes + c / 8;
+      uint8_t shift = c & 7;
+      line[0] &= ~(bits >> shift);
+      if (shift + n > 8) line[1] &= ~(uint8_t)(bits << (8 - shift));
+    }
+
+    /* Copies n bits from bit position pos of the bitmap to out, MSB first, the unused bits are cleared */
+    static void getBits(const uint8_t *bitmap, uint16_t pos, uint8_t n, uint8_t *out) {
+      const uint8_t *in = bitmap + pos / 8;
+      uint8_t shift = pos & 7;
+      for (uint16_t idx = 0; idx * 8 < n; idx++) {
+        uint8_t left = n - idx * 8 < 8 ? n - idx * 8 : 8;
+        uint8_t bits = in[idx] << shift;
+        if (shift + left > 8) bits |= in[idx + 1] >> (8 - shift);
+        out[idx] = bits & (0xFF << (8 - left));
+      }
+    }
+
+    /* Reverses the order of n bits */
+    static void reverseBits(uint8_t *bits, uint8_t n) {
+      uint8_t bytes = (n + 7) / 8;
+      for (uint8_t idx = 0; idx < bytes / 2; idx++) {
+        uint8_t t = reverse(bits[idx]);
+        bits[idx] = reverse(bits[bytes - 1 - idx]);
+        bits[bytes - 1 - idx] = t;
+      }
+      if (bytes & 1) bits[bytes / 2] = reverse(bits[bytes / 2]);
+      // Move the padding from the front to the end
+      uint8_t shift = bytes * 8 - n;
+      if (shift == 0) return;
+      for (uint8_t idx = 0; idx < bytes; idx++) {
+        bits[idx] = (bits[idx] << shift) | (idx + 1 < bytes ? bits[idx + 1] >> (8 - shift) : 0);
+      }
+    }
+
+    /* Reverses the bits of a byte */
+    static uint8_t reverse(uint8_t b) {
+      b = (b >> 4) | (b << 4);
+      b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
+      return ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
+    }
+
+    /* Transposes the 8 x 8 bits of byte idx of 8 lines, out[i] are the bits of column i, MSB from the first line */
+    static void transpose(const uint8_t lines[8][32], uint8_t idx, uint8_t *out) {
+      uint32_t x = ((uint32_t)lines[0][idx] << 24) | ((uint32_t)lines[1][idx] << 16) | ((uint32_t)lines[2][idx] << 8) | lines[3][idx];
+      uint32_t y = ((uint32_t)lines[4][idx] << 24) | ((uint32_t)lines[5][idx] << 16) | ((uint32_t)lines[6][idx] << 8) | lines[7][idx];
+      uint32_t t;
+      t = (x ^ (x >> 7)) & 0x00AA00AA; x = x ^ t ^ (t << 7);
+      t = (y ^ (y >> 7)) & 0x00AA00AA; y = y ^ t ^ (t << 7);
+      t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+      t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+      t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+      y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+      x = t;
+      out[0] = x >> 24; out[1] = x >> 16; out[2] = x >> 8; out[3] = x;
+      out[4] = y >> 24; out[5] = y >> 16; out[6] = y >> 8; out[7] = y;
+    }
+
+    uint8_t *buffer;
+};
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ * @file bench_images.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Unpacked size and FNV-1a hash of the EPD images
+ *        Written by assets/epd_images.py from the PBM files in assets/epd, do not edit
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "RAK14000_image.h"
+
+/** Reference values of an image */
+struct bench_image_s
+{
+	const epd_image_t *image;
+	const char *name;
+	uint16_t bytes;
+	uint32_t hash;
+};
+
+static const bench_image_s bench_images[] = {
+	{&good_air, "good_air", 7688, 0xE9C2C1C8},
+	{&bad_air, "bad_air", 7688, 0x458A4E71},
+	{&worried_air, "worried_air", 7688, 0x4766F28E},
+	{&rak_img, "rak_img", 1288, 0x5B94D850},
+	{&celsius_img, "celsius_img", 128, 0xD9554B4C},
+	{&humidity_img, "humidity_img", 128, 0xA012FD4B},
+	{&co2_img, "co2_img", 128, 0xA099E127},
+	{&barometer_img, "barometer_img", 128, 0x8B204858},
+	{&voc_img, "voc_img", 128, 0xA85BA310},
+	{&pm_img, "pm_img", 128, 0xBE1F62BA},
+	{&built_img, "built_img", 1056, 0x0972C868},
+	{&wisblock_img, "wisblock_img", 1152, 0xF2AFEA1B},
+};
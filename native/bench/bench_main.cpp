@@ -0,0 +1,1392 @@
+/**
+ * @file bench_main.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host benchmark of the sensor cycle
+ *        Drives app_event_handler() from STATUS to SEND_NOW on the simulated
+ *        HAL and reports host wall time, simulated awake time and payload size.
+ *        Checks the I2C transaction queue against the simulated bus
+ *        and the hourly and daily rollups of the sensor history.
+ *        Checks that a warm boot waits only for the devices in the saved bus map.
+ *        Restores the sensor history from a compacted log with a damaged end.
+ *        Sends one more cycle with the compact payload, decodes it and
+ *        compares size and values with the Cayenne LPP packet.
+ *        Collects 4 samples per uplink and compares the airtime with single uplinks.
+ *        Compares the streamed +EVT:RX output with the sprintf version.
+ *        Refreshes only the changed widgets of the 4.2" EPD.
+ *        Scrolls the VOC graph in all rotations and compares it with a complete redraw.
+ *        Compares the precalculated text bounds of the EPD fonts with getTextBounds().
+ *        Unpacks the compressed EPD images and compares them with the PBM files.
+ *        Sends a frame and a partial refresh to the 3.52" EPD over the SPI transport.
+ *        Compares the 3.52" EPD framebuffer views with pixel by pixel drawing.
+ *        Compares the 3.52" EPD glyph and bitmap blitter with pixel by pixel drawing.
+ *        Looks up every codepoint in the 3.52" EPD Chinese font and draws a status screen.
+ *        Build and run with
+ *        pio run -e native -t exec
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <chrono>
+#include "app.h"
+#include <Adafruit_EPD.h>
+#include "RAK14000_epd.h"
+#include "bench_images.h"
+#include <InternalFileSystem.h>
+
+/** SE0352NQ01 checks, in their own file because of the driver's GFXfont types */
+bool check_se0352_spi(void);
+bool check_se0352_view(void);
+bool check_se0352_blit(void);
+bool check_se0352_cjk(void);
+
+/** Number of measured send cycles per scenario */
+#define BENCH_CYCLES 5
+
+/** Upper limit for one cycle in simulated time */
+#define BENCH_CYCLE_TIMEOUT_MS 120000
+
+/**
+ * @brief Simulated sensor setup
+ *
+ */
+struct bench_device_s
+{
+	uint8_t addr;
+	int16_t power_pin;
+	uint32_t wake_ms;
+};
+
+struct bench_scenario_s
+{
+	const char *name;
+	const bench_device_s *devices;
+	uint8_t num_devices;
+};
+
+/** All sensors of the air quality setup, PMSA003I needs ~2.5s after power up */
+static const bench_device_s full_setup[] = {
+	{0x70, -1, 0},		   // RAK1901
+	{0x5c, -1, 0},		   // RAK1902
+	{0x52, -1, 0},		   // RAK12002
+	{0x59, -1, 0},		   // RAK12047
+	{0x61, -1, 0},		   // RAK12037
+	{0x12, WB_IO6, 2500}, // RAK12039
+};
+
+/** Temperature, humidity and VOC only */
+static const bench_device_s th_voc_setup[] = {
+	{0x70, -1, 0}, // RAK1901
+	{0x59, -1, 0}, // RAK12047
+};
+
+/** Environment sensor with OLED */
+static const bench_device_s env_oled_setup[] = {
+	{0x76, -1, 0}, // RAK1906
+	{0x3C, -1, 0}, // RAK1921
+	{0x52, -1, 0}, // RAK12002
+};
+
+static const bench_scenario_s scenarios[] = {
+	{"full", full_setup, sizeof(full_setup) / sizeof(bench_device_s)},
+	{"th_voc", th_voc_setup, sizeof(th_voc_setup) / sizeof(bench_device_s)},
+	{"env_oled", env_oled_setup, sizeof(env_oled_setup) / sizeof(bench_device_s)},
+};
+
+/** PMSA003I data frame returned by the simulated sensor */
+static uint8_t pm_frame[32];
+
+/**
+ * @brief Build a valid PMSA003I frame with fixed values
+ *
+ */
+static void build_pm_frame(void)
+{
+	static const uint16_t values[13] = {4, 7, 9, 4, 7, 9, 600, 180, 40, 6, 2, 1, 0};
+	pm_frame[0] = 0x42;
+	pm_frame[1] = 0x4D;
+	pm_frame[2] = 0;
+	pm_frame[3] = 28;
+	for (uint8_t idx = 0; idx < 13; idx++)
+	{
+		pm_frame[4 + idx * 2] = values[idx] >> 8;
+		pm_frame[5 + idx * 2] = values[idx] & 0xFF;
+	}
+	uint16_t checksum = 0;
+	for (uint8_t idx = 0; idx < 30; idx++)
+	{
+		checksum += pm_frame[idx];
+	}
+	pm_frame[30] = checksum >> 8;
+	pm_frame[31] = checksum & 0xFF;
+}
+
+/** Completion callbacks of the transaction check */
+static uint8_t trans_callbacks = 0;
+
+/**
+ * @brief Completion callback of the transaction check
+ *
+ * @param trans finished transaction
+ */
+static void trans_done(i2c_trans_t *trans)
+{
+	(void)trans;
+	trans_callbacks++;
+}
+
+/**
+ * @brief Queue transactions on the simulated bus and check results and counters
+ *        The PMSA003I NACKs once and needs a retry, the RAK1903 is not on the bus
+ *
+ * @return true all results and counters as expected
+ * @return false mismatch
+ */
+static bool check_transactions(void)
+{
+	sim_reset();
+	sim_i2c_clear();
+	sim_i2c_add(0x70);
+	sim_i2c_add(0x12);
+	sim_i2c_set_rx(0x12, pm_frame, sizeof(pm_frame));
+	sim_i2c_nack(0x12, 1);
+	Wire = TwoWire();
+	i2c_bus_stats_clear();
+	trans_callbacks = 0;
+
+	uint8_t rx_frame[32] = {0};
+	i2c_trans_t probe_temp = {TEMP_ID, NULL, 0, NULL, 0, 0, trans_done, NULL};
+	i2c_trans_t read_pm = {PM_ID, NULL, 0, rx_frame, sizeof(rx_frame), 2, trans_done, NULL};
+	i2c_trans_t probe_light = {LIGHT_ID, NULL, 0, NULL, 0, 1, trans_done, NULL};
+
+	i2c_bus_submit(&probe_temp);
+	i2c_bus_submit(&read_pm);
+	i2c_bus_submit(&probe_light);
+	uint8_t failed = i2c_bus_run();
+
+	bool ok = (failed == 1) && (trans_callbacks == 3) && probe_temp.success && read_pm.success && !probe_light.success && (memcmp(rx_frame, pm_frame, sizeof(pm_frame)) == 0) && (i2c_stats[PM_ID].bytes == 32) && (i2c_stats[PM_ID].nacks == 1) && (i2c_stats[PM_ID].retries == 1) && (i2c_stats[LIGHT_ID].nacks == 2) && (i2c_stats[LIGHT_ID].retries == 1);
+
+	printf("I2C queue  | callbacks %d | failed %d | PM bytes %lu nacks %lu retries %lu worst %lu us | %s\n",
+		   trans_callbacks, failed, (unsigned long)i2c_stats[PM_ID].bytes, (unsigned long)i2c_stats[PM_ID].nacks,
+		   (unsigned long)i2c_stats[PM_ID].retries, (unsigned long)i2c_stats[PM_ID].max_latency, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Read a bit field from a compact packet, MSB first
+ *
+ * @param buffer compact packet
+ * @param bit_pos position of the first bit, moved behind the field
+ * @param bits size of the field
+ * @return uint16_t value
+ */
+static uint16_t read_bits(const uint8_t *buffer, uint16_t *bit_pos, uint8_t bits)
+{
+	uint16_t value = 0;
+	for (uint8_t bit = 0; bit < bits; bit++)
+	{
+		value = (value << 1) | ((buffer[*bit_pos / 8] >> (7 - *bit_pos % 8)) & 1);
+		(*bit_pos)++;
+	}
+	return value;
+}
+
+/**
+ * @brief Decode a compact packet and compare every value with the Cayenne LPP packet
+ *        it was made from. Values outside the field range must be limited to the range.
+ *
+ * @param lpp Cayenne LPP packet
+ * @param lpp_size size of the LPP packet
+ * @param compact compact packet
+ * @param compact_size size of the compact packet
+ * @return true all values match within the resolution of the schema
+ * @return false mismatch
+ */
+static bool check_compact(const uint8_t *lpp, uint8_t lpp_size, const uint8_t *compact, uint8_t compact_size)
+{
+	if ((compact_size < 1 + COMPACT_BITMAP_SIZE) || (compact[0] != COMPACT_FORMAT_ID))
+	{
+		return false;
+	}
+
+	int32_t decoded[COMPACT_BITMAP_SIZE * 8];
+	bool present[COMPACT_BITMAP_SIZE * 8] = {false};
+	uint8_t num_present = 0;
+	uint16_t bit_pos = (1 + COMPACT_BITMAP_SIZE) * 8;
+	for (uint8_t field = 0; field < compact_num_fields; field++)
+	{
+		if (compact[1 + field / 8] & (0x80 >> (field % 8)))
+		{
+			decoded[field] = read_bits(compact, &bit_pos, compact_schema[field].bits) * compact_schema[field].divisor + compact_schema[field].offset;
+			present[field] = true;
+			num_present++;
+		}
+	}
+	if ((bit_pos + 7) / 8 != compact_size)
+	{
+		return false;
+	}
+
+	uint8_t num_found = 0;
+	uint8_t pos = 0;
+	while (pos < lpp_size)
+	{
+		uint8_t channel = lpp[pos++];
+		uint8_t type = lpp[pos++];
+		uint8_t field = 0;
+		while ((field < compact_num_fields) && (compact_schema[field].lpp_channel != channel))
+		{
+			field++;
+		}
+		if ((field == compact_num_fields) || !present[field])
+		{
+			return false;
+		}
+
+		// All types in the schema have 2 bytes, except humidity
+		uint8_t size = type == LPP_RELATIVE_HUMIDITY ? 1 : 2;
+		int32_t raw = 0;
+		for (uint8_t idx = 0; idx < size; idx++)
+		{
+			raw = (raw << 8) | lpp[pos++];
+		}
+		if (((type == LPP_TEMPERATURE) || (type == LPP_ANALOG_INPUT)) && (raw & 0x8000))
+		{
+			raw -= 0x10000;
+		}
+
+		const compact_field_t &schema = compact_schema[field];
+		int32_t range_max = schema.offset + ((1L << schema.bits) - 1) * schema.divisor;
+		raw = raw < schema.offset ? schema.offset : (raw > range_max ? range_max : raw);
+		if (abs(decoded[field] - raw) > schema.divisor / 2)
+		{
+			return false;
+		}
+		num_found++;
+	}
+	return num_found == num_present;
+}
+
+/** Host wall clock */
+typedef std::chrono::steady_clock bench_clock;
+
+/**
+ * @brief Microseconds of host time since start
+ *
+ */
+static double wall_us(bench_clock::time_point start)
+{
+	return std::chrono::duration<double, std::micro>(bench_clock::now() - start).count();
+}
+
+/**
+ * @brief Feed 8 days of values every 10 minutes into a sensor history
+ *        Value is the hour of the day, so each hour has min = max = mean
+ *        and each day has min 0, max 23 and mean 11
+ *
+ * @return true rollups as expected
+ * @return false mismatch
+ */
+static bool check_history(void)
+{
+	static SensorHistory<uint16_t, num_values> history;
+	const uint32_t interval_ms = 10 * 60 * 1000;
+
+	bench_clock::time_point wall_start = bench_clock::now();
+	for (uint32_t sample = 0; sample < 8 * 24 * 6; sample++)
+	{
+		uint32_t now_ms = sample * interval_ms;
+		history.push((now_ms / 3600000) % 24, now_ms);
+	}
+	double wall = wall_us(wall_start);
+
+	bool ok = (history.count() == num_values) && (history.hours().count() == 24) && (history.days().count() == 7);
+	for (uint8_t idx = 0; ok && (idx < history.hours().count()); idx++)
+	{
+		ok = (history.hours()[idx].min == idx) && (history.hours()[idx].max == idx) && (history.hours()[idx].mean == idx);
+	}
+	for (uint8_t idx = 0; ok && (idx < history.days().count()); idx++)
+	{
+		ok = (history.days()[idx].min == 0) && (history.days()[idx].max == 23) && (history.days()[idx].mean == 11);
+	}
+
+	printf("History    | %u samples | %lu bytes RAM | push %.3f us | hours %d days %d | %s\n",
+		   8 * 24 * 6, (unsigned long)sizeof(history), wall / (8 * 24 * 6),
+		   history.hours().count(), history.days().count(), ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Write the history log until it is compacted, add more values,
+ *        damage the last record and restore the histories from the log
+ *        Counts the file opens, the values of a cycle must be written with one open
+ *
+ * @return true restored histories are the same as before
+ * @return false mismatch
+ */
+static bool check_history_log(void)
+{
+	static uint8_t co2_saved[sizeof(co2_values)];
+	static uint8_t temp_saved[sizeof(temp_values)];
+
+	InternalFS.format();
+	co2_values = decltype(co2_values)();
+	temp_values = decltype(temp_values)();
+
+	// One file access per cycle and one per compaction, not one per value
+	const uint16_t cycles = 1000;
+	uint32_t opens = sim_flash.opens;
+	for (uint16_t sample = 0; sample < cycles; sample++)
+	{
+		history_add(HIST_CO2, co2_values.to_fixed(400.0f + sample % 200));
+		history_add(HIST_TEMP, temp_values.to_fixed(20.0f + (sample % 50) / 10.0f));
+		history_log_flush();
+		history_log_compact();
+		sim_run_until_ms(sim_now_us() / 1000 + 60000);
+	}
+	uint32_t log_opens = sim_flash.opens - opens;
+	memcpy(co2_saved, (void *)&co2_values, sizeof(co2_values));
+	memcpy(temp_saved, (void *)&temp_values, sizeof(temp_values));
+
+	// Power loss while the last record was written
+	Adafruit_LittleFS_Namespace::File log_file(InternalFS);
+	log_file.open("HIST", FILE_O_WRITE);
+	uint32_t valid_size = log_file.size();
+	const uint8_t torn[5] = {0x43, 2, 10, 0, 0x12};
+	log_file.write(torn, sizeof(torn));
+	log_file.close();
+
+	co2_values = decltype(co2_values)();
+	temp_values = decltype(temp_values)();
+	bench_clock::time_point wall_start = bench_clock::now();
+	history_log_restore();
+	double wall = wall_us(wall_start);
+
+	log_file.open("HIST", FILE_O_READ);
+	uint32_t restored_size = log_file.size();
+	log_file.close();
+
+	bool ok = (log_opens < 2 * cycles) && (valid_size <= 8192 + 2 * 1024) && (restored_size == valid_size) &&
+			  (memcmp(co2_saved, (void *)&co2_values, sizeof(co2_values)) == 0) &&
+			  (memcmp(temp_saved, (void *)&temp_values, sizeof(temp_values)) == 0);
+
+	printf("Hist log   | %u cycles 2 values | %lu file opens | log %lu bytes | restore %.1f us | CO2 %d values latest %.0f | %s\n",
+		   cycles, (unsigned long)log_opens, (unsigned long)restored_size, wall, co2_values.count(), co2_values.latest(), ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Run one STATUS -> SEND_NOW cycle
+ *        With batched uplinks the cycle ends when the sample is added to the batch
+ *
+ * @param awake_ms simulated time spent inside app_event_handler()
+ * @param cycle_ms simulated time from wake up until the packet was handed to the LoRa stack
+ * @param wall host time spent inside app_event_handler()
+ * @return true packet was sent
+ * @return false timeout
+ */
+static bool run_cycle(uint64_t *awake_ms, uint64_t *cycle_ms, double *wall)
+{
+	uint32_t packets = sim_lora.packets;
+	uint32_t failed = sim_lora.failed;
+	uint8_t batched = batch_count();
+	uint16_t skipped = report_skipped();
+	uint64_t start_us = sim_now_us();
+	uint64_t awake_us = 0;
+	*wall = 0;
+
+	api_wake_loop(STATUS);
+
+	// A cycle ends with a sent or failed packet, a sample added to the batch or a skipped sample
+	while ((sim_lora.packets == packets) && (sim_lora.failed == failed) && (batch_count() == batched) && (report_skipped() == skipped))
+	{
+		if (g_task_event_type != NO_EVENT)
+		{
+			uint64_t handler_start = sim_now_us();
+			bench_clock::time_point wall_start = bench_clock::now();
+			app_event_handler();
+			*wall += wall_us(wall_start);
+			awake_us += sim_now_us() - handler_start;
+			continue;
+		}
+
+		// Sleep until the next timer expires
+		uint64_t next_ms;
+		if (!sim_next_timer_ms(&next_ms) || ((sim_now_us() - start_us) / 1000 > BENCH_CYCLE_TIMEOUT_MS))
+		{
+			return false;
+		}
+		sim_run_until_ms(next_ms);
+	}
+
+	*awake_ms = awake_us / 1000;
+	*cycle_ms = (sim_now_us() - start_us) / 1000;
+	return true;
+}
+
+/**
+ * @brief Setup the simulated hardware and run the application init
+ *        The flash content is kept, format InternalFS before for a cold boot
+ *
+ * @param scenario sensor setup
+ * @return uint64_t simulated boot time in ms
+ */
+static uint64_t boot(const bench_scenario_s *scenario)
+{
+	sim_reset();
+	sim_i2c_clear();
+	for (uint8_t idx = 0; idx < scenario->num_devices; idx++)
+	{
+		sim_i2c_add(scenario->devices[idx].addr, scenario->devices[idx].power_pin, scenario->devices[idx].wake_ms);
+	}
+	sim_i2c_set_rx(0x12, pm_frame, sizeof(pm_frame));
+	for (uint8_t idx = 0; idx < NUM_SENSOR_ENTRIES; idx++)
+	{
+		found_sensors[idx].found_sensor = false;
+	}
+	g_task_event_type = NO_EVENT;
+	g_lorawan_settings.lorawan_enable = true;
+	Wire = TwoWire();
+
+	setup_app();
+	init_app();
+	return sim_now_us() / 1000;
+}
+
+/** Temperature and VOC with the RAK12039 added */
+static const bench_device_s th_voc_pm_setup[] = {
+	{0x70, -1, 0},		   // RAK1901
+	{0x59, -1, 0},		   // RAK12047
+	{0x12, WB_IO6, 2500}, // RAK12039
+};
+
+/**
+ * @brief Boot with the bus map of the temperature and VOC setup, then add the RAK12039
+ *        The warm boot must not wait for the RAK12039 that is not in the saved bus map,
+ *        it is found only after the bus map was deleted with AT+RESCAN.
+ *
+ * @return true warm boot skipped the wait and AT+RESCAN found the RAK12039
+ * @return false warm boot waited or the RAK12039 was missed
+ */
+static bool check_bus_map(void)
+{
+	const bench_scenario_s added = {"th_voc_pm", th_voc_pm_setup, sizeof(th_voc_pm_setup) / sizeof(bench_device_s)};
+	InternalFS.format();
+	uint64_t cold_ms = boot(&scenarios[1]);
+	uint64_t warm_ms = boot(&scenarios[1]);
+	uint64_t added_ms = boot(&added);
+	bool skipped = !found_sensors[PM_ID].found_sensor;
+	clear_bus_map();
+	uint64_t rescan_ms = boot(&added);
+	bool ok = (warm_ms < cold_ms / 2) && (added_ms < cold_ms / 2) && skipped && found_sensors[PM_ID].found_sensor;
+	printf("Bus map    | cold %llu ms | warm %llu ms | RAK12039 added %llu ms | after AT+RESCAN %llu ms | %s\n",
+		   (unsigned long long)cold_ms, (unsigned long long)warm_ms, (unsigned long long)added_ms,
+		   (unsigned long long)rescan_ms, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief LoRa time on air, SF9 125 kHz, CR 4/5, 8 symbols preamble, explicit header and CRC
+ *
+ * @param size application payload size, 13 bytes LoRaWAN header and MIC are added
+ * @return double time on air in ms
+ */
+static double airtime_ms(uint8_t size)
+{
+	const int sf = 9;
+	double symbol_ms = (1 << sf) / 125.0;
+	int payload_bits = 8 * (size + 13) - 4 * sf + 28 + 16;
+	int payload_symbols = 8 + (payload_bits > 0 ? (payload_bits + 4 * sf - 1) / (4 * sf) * 5 : 0);
+	return (8 + 4.25 + payload_symbols) * symbol_ms;
+}
+
+/**
+ * @brief Collect 4 samples per uplink with the full sensor setup
+ *        Checks the frame header, the number of records, the time between
+ *        the records and that each record has the size of a single uplink
+ *        A frame that is not sent because the LoRa stack is busy
+ *        must be sent with the next sample
+ *
+ * @return true frame as expected
+ * @return false mismatch
+ */
+static bool check_batch(void)
+{
+	const uint8_t samples = 4;
+	uint64_t awake_ms, cycle_ms;
+	double wall;
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+	g_payload_format = PAYLOAD_COMPACT;
+
+	// Single uplink for the reference size
+	bool ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+	uint8_t single_size = sim_lora.last_size;
+	sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+
+	g_batch_samples = samples;
+	uint32_t packets = sim_lora.packets;
+	for (uint8_t sample = 0; ok && (sample < samples); sample++)
+	{
+		ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+		sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+	}
+
+	const uint8_t *frame = sim_lora.last_packet;
+	uint8_t frame_size = sim_lora.last_size;
+	ok = ok && (sim_lora.packets == packets + 1) && (frame[0] == BATCH_FORMAT_ID) && (frame[1] == 0x01) && (frame[2] == samples) && (batch_count() == 0);
+
+	uint8_t pos = 7;
+	for (uint8_t record = 0; ok && (record < samples); record++)
+	{
+		uint16_t delta = (frame[pos] << 8) | frame[pos + 1];
+		uint16_t expected = record == 0 ? 0 : g_lorawan_settings.send_repeat_time / 1000;
+		ok = (abs(delta - expected) <= 1) && (frame[pos + 2] == single_size) && (frame[pos + 3] == COMPACT_FORMAT_ID);
+		pos += 3 + frame[pos + 2];
+	}
+	ok = ok && (pos == frame_size);
+
+	// The LoRa stack is busy when the frame is complete, the frame is kept and sent with the next sample
+	for (uint8_t sample = 0; ok && (sample <= samples); sample++)
+	{
+		sim_lora.force_result = sample == samples - 1 ? LMH_BUSY : LMH_SUCCESS;
+		ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+		ok = ok && (sample != samples - 1 || batch_count() == samples);
+		sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+	}
+	sim_lora.force_result = LMH_SUCCESS;
+	bool kept = ok && (sim_lora.last_packet[2] == samples + 1) && (batch_count() == 0);
+	ok = ok && kept;
+	g_batch_samples = 1;
+	g_payload_format = PAYLOAD_LPP;
+
+	printf("Batch      | %d samples | single %d x %d B %.1f ms | batch %d B %.1f ms SF9 | kept after busy %s | %s\n", samples,
+		   samples, single_size, samples * airtime_ms(single_size), frame_size, airtime_ms(frame_size), kept ? "yes" : "no", ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Get the channels of a Cayenne LPP packet
+ *
+ * @param lpp Cayenne LPP packet
+ * @param size size of the packet
+ * @return uint64_t bit mask of the channels
+ */
+static uint64_t lpp_channels(const uint8_t *lpp, uint8_t size)
+{
+	uint64_t channels = 0;
+	uint8_t pos = 0;
+	while (pos + 2 <= size)
+	{
+		bool is_signed;
+		uint8_t data_size = lpp_type_size(lpp[pos + 1], &is_signed);
+		if (data_size == 0)
+		{
+			break;
+		}
+		channels |= 1ULL << (lpp[pos] % PLAN_NUM_CHANNELS);
+		pos += 2 + data_size;
+	}
+	return channels;
+}
+
+/**
+ * @brief Send the full sensor setup with the 11 bytes payload limit of the slowest US915 data rate
+ *        Checks that no uplink is too large, that the first uplink has the channel
+ *        with the highest priority and that the other channels follow in the next uplinks
+ *        The first planned uplink fails because the LoRa stack is busy, the planned values
+ *        must be planned again with the next sample
+ *
+ * @return true all values were sent by priority
+ * @return false mismatch
+ */
+static bool check_planner(void)
+{
+	const uint8_t max_payload = 11;
+	const uint8_t max_uplinks = 8;
+	uint64_t awake_ms, cycle_ms;
+	double wall;
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+
+	// Reference uplink with all channels
+	bool ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+	uint8_t full_size = sim_lora.last_size;
+	uint64_t all_channels = lpp_channels(sim_lora.last_packet, sim_lora.last_size);
+	sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+
+	sim_lora.max_payload = max_payload;
+	sim_lora.force_result = LMH_BUSY;
+	uint32_t failed = sim_lora.failed;
+	ok = ok && run_cycle(&awake_ms, &cycle_ms, &wall) && (sim_lora.failed == failed + 1);
+	sim_lora.force_result = LMH_SUCCESS;
+	sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+
+	uint64_t sent_channels = 0;
+	uint8_t uplinks = 0;
+	uint32_t packets = sim_lora.packets;
+	while (ok && (sent_channels != all_channels) && (uplinks < max_uplinks))
+	{
+		ok = run_cycle(&awake_ms, &cycle_ms, &wall) && (sim_lora.packets == packets + uplinks + 1) && (sim_lora.last_size <= max_payload);
+		uint64_t channels = lpp_channels(sim_lora.last_packet, sim_lora.last_size);
+		if (uplinks == 0)
+		{
+			// The channel with the highest priority must be in the first uplink
+			uint8_t highest_sent = 0;
+			uint8_t highest = 0;
+			for (uint8_t channel = 0; channel < PLAN_NUM_CHANNELS; channel++)
+			{
+				if (channels & (1ULL << channel))
+				{
+					highest_sent = max(highest_sent, g_channel_priority[channel]);
+				}
+				if (all_channels & (1ULL << channel))
+				{
+					highest = max(highest, g_channel_priority[channel]);
+				}
+			}
+			ok = ok && (highest_sent == highest);
+		}
+		sent_channels |= channels;
+		uplinks++;
+		sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+	}
+	sim_lora.max_payload = 222;
+	ok = ok && (sent_channels == all_channels);
+
+	printf("Planner    | %d B sample | max %d B | first uplink busy | all channels sent after %d uplinks | %s\n",
+		   full_size, max_payload, uplinks, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Run send cycles and count the uplinks
+ *
+ * @param cycles number of send cycles
+ * @param uplinks set to the number of uplinks
+ * @param max_gap_ms set to the longest time between two uplinks
+ * @return true all cycles finished
+ * @return false timeout
+ */
+static bool report_cycles(uint8_t cycles, uint32_t *uplinks, uint64_t *max_gap_ms)
+{
+	uint64_t awake_ms, cycle_ms;
+	double wall;
+	uint32_t packets = sim_lora.packets;
+	uint64_t last_uplink_ms = 0;
+	*max_gap_ms = 0;
+
+	for (uint8_t cycle = 0; cycle < cycles; cycle++)
+	{
+		uint32_t before = sim_lora.packets;
+		if (!run_cycle(&awake_ms, &cycle_ms, &wall))
+		{
+			return false;
+		}
+		if (sim_lora.packets != before)
+		{
+			uint64_t now_ms = sim_now_us() / 1000;
+			*max_gap_ms = (last_uplink_ms == 0) ? 0 : max(*max_gap_ms, now_ms - last_uplink_ms);
+			last_uplink_ms = now_ms;
+		}
+		sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+	}
+	*uplinks = sim_lora.packets - packets;
+	return true;
+}
+
+/**
+ * @brief Run send cycles with the full sensor setup and a 30 minutes heartbeat
+ *        The simulated CO2 value rises by 4 ppm per minute, with the default delta of 50 ppm
+ *        it has to trigger uplinks before the heartbeat. Without CO2 delta only the heartbeat
+ *        sends uplinks.
+ *        Checks that fewer uplinks are sent, that the CO2 changes are reported
+ *        and that the time between two uplinks never exceeds the heartbeat
+ *        A heartbeat that could not be sent because the LoRa stack was busy
+ *        must be sent in the next cycle
+ *
+ * @return true reporting as expected
+ * @return false mismatch
+ */
+static bool check_report(void)
+{
+	const uint8_t cycles = 121;
+	const uint32_t heartbeat = 1800;
+	const uint64_t max_gap_ms = heartbeat * 1000 + g_lorawan_settings.send_repeat_time / 2;
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+	g_report_heartbeat = heartbeat;
+
+	// Default deltas, the CO2 changes trigger uplinks
+	uint32_t change_uplinks;
+	uint64_t change_gap_ms;
+	bool ok = report_cycles(cycles, &change_uplinks, &change_gap_ms);
+	ok = ok && (change_uplinks > 2 * cycles / (heartbeat / 60)) && (change_uplinks < cycles / 4) && (change_gap_ms <= heartbeat * 1000);
+
+	// CO2 does not trigger uplinks, only the heartbeat is left
+	g_report_delta[LPP_CHANNEL_CO2_2] = 0;
+	uint32_t heartbeat_uplinks;
+	uint64_t heartbeat_gap_ms;
+	ok = ok && report_cycles(cycles, &heartbeat_uplinks, &heartbeat_gap_ms);
+	ok = ok && (heartbeat_uplinks <= cycles / (heartbeat / 60) + 1) && (heartbeat_gap_ms <= max_gap_ms);
+
+	// The LoRa stack is busy when the heartbeat is due, the next cycle has to send it
+	uint32_t busy_uplinks;
+	uint64_t busy_gap_ms;
+	sim_lora.force_result = LMH_BUSY;
+	uint32_t failed = sim_lora.failed;
+	ok = ok && report_cycles(heartbeat / 60 + 1, &busy_uplinks, &busy_gap_ms) && (sim_lora.failed != failed);
+	sim_lora.force_result = LMH_SUCCESS;
+	ok = ok && report_cycles(1, &busy_uplinks, &busy_gap_ms) && (busy_uplinks == 1);
+	report_default_deltas();
+	g_report_heartbeat = 0;
+
+	printf("Report     | %d samples | heartbeat %lu s | with CO2 delta %lu uplinks | heartbeat only %lu uplinks max gap %llu s | resent after busy %s | %s\n",
+		   cycles, (unsigned long)heartbeat, (unsigned long)change_uplinks, (unsigned long)heartbeat_uplinks,
+		   (unsigned long long)(heartbeat_gap_ms / 1000), busy_uplinks == 1 ? "yes" : "no", ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Send the full sensor setup over LoRa P2P, with the DevEUI and with a short address
+ *        Checks the header, that the Cayenne LPP packet is sent from the buffer of
+ *        g_solution_data without a copy and that the compact payload is framed as well
+ *
+ * @return true frames as expected
+ * @return false mismatch
+ */
+static bool check_p2p(void)
+{
+	const uint16_t short_addr = 0x1234;
+	uint64_t awake_ms, cycle_ms;
+	double wall;
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+	g_lorawan_settings.lorawan_enable = false;
+
+	// DevEUI header, written in front of the Cayenne LPP packet
+	bool ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+	uint8_t eui_size = sim_lora.last_size;
+	ok = ok && (memcmp(sim_lora.last_packet, g_lorawan_settings.node_device_eui, P2P_HEADER_MAX) == 0) &&
+		 (sim_lora.last_data == g_solution_data.getBuffer() - P2P_HEADER_MAX);
+	sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+
+	// Short address header
+	g_p2p_short_addr = short_addr;
+	ok = ok && run_cycle(&awake_ms, &cycle_ms, &wall);
+	uint8_t short_size = sim_lora.last_size;
+	ok = ok && (sim_lora.last_packet[0] == (short_addr >> 8)) && (sim_lora.last_packet[1] == (short_addr & 0xFF)) &&
+		 (short_size == eui_size - P2P_HEADER_MAX + P2P_SHORT_ADDR_SIZE) &&
+		 (sim_lora.last_data == g_solution_data.getBuffer() - P2P_SHORT_ADDR_SIZE);
+	sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+
+	// Compact payload is not in g_solution_data, it is copied behind the header
+	g_payload_format = PAYLOAD_COMPACT;
+	ok = ok && run_cycle(&awake_ms, &cycle_ms, &wall);
+	uint8_t compact_size = sim_lora.last_size;
+	ok = ok && (sim_lora.last_packet[0] == (short_addr >> 8)) && (sim_lora.last_packet[2] == COMPACT_FORMAT_ID);
+	g_payload_format = PAYLOAD_LPP;
+	g_p2p_short_addr = 0;
+	g_lorawan_settings.lorawan_enable = true;
+
+	printf("P2P        | DevEUI frame %d B | short address frame %d B | compact %d B | %s\n",
+		   eui_size, short_size, compact_size, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Hand a downlink to the application
+ *
+ * @param fport fPort of the downlink
+ * @param data payload
+ * @param len size of the payload
+ */
+static void downlink(uint8_t fport, const uint8_t *data, uint8_t len)
+{
+	g_last_fport = fport;
+	memcpy(g_rx_lora_data, data, len);
+	g_rx_data_len = len;
+	g_task_event_type |= LORA_DATA;
+	lora_data_handler();
+}
+
+/**
+ * @brief Configure the full sensor setup over downlinks
+ *        Checks the send interval command and its length check, a disabled CO2 sensor
+ *        and a history dump of the CO2 values
+ *
+ * @return true commands applied as expected
+ * @return false mismatch
+ */
+static bool check_downlink(void)
+{
+	uint64_t awake_ms, cycle_ms;
+	double wall;
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+	bool ok = true;
+	for (uint8_t cycle = 0; ok && (cycle < 3); cycle++)
+	{
+		ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+		sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+	}
+	uint32_t send_repeat_time = g_lorawan_settings.send_repeat_time;
+
+	// Send interval, with a wrong length and with 120 s
+	const uint8_t short_interval[] = {0xAA, 0x55, 0x00, 0x78};
+	const uint8_t interval[] = {0xAA, 0x55, 0x00, 0x00, 0x00, 0x78};
+	ok = ok && !downlink_cmd_handler(3, short_interval, sizeof(short_interval)) && (g_lorawan_settings.send_repeat_time == send_repeat_time);
+	downlink(3, interval, sizeof(interval));
+	ok = ok && (g_lorawan_settings.send_repeat_time == 120000);
+	g_lorawan_settings.send_repeat_time = send_repeat_time;
+
+	// Disable the CO2 sensor, its value must be missing in the next uplink
+	const uint8_t co2_off[] = {0xAA, 0x5A, CO2_ID, 0x00};
+	const uint8_t co2_on[] = {0xAA, 0x5A, CO2_ID, 0x01};
+	downlink(3, co2_off, sizeof(co2_off));
+	ok = ok && run_cycle(&awake_ms, &cycle_ms, &wall);
+	bool co2_missing = (lpp_channels(sim_lora.last_packet, sim_lora.last_size) & (1ULL << LPP_CHANNEL_CO2_2)) == 0;
+	downlink(3, co2_on, sizeof(co2_on));
+	ok = ok && co2_missing && (g_sensors_disabled == 0);
+
+	// History dump of the CO2 values, sent after the RX windows
+	const uint8_t dump[] = {0xAA, 0x5B, HIST_CO2, HISTORY_RAW};
+	uint32_t packets = sim_lora.packets;
+	downlink(3, dump, sizeof(dump));
+	sim_run_until_ms(sim_now_us() / 1000 + HIST_DUMP_DELAY_MS);
+	app_event_handler();
+	const uint8_t *frame = sim_lora.last_packet;
+	uint8_t count = frame[5];
+	int16_t scale = (frame[3] << 8) | frame[4];
+	int16_t latest = (frame[6 + 2 * (count - 1)] << 8) | frame[7 + 2 * (count - 1)];
+	ok = ok && (sim_lora.packets == packets + 1) && (sim_lora.last_fport == HIST_DUMP_PORT) && (frame[0] == HIST_DUMP_FORMAT_ID) &&
+		 (frame[1] == HIST_CO2) && (count == co2_values.count()) && (sim_lora.last_size == 6 + 2 * count) &&
+		 (fabsf((float)latest / scale - co2_values.latest()) < 1.0f);
+	uint8_t dump_port = sim_lora.last_fport;
+
+	// Less payload than the header is not even tried, with the header only an empty dump is sent
+	const uint8_t dump_header = 6;
+	uint8_t max_payload = sim_lora.max_payload;
+	bool small_ok = true;
+	for (uint8_t payload = dump_header - 1; payload <= dump_header; payload++)
+	{
+		sim_lora.max_payload = payload;
+		packets = sim_lora.packets;
+		uint32_t failed = sim_lora.failed;
+		downlink(3, dump, sizeof(dump));
+		sim_run_until_ms(sim_now_us() / 1000 + HIST_DUMP_DELAY_MS);
+		app_event_handler();
+		small_ok = small_ok && (payload < dump_header ? (sim_lora.packets == packets) && (sim_lora.failed == failed)
+													  : (sim_lora.packets == packets + 1) && (sim_lora.last_size == dump_header) && (frame[5] == 0));
+	}
+	sim_lora.max_payload = max_payload;
+	ok = ok && small_ok;
+
+	printf("Downlink   | interval and length check | CO2 disabled %s | dump %d values on fPort %d | small payload %s | %s\n",
+		   co2_missing ? "yes" : "no", count, dump_port, small_ok ? "OK" : "FAIL", ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/** Send cycles for the check of the widget refresh */
+#define EPD_CYCLES (2 * (EPD_PARTIAL_MAX + 1))
+
+/**
+ * @brief Refresh the scientific UI of the 4.2" EPD after every send cycle
+ *        Only changed widgets may be refreshed, after EPD_PARTIAL_MAX partial refreshes
+ *        a full refresh is needed and the frame buffer must match a complete redraw.
+ *        A refresh without new values must not touch the display.
+ *
+ * @return true refreshes and frame buffer as expected
+ * @return false mismatch
+ */
+static bool check_epd_widgets(void)
+{
+	uint64_t awake_ms, cycle_ms;
+	double wall;
+	static uint8_t shown[400 * 300 / 8];
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+	init_rak14000();
+	g_ui_selected = 0;
+	g_graph_range = HISTORY_RAW;
+	invalidate_widgets_rak14000();
+	refresh_rak14000();
+
+	sim_epd_s start = sim_epd;
+	bool ok = true;
+	bool buffer_ok = true;
+	for (uint8_t cycle = 0; ok && (cycle < EPD_CYCLES); cycle++)
+	{
+		ok = run_cycle(&awake_ms, &cycle_ms, &wall);
+		sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+		refresh_rak14000();
+
+		// Compare with a complete redraw
+		memcpy(shown, display.getBuffer(), sizeof(shown));
+		clear_rak14000();
+		scientific_rak14000();
+		buffer_ok = buffer_ok && (memcmp(shown, display.getBuffer(), sizeof(shown)) == 0);
+		memcpy(display.getBuffer(), shown, sizeof(shown));
+	}
+	uint32_t full = sim_epd.full_refreshes - start.full_refreshes;
+	uint32_t partial = sim_epd.partial_refreshes - start.partial_refreshes;
+	uint64_t busy_ms = sim_epd.busy_ms - start.busy_ms;
+
+	// Nothing changed, the header shows the minute
+	sim_run_until_ms((sim_now_us() / 60000000 + 1) * 60000 + 1000);
+	refresh_rak14000();
+	uint32_t refreshes = sim_epd.full_refreshes + sim_epd.partial_refreshes;
+	refresh_rak14000();
+	bool idle_ok = (sim_epd.full_refreshes + sim_epd.partial_refreshes) == refreshes;
+
+	ok = ok && buffer_ok && idle_ok && (full == EPD_CYCLES / (EPD_PARTIAL_MAX + 1)) && (partial == EPD_CYCLES - full);
+	printf("EPD widget | %d refreshes, %lu full %lu partial | busy %llu ms, %lu ms with full refreshes | buffer %s | %s\n",
+		   EPD_CYCLES, (unsigned long)full, (unsigned long)partial, (unsigned long long)busy_ms,
+		   (unsigned long)(EPD_CYCLES * SIM_EPD_FULL_REFRESH_MS), buffer_ok ? "matches" : "differs", ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/** Values per rotation for the graph check, more than the graph can show */
+#define GRAPH_SAMPLES (num_values + 20)
+
+/**
+ * @brief Add VOC values one by one and scroll the VOC graph
+ *        The frame buffer must match a complete redraw after every refresh,
+ *        in all 4 rotations. Compares the time of a scroll with a complete
+ *        redraw of the graph.
+ *
+ * @return true every value was scrolled in and the frame buffer matches
+ * @return false mismatch
+ */
+static bool check_epd_graph(void)
+{
+	static uint8_t shown[400 * 300 / 8];
+
+	InternalFS.format();
+	boot(&scenarios[0]);
+	init_rak14000();
+	g_ui_selected = 0;
+	g_graph_range = HISTORY_RAW;
+	// Without RTC the header does not change between refresh and redraw
+	found_sensors[RTC_ID].found_sensor = false;
+
+	// The VOC graph is the first widget that can scroll
+	epd_widget_t *graph = scientific_widgets;
+	while (graph->scroll == nullptr)
+	{
+		graph++;
+	}
+
+	bool ok = true;
+	uint8_t rotation = display.getRotation();
+	for (uint8_t rot = 0; rot < 4; rot++)
+	{
+		display.setRotation(rot);
+		voc_values.clear();
+		invalidate_widgets_rak14000();
+		refresh_rak14000();
+
+		uint16_t scrolled = 0;
+		bool buffer_ok = true;
+		double scroll_wall = 0;
+		double redraw_wall = 0;
+		for (uint16_t sample = 0; sample < GRAPH_SAMPLES; sample++)
+		{
+			voc_values.push((uint16_t)(20 + (sample * 37) % 450));
+
+			epd_box_t changed;
+			bench_clock::time_point wall_start = bench_clock::now();
+			scrolled += graph->scroll(&changed) ? 1 : 0;
+			scroll_wall += wall_us(wall_start);
+			refresh_rak14000();
+			memcpy(shown, display.getBuffer(), sizeof(shown));
+
+			wall_start = bench_clock::now();
+			graph->draw();
+			redraw_wall += wall_us(wall_start);
+
+			// Compare with a complete redraw
+			clear_rak14000();
+			scientific_rak14000();
+			buffer_ok = buffer_ok && (memcmp(shown, display.getBuffer(), sizeof(shown)) == 0);
+			memcpy(display.getBuffer(), shown, sizeof(shown));
+		}
+		bool rot_ok = buffer_ok && (scrolled == GRAPH_SAMPLES);
+		printf("EPD graph  | rotation %d | %d values, %d scrolled | scroll %6.2f us | redraw %6.2f us | buffer %s | %s\n",
+			   rot, GRAPH_SAMPLES, scrolled, scroll_wall / GRAPH_SAMPLES, redraw_wall / GRAPH_SAMPLES,
+			   buffer_ok ? "matches" : "differs", rot_ok ? "OK" : "FAIL");
+		ok = ok && rot_ok;
+	}
+	display.setRotation(rotation);
+	found_sensors[RTC_ID].found_sensor = true;
+	return ok;
+}
+
+/** Number of measurements per timing of the text bounds */
+#define TEXT_BOUNDS_RUNS 2000
+
+/**
+ * @brief Compare two text bounds
+ *
+ */
+static bool same_bounds(text_bounds_t a, int16_t x1, int16_t y1, uint16_t w, uint16_t h)
+{
+	return (a.x1 == x1) && (a.y1 == y1) && (a.w == w) && (a.h == h);
+}
+
+/**
+ * @brief Measure texts with the precalculated glyph metrics
+ *        The compile time and the runtime text bounds must match
+ *        getTextBounds() of Adafruit GFX for every character and a set of
+ *        UI texts in both fonts. Compares the time of both runtime versions.
+ *
+ * @return true all text bounds match
+ * @return false mismatch
+ */
+static bool check_text_bounds(void)
+{
+	static const char *texts[] = {"", "ppm", "~C", "%RH", "mBar", "IoT Made Easy", "RAK10702 Air Quality",
+								  "Wait for connect", "Restart", "!!  1523", "1013.2 ", "23.45", "\x7Fg/m\x80",
+								  "RAK10702 Indoor Comfort Oct 16 2026 12:34 Batt: 4.12 V"};
+	const GFXfont *fonts[] = {SMALL_FONT, LARGE_FONT};
+
+	// Calculated by the compiler
+	constexpr text_bounds_t ppm = small_text_bounds("ppm");
+	constexpr text_bounds_t title = large_text_bounds("RAK10702 Air Quality");
+	static_assert(ppm.w > 0 && title.w > ppm.w, "text bounds are not calculated at compile time");
+
+	init_rak14000();
+	display.setRotation(0);
+	display.setTextSize(1);
+	display.setTextWrap(false);
+
+	bool ok = true;
+	uint16_t checked = 0;
+	char single[2] = {0, 0};
+	int16_t x1, y1;
+	uint16_t w, h;
+	for (uint8_t font = 0; font < 2; font++)
+	{
+		display.setFont(fonts[font]);
+		for (uint16_t c = RAK_EPD_FONT_FIRST; c <= RAK_EPD_FONT_LAST; c++)
+		{
+			single[0] = (char)c;
+			display.getTextBounds(single, 0, 0, &x1, &y1, &w, &h);
+			ok = ok && same_bounds(text_bounds_rak14000(fonts[font], single), x1, y1, w, h);
+			checked++;
+		}
+		for (uint8_t idx = 0; idx < sizeof(texts) / sizeof(texts[0]); idx++)
+		{
+			display.getTextBounds(texts[idx], 0, 0, &x1, &y1, &w, &h);
+			ok = ok && same_bounds(text_bounds_rak14000(fonts[font], texts[idx]), x1, y1, w, h);
+			checked++;
+		}
+	}
+	display.setFont(SMALL_FONT);
+	display.getTextBounds("ppm", 0, 0, &x1, &y1, &w, &h);
+	ok = ok && same_bounds(ppm, x1, y1, w, h);
+	display.setFont(LARGE_FONT);
+	display.getTextBounds("RAK10702 Air Quality", 0, 0, &x1, &y1, &w, &h);
+	ok = ok && same_bounds(title, x1, y1, w, h);
+
+	const char *header = texts[sizeof(texts) / sizeof(texts[0]) - 1];
+	volatile uint32_t sink = 0;
+	bench_clock::time_point wall_start = bench_clock::now();
+	for (uint16_t run = 0; run < TEXT_BOUNDS_RUNS; run++)
+	{
+		display.setFont(SMALL_FONT);
+		display.setTextSize(1);
+		display.getTextBounds(header, 0, 0, &x1, &y1, &w, &h);
+		sink = sink + w;
+	}
+	double gfx_wall = wall_us(wall_start) / TEXT_BOUNDS_RUNS;
+	wall_start = bench_clock::now();
+	for (uint16_t run = 0; run < TEXT_BOUNDS_RUNS; run++)
+	{
+		sink = sink + text_bounds_rak14000(SMALL_FONT, header).w;
+	}
+	double table_wall = wall_us(wall_start) / TEXT_BOUNDS_RUNS;
+
+	printf("Text bounds | %d texts | getTextBounds %6.3f us | glyph table %6.3f us | compile time 0 us | %s\n",
+		   checked + 2, gfx_wall, table_wall, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Unpack the compressed images and draw them
+ *        The unpacked images must match the size and hash of the PBM files
+ *        in assets/epd. draw_image_rak14000() must give the same frame buffer
+ *        as drawBitmap() with the unpacked image, also if the image is clipped.
+ *        Compares the time of both.
+ *
+ * @return true all images match
+ * @return false mismatch
+ */
+static bool check_images(void)
+{
+	static uint8_t unpacked[248 / 8 * 248];
+	static uint8_t expected[400 * 300 / 8];
+	const int16_t positions[][2] = {{3, 5}, {-7, -3}, {390, 290}};
+
+	init_rak14000();
+	uint8_t rotation = display.getRotation();
+
+	bool ok = true;
+	uint32_t packed_size = 0;
+	uint32_t unpacked_size = 0;
+	double blit_wall = 0;
+	double bitmap_wall = 0;
+	for (const bench_image_s &ref : bench_images)
+	{
+		const epd_image_t &image = *ref.image;
+		uint16_t bytes = ((image.width + 7) / 8) * image.height;
+		unpack_image(image, unpacked);
+		uint32_t hash = 2166136261;
+		for (uint16_t idx = 0; idx < bytes; idx++)
+		{
+			hash = (hash ^ unpacked[idx]) * 16777619;
+		}
+		bool image_ok = (bytes == ref.bytes) && (hash == ref.hash);
+		packed_size += image.size;
+		unpacked_size += bytes;
+
+		for (uint8_t rot = 0; rot < 4; rot++)
+		{
+			display.setRotation(rot);
+			for (const int16_t *pos : positions)
+			{
+				display.clearBuffer();
+				bench_clock::time_point wall_start = bench_clock::now();
+				display.drawBitmap(pos[0], pos[1], unpacked, image.width, image.height, EPD_BLACK);
+				bitmap_wall += wall_us(wall_start);
+				memcpy(expected, display.getBuffer(), sizeof(expected));
+
+				display.clearBuffer();
+				wall_start = bench_clock::now();
+				draw_image_rak14000(pos[0], pos[1], image, EPD_BLACK);
+				blit_wall += wall_us(wall_start);
+				image_ok = image_ok && (memcmp(expected, display.getBuffer(), sizeof(expected)) == 0);
+			}
+		}
+		if (!image_ok)
+		{
+			printf("Images     | %s does not match\n", ref.name);
+		}
+		ok = ok && image_ok;
+	}
+	display.setRotation(rotation);
+
+	printf("Images     | %d images | unpacked %lu B | packed %lu B const | blit %7.1f us | drawBitmap %7.1f us | %s\n",
+		   (int)(sizeof(bench_images) / sizeof(bench_images[0])), (unsigned long)unpacked_size, (unsigned long)packed_size,
+		   blit_wall, bitmap_wall, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/** Number of encodings per timing of the +EVT:RX output */
+#define RX_EVENT_RUNS 2000
+
+/**
+ * @brief +EVT:RX output as it was before, 512 byte buffer and one sprintf per byte
+ *
+ */
+static void rx_event_sprintf(void)
+{
+	char rx_msg[512] = {0};
+	int len = sprintf(rx_msg, "+EVT:RX_1:%d:%d:UNICAST:%d:", g_last_rssi, g_last_snr, g_last_fport);
+	for (int idx = 0; idx < g_rx_data_len; idx++)
+	{
+		sprintf(&rx_msg[len], "%02X", g_rx_lora_data[idx]);
+		len += 2;
+	}
+	AT_PRINTF("%s\n", rx_msg);
+}
+
+/**
+ * @brief Compare the streamed +EVT:RX output of a 242 byte downlink with the sprintf version
+ *        Reports the host time and the number of AT_PRINTF calls of both
+ *
+ */
+static bool check_rx_event(void)
+{
+	static char expected[600];
+	static char streamed[600];
+	InternalFS.format();
+	boot(&scenarios[0]);
+
+	// Not a command, only printed
+	g_lorawan_settings.lorawan_enable = true;
+	g_last_fport = 2;
+	g_last_rssi = -87;
+	g_last_snr = 9;
+	g_rx_data_len = 242;
+	for (uint16_t idx = 0; idx < g_rx_data_len; idx++)
+	{
+		g_rx_lora_data[idx] = (uint8_t)(idx * 37 + 5);
+	}
+	uint8_t data[242];
+	memcpy(data, g_rx_lora_data, sizeof(data));
+
+	Serial.capture = expected;
+	Serial.capture_size = sizeof(expected);
+	Serial.captured = 0;
+	rx_event_sprintf();
+
+	Serial.capture = streamed;
+	Serial.capture_size = sizeof(streamed);
+	Serial.captured = 0;
+	Serial.calls = 0;
+	downlink(2, data, sizeof(data));
+	uint32_t stream_calls = Serial.calls;
+	Serial.capture = nullptr;
+	bool ok = (strcmp(expected, streamed) == 0) && (strlen(streamed) == strlen("+EVT:RX_1:-87:9:UNICAST:2:") + 2 * 242 + 1);
+
+	bench_clock::time_point start = bench_clock::now();
+	for (uint16_t run = 0; run < RX_EVENT_RUNS; run++)
+	{
+		rx_event_sprintf();
+	}
+	double sprintf_us = wall_us(start) / RX_EVENT_RUNS;
+	start = bench_clock::now();
+	for (uint16_t run = 0; run < RX_EVENT_RUNS; run++)
+	{
+		AT_PRINTF("+EVT:RX_1:%d:%d:UNICAST:%d:", g_last_rssi, g_last_snr, g_last_fport);
+		at_print_hex(g_rx_lora_data, g_rx_data_len);
+	}
+	double stream_us = wall_us(start) / RX_EVENT_RUNS;
+
+	printf("RX event   | 242 bytes | %d sprintf + 1 AT_PRINTF %.2f us, 512 B buffer | streamed %d AT_PRINTF %.2f us, %d B buffer | %s\n",
+		   g_rx_data_len + 1, sprintf_us, stream_calls, stream_us, AT_HEX_CHUNK + 2, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+int main(void)
+{
+	build_pm_frame();
+
+	printf("Scenario   | cold boot ms | warm boot ms | cycle ms | awake ms | wall us/cycle | payload B | I2C trans | I2C bytes | I2C bus ms\n");
+	printf("-----------+--------------+--------------+----------+----------+---------------+-----------+-----------+-----------+-----------\n");
+
+	// Payload sizes per scenario
+	uint8_t lpp_size[sizeof(scenarios) / sizeof(bench_scenario_s)] = {0};
+	uint8_t compact_size[sizeof(scenarios) / sizeof(bench_scenario_s)] = {0};
+	bool compact_ok = true;
+
+	for (const bench_scenario_s &scenario : scenarios)
+	{
+		InternalFS.format();
+		uint64_t cold_boot_ms = boot(&scenario);
+		uint64_t warm_boot_ms = boot(&scenario);
+
+		// Statistics of the send cycles only
+		Wire.transactions = 0;
+		Wire.bytes = 0;
+		Wire.nacks = 0;
+		Wire.bus_time_us = 0;
+		uint64_t sum_awake = 0;
+		uint64_t sum_cycle = 0;
+		double sum_wall = 0;
+		uint8_t cycles = 0;
+
+		for (uint8_t cycle = 0; cycle < BENCH_CYCLES; cycle++)
+		{
+			uint64_t awake_ms, cycle_ms;
+			double wall;
+			if (!run_cycle(&awake_ms, &cycle_ms, &wall))
+			{
+				printf("%-10s | cycle %d timed out\n", scenario.name, cycle);
+				break;
+			}
+			sum_awake += awake_ms;
+			sum_cycle += cycle_ms;
+			sum_wall += wall;
+			cycles++;
+			// Sleep until the next send interval
+			sim_run_until_ms(sim_now_us() / 1000 + g_lorawan_settings.send_repeat_time - cycle_ms);
+		}
+		if (cycles == 0)
+		{
+			continue;
+		}
+
+		printf("%-10s | %12llu | %12llu | %8llu | %8llu | %13.1f | %9d | %9lu | %9lu | %10.1f\n",
+			   scenario.name, (unsigned long long)cold_boot_ms, (unsigned long long)warm_boot_ms,
+			   (unsigned long long)(sum_cycle / cycles), (unsigned long long)(sum_awake / cycles),
+			   sum_wall / cycles, sim_lora.last_size,
+			   (unsigned long)(Wire.transactions / cycles), (unsigned long)(Wire.bytes / cycles),
+			   Wire.bus_time_us / 1000.0 / cycles);
+
+		// Same cycle with the compact payload
+		uint8_t idx = &scenario - scenarios;
+		uint8_t lpp_packet[256];
+		lpp_size[idx] = sim_lora.last_size;
+		memcpy(lpp_packet, sim_lora.last_packet, lpp_size[idx]);
+
+		uint8_t encoded[COMPACT_MAX_SIZE];
+		uint8_t encoded_size = compact_encode(lpp_packet, lpp_size[idx], encoded, sizeof(encoded));
+		compact_ok = check_compact(lpp_packet, lpp_size[idx], encoded, encoded_size) && compact_ok;
+
+		uint64_t awake_ms, cycle_ms;
+		double wall;
+		g_payload_format = PAYLOAD_COMPACT;
+		if (run_cycle(&awake_ms, &cycle_ms, &wall))
+		{
+			compact_size[idx] = sim_lora.last_size;
+		}
+		g_payload_format = PAYLOAD_LPP;
+		compact_ok = (compact_size[idx] == encoded_size) && (sim_lora.last_packet[0] == COMPACT_FORMAT_ID) && compact_ok;
+	}
+
+	printf("\nScenario   | LPP B | compact B | saved\n");
+	for (const bench_scenario_s &scenario : scenarios)
+	{
+		uint8_t idx = &scenario - scenarios;
+		printf("%-10s | %5d | %9d | %4d%%\n", scenario.name, lpp_size[idx], compact_size[idx],
+			   lpp_size[idx] == 0 ? 0 : 100 - 100 * compact_size[idx] / lpp_size[idx]);
+	}
+	printf("Compact    | decoded values match Cayenne LPP | %s\n\n", compact_ok ? "OK" : "FAIL");
+
+	// Rendering of the 4.2" EPD, the display task does not run on the host
+	// UI 0 is rendered with the graphs over the last values, 24 hours and 7 days
+	init_rak14000();
+	for (uint8_t ui = 0; ui < 5; ui++)
+	{
+		g_ui_selected = ui < 3 ? ui : 0;
+		g_graph_range = ui < 3 ? HISTORY_RAW : ui - 2;
+		uint32_t full_refreshes = sim_epd.full_refreshes;
+		uint32_t partial_refreshes = sim_epd.partial_refreshes;
+		uint64_t sim_start = sim_now_us();
+		bench_clock::time_point wall_start = bench_clock::now();
+		refresh_rak14000();
+		double wall = wall_us(wall_start);
+		printf("EPD UI %d/%d | render wall %8.1f us | simulated %6llu ms | full refreshes %lu | partial refreshes %lu\n",
+			   g_ui_selected, g_graph_range, wall, (unsigned long long)((sim_now_us() - sim_start) / 1000),
+			   (unsigned long)(sim_epd.full_refreshes - full_refreshes), (unsigned long)(sim_epd.partial_refreshes - partial_refreshes));
+	}
+
+	bool ok = check_transactions() && compact_ok;
+	ok = check_bus_map() && ok;
+	ok = check_batch() && ok;
+	ok = check_planner() && ok;
+	ok = check_report() && ok;
+	ok = check_p2p() && ok;
+	ok = check_downlink() && ok;
+	ok = check_rx_event() && ok;
+	ok = check_epd_widgets() && ok;
+	ok = check_epd_graph() && ok;
+	ok = check_text_bounds() && ok;
+	ok = check_images() && ok;
+	ok = check_se0352_spi() && ok;
+	ok = check_se0352_view() && ok;
+	ok = check_se0352_blit() && ok;
+	ok = check_se0352_cjk() && ok;
+	ok = check_history() && ok;
+	ok = check_history_log() && ok;
+	return ok ? 0 : 1;
+}
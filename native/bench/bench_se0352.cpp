@@ -0,0 +1,679 @@
+/**
+ * @file bench_se0352.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host checks of the SE0352NQ01 driver of the 3.52" EPD
+ *        Checks the SPI transport and compares the framebuffer views
+ *        with the pixel by pixel drawing functions they replaced.
+ *        Compares the bitmap blitter with pixel by pixel drawing,
+ *        with the Adafruit GFX fonts of the driver examples.
+ *        Compares the glyph lookups and the glyph cache of the Chinese fonts
+ *        with the replaced binary search.
+ *        The driver has its own GFXfont types, it can not share
+ *        a file with Adafruit GFX.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <chrono>
+#include <SE0352NQ01.h>
+#include <SPI.h>
+
+#define PROGMEM
+#include "../../lib/SE0352NQ01_Library/examples/SE0352NQ01/FreeSansBold12pt7b.h"
+#include "../../lib/SE0352NQ01_Library/examples/SE0352NQ01/FreeSerifBoldItalic24pt7b.h"
+#include "../../lib/SE0352NQ01_Library/examples/SE0352NQ01/CJK14pt.h"
+#include "../../lib/SE0352NQ01_Library/examples/SE0352NQ01/CJK16ptB.h"
+
+typedef std::chrono::steady_clock se0352_clock;
+
+/** Size of the frame buffer */
+#define SE0352_FRAME_SIZE (Gate_Pixel * Source_Pixel / 8)
+
+/** Bytes of one GC or DU LUT upload, 5 commands and their tables */
+#define SE0352_LUT_BYTES (5 + 4 * 56 + 42)
+
+/** Frame buffer of the checks */
+static uint8_t se0352_frame[SE0352_FRAME_SIZE];
+
+/** Bytes sent over SPI */
+static uint8_t se0352_sent[SE0352_FRAME_SIZE + 512];
+
+/**
+ * @brief Start capturing the SPI bus
+ *
+ */
+static void capture_spi(void)
+{
+	SPI.capture = se0352_sent;
+	SPI.capture_size = sizeof(se0352_sent);
+	SPI.captured = 0;
+	SPI.transactions = 0;
+	SPI.bytes = 0;
+	SPI.bus_time_ns = 0;
+}
+
+/**
+ * @brief Check the SPI transport of the SE0352NQ01 driver
+ *        A full frame and a partial refresh must be sent with one CS assertion
+ *        per command and per data burst, the bit-banged version needed one per byte.
+ *
+ * @return true the bytes on the bus match the frame buffer
+ * @return false mismatch
+ */
+bool check_se0352_spi(void)
+{
+	for (uint16_t idx = 0; idx < SE0352_FRAME_SIZE; idx++)
+	{
+		se0352_frame[idx] = (uint8_t)(idx * 7 ^ (idx >> 8));
+	}
+	// The EPD is never busy on the host
+	digitalWrite(BUSY_Pin, HIGH);
+
+	// Full frame with the DU LUT
+	capture_spi();
+	uint64_t sim_start = sim_now_us();
+	SE0352.send_DU(se0352_frame);
+	uint64_t frame_us = sim_now_us() - sim_start;
+	uint32_t frame_trans = SPI.transactions;
+	uint32_t frame_bytes = SPI.bytes;
+	bool ok = SPI.started;
+	ok = ok && (frame_bytes == 1 + SE0352_FRAME_SIZE + SE0352_LUT_BYTES) && (frame_trans == 2 + 10);
+	ok = ok && (se0352_sent[0] == 0x13) && (memcmp(&se0352_sent[1], se0352_frame, SE0352_FRAME_SIZE) == 0);
+	ok = ok && (se0352_sent[1 + SE0352_FRAME_SIZE] == 0x20);
+
+	// Partial refresh of 4 bytes x 10 rows in portrait orientation
+	capture_spi();
+	SE0352.partialRefresh(16, 10, 47, 19, 1, se0352_frame);
+	uint32_t partial_trans = SPI.transactions;
+	uint32_t partial_bytes = SPI.bytes;
+	ok = ok && (partial_bytes == 10 + 40 + SE0352_LUT_BYTES + 3) && (partial_trans == 11 + 10 + 3);
+	ok = ok && (se0352_sent[0] == 0x91) && (se0352_sent[9] == 0x13);
+	for (uint16_t row = 0; row < 10; row++)
+	{
+		ok = ok && (memcmp(&se0352_sent[10 + row * 4], &se0352_frame[(10 + row) * 30 + 2], 4) == 0);
+	}
+	SPI.capture = nullptr;
+
+	printf("SE0352 SPI | frame + LUT %lu B %lu CS, bit-banged %lu CS | %llu us simulated at %lu kHz | partial %lu B %lu CS | %s\n",
+		   (unsigned long)frame_bytes, (unsigned long)frame_trans, (unsigned long)frame_bytes, (unsigned long long)frame_us,
+		   (unsigned long)(SE0352_SPI_FREQ / 1000), (unsigned long)partial_bytes, (unsigned long)partial_trans, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/**
+ * @brief Pixel position in the buffer as calculated by the replaced functions
+ *
+ */
+static uint16_t legacy_pos(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *bit)
+{
+	uint16_t x0 = 0, y0 = 0;
+	if (rotation == 0)
+	{
+		x0 = y;
+		y0 = 359 - x;
+	}
+	else if (rotation == 2)
+	{
+		x0 = 239 - y;
+		y0 = x;
+	}
+	else if (rotation == 1)
+	{
+		x0 = x;
+		y0 = y;
+	}
+	else if (rotation == 3)
+	{
+		x0 = 239 - x;
+		y0 = 359 - y;
+	}
+	*bit = x0 % 8;
+	return y0 * 30 + x0 / 8;
+}
+
+/** Replaced setPixel(), mask table built on every call */
+static void legacy_set_pixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer)
+{
+	uint8_t anders[8] = {
+		0b01111111, 0b10111111, 0b11011111, 0b11101111,
+		0b11110111, 0b11111011, 0b11111101, 0b11111110};
+	uint8_t n;
+	uint16_t pos = legacy_pos(x, y, rotation, &n);
+	buffer[pos] = buffer[pos] & anders[n];
+}
+
+/** Replaced clearPixel() */
+static void legacy_clear_pixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer)
+{
+	uint8_t n;
+	uint16_t pos = legacy_pos(x, y, rotation, &n);
+	buffer[pos] = buffer[pos] | (1 << (7 - n));
+}
+
+/** Replaced getPixel() */
+static uint8_t legacy_get_pixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer)
+{
+	uint8_t anders[8] = {
+		0b10000000, 0b01000000, 0b00100000, 0b00010000,
+		0b00001000, 0b00000100, 0b00000010, 0b00000001};
+	uint8_t n;
+	uint16_t pos = legacy_pos(x, y, rotation, &n);
+	return (buffer[pos] & anders[n]) == 0 ? PIC_BLACK : PIC_WHITE;
+}
+
+/** Replaced drawHLine() */
+static void legacy_hline(uint16_t x0, uint16_t y0, uint16_t x1, uint8_t rotation, uint8_t *buffer)
+{
+	uint16_t x2 = x0 > x1 ? x1 : x0;
+	uint16_t x3 = (x0 > x1 ? x0 : x1) + 1;
+	for (int16_t x = x2; x < x3; x++)
+	{
+		legacy_set_pixel(x, y0, rotation, buffer);
+	}
+}
+
+/** Replaced drawVLine() */
+static void legacy_vline(uint16_t x0, uint16_t y0, uint16_t y1, uint8_t rotation, uint8_t *buffer)
+{
+	uint16_t y2 = y0 > y1 ? y1 : y0;
+	uint16_t y3 = (y0 > y1 ? y0 : y1) + 1;
+	for (int16_t y = y2; y < y3; y++)
+	{
+		legacy_set_pixel(x0, y, rotation, buffer);
+	}
+}
+
+/** Replaced drawRect() */
+static void legacy_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer)
+{
+	legacy_hline(x0, y0, x1, rotation, buffer);
+	legacy_hline(x0, y1, x1, rotation, buffer);
+	legacy_vline(x0, y0, y1, rotation, buffer);
+	legacy_vline(x1, y0, y1, rotation, buffer);
+}
+
+/** Replaced fillRect(), without the extra column it filled right of x1 */
+static void legacy_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer)
+{
+	for (uint16_t y = y0; y <= y1; y++)
+	{
+		legacy_hline(x0, y, x1, rotation, buffer);
+	}
+}
+
+/** Replaced clearRect() */
+static void legacy_clear_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer)
+{
+	for (uint16_t y = y0; y <= y1; y++)
+	{
+		for (uint16_t x = x0; x <= x1; x++)
+		{
+			legacy_clear_pixel(x, y, rotation, buffer);
+		}
+	}
+}
+
+/**
+ * @brief Drawing functions of a check run
+ *
+ */
+struct se0352_draw_s
+{
+	void (*set_pixel)(uint16_t, uint16_t, uint8_t, uint8_t *);
+	void (*clear_pixel)(uint16_t, uint16_t, uint8_t, uint8_t *);
+	void (*hline)(uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
+	void (*vline)(uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
+	void (*rect)(uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
+	void (*fill_rect)(uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
+	void (*clear_rect)(uint16_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t *);
+};
+
+static void view_set_pixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer) { SE0352.setPixel(x, y, rotation, buffer); }
+static void view_clear_pixel(uint16_t x, uint16_t y, uint8_t rotation, uint8_t *buffer) { SE0352.clearPixel(x, y, rotation, buffer); }
+static void view_hline(uint16_t x0, uint16_t y0, uint16_t x1, uint8_t rotation, uint8_t *buffer) { SE0352.drawHLine(x0, y0, x1, rotation, buffer); }
+static void view_vline(uint16_t x0, uint16_t y0, uint16_t y1, uint8_t rotation, uint8_t *buffer) { SE0352.drawVLine(x0, y0, y1, rotation, buffer); }
+static void view_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer) { SE0352.drawRect(x0, y0, x1, y1, rotation, buffer); }
+static void view_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer) { SE0352.fillRect(x0, y0, x1, y1, rotation, buffer); }
+static void view_clear_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t rotation, uint8_t *buffer) { SE0352.clearRect(x0, y0, x1, y1, rotation, buffer); }
+
+static const se0352_draw_s legacy_draw = {legacy_set_pixel, legacy_clear_pixel, legacy_hline, legacy_vline,
+										  legacy_rect, legacy_fill_rect, legacy_clear_rect};
+static const se0352_draw_s view_draw = {view_set_pixel, view_clear_pixel, view_hline, view_vline,
+										view_rect, view_fill_rect, view_clear_rect};
+
+/** Number of runs of the drawing workload per rotation */
+#define SE0352_DRAW_RUNS 20
+
+/**
+ * @brief Draw a screen of lines, rectangles and pixels, all inside the screen
+ *
+ * @param draw drawing functions
+ * @param rotation 0 / 2 landscape, 1 / 3 portrait
+ * @param buffer frame buffer
+ * @return double host time in us
+ */
+static double draw_workload(const se0352_draw_s &draw, uint8_t rotation, uint8_t *buffer)
+{
+	uint16_t w = SE0352.width(rotation);
+	uint16_t h = SE0352.height(rotation);
+	memset(buffer, PIC_WHITE, SE0352_FRAME_SIZE);
+	se0352_clock::time_point start = se0352_clock::now();
+	for (uint16_t y = 0; y < h; y += 7)
+	{
+		draw.hline(y % 13, y, w - 1 - y % 5, rotation, buffer);
+	}
+	for (uint16_t x = 0; x < w; x += 9)
+	{
+		draw.vline(x, h - 1 - x % 11, x % 17, rotation, buffer);
+	}
+	for (uint16_t idx = 0; idx < 40; idx++)
+	{
+		uint16_t x0 = (idx * 37) % (w - 100);
+		uint16_t y0 = (idx * 23) % (h - 60);
+		draw.clear_rect(x0, y0, x0 + 99, y0 + 59, rotation, buffer);
+		draw.rect(x0 + 3, y0 + 3, x0 + 96, y0 + 56, rotation, buffer);
+		draw.fill_rect(x0 + 5 + idx % 8, y0 + 5, x0 + 60 + idx % 5, y0 + 30, rotation, buffer);
+	}
+	for (uint16_t idx = 0; idx < 2000; idx++)
+	{
+		uint16_t x = (idx * 31) % w;
+		uint16_t y = (idx * 17) % h;
+		if (idx & 1)
+		{
+			draw.set_pixel(x, y, rotation, buffer);
+		}
+		else
+		{
+			draw.clear_pixel(x, y, rotation, buffer);
+		}
+	}
+	return std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+}
+
+/**
+ * @brief Compare the framebuffer views with the pixel by pixel drawing functions
+ *        in all rotations, the frame buffers and getPixel() must match
+ *
+ * @return true all frame buffers match
+ * @return false mismatch
+ */
+bool check_se0352_view(void)
+{
+	static uint8_t expected[SE0352_FRAME_SIZE];
+	bool ok = true;
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		double legacy_us = 0;
+		double view_us = 0;
+		for (uint8_t run = 0; run < SE0352_DRAW_RUNS; run++)
+		{
+			legacy_us += draw_workload(legacy_draw, rotation, expected);
+			view_us += draw_workload(view_draw, rotation, se0352_frame);
+		}
+		bool same = memcmp(expected, se0352_frame, SE0352_FRAME_SIZE) == 0;
+
+		// getPixel() over the whole screen
+		uint16_t w = SE0352.width(rotation);
+		uint16_t h = SE0352.height(rotation);
+		uint32_t black = 0;
+		se0352_clock::time_point start = se0352_clock::now();
+		for (uint16_t y = 0; y < h; y++)
+		{
+			for (uint16_t x = 0; x < w; x++)
+			{
+				black += legacy_get_pixel(x, y, rotation, expected) == PIC_BLACK;
+			}
+		}
+		double legacy_get_us = std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+		start = se0352_clock::now();
+		for (uint16_t y = 0; y < h; y++)
+		{
+			for (uint16_t x = 0; x < w; x++)
+			{
+				black -= SE0352.getPixel(x, y, rotation, se0352_frame) == PIC_BLACK;
+			}
+		}
+		double view_get_us = std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+		same = same && (black == 0);
+
+		// Outside of the screen nothing is drawn
+		memcpy(expected, se0352_frame, SE0352_FRAME_SIZE);
+		SE0352.fillRect(w, 0, w + 20, h + 20, rotation, se0352_frame);
+		SE0352.drawHLine(0, h, w - 1, rotation, se0352_frame);
+		SE0352.setPixel(w, h, rotation, se0352_frame);
+		same = same && (memcmp(expected, se0352_frame, SE0352_FRAME_SIZE) == 0);
+		same = same && (SE0352.getPixel(w, 0, rotation, se0352_frame) == PIC_BLACK);
+
+		printf("SE0352 view | rotation %d | draw pixel by pixel %8.1f us | view %7.1f us | getPixel %7.1f us / %7.1f us | %s\n",
+			   rotation, legacy_us / SE0352_DRAW_RUNS, view_us / SE0352_DRAW_RUNS, legacy_get_us, view_get_us, same ? "OK" : "FAIL");
+		ok = ok && same;
+	}
+	return ok;
+}
+
+/**
+ * @brief Replaced drawBitmap(), pixel by pixel with the rotation calculated
+ *        for every pixel, pixels outside of the screen are skipped like in the view
+ *
+ */
+static void legacy_draw_bitmap(uint8_t width, uint8_t height, uint16_t posX, uint16_t posY,
+							   int8_t xOffset, int8_t yOffset, uint16_t bitmapOffset,
+							   uint8_t *buffer, const uint8_t *bitmap, uint8_t rotation)
+{
+	for (uint16_t y = 0; y < height; y++)
+	{
+		for (uint16_t x = 0; x < width; x++)
+		{
+			uint16_t bitIndex = x + width * y;
+			if (bitmap[(bitIndex >> 3) + bitmapOffset] & (0x80 >> (bitIndex & 7)))
+			{
+				uint16_t px = posX + x + xOffset;
+				uint16_t py = posY + yOffset + y;
+				if ((px < SE0352.width(rotation)) && (py < SE0352.height(rotation)))
+				{
+					legacy_set_pixel(px, py, rotation, buffer);
+				}
+			}
+		}
+	}
+}
+
+/** Replaced drawString(), glyphs drawn with legacy_draw_bitmap() */
+static void legacy_draw_string(const char *text, uint16_t posX, uint16_t posY, const GFXfont &font, uint8_t rotation, uint8_t *buffer)
+{
+	for (; *text; text++)
+	{
+		const GFXglyph &glyph = font.glyph[*text - font.first];
+		legacy_draw_bitmap(glyph.width, glyph.height, posX, posY, glyph.xOffset, glyph.yOffset,
+						   glyph.bitmapOffset, buffer, font.bitmap, rotation);
+		posX += glyph.xAdvance;
+	}
+}
+
+/** Number of text lines per timing of drawString() */
+#define SE0352_TEXT_LINES 8
+
+/**
+ * @brief Compare the bitmap blitter with pixel by pixel drawing
+ *        Every glyph of both example fonts is drawn inside the screen and across
+ *        its edges in all rotations, the frame buffers must match.
+ *        Lines of text are drawn with drawString() and with the replaced version.
+ *
+ * @return true all frame buffers match
+ * @return false mismatch
+ */
+bool check_se0352_blit(void)
+{
+	static uint8_t expected[SE0352_FRAME_SIZE];
+	const GFXfont *fonts[] = {&FreeSansBold12pt7b, &FreeSerifBoldItalic24pt7b};
+	bool ok = true;
+	uint32_t glyphs = 0;
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		uint16_t w = SE0352.width(rotation);
+		uint16_t h = SE0352.height(rotation);
+		// Inside, across the left, top, right and bottom edge
+		const int16_t positions[][2] = {{13, 40}, {5, 60}, {70, 10}, {(int16_t)(w - 20), 100}, {100, (int16_t)(h - 5)}};
+		bool same = true;
+		for (const GFXfont *font : fonts)
+		{
+			for (uint16_t c = font->first; c <= font->last; c++)
+			{
+				const GFXglyph &glyph = font->glyph[c - font->first];
+				for (const int16_t *pos : positions)
+				{
+					memset(expected, PIC_WHITE, SE0352_FRAME_SIZE);
+					memset(se0352_frame, PIC_WHITE, SE0352_FRAME_SIZE);
+					legacy_draw_bitmap(glyph.width, glyph.height, pos[0], pos[1], glyph.xOffset, glyph.yOffset,
+									   glyph.bitmapOffset, expected, font->bitmap, rotation);
+					SE0352.drawBitmap(glyph.width, glyph.height, pos[0], pos[1], glyph.xOffset, glyph.yOffset,
+									  glyph.bitmapOffset, se0352_frame, font->bitmap, rotation);
+					same = same && (memcmp(expected, se0352_frame, SE0352_FRAME_SIZE) == 0);
+					glyphs++;
+				}
+			}
+		}
+
+		// Text lines, drawString() wraps at the right edge
+		char text[] = "Air quality 23.5C 45% 1013hPa";
+		memset(expected, PIC_WHITE, SE0352_FRAME_SIZE);
+		memset(se0352_frame, PIC_WHITE, SE0352_FRAME_SIZE);
+		se0352_clock::time_point start = se0352_clock::now();
+		for (uint8_t line = 0; line < SE0352_TEXT_LINES; line++)
+		{
+			legacy_draw_string(text, 0, 20 + line * 25, FreeSansBold12pt7b, rotation, expected);
+		}
+		double legacy_us = std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+		start = se0352_clock::now();
+		for (uint8_t line = 0; line < SE0352_TEXT_LINES; line++)
+		{
+			SE0352.drawString(text, 0, 20 + line * 25, FreeSansBold12pt7b, rotation, se0352_frame);
+		}
+		double blit_us = std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+		if (SE0352.strWidth(text, FreeSansBold12pt7b) < w)
+		{
+			same = same && (memcmp(expected, se0352_frame, SE0352_FRAME_SIZE) == 0);
+		}
+
+		printf("SE0352 blit | rotation %d | %d text lines pixel by pixel %7.1f us | blit %6.1f us | %s\n",
+			   rotation, SE0352_TEXT_LINES, legacy_us, blit_us, same ? "OK" : "FAIL");
+		ok = ok && same;
+	}
+	printf("SE0352 blit | %lu glyphs drawn inside and across the edges | %s\n", (unsigned long)glyphs, ok ? "OK" : "FAIL");
+	return ok;
+}
+
+/** Replaced bs() of the driver, without the Serial output */
+static uint16_t legacy_bs(const uint8_t *lst, uint16_t sparseLen, uint16_t val)
+{
+	uint16_t low = 0;
+	uint16_t high = (sparseLen / 4);
+	uint8_t count = 0;
+	while (count < 30)
+	{
+		uint16_t m = (high - low) / 2 + low;
+		uint16_t pos = m * 4;
+		uint16_t v = lst[pos] | (lst[pos + 1] << 8);
+		if (v == val)
+		{
+			v = lst[pos + 2] | (lst[pos + 3] << 8);
+			return v;
+		}
+		if (low > high)
+		{
+			return 0;
+		}
+		if (v < val)
+		{
+			low = m + 1;
+		}
+		else
+		{
+			high = m - 1;
+		}
+		count += 1;
+	}
+	return 0;
+}
+
+/** Reference drawUnicode(), glyphs found by a linear search and drawn with legacy_draw_bitmap() */
+static void legacy_draw_unicode(const uint16_t *text, uint8_t len, uint16_t posX, uint16_t posY,
+								const uint8_t *font, const uint8_t *sparse, uint16_t sparseLen,
+								uint8_t height, uint8_t rotation, uint8_t *buffer)
+{
+	for (uint8_t idx = 0; idx < len; idx++)
+	{
+		uint16_t offset = 0;
+		for (uint16_t pos = 0; pos < sparseLen; pos += 4)
+		{
+			if ((sparse[pos] | (sparse[pos + 1] << 8)) == text[idx])
+			{
+				offset = sparse[pos + 2] | (sparse[pos + 3] << 8);
+			}
+		}
+		uint8_t width = ((font[offset] | (font[offset + 1] << 8)) + 7) / 8 * 8;
+		legacy_draw_bitmap(width, height, posX, posY, 0, 0, offset + 2, buffer, font, rotation);
+		posX += width;
+	}
+}
+
+/** Status screen of the air quality sensor, 质 has no glyph and is drawn as ? */
+static uint16_t cjk_air[] = {0x7A7A, 0x6C14, 0x8D28, 0x91CF, 0x826F, 0x597D}; // 空气质量良好
+static uint16_t cjk_temp[] = {0x6E29, 0x5EA6};								   // 温度
+static uint16_t cjk_humid[] = {0x6E7F, 0x5EA6};								   // 湿度
+static uint16_t cjk_signal[] = {0x4FE1, 0x53F7, 0x6B63, 0x5E38};			   // 信号正常
+static uint16_t cjk_alert[] = {0x8B66, 0x544A};								   // 警告
+
+struct se0352_cjk_line_s
+{
+	uint16_t *text;
+	uint8_t len;
+};
+
+static const se0352_cjk_line_s cjk_status[] = {{cjk_air, 6}, {cjk_temp, 2}, {cjk_humid, 2}, {cjk_signal, 4}, {cjk_alert, 2}};
+
+/** Number of status screens per timing */
+#define SE0352_CJK_RUNS 200
+
+/** Draw the status screen with the direct index or with the sparse index of the 16pt font */
+static void draw_cjk_status(bool direct, uint8_t rotation, uint8_t *buffer)
+{
+	for (uint8_t line = 0; line < sizeof(cjk_status) / sizeof(cjk_status[0]); line++)
+	{
+		const se0352_cjk_line_s &status = cjk_status[line];
+		if (direct)
+		{
+			SE0352.drawUnicode(status.text, status.len, 4, 10 + line * 20, CJK16ptB, rotation, buffer);
+		}
+		else
+		{
+			SE0352.drawUnicode(status.text, status.len, 4, 10 + line * 20, CJK16ptBfont, CJK16ptBsparse,
+							   CJK16ptBSparseLen, CJK16ptBHeight, rotation, buffer);
+		}
+	}
+}
+
+/** Fill the glyph cache with glyphs that are not on the status screen */
+static void flush_cjk_cache(uint8_t *buffer)
+{
+	for (uint16_t idx = 0; idx < SE0352_CJK_CACHE; idx++)
+	{
+		uint16_t pos = CJK16ptBSparseLen - 4 - idx * 4;
+		uint16_t ch = CJK16ptBsparse[pos] | (CJK16ptBsparse[pos + 1] << 8);
+		SE0352.drawUnicode(&ch, 1, 200, 200, CJK16ptB, 0, buffer);
+	}
+}
+
+/**
+ * @brief Compare the glyph lookups and the glyph cache of the Chinese fonts
+ *        Every codepoint is looked up in the sparse index and the direct index,
+ *        both must give the offset of the glyph or 0 for the first glyph.
+ *        The status screen is drawn in all rotations with both indexes and the
+ *        14pt font and compared with a linear search and pixel by pixel drawing.
+ *
+ * @return true all lookups and frame buffers match
+ * @return false mismatch
+ */
+bool check_se0352_cjk(void)
+{
+	static uint8_t expected[SE0352_FRAME_SIZE];
+	bool ok = true;
+
+	// Every codepoint, the sparse index is sorted
+	uint16_t pos = 0;
+	for (uint32_t ch = 0; ch <= 0xFFFF; ch++)
+	{
+		uint16_t offset = 0;
+		if (pos < CJK16ptBSparseLen && (uint32_t)(CJK16ptBsparse[pos] | (CJK16ptBsparse[pos + 1] << 8)) == ch)
+		{
+			offset = CJK16ptBsparse[pos + 2] | (CJK16ptBsparse[pos + 3] << 8);
+			ok = ok && (legacy_bs(CJK16ptBsparse, CJK16ptBSparseLen, ch) == offset);
+			pos += 4;
+		}
+		ok = ok && (SE0352.glyphOffset(ch, CJK16ptBsparse, CJK16ptBSparseLen) == offset);
+		ok = ok && (SE0352.glyphOffset(ch, CJK16ptB) == offset);
+	}
+	unsigned long index_bytes = sizeof(CJK16ptBpages) + sizeof(CJK16ptBbits) + sizeof(CJK16ptBranks) + sizeof(CJK16ptBoffsets);
+	printf("SE0352 CJK | 65536 codepoints | sparse index %u B, direct index %lu B | %s\n",
+		   CJK16ptBSparseLen, index_bytes, ok ? "OK" : "FAIL");
+
+	// Lookups of the status screen characters
+	volatile uint32_t sum[3] = {0, 0, 0};
+	double lookup_ns[3];
+	uint32_t lookups = 0;
+	for (uint8_t method = 0; method < 3; method++)
+	{
+		se0352_clock::time_point start = se0352_clock::now();
+		for (uint16_t run = 0; run < SE0352_CJK_RUNS; run++)
+		{
+			for (const se0352_cjk_line_s &status : cjk_status)
+			{
+				for (uint8_t idx = 0; idx < status.len; idx++)
+				{
+					uint16_t ch = status.text[idx];
+					sum[method] = sum[method] + (method == 0   ? legacy_bs(CJK16ptBsparse, CJK16ptBSparseLen, ch)
+												 : method == 1 ? SE0352.glyphOffset(ch, CJK16ptBsparse, CJK16ptBSparseLen)
+															   : SE0352.glyphOffset(ch, CJK16ptB));
+					lookups += (method == 0);
+				}
+			}
+		}
+		lookup_ns[method] = std::chrono::duration<double, std::nano>(se0352_clock::now() - start).count();
+	}
+	bool same = (sum[0] == sum[1]) && (sum[1] == sum[2]);
+	printf("SE0352 CJK | lookup binary search %5.1f ns | fixed %5.1f ns | direct index %5.1f ns | %s\n",
+		   lookup_ns[0] / lookups, lookup_ns[1] / lookups, lookup_ns[2] / lookups, same ? "OK" : "FAIL");
+	ok = ok && same;
+
+	for (uint8_t rotation = 0; rotation < 4; rotation++)
+	{
+		// Both indexes, the 14pt font shares the codepoints but not the cache entries
+		memset(expected, PIC_WHITE, SE0352_FRAME_SIZE);
+		memset(se0352_frame, PIC_WHITE, SE0352_FRAME_SIZE);
+		for (uint8_t line = 0; line < sizeof(cjk_status) / sizeof(cjk_status[0]); line++)
+		{
+			const se0352_cjk_line_s &status = cjk_status[line];
+			legacy_draw_unicode(status.text, status.len, 4, 10 + line * 20, CJK16ptBfont, CJK16ptBsparse,
+								CJK16ptBSparseLen, CJK16ptBHeight, rotation, expected);
+			legacy_draw_unicode(status.text, status.len, 150, 10 + line * 20, CJK14ptfont, CJK14ptsparse,
+								CJK14ptSparseLen, CJK14ptHeight, rotation, expected);
+		}
+		same = true;
+		for (uint8_t direct = 0; direct < 2; direct++)
+		{
+			memset(se0352_frame, PIC_WHITE, SE0352_FRAME_SIZE);
+			draw_cjk_status(direct, rotation, se0352_frame);
+			for (uint8_t line = 0; line < sizeof(cjk_status) / sizeof(cjk_status[0]); line++)
+			{
+				const se0352_cjk_line_s &status = cjk_status[line];
+				SE0352.drawUnicode(status.text, status.len, 150, 10 + line * 20, CJK14ptfont, CJK14ptsparse,
+								   CJK14ptSparseLen, CJK14ptHeight, rotation, se0352_frame);
+			}
+			same = same && (memcmp(expected, se0352_frame, SE0352_FRAME_SIZE) == 0);
+		}
+
+		// Status screen with the glyphs in the cache and after they were replaced
+		double cold_us = 0;
+		for (uint16_t run = 0; run < SE0352_CJK_RUNS; run++)
+		{
+			flush_cjk_cache(se0352_frame);
+			memset(se0352_frame, PIC_WHITE, SE0352_FRAME_SIZE);
+			se0352_clock::time_point start = se0352_clock::now();
+			draw_cjk_status(true, rotation, se0352_frame);
+			cold_us += std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+		}
+		se0352_clock::time_point start = se0352_clock::now();
+		for (uint16_t run = 0; run < SE0352_CJK_RUNS; run++)
+		{
+			draw_cjk_status(true, rotation, se0352_frame);
+		}
+		double warm_us = std::chrono::duration<double, std::micro>(se0352_clock::now() - start).count();
+
+		printf("SE0352 CJK | rotation %d | status screen, glyphs in flash %6.2f us | in the cache %6.2f us | %s\n",
+			   rotation, cold_us / SE0352_CJK_RUNS, warm_us / SE0352_CJK_RUNS, same ? "OK" : "FAIL");
+		ok = ok && same;
+	}
+	return ok;
+}
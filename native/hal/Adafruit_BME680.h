@@ -0,0 +1,118 @@
+/**
+ * @file Adafruit_BME680.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Adafruit BME680 library (RAK1906)
+ *        Conversion time follows the selected oversampling
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ADAFRUIT_BME680_H
+#define ADAFRUIT_BME680_H
+
+#include <Wire.h>
+
+#define BME680_OS_NONE 0
+#define BME680_OS_1X 1
+#define BME680_OS_2X 2
+#define BME680_OS_4X 3
+#define BME680_OS_8X 4
+#define BME680_OS_16X 5
+
+#define BME680_FILTER_SIZE_0 0
+#define BME680_FILTER_SIZE_1 1
+#define BME680_FILTER_SIZE_3 2
+#define BME680_FILTER_SIZE_7 3
+
+class Adafruit_BME680
+{
+public:
+	Adafruit_BME680(TwoWire *wire) { (void)wire; }
+
+	float temperature = 0;
+	uint32_t pressure = 0;
+	float humidity = 0;
+	uint32_t gas_resistance = 0;
+
+	bool begin(uint8_t addr = 0x76)
+	{
+		_addr = addr;
+		// Chip ID and calibration data
+		return sim_i2c_transfer(_addr, 1, 1) && sim_i2c_transfer(_addr, 1, 41);
+	}
+	bool setTemperatureOversampling(uint8_t os) { return config(_os_t = os); }
+	bool setHumidityOversampling(uint8_t os) { return config(_os_h = os); }
+	bool setPressureOversampling(uint8_t os) { return config(_os_p = os); }
+	bool setIIRFilterSize(uint8_t fs) { return config(fs); }
+	bool setGasHeater(uint16_t heater_temp, uint16_t heater_time)
+	{
+		_heater_ms = heater_temp == 0 ? 0 : heater_time;
+		return config(0);
+	}
+
+	/**
+	 * @brief Start a forced mode conversion
+	 *
+	 * @return uint32_t time when the conversion will be finished
+	 */
+	uint32_t beginReading(void)
+	{
+		if (_end_ms == 0)
+		{
+			sim_i2c_transfer(_addr, 2, 0);
+			_end_ms = millis() + conversion_ms();
+		}
+		return _end_ms;
+	}
+	int remainingReadingMillis(void)
+	{
+		if (_end_ms == 0)
+		{
+			return -1;
+		}
+		return millis() >= _end_ms ? 0 : (int)(_end_ms - millis());
+	}
+	bool endReading(void)
+	{
+		uint32_t end_ms = beginReading();
+		if (millis() < end_ms)
+		{
+			delay(end_ms - millis());
+		}
+		_end_ms = 0;
+		if (!sim_i2c_transfer(_addr, 1, 15))
+		{
+			return false;
+		}
+		temperature = 24.1;
+		humidity = 46.5;
+		pressure = 101240;
+		gas_resistance = 0;
+		return true;
+	}
+	bool performReading(void) { return endReading(); }
+
+private:
+	bool config(uint8_t value)
+	{
+		(void)value;
+		return sim_i2c_transfer(_addr, 2, 0);
+	}
+	uint32_t conversion_ms(void)
+	{
+		// Datasheet: 1.25ms + 2.3ms per oversampling cycle + heater time
+		static const uint8_t cycles[] = {0, 1, 2, 4, 8, 16};
+		uint32_t us = 1250 + 2300 * (cycles[_os_t] + cycles[_os_p] + cycles[_os_h]) + 2300;
+		return us / 1000 + 1 + _heater_ms;
+	}
+	uint8_t _addr = 0x76;
+	uint8_t _os_t = BME680_OS_1X;
+	uint8_t _os_h = BME680_OS_1X;
+	uint8_t _os_p = BME680_OS_1X;
+	uint16_t _heater_ms = 0;
+	uint32_t _end_ms = 0;
+};
+
+#endif // ADAFRUIT_BME680_H
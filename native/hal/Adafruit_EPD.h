@@ -0,0 +1,79 @@
+/**
+ * @file Adafruit_EPD.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for Adafruit EPD
+ *        Renders into a 1 bit frame buffer, display() accounts the SPI
+ *        upload and the panel refresh time on the simulated clock
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ADAFRUIT_EPD_H
+#define ADAFRUIT_EPD_H
+
+#include <Adafruit_GFX.h>
+
+enum
+{
+	EPD_WHITE,
+	EPD_BLACK,
+	EPD_RED,
+	EPD_GRAY,
+	EPD_DARK,
+	EPD_LIGHT,
+	EPD_NUM_COLORS
+};
+
+/** SPI clock used by the EPD driver */
+#define SIM_EPD_SPI_CLOCK 4000000
+/** Panel busy time for a full refresh */
+#define SIM_EPD_FULL_REFRESH_MS 3500
+/** Panel busy time for a partial refresh */
+#define SIM_EPD_PARTIAL_REFRESH_MS 700
+
+class Adafruit_EPD : public Adafruit_GFX
+{
+public:
+	Adafruit_EPD(int width, int height, int16_t spi_mosi, int16_t spi_clk, int16_t dc, int16_t rst,
+				 int16_t cs, int16_t sram_cs, int16_t spi_miso, int16_t busy = -1);
+	~Adafruit_EPD();
+
+	void begin(bool reset = true) { (void)reset; }
+	void drawPixel(int16_t x, int16_t y, uint16_t color);
+	void clearBuffer(void);
+	void display(bool sleep = false);
+	void displayPartial(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+	void powerUp(void) {}
+	void powerDown(void) {}
+	uint8_t *getBuffer(void) { return buffer1; }
+	uint32_t getBufferSize(void) { return buffer1_size; }
+
+protected:
+	uint8_t *buffer1;
+	uint32_t buffer1_size;
+};
+
+class Adafruit_SSD1681 : public Adafruit_EPD
+{
+public:
+	Adafruit_SSD1681(int width, int height, int16_t spi_mosi, int16_t spi_clk, int16_t dc, int16_t rst,
+					 int16_t cs, int16_t sram_cs, int16_t spi_miso, int16_t busy = -1)
+		: Adafruit_EPD(width, height, spi_mosi, spi_clk, dc, rst, cs, sram_cs, spi_miso, busy) {}
+};
+
+/**
+ * @brief Simulation control, only available on the host
+ *
+ */
+struct sim_epd_s
+{
+	uint32_t full_refreshes = 0;
+	uint32_t partial_refreshes = 0;
+	uint32_t bytes_sent = 0;
+	uint64_t busy_ms = 0;
+};
+extern sim_epd_s sim_epd;
+
+#endif // ADAFRUIT_EPD_H
@@ -0,0 +1,101 @@
+/**
+ * @file Adafruit_GFX.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for Adafruit GFX
+ *        Same drawing and text layout algorithms as the original,
+ *        so render cost and text bounds on the host match the device.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ADAFRUIT_GFX_H
+#define ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+/** Font data stored PER GLYPH */
+typedef struct
+{
+	uint16_t bitmapOffset; ///< Pointer into GFXfont->bitmap
+	uint8_t width;		   ///< Bitmap dimensions in pixels
+	uint8_t height;		   ///< Bitmap dimensions in pixels
+	uint8_t xAdvance;	   ///< Distance to advance cursor (x axis)
+	int8_t xOffset;		   ///< X dist from cursor pos to UL corner
+	int8_t yOffset;		   ///< Y dist from cursor pos to UL corner
+} GFXglyph;
+
+/** Data stored for FONT AS A WHOLE */
+typedef struct
+{
+	uint8_t *bitmap;  ///< Glyph bitmaps, concatenated
+	GFXglyph *glyph;  ///< Glyph array
+	uint16_t first;	  ///< ASCII extents (first char)
+	uint16_t last;	  ///< ASCII extents (last char)
+	uint8_t yAdvance; ///< Newline distance (y axis)
+} GFXfont;
+
+class Adafruit_GFX
+{
+public:
+	Adafruit_GFX(int16_t w, int16_t h);
+	virtual ~Adafruit_GFX() {}
+
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+	virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+	virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+	virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	virtual void fillScreen(uint16_t color);
+	virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+	void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+	void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+
+	void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y);
+	void getTextBounds(const char *string, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+	void setTextSize(uint8_t s) { setTextSize(s, s); }
+	void setTextSize(uint8_t sx, uint8_t sy);
+	void setFont(const GFXfont *f = NULL);
+	void setCursor(int16_t x, int16_t y)
+	{
+		cursor_x = x;
+		cursor_y = y;
+	}
+	void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+	void setTextColor(uint16_t c, uint16_t bg)
+	{
+		textcolor = c;
+		textbgcolor = bg;
+	}
+	void setTextWrap(bool w) { wrap = w; }
+	void setRotation(uint8_t r);
+	uint8_t getRotation(void) const { return rotation; }
+	int16_t width(void) const { return _width; }
+	int16_t height(void) const { return _height; }
+	int16_t getCursorX(void) const { return cursor_x; }
+	int16_t getCursorY(void) const { return cursor_y; }
+
+	size_t write(uint8_t c);
+	size_t print(const char *text);
+	size_t print(int value);
+
+protected:
+	void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy);
+	int16_t WIDTH;
+	int16_t HEIGHT;
+	int16_t _width;
+	int16_t _height;
+	int16_t cursor_x = 0;
+	int16_t cursor_y = 0;
+	uint16_t textcolor = 0xFFFF;
+	uint16_t textbgcolor = 0xFFFF;
+	uint8_t textsize_x = 1;
+	uint8_t textsize_y = 1;
+	uint8_t rotation = 0;
+	bool wrap = true;
+	GFXfont *gfxFont = NULL;
+};
+
+#endif // ADAFRUIT_GFX_H
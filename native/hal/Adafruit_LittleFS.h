@@ -0,0 +1,70 @@
+/**
+ * @file Adafruit_LittleFS.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Adafruit LittleFS wrapper
+ *        Files are kept in RAM for the lifetime of the process
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ADAFRUIT_LITTLEFS_H
+#define ADAFRUIT_LITTLEFS_H
+
+#include <Arduino.h>
+
+#define FILE_O_READ 0
+#define FILE_O_WRITE 1
+
+namespace Adafruit_LittleFS_Namespace
+{
+	class File;
+}
+
+class Adafruit_LittleFS
+{
+public:
+	bool begin(void) { return true; }
+	bool exists(char const *filepath);
+	bool remove(char const *filepath);
+	bool rename(char const *oldfilepath, char const *newfilepath);
+	bool mkdir(char const *dirpath) { (void)dirpath; return true; }
+	bool format(void);
+	Adafruit_LittleFS_Namespace::File open(char const *filename, uint8_t mode = FILE_O_READ);
+};
+
+namespace Adafruit_LittleFS_Namespace
+{
+	class File
+	{
+	public:
+		File(Adafruit_LittleFS &fs) : _fs(&fs) {}
+		File(char const *filename, uint8_t mode, Adafruit_LittleFS &fs) : _fs(&fs) { open(filename, mode); }
+
+		bool open(char const *filepath, uint8_t mode);
+		bool isOpen(void) { return _is_open; }
+		operator bool() { return _is_open; }
+		size_t write(uint8_t ch) { return write(&ch, 1); }
+		size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+		size_t write(const uint8_t *buf, size_t size);
+		int read(void);
+		int read(void *buf, uint16_t nbyte);
+		int available(void) { return (int)(size() - _pos); }
+		bool seek(uint32_t pos);
+		uint32_t position(void) { return _pos; }
+		uint32_t size(void);
+		bool truncate(uint32_t pos);
+		void flush(void) {}
+		void close(void) { _is_open = false; }
+
+	private:
+		Adafruit_LittleFS *_fs;
+		char _name[64] = {0};
+		uint32_t _pos = 0;
+		bool _is_open = false;
+		bool _writable = false;
+	};
+}
+
+#endif // ADAFRUIT_LITTLEFS_H
@@ -0,0 +1,16 @@
+/**
+ * @file Adafruit_Sensor.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Adafruit Unified Sensor header
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ADAFRUIT_SENSOR_H
+#define ADAFRUIT_SENSOR_H
+
+#include <Arduino.h>
+
+#endif // ADAFRUIT_SENSOR_H
@@ -0,0 +1,122 @@
+/**
+ * @file Arduino.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Arduino core of the RAK4631 (nRF52 BSP)
+ *        Only the parts used by the application are provided.
+ *        Time is simulated, delay() advances the simulated clock and
+ *        fires expired SoftwareTimer callbacks instead of blocking.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define HEX 16
+#define DEC 10
+
+// WisBlock IO mapping of the RAK4631
+#define WB_IO1 17
+#define WB_IO2 34
+#define WB_IO3 21
+#define WB_IO4 4
+#define WB_IO5 9
+#define WB_IO6 10
+#define WB_SW1 33
+#define LED_GREEN 35
+#define LED_BLUE 36
+#define LED_BUILTIN LED_GREEN
+#define PIN_WIRE_SDA 13
+#define PIN_WIRE_SCL 14
+#define MOSI 44
+#define MISO 45
+#define SCK 43
+#define SS 26
+
+/** Number of simulated GPIO's */
+#define SIM_NUM_PINS 48
+
+#ifndef min
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+/** Simulated time base */
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+/** Simulated GPIO's */
+void pinMode(uint32_t pin, uint32_t mode);
+void digitalWrite(uint32_t pin, uint32_t value);
+int digitalRead(uint32_t pin);
+#define digitalPinToInterrupt(p) (p)
+void attachInterrupt(uint32_t pin, void (*callback)(void), uint32_t mode);
+
+/**
+ * @brief Simulation control, only available on the host
+ *
+ */
+uint64_t sim_now_us(void);
+void sim_advance_us(uint64_t us);
+void sim_run_until_ms(uint64_t ms);
+bool sim_next_timer_ms(uint64_t *next_ms);
+int64_t sim_pin_high_since_ms(uint32_t pin);
+void sim_reset(void);
+
+/**
+ * @brief Minimal Serial replacement
+ *        Output is discarded unless echo is enabled or a capture buffer is set
+ *
+ */
+class HostSerial
+{
+public:
+	bool echo = false;
+	char *capture = nullptr;	 // Output is appended here if set
+	size_t capture_size = 0;	 // Size of the capture buffer
+	size_t captured = 0;		 // Number of captured characters
+	uint32_t calls = 0;			 // Number of printf calls
+	void begin(uint32_t baud) { (void)baud; }
+	void flush(void) { fflush(stdout); }
+	operator bool() { return true; }
+	int available(void) { return 0; }
+	int read(void) { return -1; }
+	size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+	size_t print(const char *text);
+	size_t print(long value, int base = DEC);
+	size_t println(const char *text = "");
+};
+extern HostSerial Serial;
+
+#include "rtos.h"
+
+#endif // ARDUINO_H
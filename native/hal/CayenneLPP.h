@@ -0,0 +1,97 @@
+/**
+ * @file CayenneLPP.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the CayenneLPP library
+ *        Only the data types used by the application, with the same
+ *        encoding and sizes as the original library.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CAYENNE_LPP_H
+#define CAYENNE_LPP_H
+
+#include <Arduino.h>
+
+#define LPP_ANALOG_INPUT 2
+#define LPP_LUMINOSITY 101
+#define LPP_TEMPERATURE 103
+#define LPP_RELATIVE_HUMIDITY 104
+#define LPP_BAROMETRIC_PRESSURE 115
+#define LPP_VOLTAGE 116
+#define LPP_CONCENTRATION 125
+
+#define LPP_ANALOG_INPUT_SIZE 2
+#define LPP_LUMINOSITY_SIZE 2
+#define LPP_TEMPERATURE_SIZE 2
+#define LPP_RELATIVE_HUMIDITY_SIZE 1
+#define LPP_BAROMETRIC_PRESSURE_SIZE 2
+#define LPP_VOLTAGE_SIZE 2
+#define LPP_CONCENTRATION_SIZE 2
+
+#define LPP_ERROR_OK 0
+#define LPP_ERROR_OVERFLOW 1
+#define LPP_ERROR_UNKOWN_TYPE 2
+
+class CayenneLPP
+{
+public:
+	CayenneLPP(uint8_t size) : _maxsize(size)
+	{
+		_buffer = (uint8_t *)malloc(size);
+		_cursor = 0;
+	}
+	~CayenneLPP() { free(_buffer); }
+
+	void reset(void)
+	{
+		_cursor = 0;
+		_error = LPP_ERROR_OK;
+	}
+	uint8_t getSize(void) { return _cursor; }
+	uint8_t *getBuffer(void) { return _buffer; }
+	uint8_t copy(uint8_t *buffer)
+	{
+		memcpy(buffer, _buffer, _cursor);
+		return _cursor;
+	}
+	uint8_t getError(void) { return _error; }
+
+	uint8_t addAnalogInput(uint8_t channel, float value) { return addField(LPP_ANALOG_INPUT, channel, value, 100, LPP_ANALOG_INPUT_SIZE); }
+	uint8_t addLuminosity(uint8_t channel, uint32_t value) { return addField(LPP_LUMINOSITY, channel, (float)value, 1, LPP_LUMINOSITY_SIZE); }
+	uint8_t addTemperature(uint8_t channel, float value) { return addField(LPP_TEMPERATURE, channel, value, 10, LPP_TEMPERATURE_SIZE); }
+	uint8_t addRelativeHumidity(uint8_t channel, float value) { return addField(LPP_RELATIVE_HUMIDITY, channel, value, 2, LPP_RELATIVE_HUMIDITY_SIZE); }
+	uint8_t addBarometricPressure(uint8_t channel, float value) { return addField(LPP_BAROMETRIC_PRESSURE, channel, value, 10, LPP_BAROMETRIC_PRESSURE_SIZE); }
+	uint8_t addVoltage(uint8_t channel, float value) { return addField(LPP_VOLTAGE, channel, value, 100, LPP_VOLTAGE_SIZE); }
+	uint8_t addConcentration(uint8_t channel, uint32_t value) { return addField(LPP_CONCENTRATION, channel, (float)value, 1, LPP_CONCENTRATION_SIZE); }
+
+protected:
+	uint8_t *_buffer;
+	uint8_t _maxsize;
+	uint8_t _cursor;
+	uint8_t _error = LPP_ERROR_OK;
+
+private:
+	uint8_t addField(uint8_t type, uint8_t channel, float value, uint32_t multiplier, uint8_t size)
+	{
+		if ((_cursor + size + 2) > _maxsize)
+		{
+			_error = LPP_ERROR_OVERFLOW;
+			return 0;
+		}
+		int32_t raw = (int32_t)roundf(value * multiplier);
+		_buffer[_cursor++] = channel;
+		_buffer[_cursor++] = type;
+		for (int8_t idx = size - 1; idx >= 0; idx--)
+		{
+			_buffer[_cursor + idx] = raw & 0xFF;
+			raw >>= 8;
+		}
+		_cursor += size;
+		return _cursor;
+	}
+};
+
+#endif // CAYENNE_LPP_H
@@ -0,0 +1,76 @@
+/**
+ * @file ClosedCube_OPT3001.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the ClosedCube OPT3001 library (RAK1903)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CLOSEDCUBE_OPT3001_H
+#define CLOSEDCUBE_OPT3001_H
+
+#include <Wire.h>
+
+typedef enum
+{
+	NO_ERROR = 0,
+	TIMEOUT_ERROR = -100,
+	WIRE_I2C_DATA_TOO_LOG = -10,
+	WIRE_I2C_RECEIVED_NACK_ON_ADDRESS = -20,
+	WIRE_I2C_RECEIVED_NACK_ON_DATA = -30,
+	WIRE_I2C_UNKNOW_ERROR = -40
+} OPT3001_ErrorCode;
+
+typedef union
+{
+	struct
+	{
+		uint8_t FaultCount : 2;
+		uint8_t MaskExponent : 1;
+		uint8_t Polarity : 1;
+		uint8_t Latch : 1;
+		uint8_t FlagLow : 1;
+		uint8_t FlagHigh : 1;
+		uint8_t ConversionReady : 1;
+		uint8_t OverflowFlag : 1;
+		uint8_t ModeOfConversionOperation : 2;
+		uint8_t ConvertionTime : 1;
+		uint8_t RangeNumber : 4;
+	};
+	uint16_t rawData;
+} OPT3001_Config;
+
+struct OPT3001
+{
+	float lux;
+	OPT3001_ErrorCode error;
+};
+
+class ClosedCube_OPT3001
+{
+public:
+	OPT3001_ErrorCode begin(uint8_t address)
+	{
+		_address = address;
+		return sim_i2c_transfer(_address, 1, 2) ? NO_ERROR : WIRE_I2C_RECEIVED_NACK_ON_ADDRESS;
+	}
+	OPT3001_ErrorCode writeConfig(OPT3001_Config config)
+	{
+		(void)config;
+		return sim_i2c_transfer(_address, 3, 0) ? NO_ERROR : WIRE_I2C_RECEIVED_NACK_ON_ADDRESS;
+	}
+	OPT3001 readResult(void)
+	{
+		OPT3001 result;
+		result.error = sim_i2c_transfer(_address, 1, 2) ? NO_ERROR : WIRE_I2C_RECEIVED_NACK_ON_ADDRESS;
+		result.lux = 320.0;
+		return result;
+	}
+
+private:
+	uint8_t _address = 0x44;
+};
+
+#endif // CLOSEDCUBE_OPT3001_H
@@ -0,0 +1,35 @@
+/**
+ * @file InternalFileSystem.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the nRF52 internal flash file system
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef INTERNALFILESYSTEM_H
+#define INTERNALFILESYSTEM_H
+
+#include "Adafruit_LittleFS.h"
+
+class InternalFileSystem : public Adafruit_LittleFS
+{
+};
+
+extern InternalFileSystem InternalFS;
+
+/**
+ * @brief Simulation control, only available on the host
+ *        Bytes written to and read from the simulated flash
+ *
+ */
+struct sim_flash_s
+{
+	uint32_t bytes_written = 0;
+	uint32_t bytes_read = 0;
+	uint32_t opens = 0;
+};
+extern sim_flash_s sim_flash;
+
+#endif // INTERNALFILESYSTEM_H
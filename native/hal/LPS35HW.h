@@ -0,0 +1,75 @@
+/**
+ * @file LPS35HW.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the LPS35HW library (RAK1902 LPS22HB)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef LPS35HW_H
+#define LPS35HW_H
+
+#include <Wire.h>
+
+class LPS35HW
+{
+public:
+	enum OutputRate
+	{
+		OutputRate_OneShot = 0,
+		OutputRate_1Hz,
+		OutputRate_10Hz,
+		OutputRate_25Hz,
+		OutputRate_50Hz,
+		OutputRate_75Hz
+	};
+	enum LowPassFilter
+	{
+		LowPassFilter_Off = 0,
+		LowPassFilter_ODR9 = 2,
+		LowPassFilter_ODR20 = 3
+	};
+
+	bool begin(TwoWire *wire)
+	{
+		(void)wire;
+		// WHO_AM_I
+		return sim_i2c_transfer(0x5c, 1, 1);
+	}
+	void setLowPower(bool low_power)
+	{
+		(void)low_power;
+		sim_i2c_transfer(0x5c, 1, 1);
+		sim_i2c_transfer(0x5c, 2, 0);
+	}
+	void setOutputRate(OutputRate rate)
+	{
+		(void)rate;
+		sim_i2c_transfer(0x5c, 1, 1);
+		sim_i2c_transfer(0x5c, 2, 0);
+	}
+	void setLowPassFilter(LowPassFilter filter)
+	{
+		(void)filter;
+		sim_i2c_transfer(0x5c, 1, 1);
+		sim_i2c_transfer(0x5c, 2, 0);
+	}
+	void requestOneShot(void)
+	{
+		sim_i2c_transfer(0x5c, 2, 0);
+	}
+	float readPressure(void)
+	{
+		sim_i2c_transfer(0x5c, 1, 3);
+		return 1012.5 + (millis() / 60000) % 5 * 0.25;
+	}
+	float readTemp(void)
+	{
+		sim_i2c_transfer(0x5c, 1, 2);
+		return 24.0;
+	}
+};
+
+#endif // LPS35HW_H
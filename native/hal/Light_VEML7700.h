@@ -0,0 +1,78 @@
+/**
+ * @file Light_VEML7700.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the RAKwireless VEML7700 library (RAK12010)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef LIGHT_VEML7700_H
+#define LIGHT_VEML7700_H
+
+#include <Wire.h>
+
+#define VEML7700_ADDRESS 0x10
+
+#define VEML7700_GAIN_1 0x00
+#define VEML7700_GAIN_2 0x01
+#define VEML7700_GAIN_1_8 0x02
+#define VEML7700_GAIN_1_4 0x03
+#define VEML7700_IT_100MS 0x00
+#define VEML7700_IT_200MS 0x01
+#define VEML7700_IT_400MS 0x02
+#define VEML7700_IT_800MS 0x03
+#define VEML7700_IT_50MS 0x08
+#define VEML7700_IT_25MS 0x0C
+#define VEML7700_POWERSAVE_MODE1 0x00
+#define VEML7700_POWERSAVE_MODE2 0x01
+#define VEML7700_POWERSAVE_MODE3 0x02
+#define VEML7700_POWERSAVE_MODE4 0x03
+
+class Light_VEML7700
+{
+public:
+	bool begin(TwoWire *wire = &Wire)
+	{
+		(void)wire;
+		return sim_i2c_transfer(VEML7700_ADDRESS, 3, 0);
+	}
+	void setGain(uint8_t gain)
+	{
+		(void)gain;
+		modify();
+	}
+	void setIntegrationTime(uint8_t it)
+	{
+		(void)it;
+		modify();
+	}
+	void powerSaveEnable(bool enable)
+	{
+		(void)enable;
+		modify();
+	}
+	void setPowerSaveMode(uint8_t mode)
+	{
+		(void)mode;
+		modify();
+	}
+	float readLux(void) { return read(318.0); }
+	float readWhite(void) { return read(412.0); }
+	float readALS(void) { return read(2650.0); }
+
+private:
+	void modify(void)
+	{
+		sim_i2c_transfer(VEML7700_ADDRESS, 1, 2);
+		sim_i2c_transfer(VEML7700_ADDRESS, 3, 0);
+	}
+	float read(float value)
+	{
+		sim_i2c_transfer(VEML7700_ADDRESS, 1, 2);
+		return value;
+	}
+};
+
+#endif // LIGHT_VEML7700_H
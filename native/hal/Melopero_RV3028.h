@@ -0,0 +1,73 @@
+/**
+ * @file Melopero_RV3028.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Melopero RV3028 library (RAK12002)
+ *        Time is derived from the simulated clock
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef MELOPERO_RV3028_H
+#define MELOPERO_RV3028_H
+
+#include <Wire.h>
+
+#define RV3028_ADDRESS 0x52
+
+class Melopero_RV3028
+{
+public:
+	void initI2C(TwoWire &wire = Wire) { (void)wire; }
+	void writeToRegister(uint8_t reg, uint8_t value)
+	{
+		(void)reg;
+		(void)value;
+		sim_i2c_transfer(RV3028_ADDRESS, 2, 0);
+	}
+	uint8_t readFromRegister(uint8_t reg)
+	{
+		(void)reg;
+		sim_i2c_transfer(RV3028_ADDRESS, 1, 1);
+		return 0;
+	}
+	void useEEPROM(bool disableRefresh = true)
+	{
+		(void)disableRefresh;
+		sim_i2c_transfer(RV3028_ADDRESS, 1, 1);
+		sim_i2c_transfer(RV3028_ADDRESS, 2, 0);
+	}
+	void set24HourMode(void)
+	{
+		sim_i2c_transfer(RV3028_ADDRESS, 1, 1);
+		sim_i2c_transfer(RV3028_ADDRESS, 2, 0);
+	}
+	void setTime(uint16_t year, uint8_t month, uint8_t weekday, uint8_t date, uint8_t hour, uint8_t minute, uint8_t second)
+	{
+		(void)year;
+		(void)month;
+		(void)weekday;
+		(void)date;
+		(void)hour;
+		(void)minute;
+		(void)second;
+		sim_i2c_transfer(RV3028_ADDRESS, 8, 0);
+	}
+	uint16_t getYear(void) { return 2000 + reg(24); }
+	uint8_t getMonth(void) { return reg(10); }
+	uint8_t getWeekday(void) { return reg(5); }
+	uint8_t getDate(void) { return reg(16); }
+	uint8_t getHour(void) { return reg((8 + millis() / 3600000) % 24); }
+	uint8_t getMinute(void) { return reg((millis() / 60000) % 60); }
+	uint8_t getSecond(void) { return reg((millis() / 1000) % 60); }
+
+private:
+	uint8_t reg(uint32_t value)
+	{
+		sim_i2c_transfer(RV3028_ADDRESS, 1, 1);
+		return (uint8_t)value;
+	}
+};
+
+#endif // MELOPERO_RV3028_H
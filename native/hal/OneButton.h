@@ -0,0 +1,37 @@
+/**
+ * @file OneButton.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the OneButton library
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef ONEBUTTON_H
+#define ONEBUTTON_H
+
+#include <Arduino.h>
+
+typedef void (*callbackFunction)(void);
+
+class OneButton
+{
+public:
+	OneButton(int pin, bool activeLow = true, bool pullupActive = true)
+	{
+		(void)pin;
+		(void)activeLow;
+		(void)pullupActive;
+	}
+	void tick(void) {}
+	void attachClick(callbackFunction cb) { (void)cb; }
+	void attachDoubleClick(callbackFunction cb) { (void)cb; }
+	void attachMultiClick(callbackFunction cb) { (void)cb; }
+	void attachLongPressStart(callbackFunction cb) { (void)cb; }
+	void attachLongPressStop(callbackFunction cb) { (void)cb; }
+	void setPressTicks(int ticks) { (void)ticks; }
+	int getNumberClicks(void) { return 0; }
+};
+
+#endif // ONEBUTTON_H
@@ -0,0 +1,57 @@
+/**
+ * @file RAK12039_PMSA003I.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the RAK12039 PMSA003I library
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RAK12039_PMSA003I_H
+#define RAK12039_PMSA003I_H
+
+#include <Wire.h>
+
+#define PMSA003I_ADDRESS 0x12
+
+typedef struct
+{
+	uint16_t pm10_standard;
+	uint16_t pm25_standard;
+	uint16_t pm100_standard;
+	uint16_t pm10_env;
+	uint16_t pm25_env;
+	uint16_t pm100_env;
+	uint16_t particles_03um;
+	uint16_t particles_05um;
+	uint16_t particles_10um;
+	uint16_t particles_25um;
+	uint16_t particles_50um;
+	uint16_t particles_100um;
+} PMSA_Data_t;
+
+class RAK_PMSA003I
+{
+public:
+	bool begin(TwoWire &wire = Wire)
+	{
+		(void)wire;
+		return sim_i2c_transfer(PMSA003I_ADDRESS, 0, 1);
+	}
+	bool readDate(PMSA_Data_t *data)
+	{
+		// One complete 32 byte frame
+		if (!sim_i2c_transfer(PMSA003I_ADDRESS, 0, 32))
+		{
+			return false;
+		}
+		memset(data, 0, sizeof(PMSA_Data_t));
+		data->pm10_standard = data->pm10_env = 4;
+		data->pm25_standard = data->pm25_env = 7;
+		data->pm100_standard = data->pm100_env = 9;
+		return true;
+	}
+};
+
+#endif // RAK12039_PMSA003I_H
@@ -0,0 +1,69 @@
+/**
+ * @file SPI.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for SPIClass of the nRF52 BSP
+ *        Every transfer advances the simulated clock by its bus time
+ *        at the clock of the transaction. Single byte transfers have
+ *        the overhead of a started SPIM transfer, buffer transfers
+ *        are sent with one EasyDMA transfer.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef SPI_H
+#define SPI_H
+
+#include <Arduino.h>
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+/** Overhead of starting one SPIM transfer on the nRF52 in ns */
+#define SIM_SPI_XFER_NS 2000
+
+class SPISettings
+{
+public:
+	SPISettings(uint32_t clock = 4000000, uint8_t bit_order = MSBFIRST, uint8_t data_mode = SPI_MODE0)
+		: clock(clock), bit_order(bit_order), data_mode(data_mode) {}
+	uint32_t clock;
+	uint8_t bit_order;
+	uint8_t data_mode;
+};
+
+class SPIClass
+{
+public:
+	void begin(void) { started = true; }
+	void end(void) { started = false; }
+	void beginTransaction(SPISettings settings);
+	void endTransaction(void) {}
+	uint8_t transfer(uint8_t data);
+	void transfer(const void *tx_buf, void *rx_buf, size_t count);
+
+	// Simulation statistics
+	bool started = false;
+	uint32_t transactions = 0;
+	uint32_t xfers = 0;
+	uint32_t bytes = 0;
+	uint64_t bus_time_ns = 0;
+	uint8_t *capture = nullptr; // Sent bytes are appended here if set
+	size_t capture_size = 0;	// Size of the capture buffer
+	size_t captured = 0;		// Number of captured bytes
+
+private:
+	void send(const uint8_t *data, size_t count);
+	uint32_t _clock = 4000000;
+	uint64_t _pending_ns = 0;
+};
+
+extern SPIClass SPI;
+
+#endif // SPI_H
@@ -0,0 +1,67 @@
+/**
+ * @file SensirionI2CSgp40.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Sensirion SGP40 and Sensirion Core libraries (RAK12047)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef SENSIRION_I2C_SGP40_H
+#define SENSIRION_I2C_SGP40_H
+
+#include <Wire.h>
+
+#define SGP40_ADDRESS 0x59
+
+inline void errorToString(uint16_t error, char errorMessage[], size_t errorMessageSize)
+{
+	snprintf(errorMessage, errorMessageSize, "I2C error 0x%04X", error);
+}
+
+class SensirionI2CSgp40
+{
+public:
+	void begin(TwoWire &wire) { (void)wire; }
+	uint16_t getSerialNumber(uint16_t serialNumber[], uint8_t serialNumberSize)
+	{
+		if (!sim_i2c_transfer(SGP40_ADDRESS, 2, 0))
+		{
+			return 0x0102;
+		}
+		delay(1);
+		sim_i2c_transfer(SGP40_ADDRESS, 0, 9);
+		for (uint8_t idx = 0; idx < serialNumberSize; idx++)
+		{
+			serialNumber[idx] = 0x1234 + idx;
+		}
+		return 0;
+	}
+	uint16_t executeSelfTest(uint16_t &testResult)
+	{
+		if (!sim_i2c_transfer(SGP40_ADDRESS, 2, 0))
+		{
+			return 0x0102;
+		}
+		delay(320);
+		sim_i2c_transfer(SGP40_ADDRESS, 0, 3);
+		testResult = 0xD400;
+		return 0;
+	}
+	uint16_t measureRawSignal(uint16_t relativeHumidity, uint16_t temperature, uint16_t &srawVoc)
+	{
+		(void)relativeHumidity;
+		(void)temperature;
+		if (!sim_i2c_transfer(SGP40_ADDRESS, 8, 0))
+		{
+			return 0x0102;
+		}
+		delay(30);
+		sim_i2c_transfer(SGP40_ADDRESS, 0, 3);
+		srawVoc = 30000;
+		return 0;
+	}
+};
+
+#endif // SENSIRION_I2C_SGP40_H
@@ -0,0 +1,104 @@
+/**
+ * @file SparkFun_SCD30_Arduino_Library.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the SparkFun SCD30 library (RAK12037)
+ *        New data is available every measurement interval after
+ *        beginMeasuring()
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef SPARKFUN_SCD30_H
+#define SPARKFUN_SCD30_H
+
+#include <Wire.h>
+
+#define SCD30_ADDRESS 0x61
+
+class SCD30
+{
+public:
+	bool begin(TwoWire &wire, bool autoCalibrate = false, bool measBegin = true)
+	{
+		(void)wire;
+		(void)autoCalibrate;
+		// Firmware version
+		if (!sim_i2c_transfer(SCD30_ADDRESS, 2, 3))
+		{
+			return false;
+		}
+		if (measBegin)
+		{
+			return beginMeasuring();
+		}
+		return true;
+	}
+	bool setMeasurementInterval(uint16_t interval)
+	{
+		_interval_s = interval;
+		return sim_i2c_transfer(SCD30_ADDRESS, 5, 0);
+	}
+	uint16_t getMeasurementInterval(void) { return _interval_s; }
+	bool setAutoSelfCalibration(bool enable)
+	{
+		(void)enable;
+		return sim_i2c_transfer(SCD30_ADDRESS, 5, 0);
+	}
+	bool beginMeasuring(uint16_t pressureOffset = 0)
+	{
+		(void)pressureOffset;
+		_measuring = true;
+		_next_data_ms = millis() + _interval_s * 1000;
+		return sim_i2c_transfer(SCD30_ADDRESS, 5, 0);
+	}
+	bool StopMeasurement(void)
+	{
+		_measuring = false;
+		return sim_i2c_transfer(SCD30_ADDRESS, 2, 0);
+	}
+	bool dataAvailable(void)
+	{
+		if (!sim_i2c_transfer(SCD30_ADDRESS, 2, 0) || !sim_i2c_transfer(SCD30_ADDRESS, 0, 3))
+		{
+			return false;
+		}
+		return _measuring && (millis() >= _next_data_ms);
+	}
+	uint16_t getCO2(void)
+	{
+		read_measurement();
+		return 612 + (millis() / 60000) % 20 * 4;
+	}
+	float getTemperature(void)
+	{
+		read_measurement();
+		return 24.6;
+	}
+	float getHumidity(void)
+	{
+		read_measurement();
+		return 45.0;
+	}
+
+private:
+	void read_measurement(void)
+	{
+		// All three values are read in one 18 byte transfer, the library caches them
+		if (_measuring && (millis() >= _next_data_ms))
+		{
+			sim_i2c_transfer(SCD30_ADDRESS, 2, 0);
+			sim_i2c_transfer(SCD30_ADDRESS, 0, 18);
+			while (_next_data_ms <= millis())
+			{
+				_next_data_ms += _interval_s * 1000;
+			}
+		}
+	}
+	uint16_t _interval_s = 2;
+	bool _measuring = false;
+	uint32_t _next_data_ms = 0;
+};
+
+#endif // SPARKFUN_SCD30_H
@@ -0,0 +1,62 @@
+/**
+ * @file SparkFun_SHTC3.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the SparkFun SHTC3 library (RAK1901)
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef SPARKFUN_SHTC3_H
+#define SPARKFUN_SHTC3_H
+
+#include <Wire.h>
+
+typedef enum
+{
+	SHTC3_Status_Nominal = 0,
+	SHTC3_Status_Error,
+	SHTC3_Status_CRC_Fail,
+	SHTC3_Status_ID_Fail
+} SHTC3_Status_TypeDef;
+
+class SHTC3
+{
+public:
+	SHTC3_Status_TypeDef lastStatus = SHTC3_Status_Error;
+
+	SHTC3_Status_TypeDef begin(TwoWire &wire)
+	{
+		(void)wire;
+		// Read ID register
+		lastStatus = sim_i2c_transfer(0x70, 2, 3) ? SHTC3_Status_Nominal : SHTC3_Status_ID_Fail;
+		return lastStatus;
+	}
+	SHTC3_Status_TypeDef wake(bool hold)
+	{
+		(void)hold;
+		sim_i2c_transfer(0x70, 2, 0);
+		// Wake-up time
+		delayMicroseconds(240);
+		return lastStatus;
+	}
+	SHTC3_Status_TypeDef sleep(bool hold)
+	{
+		(void)hold;
+		sim_i2c_transfer(0x70, 2, 0);
+		return lastStatus;
+	}
+	SHTC3_Status_TypeDef update(void)
+	{
+		// Normal mode measurement with clock stretching takes ~12ms
+		sim_i2c_transfer(0x70, 2, 0);
+		delay(12);
+		lastStatus = sim_i2c_transfer(0x70, 0, 6) ? SHTC3_Status_Nominal : SHTC3_Status_Error;
+		return lastStatus;
+	}
+	float toDegC(void) { return 23.5 + (millis() / 60000) % 10 * 0.1; }
+	float toPercent(void) { return 48.0 + (millis() / 60000) % 7 * 0.5; }
+};
+
+#endif // SPARKFUN_SHTC3_H
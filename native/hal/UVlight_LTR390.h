@@ -0,0 +1,95 @@
+/**
+ * @file UVlight_LTR390.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the RAK12019 LTR390 library
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef UVLIGHT_LTR390_H
+#define UVLIGHT_LTR390_H
+
+#include <Wire.h>
+
+#define LTR390_ADDRESS 0x53
+
+typedef enum
+{
+	LTR390_MODE_ALS,
+	LTR390_MODE_UVS,
+} ltr390_mode_t;
+
+typedef enum
+{
+	LTR390_GAIN_1 = 0,
+	LTR390_GAIN_3,
+	LTR390_GAIN_6,
+	LTR390_GAIN_9,
+	LTR390_GAIN_18,
+} ltr390_gain_t;
+
+typedef enum
+{
+	LTR390_RESOLUTION_20BIT,
+	LTR390_RESOLUTION_19BIT,
+	LTR390_RESOLUTION_18BIT,
+	LTR390_RESOLUTION_17BIT,
+	LTR390_RESOLUTION_16BIT,
+	LTR390_RESOLUTION_13BIT,
+} ltr390_resolution_t;
+
+class UVlight_LTR390
+{
+public:
+	bool init(void) { return sim_i2c_transfer(LTR390_ADDRESS, 1, 1); }
+	void setMode(ltr390_mode_t mode)
+	{
+		_mode = mode;
+		sim_i2c_transfer(LTR390_ADDRESS, 2, 0);
+	}
+	ltr390_mode_t getMode(void)
+	{
+		sim_i2c_transfer(LTR390_ADDRESS, 1, 1);
+		return _mode;
+	}
+	void setGain(ltr390_gain_t gain)
+	{
+		(void)gain;
+		sim_i2c_transfer(LTR390_ADDRESS, 2, 0);
+	}
+	void setResolution(ltr390_resolution_t res)
+	{
+		(void)res;
+		sim_i2c_transfer(LTR390_ADDRESS, 2, 0);
+	}
+	void setThresholds(uint32_t lower, uint32_t higher)
+	{
+		(void)lower;
+		(void)higher;
+		sim_i2c_transfer(LTR390_ADDRESS, 7, 0);
+	}
+	void configInterrupt(bool enable, ltr390_mode_t source, uint8_t persistance = 0)
+	{
+		(void)enable;
+		(void)source;
+		(void)persistance;
+		sim_i2c_transfer(LTR390_ADDRESS, 2, 0);
+	}
+	bool newDataAvailable(void) { return sim_i2c_transfer(LTR390_ADDRESS, 1, 1); }
+	uint32_t readALS(void) { return read(1200); }
+	uint32_t readUVS(void) { return read(35); }
+	float getLUX(void) { return (float)readALS() * 0.6; }
+	float getUVI(void) { return (float)readUVS() / 2300.0; }
+
+private:
+	uint32_t read(uint32_t value)
+	{
+		sim_i2c_transfer(LTR390_ADDRESS, 1, 3);
+		return value;
+	}
+	ltr390_mode_t _mode = LTR390_MODE_ALS;
+};
+
+#endif // UVLIGHT_LTR390_H
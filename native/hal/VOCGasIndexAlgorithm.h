@@ -0,0 +1,42 @@
+/**
+ * @file VOCGasIndexAlgorithm.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the Sensirion Gas Index Algorithm
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef VOC_GAS_INDEX_ALGORITHM_H
+#define VOC_GAS_INDEX_ALGORITHM_H
+
+#include <Arduino.h>
+
+class VOCGasIndexAlgorithm
+{
+public:
+	VOCGasIndexAlgorithm(int32_t sampling_interval = 1) { (void)sampling_interval; }
+	void get_tuning_parameters(int32_t &index_offset, int32_t &learning_time_offset_hours,
+							   int32_t &learning_time_gain_hours, int32_t &gating_max_duration_minutes,
+							   int32_t &std_initial, int32_t &gain_factor)
+	{
+		index_offset = 100;
+		learning_time_offset_hours = 12;
+		learning_time_gain_hours = 12;
+		gating_max_duration_minutes = 180;
+		std_initial = 50;
+		gain_factor = 230;
+	}
+	int32_t process(int32_t sraw)
+	{
+		(void)sraw;
+		_samples++;
+		return 100 + (_samples % 9);
+	}
+
+private:
+	uint32_t _samples = 0;
+};
+
+#endif // VOC_GAS_INDEX_ALGORITHM_H
@@ -0,0 +1,84 @@
+/**
+ * @file Wire.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for TwoWire
+ *        Simulates an I2C bus with a configurable set of devices.
+ *        Every transfer advances the simulated clock by its bus time
+ *        at the selected clock speed.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <Arduino.h>
+
+/** Size of the TwoWire RX/TX buffer on the nRF52 */
+#define WIRE_BUFFER_SIZE 64
+
+/**
+ * @brief Simulated I2C device
+ *        A device can be bound to a power/enable pin, it ACKs only
+ *        after the pin was HIGH for at least wake_ms.
+ *        Reads return rx_data if set, otherwise 0.
+ *
+ */
+struct sim_i2c_dev_s
+{
+	uint8_t addr;
+	bool present;
+	int16_t power_pin;
+	uint32_t wake_ms;
+	const uint8_t *rx_data;
+	size_t rx_data_len;
+	uint32_t force_nacks;
+};
+
+class TwoWire
+{
+public:
+	void begin(void);
+	void end(void);
+	void setClock(uint32_t clock);
+	uint32_t getClock(void) { return _clock; }
+	void beginTransmission(uint8_t address);
+	size_t write(uint8_t data);
+	size_t write(const uint8_t *data, size_t len);
+	uint8_t endTransmission(bool stop = true);
+	uint8_t requestFrom(uint8_t address, size_t len, bool stop = true);
+	int available(void);
+	int read(void);
+
+	// Simulation statistics
+	uint32_t transactions = 0;
+	uint32_t bytes = 0;
+	uint32_t nacks = 0;
+	uint64_t bus_time_us = 0;
+
+private:
+	uint32_t _clock = 100000;
+	uint8_t _tx_addr = 0;
+	uint8_t _rx_addr = 0;
+	size_t _tx_len = 0;
+	size_t _rx_len = 0;
+	size_t _rx_idx = 0;
+};
+
+extern TwoWire Wire;
+
+/**
+ * @brief Simulation control, only available on the host
+ *
+ */
+void sim_i2c_clear(void);
+void sim_i2c_add(uint8_t addr, int16_t power_pin = -1, uint32_t wake_ms = 0);
+bool sim_i2c_acks(uint8_t addr);
+bool sim_i2c_transfer(uint8_t addr, size_t tx_len, size_t rx_len);
+void sim_i2c_set_rx(uint8_t addr, const uint8_t *data, size_t len);
+void sim_i2c_nack(uint8_t addr, uint32_t count);
+int sim_i2c_read(uint8_t addr, size_t idx);
+
+#endif // WIRE_H
@@ -0,0 +1,186 @@
+/**
+ * @file WisBlock-API-V2.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the parts of WisBlock-API-V2 used by the application
+ *        LoRa/LoRaWAN sends are captured instead of transmitted.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WISBLOCK_API_H
+#define WISBLOCK_API_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+/** Wake up events, the application can define its own events in the upper bits */
+#define NO_EVENT 0
+#define STATUS 0b0000000000000001
+#define N_STATUS 0b1111111111111110
+#define BLE_CONFIG 0b0000000000000010
+#define N_BLE_CONFIG 0b1111111111111101
+#define BLE_DATA 0b0000000000000100
+#define N_BLE_DATA 0b1111111111111011
+#define LORA_DATA 0b0000000000001000
+#define N_LORA_DATA 0b1111111111110111
+#define LORA_TX_FIN 0b0000000000010000
+#define N_LORA_TX_FIN 0b1111111111101111
+#define AT_CMD 0b0000000000100000
+#define N_AT_CMD 0b1111111111011111
+#define LORA_JOIN_FIN 0b0000000001000000
+#define N_LORA_JOIN_FIN 0b1111111110111111
+
+/** Event flags for the app loop */
+extern volatile uint16_t g_task_event_type;
+
+void api_wake_loop(uint16_t reason);
+void api_set_version(uint16_t sw_1 = 1, uint16_t sw_2 = 0, uint16_t sw_3 = 0);
+void api_log_settings(void);
+void api_reset(void);
+void api_timer_restart(uint32_t new_time);
+void save_settings(void);
+float read_batt(void);
+void restart_advertising(uint16_t timeout);
+void at_serial_input(uint8_t cmd);
+
+extern uint16_t g_sw_ver_1;
+extern uint16_t g_sw_ver_2;
+extern uint16_t g_sw_ver_3;
+
+/** LoRaWAN settings, same layout as in the API */
+struct s_lorawan_settings
+{
+	uint8_t valid_mark_1 = 0xAA;
+	uint8_t valid_mark_2 = 0x55;
+	uint8_t node_device_eui[8] = {0xAC, 0x1F, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x01};
+	uint8_t node_app_eui[8] = {0};
+	uint8_t node_app_key[16] = {0};
+	uint32_t node_dev_addr = 0x26021FB4;
+	uint8_t node_nws_key[16] = {0};
+	uint8_t node_apps_key[16] = {0};
+	bool otaa_enabled = true;
+	bool adr_enabled = false;
+	bool public_network = true;
+	bool duty_cycle_enabled = false;
+	uint32_t send_repeat_time = 60000;
+	uint8_t join_trials = 5;
+	uint8_t tx_power = 0;
+	uint8_t data_rate = 3;
+	uint8_t lora_class = 0;
+	uint8_t subband_channels = 1;
+	bool auto_join = true;
+	uint8_t app_port = 2;
+	bool confirmed_msg_enabled = false;
+	uint8_t lora_region = 10;
+	bool lorawan_enable = true;
+	uint32_t p2p_frequency = 916000000;
+	uint8_t p2p_tx_power = 22;
+	uint8_t p2p_bandwidth = 0;
+	uint8_t p2p_sf = 7;
+	uint8_t p2p_cr = 1;
+	uint8_t p2p_preamble_len = 8;
+	uint16_t p2p_symbol_timeout = 0;
+	bool resetRequest = true;
+};
+extern s_lorawan_settings g_lorawan_settings;
+
+/** Result of LoRaWAN send requests */
+typedef enum
+{
+	LMH_SUCCESS = 0,
+	LMH_BUSY = -1,
+	LMH_ERROR = -2,
+} lmh_error_status;
+
+lmh_error_status send_lora_packet(uint8_t *data, uint8_t size, uint8_t fport = 0);
+
+/** Payload size check of the LoRaMAC, same as in SX126x-Arduino */
+typedef enum
+{
+	LORAMAC_STATUS_OK = 0,
+	LORAMAC_STATUS_LENGTH_ERROR = 8,
+} LoRaMacStatus_t;
+
+typedef struct sLoRaMacTxInfo
+{
+	uint8_t MaxPossiblePayload;
+	uint8_t CurrentPayloadSize;
+} LoRaMacTxInfo_t;
+
+LoRaMacStatus_t LoRaMacQueryTxPossible(uint8_t size, LoRaMacTxInfo_t *txInfo);
+bool send_p2p_packet(uint8_t *data, uint8_t size);
+lmh_error_status lmh_join(void);
+
+extern bool g_lpwan_has_joined;
+extern bool g_join_result;
+extern bool g_rx_fin_result;
+extern uint8_t g_rx_lora_data[256];
+extern uint8_t g_rx_data_len;
+extern int16_t g_last_rssi;
+extern int8_t g_last_snr;
+extern uint8_t g_last_fport;
+extern char *region_names[];
+extern char *bandwidths[];
+
+/** BLE */
+extern bool g_enable_ble;
+extern bool g_ble_uart_is_connected;
+extern char g_ble_dev_name[];
+class HostBleUart
+{
+public:
+	int available(void) { return 0; }
+	int read(void) { return -1; }
+	size_t printf(const char *format, ...) { (void)format; return 0; }
+};
+extern HostBleUart g_ble_uart;
+
+/** AT command handling */
+#define AT_SUCCESS (0)
+#define AT_ERRNO_NOSUPP (1)
+#define AT_ERRNO_NOALLOW (2)
+#define AT_ERRNO_PARA_VAL (5)
+#define AT_ERRNO_PARA_NUM (6)
+#define AT_ERRNO_EXEC_FAIL (7)
+#define AT_ERRNO_SYS (8)
+#define AT_CB_PRINT (0xFF)
+#define AT_ERRNO_PARA_FAIL AT_ERRNO_PARA_VAL
+
+typedef struct atcmd_s
+{
+	const char *cmd_name;
+	const char *cmd_desc;
+	int (*query_cmd)(void);
+	int (*exec_cmd)(char *str);
+	int (*exec_cmd_no_para)(void);
+	const char *permission;
+} atcmd_t;
+
+extern atcmd_t *g_user_at_cmd_list __attribute__((weak));
+extern uint8_t g_user_at_cmd_num __attribute__((weak));
+
+#define PRINTF(...) Serial.printf(__VA_ARGS__)
+#define AT_PRINTF(...) Serial.printf(__VA_ARGS__)
+
+/**
+ * @brief Simulation control, only available on the host
+ *        Captures the last packet handed to the LoRa stack
+ *
+ */
+struct sim_lora_s
+{
+	uint32_t packets = 0;
+	uint32_t failed = 0; // Sends that were too large or returned force_result
+	uint32_t bytes = 0;
+	uint8_t last_size = 0;
+	uint8_t last_fport = 0;
+	uint8_t last_packet[256];
+	const uint8_t *last_data = NULL; // Buffer handed to the send function
+	uint8_t max_payload = 222;
+	lmh_error_status force_result = LMH_SUCCESS;
+};
+extern sim_lora_s sim_lora;
+
+#endif // WISBLOCK_API_H
@@ -0,0 +1,144 @@
+/**
+ * @file api_host.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief WisBlock-API-V2 replacement for the host build
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <WisBlock-API-V2.h>
+
+volatile uint16_t g_task_event_type = NO_EVENT;
+
+uint16_t g_sw_ver_1 = 1;
+uint16_t g_sw_ver_2 = 0;
+uint16_t g_sw_ver_3 = 0;
+
+s_lorawan_settings g_lorawan_settings;
+
+bool g_lpwan_has_joined = true;
+bool g_join_result = true;
+bool g_rx_fin_result = true;
+uint8_t g_rx_lora_data[256];
+uint8_t g_rx_data_len = 0;
+int16_t g_last_rssi = -70;
+int8_t g_last_snr = 8;
+uint8_t g_last_fport = 0;
+
+char *region_names[] = {(char *)"AS923", (char *)"AU915", (char *)"CN470", (char *)"CN779",
+						(char *)"EU433", (char *)"EU868", (char *)"KR920", (char *)"IN865",
+						(char *)"US915", (char *)"AS923-2", (char *)"AS923-3", (char *)"AS923-4", (char *)"RU864"};
+char *bandwidths[] = {(char *)"125", (char *)"250", (char *)"500", (char *)"062", (char *)"041",
+					  (char *)"031", (char *)"020", (char *)"015", (char *)"010", (char *)"007"};
+
+bool g_enable_ble = false;
+bool g_ble_uart_is_connected = false;
+HostBleUart g_ble_uart;
+
+sim_lora_s sim_lora;
+
+void api_wake_loop(uint16_t reason)
+{
+	g_task_event_type |= reason;
+}
+
+void api_set_version(uint16_t sw_1, uint16_t sw_2, uint16_t sw_3)
+{
+	g_sw_ver_1 = sw_1;
+	g_sw_ver_2 = sw_2;
+	g_sw_ver_3 = sw_3;
+}
+
+void api_log_settings(void)
+{
+}
+
+void api_reset(void)
+{
+	Serial.printf("api_reset() requested\n");
+}
+
+void api_timer_restart(uint32_t new_time)
+{
+	(void)new_time;
+}
+
+void save_settings(void)
+{
+}
+
+float read_batt(void)
+{
+	return 3950.0;
+}
+
+void restart_advertising(uint16_t timeout)
+{
+	(void)timeout;
+}
+
+void at_serial_input(uint8_t cmd)
+{
+	(void)cmd;
+}
+
+/**
+ * @brief Capture the packet instead of sending it
+ *
+ * @param data payload
+ * @param size payload size
+ * @param fport fPort, 0 = use g_lorawan_settings.app_port
+ * @return lmh_error_status LMH_ERROR if payload is too large for the simulated DR
+ */
+lmh_error_status send_lora_packet(uint8_t *data, uint8_t size, uint8_t fport)
+{
+	if (size > sim_lora.max_payload)
+	{
+		sim_lora.failed++;
+		return LMH_ERROR;
+	}
+	if (sim_lora.force_result != LMH_SUCCESS)
+	{
+		sim_lora.failed++;
+		return sim_lora.force_result;
+	}
+	sim_lora.packets++;
+	sim_lora.bytes += size;
+	sim_lora.last_size = size;
+	sim_lora.last_fport = fport == 0 ? g_lorawan_settings.app_port : fport;
+	sim_lora.last_data = data;
+	memcpy(sim_lora.last_packet, data, size);
+	return LMH_SUCCESS;
+}
+
+/**
+ * @brief Maximum payload of the simulated DR
+ *
+ * @param size payload size to check
+ * @param txInfo set to the maximum payload size
+ * @return LoRaMacStatus_t LORAMAC_STATUS_LENGTH_ERROR if size is too large
+ */
+LoRaMacStatus_t LoRaMacQueryTxPossible(uint8_t size, LoRaMacTxInfo_t *txInfo)
+{
+	txInfo->MaxPossiblePayload = sim_lora.max_payload;
+	txInfo->CurrentPayloadSize = sim_lora.max_payload;
+	return size > sim_lora.max_payload ? LORAMAC_STATUS_LENGTH_ERROR : LORAMAC_STATUS_OK;
+}
+
+bool send_p2p_packet(uint8_t *data, uint8_t size)
+{
+	sim_lora.packets++;
+	sim_lora.bytes += size;
+	sim_lora.last_size = size;
+	sim_lora.last_fport = 0;
+	sim_lora.last_data = data;
+	memcpy(sim_lora.last_packet, data, size);
+	return true;
+}
+
+lmh_error_status lmh_join(void)
+{
+	return LMH_SUCCESS;
+}
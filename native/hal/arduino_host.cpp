@@ -0,0 +1,341 @@
+/**
+ * @file arduino_host.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Simulated clock, GPIO's, Serial, FreeRTOS and SoftwareTimer
+ *        for the host build
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <Arduino.h>
+
+/** Simulated time in microseconds */
+static uint64_t sim_us = 0;
+
+/** List of all constructed timers */
+static SoftwareTimer *timer_list = NULL;
+
+/** Simulated pin levels */
+static uint8_t pin_level[SIM_NUM_PINS] = {0};
+/** Simulated time of the last LOW to HIGH change of each pin */
+static uint64_t pin_high_ms[SIM_NUM_PINS] = {0};
+
+HostSerial Serial;
+
+/**
+ * @brief Get the earliest expired timer
+ *
+ * @param limit_ms only timers expiring before or at this time are returned
+ * @return SoftwareTimer* expired timer or NULL
+ */
+static SoftwareTimer *next_expired(uint64_t limit_ms)
+{
+	SoftwareTimer *found = NULL;
+	for (SoftwareTimer *timer = timer_list; timer != NULL; timer = timer->_next)
+	{
+		if (timer->_active && (timer->_deadline_ms <= limit_ms))
+		{
+			if ((found == NULL) || (timer->_deadline_ms < found->_deadline_ms))
+			{
+				found = timer;
+			}
+		}
+	}
+	return found;
+}
+
+uint64_t sim_now_us(void)
+{
+	return sim_us;
+}
+
+/**
+ * @brief Advance the simulated clock and fire all timers that expire
+ *        on the way, in order of their deadline
+ *
+ * @param us time to advance in microseconds
+ */
+void sim_advance_us(uint64_t us)
+{
+	uint64_t target_us = sim_us + us;
+	SoftwareTimer *timer;
+	while ((timer = next_expired(target_us / 1000)) != NULL)
+	{
+		if ((timer->_deadline_ms * 1000) > sim_us)
+		{
+			sim_us = timer->_deadline_ms * 1000;
+		}
+		if (timer->_repeating)
+		{
+			timer->_deadline_ms += timer->_period_ms;
+		}
+		else
+		{
+			timer->_active = false;
+		}
+		if (timer->_callback != NULL)
+		{
+			timer->_callback(timer->getHandle());
+		}
+	}
+	sim_us = target_us;
+}
+
+void sim_run_until_ms(uint64_t ms)
+{
+	if ((ms * 1000) > sim_us)
+	{
+		sim_advance_us((ms * 1000) - sim_us);
+	}
+}
+
+/**
+ * @brief Get the deadline of the next active timer
+ *
+ * @param next_ms deadline in ms
+ * @return true if a timer is active
+ * @return false if no timer is active
+ */
+bool sim_next_timer_ms(uint64_t *next_ms)
+{
+	SoftwareTimer *found = next_expired(UINT64_MAX);
+	if (found == NULL)
+	{
+		return false;
+	}
+	*next_ms = found->_deadline_ms;
+	return true;
+}
+
+/**
+ * @brief Time since a pin was switched to HIGH
+ *
+ * @param pin GPIO number
+ * @return int64_t ms since the pin is HIGH, -1 if the pin is LOW
+ */
+int64_t sim_pin_high_since_ms(uint32_t pin)
+{
+	if ((pin >= SIM_NUM_PINS) || (pin_level[pin] == LOW))
+	{
+		return -1;
+	}
+	return (int64_t)(sim_us / 1000 - pin_high_ms[pin]);
+}
+
+/**
+ * @brief Stop all timers and restart the clock
+ *
+ */
+void sim_reset(void)
+{
+	for (SoftwareTimer *timer = timer_list; timer != NULL; timer = timer->_next)
+	{
+		timer->_active = false;
+	}
+	memset(pin_level, 0, sizeof(pin_level));
+	memset(pin_high_ms, 0, sizeof(pin_high_ms));
+	sim_us = 0;
+}
+
+uint32_t millis(void)
+{
+	return (uint32_t)(sim_us / 1000);
+}
+
+uint32_t micros(void)
+{
+	return (uint32_t)sim_us;
+}
+
+void delay(uint32_t ms)
+{
+	sim_advance_us((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+	sim_advance_us(us);
+}
+
+void pinMode(uint32_t pin, uint32_t mode)
+{
+	(void)pin;
+	(void)mode;
+}
+
+void digitalWrite(uint32_t pin, uint32_t value)
+{
+	if (pin >= SIM_NUM_PINS)
+	{
+		return;
+	}
+	if ((pin_level[pin] == LOW) && (value != LOW))
+	{
+		pin_high_ms[pin] = sim_us / 1000;
+	}
+	pin_level[pin] = (value != LOW) ? HIGH : LOW;
+}
+
+int digitalRead(uint32_t pin)
+{
+	return (pin < SIM_NUM_PINS) ? pin_level[pin] : LOW;
+}
+
+void attachInterrupt(uint32_t pin, void (*callback)(void), uint32_t mode)
+{
+	(void)pin;
+	(void)callback;
+	(void)mode;
+}
+
+size_t HostSerial::printf(const char *format, ...)
+{
+	char buffer[512];
+	va_list args;
+	va_start(args, format);
+	int len = vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	calls++;
+	if ((capture != nullptr) && (len > 0))
+	{
+		size_t copy = (captured + len < capture_size) ? len : capture_size - captured - 1;
+		memcpy(&capture[captured], buffer, copy);
+		captured += copy;
+		capture[captured] = 0;
+	}
+	if (echo)
+	{
+		fputs(buffer, stdout);
+	}
+	return len > 0 ? (size_t)len : 0;
+}
+
+size_t HostSerial::print(const char *text)
+{
+	return printf("%s", text);
+}
+
+size_t HostSerial::print(long value, int base)
+{
+	return printf(base == HEX ? "%lX" : "%ld", value);
+}
+
+size_t HostSerial::println(const char *text)
+{
+	return printf("%s\n", text);
+}
+
+/** Simulated binary semaphore, just a counter */
+struct host_semaphore_s
+{
+	int count;
+};
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+	host_semaphore_s *sem = new host_semaphore_s;
+	sem->count = 0;
+	return (SemaphoreHandle_t)sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+	// A mutex is created available
+	host_semaphore_s *sem = new host_semaphore_s;
+	sem->count = 1;
+	return (SemaphoreHandle_t)sem;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+	((host_semaphore_s *)sem)->count = 1;
+	return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken)
+{
+	(void)woken;
+	return xSemaphoreGive(sem);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+	(void)ticks;
+	if (((host_semaphore_s *)sem)->count > 0)
+	{
+		((host_semaphore_s *)sem)->count = 0;
+		return pdTRUE;
+	}
+	return pdFALSE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack, void *param, uint32_t prio, TaskHandle_t *handle)
+{
+	// Tasks run forever, on the host they are never started
+	(void)code;
+	(void)name;
+	(void)stack;
+	(void)param;
+	(void)prio;
+	if (handle != NULL)
+	{
+		*handle = NULL;
+	}
+	return pdPASS;
+}
+
+SoftwareTimer::SoftwareTimer(void)
+{
+	_next = timer_list;
+	timer_list = this;
+}
+
+SoftwareTimer::~SoftwareTimer(void)
+{
+	SoftwareTimer **link = &timer_list;
+	while (*link != NULL)
+	{
+		if (*link == this)
+		{
+			*link = _next;
+			break;
+		}
+		link = &(*link)->_next;
+	}
+}
+
+void SoftwareTimer::begin(uint32_t ms, TimerCallbackFunction_t callback, void *timerID, bool repeating)
+{
+	(void)timerID;
+	_period_ms = ms;
+	_callback = callback;
+	_repeating = repeating;
+	_active = false;
+}
+
+bool SoftwareTimer::start(void)
+{
+	_deadline_ms = sim_us / 1000 + _period_ms;
+	_active = true;
+	return true;
+}
+
+bool SoftwareTimer::stop(void)
+{
+	_active = false;
+	return true;
+}
+
+bool SoftwareTimer::reset(void)
+{
+	return start();
+}
+
+bool SoftwareTimer::setPeriod(uint32_t ms)
+{
+	// Like xTimerChangePeriod(), this starts a dormant timer
+	_period_ms = ms;
+	return start();
+}
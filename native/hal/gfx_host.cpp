@@ -0,0 +1,466 @@
+/**
+ * @file gfx_host.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Adafruit GFX and EPD replacement for the host build
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <Adafruit_EPD.h>
+
+sim_epd_s sim_epd;
+
+#define gfx_swap(a, b) \
+	{                  \
+		int16_t t = a; \
+		a = b;         \
+		b = t;         \
+	}
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h)
+{
+	_width = WIDTH;
+	_height = HEIGHT;
+}
+
+void Adafruit_GFX::setRotation(uint8_t r)
+{
+	rotation = (r & 3);
+	switch (rotation)
+	{
+	case 0:
+	case 2:
+		_width = WIDTH;
+		_height = HEIGHT;
+		break;
+	case 1:
+	case 3:
+		_width = HEIGHT;
+		_height = WIDTH;
+		break;
+	}
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+	drawLine(x, y, x, y + h - 1, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+	drawLine(x, y, x + w - 1, y, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	for (int16_t i = x; i < x + w; i++)
+	{
+		drawFastVLine(i, y, h, color);
+	}
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color)
+{
+	fillRect(0, 0, _width, _height, color);
+}
+
+/**
+ * @brief Bresenham line, same as in Adafruit GFX
+ *
+ */
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+	if (steep)
+	{
+		gfx_swap(x0, y0);
+		gfx_swap(x1, y1);
+	}
+
+	if (x0 > x1)
+	{
+		gfx_swap(x0, x1);
+		gfx_swap(y0, y1);
+	}
+
+	int16_t dx, dy;
+	dx = x1 - x0;
+	dy = abs(y1 - y0);
+
+	int16_t err = dx / 2;
+	int16_t ystep;
+
+	if (y0 < y1)
+	{
+		ystep = 1;
+	}
+	else
+	{
+		ystep = -1;
+	}
+
+	for (; x0 <= x1; x0++)
+	{
+		if (steep)
+		{
+			drawPixel(y0, x0, color);
+		}
+		else
+		{
+			drawPixel(x0, y0, color);
+		}
+		err -= dy;
+		if (err < 0)
+		{
+			y0 += ystep;
+			err += dx;
+		}
+	}
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	drawFastHLine(x, y, w, color);
+	drawFastHLine(x, y + h - 1, w, color);
+	drawFastVLine(x, y, h, color);
+	drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+{
+	int16_t byteWidth = (w + 7) / 8;
+	uint8_t b = 0;
+
+	for (int16_t j = 0; j < h; j++, y++)
+	{
+		for (int16_t i = 0; i < w; i++)
+		{
+			if (i & 7)
+			{
+				b <<= 1;
+			}
+			else
+			{
+				b = bitmap[j * byteWidth + i / 8];
+			}
+			if (b & 0x80)
+			{
+				drawPixel(x + i, y, color);
+			}
+		}
+	}
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+	int16_t byteWidth = (w + 7) / 8;
+	uint8_t b = 0;
+
+	for (int16_t j = 0; j < h; j++, y++)
+	{
+		for (int16_t i = 0; i < w; i++)
+		{
+			if (i & 7)
+			{
+				b <<= 1;
+			}
+			else
+			{
+				b = bitmap[j * byteWidth + i / 8];
+			}
+			drawPixel(x + i, y, (b & 0x80) ? color : bg);
+		}
+	}
+}
+
+void Adafruit_GFX::setTextSize(uint8_t sx, uint8_t sy)
+{
+	textsize_x = (sx > 0) ? sx : 1;
+	textsize_y = (sy > 0) ? sy : 1;
+}
+
+void Adafruit_GFX::setFont(const GFXfont *f)
+{
+	if (f)
+	{
+		if (!gfxFont)
+		{
+			// Switching from classic to new font behavior, move cursor pos down 6 pixels
+			cursor_y += 6;
+		}
+	}
+	else if (gfxFont)
+	{
+		cursor_y -= 6;
+	}
+	gfxFont = (GFXfont *)f;
+}
+
+/**
+ * @brief Draw a single character of a custom font
+ *        The classic built-in font is not supported on the host
+ *
+ */
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y)
+{
+	(void)bg;
+	if (!gfxFont)
+	{
+		return;
+	}
+	c -= (uint8_t)gfxFont->first;
+	GFXglyph *glyph = &gfxFont->glyph[c];
+	uint8_t *bitmap = gfxFont->bitmap;
+
+	uint16_t bo = glyph->bitmapOffset;
+	uint8_t w = glyph->width, h = glyph->height;
+	int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+	uint8_t xx, yy, bits = 0, bit = 0;
+
+	for (yy = 0; yy < h; yy++)
+	{
+		for (xx = 0; xx < w; xx++)
+		{
+			if (!(bit++ & 7))
+			{
+				bits = bitmap[bo++];
+			}
+			if (bits & 0x80)
+			{
+				if (size_x == 1 && size_y == 1)
+				{
+					drawPixel(x + xo + xx, y + yo + yy, color);
+				}
+				else
+				{
+					fillRect(x + (xo + xx) * size_x, y + (yo + yy) * size_y, size_x, size_y, color);
+				}
+			}
+			bits <<= 1;
+		}
+	}
+}
+
+size_t Adafruit_GFX::write(uint8_t c)
+{
+	if (!gfxFont)
+	{
+		return 1;
+	}
+	if (c == '\n')
+	{
+		cursor_x = 0;
+		cursor_y += (int16_t)textsize_y * (uint8_t)gfxFont->yAdvance;
+	}
+	else if (c != '\r')
+	{
+		uint8_t first = gfxFont->first;
+		if ((c >= first) && (c <= (uint8_t)gfxFont->last))
+		{
+			GFXglyph *glyph = &gfxFont->glyph[c - first];
+			uint8_t w = glyph->width, h = glyph->height;
+			if ((w > 0) && (h > 0))
+			{
+				int16_t xo = (int8_t)glyph->xOffset;
+				if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width))
+				{
+					cursor_x = 0;
+					cursor_y += (int16_t)textsize_y * (uint8_t)gfxFont->yAdvance;
+				}
+				drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+			}
+			cursor_x += (uint8_t)glyph->xAdvance * (int16_t)textsize_x;
+		}
+	}
+	return 1;
+}
+
+size_t Adafruit_GFX::print(const char *text)
+{
+	size_t n = 0;
+	while (*text)
+	{
+		n += write((uint8_t)*text++);
+	}
+	return n;
+}
+
+size_t Adafruit_GFX::print(int value)
+{
+	char buffer[12];
+	snprintf(buffer, sizeof(buffer), "%d", value);
+	return print(buffer);
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy)
+{
+	if (!gfxFont)
+	{
+		return;
+	}
+	if (c == '\n')
+	{
+		*x = 0;
+		*y += textsize_y * (uint8_t)gfxFont->yAdvance;
+	}
+	else if (c != '\r')
+	{
+		uint8_t first = gfxFont->first, last = gfxFont->last;
+		if ((c >= first) && (c <= last))
+		{
+			GFXglyph *glyph = &gfxFont->glyph[c - first];
+			uint8_t gw = glyph->width, gh = glyph->height, xa = glyph->xAdvance;
+			int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+			if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x)) > _width))
+			{
+				*x = 0;
+				*y += textsize_y * (uint8_t)gfxFont->yAdvance;
+			}
+			int16_t tsx = (int16_t)textsize_x, tsy = (int16_t)textsize_y,
+					x1 = *x + xo * tsx, y1 = *y + yo * tsy, x2 = x1 + gw * tsx - 1,
+					y2 = y1 + gh * tsy - 1;
+			if (x1 < *minx)
+			{
+				*minx = x1;
+			}
+			if (y1 < *miny)
+			{
+				*miny = y1;
+			}
+			if (x2 > *maxx)
+			{
+				*maxx = x2;
+			}
+			if (y2 > *maxy)
+			{
+				*maxy = y2;
+			}
+			*x += xa * tsx;
+		}
+	}
+}
+
+void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+	uint8_t c;
+	int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+	*x1 = x;
+	*y1 = y;
+	*w = *h = 0;
+
+	while ((c = *str++))
+	{
+		charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+	}
+
+	if (maxx >= minx)
+	{
+		*x1 = minx;
+		*w = maxx - minx + 1;
+	}
+	if (maxy >= miny)
+	{
+		*y1 = miny;
+		*h = maxy - miny + 1;
+	}
+}
+
+Adafruit_EPD::Adafruit_EPD(int width, int height, int16_t spi_mosi, int16_t spi_clk, int16_t dc, int16_t rst,
+						   int16_t cs, int16_t sram_cs, int16_t spi_miso, int16_t busy)
+	: Adafruit_GFX(width, height)
+{
+	(void)spi_mosi;
+	(void)spi_clk;
+	(void)dc;
+	(void)rst;
+	(void)cs;
+	(void)sram_cs;
+	(void)spi_miso;
+	(void)busy;
+	buffer1_size = ((uint32_t)width * (uint32_t)height) / 8;
+	buffer1 = (uint8_t *)malloc(buffer1_size);
+	memset(buffer1, 0, buffer1_size);
+}
+
+Adafruit_EPD::~Adafruit_EPD()
+{
+	free(buffer1);
+}
+
+/**
+ * @brief Set a pixel in the frame buffer, same rotation handling as Adafruit EPD
+ *
+ */
+void Adafruit_EPD::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+	if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+	{
+		return;
+	}
+
+	switch (getRotation())
+	{
+	case 1:
+		gfx_swap(x, y);
+		x = WIDTH - x - 1;
+		break;
+	case 2:
+		x = WIDTH - x - 1;
+		y = HEIGHT - y - 1;
+		break;
+	case 3:
+		gfx_swap(x, y);
+		y = HEIGHT - y - 1;
+		break;
+	}
+
+	// Column major like the Adafruit EPD driver, each column is padded to full bytes
+	uint32_t column = ((uint32_t)HEIGHT + 7) & ~7UL;
+	uint32_t addr = ((uint32_t)(WIDTH - 1 - x) * column + (uint32_t)y) / 8;
+	uint8_t mask = 1 << (7 - (y & 7));
+	if (color == EPD_BLACK)
+	{
+		buffer1[addr] |= mask;
+	}
+	else
+	{
+		buffer1[addr] &= ~mask;
+	}
+}
+
+void Adafruit_EPD::clearBuffer(void)
+{
+	memset(buffer1, 0, buffer1_size);
+}
+
+/**
+ * @brief Upload the complete buffer and do a full refresh
+ *
+ */
+void Adafruit_EPD::display(bool sleep)
+{
+	(void)sleep;
+	uint64_t spi_us = (uint64_t)buffer1_size * 8 * 1000000 / SIM_EPD_SPI_CLOCK;
+	sim_epd.full_refreshes++;
+	sim_epd.bytes_sent += buffer1_size;
+	sim_epd.busy_ms += spi_us / 1000 + SIM_EPD_FULL_REFRESH_MS;
+	sim_advance_us(spi_us + SIM_EPD_FULL_REFRESH_MS * 1000ULL);
+}
+
+/**
+ * @brief Upload a window of the buffer and do a partial refresh
+ *        Coordinates are in rotated display space
+ *
+ */
+void Adafruit_EPD::displayPartial(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+	uint32_t bytes = ((uint32_t)(abs(x2 - x1) + 8) / 8) * (uint32_t)(abs(y2 - y1) + 1);
+	uint64_t spi_us = (uint64_t)bytes * 8 * 1000000 / SIM_EPD_SPI_CLOCK;
+	sim_epd.partial_refreshes++;
+	sim_epd.bytes_sent += bytes;
+	sim_epd.busy_ms += spi_us / 1000 + SIM_EPD_PARTIAL_REFRESH_MS;
+	sim_advance_us(spi_us + SIM_EPD_PARTIAL_REFRESH_MS * 1000ULL);
+}
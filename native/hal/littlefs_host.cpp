@@ -0,0 +1,156 @@
+/**
+ * @file littlefs_host.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief RAM based file system for the host build
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <map>
+#include <string>
+#include <vector>
+
+#include <InternalFileSystem.h>
+
+using namespace Adafruit_LittleFS_Namespace;
+
+InternalFileSystem InternalFS;
+
+sim_flash_s sim_flash;
+
+/** All files of the simulated file system */
+static std::map<std::string, std::vector<uint8_t>> sim_files;
+
+bool Adafruit_LittleFS::exists(char const *filepath)
+{
+	return sim_files.find(filepath) != sim_files.end();
+}
+
+bool Adafruit_LittleFS::remove(char const *filepath)
+{
+	return sim_files.erase(filepath) != 0;
+}
+
+bool Adafruit_LittleFS::rename(char const *oldfilepath, char const *newfilepath)
+{
+	auto found = sim_files.find(oldfilepath);
+	if (found == sim_files.end())
+	{
+		return false;
+	}
+	sim_files[newfilepath] = found->second;
+	sim_files.erase(oldfilepath);
+	return true;
+}
+
+bool Adafruit_LittleFS::format(void)
+{
+	sim_files.clear();
+	return true;
+}
+
+File Adafruit_LittleFS::open(char const *filename, uint8_t mode)
+{
+	return File(filename, mode, *this);
+}
+
+/**
+ * @brief Open a file
+ *        Like the original, FILE_O_WRITE creates the file if required
+ *        and positions at the end of the file
+ *
+ * @param filepath file name
+ * @param mode FILE_O_READ or FILE_O_WRITE
+ * @return true file is open
+ * @return false file does not exist (FILE_O_READ)
+ */
+bool File::open(char const *filepath, uint8_t mode)
+{
+	snprintf(_name, sizeof(_name), "%s", filepath);
+	_writable = (mode == FILE_O_WRITE);
+	if (!_fs->exists(_name))
+	{
+		if (!_writable)
+		{
+			_is_open = false;
+			return false;
+		}
+		sim_files[_name] = std::vector<uint8_t>();
+	}
+	_pos = _writable ? sim_files[_name].size() : 0;
+	_is_open = true;
+	sim_flash.opens++;
+	return true;
+}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+	if (!_is_open || !_writable)
+	{
+		return 0;
+	}
+	std::vector<uint8_t> &data = sim_files[_name];
+	if (data.size() < _pos + size)
+	{
+		data.resize(_pos + size);
+	}
+	memcpy(&data[_pos], buf, size);
+	_pos += size;
+	sim_flash.bytes_written += size;
+	return size;
+}
+
+int File::read(void)
+{
+	uint8_t ch;
+	return read(&ch, 1) == 1 ? ch : -1;
+}
+
+int File::read(void *buf, uint16_t nbyte)
+{
+	if (!_is_open)
+	{
+		return -1;
+	}
+	std::vector<uint8_t> &data = sim_files[_name];
+	uint32_t len = (_pos + nbyte > data.size()) ? data.size() - _pos : nbyte;
+	memcpy(buf, &data[0] + _pos, len);
+	_pos += len;
+	sim_flash.bytes_read += len;
+	return (int)len;
+}
+
+bool File::seek(uint32_t pos)
+{
+	if (!_is_open || (pos > size()))
+	{
+		return false;
+	}
+	_pos = pos;
+	return true;
+}
+
+uint32_t File::size(void)
+{
+	if (!_fs->exists(_name))
+	{
+		return 0;
+	}
+	return sim_files[_name].size();
+}
+
+bool File::truncate(uint32_t pos)
+{
+	if (!_is_open || !_writable)
+	{
+		return false;
+	}
+	sim_files[_name].resize(pos);
+	if (_pos > pos)
+	{
+		_pos = pos;
+	}
+	return true;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file nRF_SSD1306Wire.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the nRF52_OLED library (RAK1921)
+ *        Drawing is not rendered, display() transfers the 1 kByte
+ *        frame buffer over the simulated I2C bus
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef NRF_SSD1306WIRE_H
+#define NRF_SSD1306WIRE_H
+
+#include <Wire.h>
+
+typedef enum
+{
+	GEOMETRY_128_64 = 0,
+	GEOMETRY_128_32,
+} OLEDDISPLAY_GEOMETRY;
+
+typedef enum
+{
+	BLACK = 0,
+	WHITE = 1,
+	INVERSE = 2
+} OLEDDISPLAY_COLOR;
+
+typedef enum
+{
+	TEXT_ALIGN_LEFT = 0,
+	TEXT_ALIGN_RIGHT = 1,
+	TEXT_ALIGN_CENTER = 2,
+	TEXT_ALIGN_CENTER_BOTH = 3
+} OLEDDISPLAY_TEXT_ALIGNMENT;
+
+static const uint8_t ArialMT_Plain_10[] = {0};
+
+class SSD1306Wire
+{
+public:
+	SSD1306Wire(uint8_t address, int sda, int scl, OLEDDISPLAY_GEOMETRY g, TwoWire *wire)
+	{
+		_address = address;
+		(void)sda;
+		(void)scl;
+		(void)g;
+		(void)wire;
+	}
+	void setI2cAutoInit(bool doI2cAutoInit) { (void)doI2cAutoInit; }
+	bool init(void) { return command(25); }
+	void displayOff(void) { command(1); }
+	void displayOn(void) { command(1); }
+	void flipScreenVertically(void) { command(2); }
+	void setContrast(uint8_t contrast)
+	{
+		(void)contrast;
+		command(2);
+	}
+	void clear(void) {}
+	void setFont(const uint8_t *font) { (void)font; }
+	void setColor(OLEDDISPLAY_COLOR color) { (void)color; }
+	void setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT alignment) { (void)alignment; }
+	void fillRect(int16_t x, int16_t y, int16_t width, int16_t height)
+	{
+		(void)x;
+		(void)y;
+		(void)width;
+		(void)height;
+	}
+	void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+	{
+		(void)x0;
+		(void)y0;
+		(void)x1;
+		(void)y1;
+	}
+	void drawString(int16_t x, int16_t y, const char *text)
+	{
+		(void)x;
+		(void)y;
+		(void)text;
+	}
+	void display(void)
+	{
+		// Column/page address setup, then the buffer in 16 byte chunks
+		command(6);
+		for (uint16_t idx = 0; idx < 1024; idx += 16)
+		{
+			sim_i2c_transfer(_address, 17, 0);
+		}
+	}
+
+private:
+	bool command(uint8_t num)
+	{
+		bool ack = true;
+		for (uint8_t idx = 0; idx < num; idx++)
+		{
+			ack &= sim_i2c_transfer(_address, 2, 0);
+		}
+		return ack;
+	}
+	uint8_t _address;
+};
+
+#endif // NRF_SSD1306WIRE_H
@@ -0,0 +1,70 @@
+/**
+ * @file rtos.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Host stand-in for the FreeRTOS parts and the SoftwareTimer
+ *        class of the nRF52 BSP.
+ *        Tasks are registered but never run, timers are driven by the
+ *        simulated clock.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RTOS_H
+#define RTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void *TimerHandle_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+typedef long BaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TimerCallbackFunction_t)(TimerHandle_t xTimer);
+typedef void (*TaskFunction_t)(void *);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffffUL
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack, void *param, uint32_t prio, TaskHandle_t *handle);
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+/**
+ * @brief SoftwareTimer with the interface of the nRF52 BSP
+ *        Expiry is checked whenever the simulated clock advances
+ *
+ */
+class SoftwareTimer
+{
+public:
+	SoftwareTimer(void);
+	~SoftwareTimer(void);
+
+	void begin(uint32_t ms, TimerCallbackFunction_t callback, void *timerID = NULL, bool repeating = true);
+	bool start(void);
+	bool stop(void);
+	bool reset(void);
+	bool setPeriod(uint32_t ms);
+	TimerHandle_t getHandle(void) { return (TimerHandle_t)this; }
+
+	// Simulation internals
+	uint32_t _period_ms = 0;
+	uint64_t _deadline_ms = 0;
+	bool _active = false;
+	bool _repeating = true;
+	TimerCallbackFunction_t _callback = NULL;
+	SoftwareTimer *_next = NULL;
+};
+
+#endif // RTOS_H
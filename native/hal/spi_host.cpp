@@ -0,0 +1,56 @@
+/**
+ * @file spi_host.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Simulated SPI bus for the host build
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <SPI.h>
+
+SPIClass SPI;
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+	_clock = settings.clock;
+	transactions++;
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+	send(&data, 1);
+	return 0;
+}
+
+void SPIClass::transfer(const void *tx_buf, void *rx_buf, size_t count)
+{
+	send((const uint8_t *)tx_buf, count);
+	if (rx_buf != NULL)
+	{
+		memset(rx_buf, 0, count);
+	}
+}
+
+/**
+ * @brief Send bytes and advance the simulated clock by the bus time
+ *
+ * @param data bytes to send, NULL sends 0's
+ * @param count number of bytes
+ */
+void SPIClass::send(const uint8_t *data, size_t count)
+{
+	for (size_t idx = 0; (capture != nullptr) && (idx < count) && (captured < capture_size); idx++)
+	{
+		capture[captured++] = (data != NULL) ? data[idx] : 0;
+	}
+	xfers++;
+	bytes += count;
+	uint64_t time_ns = SIM_SPI_XFER_NS + (uint64_t)count * 8 * 1000000000ULL / _clock;
+	bus_time_ns += time_ns;
+	// The simulated clock runs in us, keep the rest for the next transfer
+	_pending_ns += time_ns;
+	sim_advance_us(_pending_ns / 1000);
+	_pending_ns %= 1000;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file wire_host.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Simulated I2C bus for the host build
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <Wire.h>
+
+TwoWire Wire;
+
+/** Maximum number of simulated devices */
+#define SIM_I2C_MAX_DEV 16
+
+/** Simulated devices on the bus */
+static sim_i2c_dev_s sim_devices[SIM_I2C_MAX_DEV];
+/** Number of simulated devices */
+static uint8_t sim_num_devices = 0;
+
+/**
+ * @brief Remove all simulated devices from the bus
+ *
+ */
+void sim_i2c_clear(void)
+{
+	sim_num_devices = 0;
+}
+
+/**
+ * @brief Add a simulated device to the bus
+ *
+ * @param addr I2C address
+ * @param power_pin GPIO that powers the device, -1 if always powered
+ * @param wake_ms time the device needs after power on before it ACKs
+ */
+void sim_i2c_add(uint8_t addr, int16_t power_pin, uint32_t wake_ms)
+{
+	if (sim_num_devices < SIM_I2C_MAX_DEV)
+	{
+		sim_devices[sim_num_devices].addr = addr;
+		sim_devices[sim_num_devices].present = true;
+		sim_devices[sim_num_devices].power_pin = power_pin;
+		sim_devices[sim_num_devices].wake_ms = wake_ms;
+		sim_devices[sim_num_devices].rx_data = NULL;
+		sim_devices[sim_num_devices].rx_data_len = 0;
+		sim_devices[sim_num_devices].force_nacks = 0;
+		sim_num_devices++;
+	}
+}
+
+/**
+ * @brief Find a simulated device
+ *
+ * @param addr I2C address
+ * @return sim_i2c_dev_s* device or NULL if there is no device at this address
+ */
+static sim_i2c_dev_s *find_device(uint8_t addr)
+{
+	for (uint8_t idx = 0; idx < sim_num_devices; idx++)
+	{
+		if (sim_devices[idx].addr == addr)
+		{
+			return &sim_devices[idx];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Set the data a simulated device returns on reads
+ *        Every read starts at the beginning of the data
+ *
+ * @param addr I2C address
+ * @param data data, must stay valid, NULL to return 0
+ * @param len size of data
+ */
+void sim_i2c_set_rx(uint8_t addr, const uint8_t *data, size_t len)
+{
+	sim_i2c_dev_s *dev = find_device(addr);
+	if (dev != NULL)
+	{
+		dev->rx_data = data;
+		dev->rx_data_len = len;
+	}
+}
+
+/**
+ * @brief Let the next transfers to a device fail with NACK
+ *
+ * @param addr I2C address
+ * @param count number of transfers that fail
+ */
+void sim_i2c_nack(uint8_t addr, uint32_t count)
+{
+	sim_i2c_dev_s *dev = find_device(addr);
+	if (dev != NULL)
+	{
+		dev->force_nacks = count;
+	}
+}
+
+/**
+ * @brief Get a byte of the read data of a device
+ *
+ * @param addr I2C address
+ * @param idx index of the byte in the current read
+ * @return int data byte, 0 if the device has no data set
+ */
+int sim_i2c_read(uint8_t addr, size_t idx)
+{
+	sim_i2c_dev_s *dev = find_device(addr);
+	if ((dev == NULL) || (dev->rx_data == NULL) || (idx >= dev->rx_data_len))
+	{
+		return 0;
+	}
+	return dev->rx_data[idx];
+}
+
+/**
+ * @brief Check if a device would ACK its address right now
+ *
+ * @param addr I2C address
+ * @return true device is present and awake
+ * @return false no device or device not yet awake
+ */
+bool sim_i2c_acks(uint8_t addr)
+{
+	sim_i2c_dev_s *dev = find_device(addr);
+	if (dev == NULL)
+	{
+		return false;
+	}
+	if (dev->power_pin < 0)
+	{
+		return true;
+	}
+	int64_t high_since = sim_pin_high_since_ms(dev->power_pin);
+	return (high_since >= 0) && (high_since >= (int64_t)dev->wake_ms);
+}
+
+/**
+ * @brief Account one bus transaction, used by the simulated sensor libraries
+ *
+ * @param addr I2C address
+ * @param tx_len bytes written (without address byte)
+ * @param rx_len bytes read (without address byte)
+ * @return true device ACKed
+ * @return false device NACKed
+ */
+bool sim_i2c_transfer(uint8_t addr, size_t tx_len, size_t rx_len)
+{
+	bool ack = sim_i2c_acks(addr);
+	sim_i2c_dev_s *dev = find_device(addr);
+	if (ack && (dev != NULL) && (dev->force_nacks != 0))
+	{
+		dev->force_nacks--;
+		ack = false;
+	}
+	// START + address + ACK for each phase, 9 clocks per data byte
+	size_t bits = 0;
+	if ((tx_len > 0) || (rx_len == 0))
+	{
+		bits += 2 + 9 + (ack ? tx_len * 9 : 0);
+	}
+	if ((rx_len > 0) && ack)
+	{
+		bits += 2 + 9 + rx_len * 9;
+	}
+	uint64_t time_us = (bits * 1000000ULL + Wire.getClock() - 1) / Wire.getClock();
+	Wire.transactions++;
+	Wire.bytes += ack ? tx_len + rx_len : 0;
+	Wire.bus_time_us += time_us;
+	if (!ack)
+	{
+		Wire.nacks++;
+	}
+	sim_advance_us(time_us);
+	return ack;
+}
+
+void TwoWire::begin(void)
+{
+}
+
+void TwoWire::end(void)
+{
+}
+
+void TwoWire::setClock(uint32_t clock)
+{
+	_clock = clock;
+}
+
+void TwoWire::beginTransmission(uint8_t address)
+{
+	_tx_addr = address;
+	_tx_len = 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+	(void)data;
+	if (_tx_len >= WIRE_BUFFER_SIZE)
+	{
+		return 0;
+	}
+	_tx_len++;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t len)
+{
+	size_t written = 0;
+	for (size_t idx = 0; idx < len; idx++)
+	{
+		written += write(data[idx]);
+	}
+	return written;
+}
+
+uint8_t TwoWire::endTransmission(bool stop)
+{
+	(void)stop;
+	// 0 = success, 2 = NACK on address
+	return sim_i2c_transfer(_tx_addr, _tx_len, 0) ? 0 : 2;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, size_t len, bool stop)
+{
+	(void)stop;
+	if (len > WIRE_BUFFER_SIZE)
+	{
+		len = WIRE_BUFFER_SIZE;
+	}
+	_rx_idx = 0;
+	_rx_addr = address;
+	_rx_len = sim_i2c_transfer(address, 0, len) ? len : 0;
+	return (uint8_t)_rx_len;
+}
+
+int TwoWire::available(void)
+{
+	return (int)(_rx_len - _rx_idx);
+}
+
+int TwoWire::read(void)
+{
+	if (_rx_idx >= _rx_len)
+	{
+		return -1;
+	}
+	return sim_i2c_read(_rx_addr, _rx_idx++);
+}
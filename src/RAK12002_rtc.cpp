@@ -24,6 +24,7 @@ date_time_s g_date_time;
  */
 bool init_rak12002(void)
 {
+	i2c_bus_acquire(RTC_ID);
 	Wire.begin();
 	rtc.initI2C(Wire);
 
@@ -43,6 +44,7 @@ bool init_rak12002(void)
 	g_date_time.second = rtc.getSecond();
 
 	MYLOG("RTC", "%d.%02d.%02d %d:%02d:%02d", g_date_time.year, g_date_time.month, g_date_time.date, g_date_time.hour, g_date_time.minute, g_date_time.second);
+	i2c_bus_release(RTC_ID);
 	return true;
 }
 
@@ -57,9 +59,11 @@ bool init_rak12002(void)
  */
 void set_rak12002(uint16_t year, uint8_t month, uint8_t date, uint8_t hour, uint8_t minute)
 {
+	i2c_bus_acquire(RTC_ID);
 	uint8_t weekday = (date + (uint16_t)((2.6 * month) - 0.2) - (2 * (year / 100)) + year + (uint16_t)(year / 4) + (uint16_t)(year / 400)) % 7;
 	MYLOG("RTC", "Calculated weekday is %d", weekday);
 	rtc.setTime(year, month, weekday, date, hour, minute, 0);
+	i2c_bus_release(RTC_ID);
 }
 
 /**
@@ -69,6 +73,7 @@ void set_rak12002(uint16_t year, uint8_t month, uint8_t date, uint8_t hour, uint
  */
 void read_rak12002(void)
 {
+	i2c_bus_acquire(RTC_ID);
 	g_date_time.year = rtc.getYear();
 	g_date_time.month = rtc.getMonth();
 	g_date_time.weekday = rtc.getWeekday();
@@ -76,4 +81,30 @@ void read_rak12002(void)
 	g_date_time.hour = rtc.getHour();
 	g_date_time.minute = rtc.getMinute();
 	g_date_time.second = rtc.getSecond();
-}
\ No newline at end of file
+	i2c_bus_release(RTC_ID);
+}
+
+/**
+ * @brief Get the date and time from the RTC as seconds since 1970-01-01
+ *        Updates g_date_time as well
+ *
+ * @return uint32_t seconds since 1970-01-01 00:00:00
+ */
+uint32_t get_rak12002_epoch(void)
+{
+	static const uint16_t days_before_month[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+	read_rak12002();
+
+	uint32_t days = 0;
+	for (uint16_t year = 1970; year < g_date_time.year; year++)
+	{
+		days += ((year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0))) ? 366 : 365;
+	}
+	uint16_t year = g_date_time.year;
+	bool leap_year = (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+	uint8_t month = (g_date_time.month >= 1) && (g_date_time.month <= 12) ? g_date_time.month : 1;
+	days += days_before_month[month - 1] + ((leap_year && (month > 2)) ? 1 : 0) + g_date_time.date - 1;
+
+	return days * 86400UL + g_date_time.hour * 3600UL + g_date_time.minute * 60UL + g_date_time.second;
+}
@@ -25,16 +25,19 @@ float last_light_lux = 0.0;
  */
 bool init_rak12010(void)
 {
+	i2c_bus_acquire(LIGHT2_ID);
 	Wire.begin();
 	if (!VEML.begin(&Wire))
 	{
 		MYLOG("VEML", "VEML7700 not found");
+		i2c_bus_release(LIGHT2_ID);
 		return false;
 	}
 
 	if (!VEML.begin())
 	{
 		MYLOG("VEML", "VEML7700 not found");
+		i2c_bus_release(LIGHT2_ID);
 		return false;
 	}
 	MYLOG("VEML", "Found VEML7700");
@@ -43,6 +46,7 @@ bool init_rak12010(void)
 
 	// VEML.powerSaveEnable(true);
 	// VEML.setPowerSaveMode(VEML7700_POWERSAVE_MODE4);
+	i2c_bus_release(LIGHT2_ID);
 	return true;
 }
 
@@ -54,6 +58,7 @@ bool init_rak12010(void)
  */
 void read_rak12010(void)
 {
+	i2c_bus_acquire(LIGHT2_ID);
 	last_light_lux = VEML.readLux();
 #if MY_DEBUG > 0
 	float light_white = VEML.readWhite();
@@ -62,6 +67,7 @@ void read_rak12010(void)
 #endif
 
 	g_solution_data.addLuminosity(LPP_CHANNEL_LIGHT2, (uint32_t)last_light_lux);
+	i2c_bus_release(LIGHT2_ID);
 }
 
 /**
@@ -70,9 +76,11 @@ void read_rak12010(void)
  */
 void startup_rak12010(void)
 {
+	i2c_bus_acquire(LIGHT2_ID);
 	VEML.powerSaveEnable(false);
 	VEML.setGain(VEML7700_GAIN_2);
 	VEML.setIntegrationTime(VEML7700_IT_400MS);
+	i2c_bus_release(LIGHT2_ID);
 }
 
 /**
@@ -81,6 +89,8 @@ void startup_rak12010(void)
  */
 void shut_down_rak12010(void)
 {
+	i2c_bus_acquire(LIGHT2_ID);
 	VEML.powerSaveEnable(true);
 	VEML.setPowerSaveMode(VEML7700_POWERSAVE_MODE4);
+	i2c_bus_release(LIGHT2_ID);
 }
\ No newline at end of file
@@ -22,10 +22,12 @@ UVlight_LTR390 ltr = UVlight_LTR390();
  */
 bool init_rak12019(void)
 {
+	i2c_bus_acquire(UVL_ID);
 	Wire.begin();
 	if (!ltr.init())
 	{
 		MYLOG("LTR", "LTR390 not found");
+		i2c_bus_release(UVL_ID);
 		return false;
 	}
 
@@ -56,6 +58,7 @@ bool init_rak12019(void)
 	{
 		ltr.configInterrupt(true, LTR390_MODE_UVS);
 	}
+	i2c_bus_release(UVL_ID);
 	return true;
 }
 
@@ -67,6 +70,7 @@ bool init_rak12019(void)
  */
 void read_rak12019(void)
 {
+	i2c_bus_acquire(UVL_ID);
 	float _uvi_read = 0.0;
 	uint32_t _uvs_read = 0;
 
@@ -90,6 +94,7 @@ void read_rak12019(void)
 
 	g_solution_data.addAnalogInput(LPP_CHANNEL_UVI, _uvi_read);
 	g_solution_data.addLuminosity(LPP_CHANNEL_UVS, _uvs_read);
+	i2c_bus_release(UVL_ID);
 }
 
 /**
@@ -22,6 +22,7 @@ SCD30 scd30;
  */
 bool init_rak12037(void)
 {
+	i2c_bus_acquire(CO2_ID);
 	// Enable power
 	pinMode(WB_IO2, OUTPUT);
 	digitalWrite(WB_IO2, HIGH); // power on RAK12037
@@ -31,6 +32,7 @@ bool init_rak12037(void)
 	{
 		MYLOG("SCD30", "SCD30 not found");
 		// digitalWrite(WB_IO2, LOW); // power down RAK12037
+		i2c_bus_release(CO2_ID);
 		return false;
 	}
 
@@ -44,30 +46,34 @@ bool init_rak12037(void)
 	// Start the measurements
 	scd30.beginMeasuring();
 
+	i2c_bus_release(CO2_ID);
 	return true;
 }
 
+/**
+ * @brief Check if the SCD30 has a new measurement
+ *
+ * @return true if the result can be read
+ * @return false if no new data is available
+ */
+bool ready_rak12037(void)
+{
+	i2c_bus_acquire(CO2_ID);
+	bool has_data = scd30.dataAvailable();
+	i2c_bus_release(CO2_ID);
+	return has_data;
+}
+
 /**
  * @brief Read CO2 sensor data
+ *     Call only after ready_rak12037() reported new data
  *     Data is added to Cayenne LPP payload as channels
  *     LPP_CHANNEL_CO2_2, LPP_CHANNEL_CO2_Temp_2 and LPP_CHANNEL_CO2_HUMID_2
  *
  */
 void read_rak12037(void)
 {
-	time_t start_time = millis();
-	while (!scd30.dataAvailable())
-	{
-		MYLOG("SCD30", "Waiting for data");
-		delay(500);
-		if ((millis() - start_time) > 10000)
-		{
-			// timeout, no data available
-			MYLOG("SCD30", "Timeout");
-			return;
-		}
-	}
-
+	i2c_bus_acquire(CO2_ID);
 	uint16_t co2_reading = scd30.getCO2();
 	float temp_reading = scd30.getTemperature();
 	float humid_reading = scd30.getHumidity();
@@ -83,6 +89,7 @@ void read_rak12037(void)
 #if HAS_EPD > 0
 	set_co2_rak14000(co2_reading);
 #endif
+	i2c_bus_release(CO2_ID);
 }
 
 /**
@@ -91,6 +98,7 @@ void read_rak12037(void)
  */
 void startup_rak12037(void)
 {
+	i2c_bus_acquire(CO2_ID);
 	// digitalWrite(CO2_PM_POWER, HIGH); // power off RAK12037
 	// Change number of seconds between measurements: 2 to 1800 (30 minutes), stored in non-volatile memory of SCD30
 	scd30.setMeasurementInterval(10);
@@ -101,6 +109,7 @@ void startup_rak12037(void)
 	// Start the measurements
 	scd30.beginMeasuring();
 	// init_rak12037();
+	i2c_bus_release(CO2_ID);
 }
 
 /**
@@ -109,7 +118,9 @@ void startup_rak12037(void)
  */
 void shut_down_rak12037(void)
 {
+	i2c_bus_acquire(CO2_ID);
 	// Disable power
 	// digitalWrite(CO2_PM_POWER, LOW); // power off RAK12037
 	scd30.StopMeasurement();
+	i2c_bus_release(CO2_ID);
 }
\ No newline at end of file
@@ -18,6 +18,18 @@ RAK_PMSA003I PMSA003I;
 /** Data structure */
 PMSA_Data_t data;
 
+/** Size of a PMSA003I data frame */
+#define PMSA_FRAME_SIZE 32
+
+/** Buffer for one data frame */
+static uint8_t pm_frame[PMSA_FRAME_SIZE];
+
+/** Transaction to read one data frame */
+static i2c_trans_t pm_frame_trans = {PM_ID, NULL, 0, pm_frame, PMSA_FRAME_SIZE, 2, NULL, NULL};
+
+/** Transaction to check if the sensor is awake */
+static i2c_trans_t pm_probe_trans = {PM_ID, NULL, 0, NULL, 0, 0, NULL, NULL};
+
 /*
  * @brief WB_IO6 is connected to the SET pin.
  *        Set pin/TTL level @3.3V, high level or suspending is normal working status.
@@ -33,6 +45,7 @@ PMSA_Data_t data;
  */
 bool init_rak12039(void)
 {
+	i2c_bus_acquire(PM_ID);
 	// On/Off control pin
 	pinMode(SET_PIN, OUTPUT);
 
@@ -46,28 +59,83 @@ bool init_rak12039(void)
 	{
 		MYLOG("Dust", "PMSA003I begin fail,please check connection!");
 		digitalWrite(SET_PIN, LOW);
+		i2c_bus_release(PM_ID);
 		return false;
 	}
 
 	// digitalWrite(SET_PIN, LOW);
+	i2c_bus_release(PM_ID);
 	return true;
 }
 
 /**
- * @brief Read ToF data from VL53L01
+ * @brief Start reading the PMSA003I
+ *     The sensor needs some time before the data can be read
+ *
+ * @return uint32_t time in ms until the result can be read
+ */
+uint32_t start_rak12039(void)
+{
+	return 300;
+}
+
+/**
+ * @brief Decode a PMSA003I data frame
+ *     Frame starts with 0x42 0x4D and the frame length, followed by
+ *     13 big endian values and the checksum over all previous bytes
+ *
+ * @param frame 32 byte frame
+ * @param pm_data decoded values
+ * @return true if the frame is valid
+ * @return false if header or checksum are wrong
+ */
+static bool parse_pm_frame(uint8_t *frame, PMSA_Data_t *pm_data)
+{
+	if ((frame[0] != 0x42) || (frame[1] != 0x4D))
+	{
+		return false;
+	}
+	uint16_t checksum = 0;
+	for (uint8_t idx = 0; idx < PMSA_FRAME_SIZE - 2; idx++)
+	{
+		checksum += frame[idx];
+	}
+	if (checksum != (uint16_t)((frame[PMSA_FRAME_SIZE - 2] << 8) | frame[PMSA_FRAME_SIZE - 1]))
+	{
+		return false;
+	}
+
+	uint16_t values[12];
+	for (uint8_t idx = 0; idx < 12; idx++)
+	{
+		values[idx] = (frame[4 + idx * 2] << 8) | frame[5 + idx * 2];
+	}
+	pm_data->pm10_standard = values[0];
+	pm_data->pm25_standard = values[1];
+	pm_data->pm100_standard = values[2];
+	pm_data->pm10_env = values[3];
+	pm_data->pm25_env = values[4];
+	pm_data->pm100_env = values[5];
+	pm_data->particles_03um = values[6];
+	pm_data->particles_05um = values[7];
+	pm_data->particles_10um = values[8];
+	pm_data->particles_25um = values[9];
+	pm_data->particles_50um = values[10];
+	pm_data->particles_100um = values[11];
+	return true;
+}
+
+/**
+ * @brief Read particle matter data from PMSA003I
  *     Data is added to Cayenne LPP payload as channels
- *     LPP_CHANNEL_TOF
+ *     LPP_CHANNEL_PM_1_0, LPP_CHANNEL_PM_2_5 and LPP_CHANNEL_PM_10_0
+ *     The complete frame is read in one transaction, the bus manager
+ *     sets the low I2C speed the RAK12039 needs.
  *
  */
 void read_rak12039(void)
 {
-	// RAK12039 supports only low I2C speed
-	Wire.setClock(100000);
-	// Sensor on
-	// digitalWrite(SET_PIN, HIGH);
-	delay(300);
-
-	if (PMSA003I.readDate(&data))
+	if (i2c_bus_transfer(&pm_frame_trans) && parse_pm_frame(pm_frame, &data))
 	{
 
 		MYLOG("PMS", "PMSA003I read date success.");
@@ -87,8 +155,6 @@ void read_rak12039(void)
 		Serial.println("PMSA003I read failed!");
 	}
 
-	// RAK12039 supports only low I2C speed
-	Wire.setClock(100000); // Wire.setClock(400000);
 	// Sensor off
 	// digitalWrite(SET_PIN, LOW);
 	return;
@@ -103,30 +169,23 @@ void startup_rak12039(void)
 	// Sensor on
 	// digitalWrite(CO2_PM_POWER, HIGH); // power on RAK12039
 	digitalWrite(SET_PIN, HIGH);
-	// Wait for wakeup
-	time_t wait_sensor = millis();
-	MYLOG("PM", "RAK12039 wake-up scan start %ld ms", millis());
-	byte error;
-	while (1)
-	{
-		delay(500);
-		Wire.beginTransmission(0x12);
-		error = Wire.endTransmission();
-		if (error == 0)
-		{
-			MYLOG("PM", "RAK12039 answered at %ld ms", millis());
-			break;
-		}
-		if ((millis() - wait_sensor) > 10000)
-		{
-			MYLOG("PM", "RAK12039 timeout after 10000 ms");
-			break;
-		}
-	}
+	// Wake-up is checked with ready_rak12039() before sending
+	MYLOG("PM", "RAK12039 wake-up start %ld ms", millis());
 
 	// init_rak12039();
 }
 
+/**
+ * @brief Check if the RAK12039 answers on the I2C bus after wake-up
+ *
+ * @return true if the sensor is awake
+ * @return false if the sensor does not respond yet
+ */
+bool ready_rak12039(void)
+{
+	return i2c_bus_transfer(&pm_probe_trans);
+}
+
 /**
  * @brief Put the RAK12037 into sleep mode
  *
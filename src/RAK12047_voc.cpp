@@ -70,6 +70,7 @@ void voc_read_wakeup(void)
  */
 bool init_rak12047(void)
 {
+	i2c_bus_acquire(VOC_ID);
 	sgp40.begin(Wire);
 
 	uint16_t serialNumber[3];
@@ -81,6 +82,7 @@ bool init_rak12047(void)
 	{
 		errorToString(error, errorMessage, 256);
 		MYLOG("VOC", "Error trying to execute getSerialNumber() %s", errorMessage);
+		i2c_bus_release(VOC_ID);
 		return false;
 	}
 	else
@@ -106,11 +108,13 @@ bool init_rak12047(void)
 	{
 		errorToString(error, errorMessage, 256);
 		MYLOG("VOC", "Error trying to execute executeSelfTest() %s", errorMessage);
+		i2c_bus_release(VOC_ID);
 		return false;
 	}
 	else if (testResult != 0xD400)
 	{
 		MYLOG("VOC", "executeSelfTest failed with error %d", testResult);
+		i2c_bus_release(VOC_ID);
 		return false;
 	}
 
@@ -138,6 +142,7 @@ bool init_rak12047(void)
 #ifdef ARDUINO_ARCH_RP2040
 	voc_read_timer.attach(voc_read_wakeup, (microseconds)(10000000));
 #endif
+	i2c_bus_release(VOC_ID);
 	return true;
 }
 
@@ -175,6 +180,7 @@ void read_rak12047(void)
  */
 void do_read_rak12047(void)
 {
+	i2c_bus_acquire(VOC_ID);
 #if MY_DEBUG > 0
 	digitalWrite(LED_BLUE, HIGH);
 #endif
@@ -253,4 +259,5 @@ void do_read_rak12047(void)
 #if MY_DEBUG > 0
 	digitalWrite(LED_BLUE, LOW);
 #endif
+	i2c_bus_release(VOC_ID);
 }
@@ -14,6 +14,10 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_EPD.h>
+#include "sensor_history.h"
+#include "RAK14000_fonts.h"
+#include "RAK14000_layout.h"
+#include "RAK14000_image.h"
 
 // For text length calculations
 extern int16_t txt_x1;
@@ -22,39 +26,113 @@ extern uint16_t txt_w;
 extern uint16_t txt_w2;
 extern uint16_t txt_h;
 
-// For text and image placements
-extern uint16_t x_text;
-extern uint16_t y_text;
-extern uint16_t s_text;
-extern uint16_t w_text;
-extern uint16_t h_text;
-extern uint16_t x_graph;
-extern uint16_t y_graph;
-extern uint16_t h_bar;
-extern uint16_t w_bar;
-extern float bar_divider;
-extern uint16_t spacer;
-
-extern Adafruit_SSD1681 display;
+/** Area on the display, x2 and y2 are inside, empty if x2 < x1 */
+typedef struct epd_box_s
+{
+	int16_t x1;
+	int16_t y1;
+	int16_t x2;
+	int16_t y2;
+} epd_box_t;
+
+/** Drawing modes of the display */
+#define EPD_TRACK_OFF 0		// Draw only
+#define EPD_TRACK_DRAW 1	// Draw and collect area and hash of the pixels
+#define EPD_TRACK_MEASURE 2 // Collect area and hash only, the buffer is not changed
+
+/**
+ * @brief 4.2" EPD that collects the area and a hash of the drawn pixels
+ *        Used to find the widgets that changed since the last refresh
+ *
+ */
+class RAK14000_SSD1681 : public Adafruit_SSD1681
+{
+public:
+	using Adafruit_SSD1681::Adafruit_SSD1681;
+	void drawPixel(int16_t x, int16_t y, uint16_t color);
+	void track(uint8_t mode);
+	epd_box_t tracked_box(void) { return _box; }
+	uint32_t tracked_hash(void) { return _hash; }
+	void scroll_left(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx);
+
+private:
+	uint32_t bit_index(int16_t x, int16_t y);
+	void copy_bits(uint32_t dst, uint32_t src, uint32_t num);
+
+	uint8_t _mode = EPD_TRACK_OFF;
+	epd_box_t _box = {0, 0, -1, -1};
+	uint32_t _hash = 0;
+};
+
+extern RAK14000_SSD1681 display;
+
+/** Part of the screen that is drawn and refreshed on its own */
+typedef struct epd_widget_s
+{
+	void (*draw)(void);					// Draws the widget with the current values
+	bool (*scroll)(epd_box_t *changed); // Updates the widget in the buffer, nullptr or false if it must be drawn
+	epd_box_t box;						// Area of the last drawing
+	uint32_t hash;						// Hash of the pixels of the last drawing, 0 after a scroll
+} epd_widget_t;
+
+/**
+ * @brief Entry of a widget table, the area and the hash are set by the first full refresh
+ *
+ * @param draw draws the widget with the current values
+ * @param scroll updates the widget in the buffer, nullptr if it is always drawn
+ * @return epd_widget_t widget that was not drawn yet
+ */
+constexpr epd_widget_t epd_widget(void (*draw)(void), bool (*scroll)(epd_box_t *changed) = nullptr)
+{
+	return {draw, scroll, {0, 0, -1, -1}, 0};
+}
+
+/** Raw value graph as it is in the frame buffer, used to scroll it instead of drawing it again */
+typedef struct epd_graph_s
+{
+	bool valid;		 // false if the graph is not shown or cannot scroll
+	uint16_t pushed; // pushed() of the history at the last drawing
+	uint16_t count;	 // Number of columns
+	int16_t x;		 // Position of the first column
+	int16_t y;		 // Top of the graph
+	int16_t h;		 // Height of the graph, the base line is below
+	int16_t w_bar;	 // Distance of the columns
+	float divider;	 // Value per pixel
+	float offset;	 // Value at the base line
+	uint16_t color;	 // Color of the columns
+} epd_graph_t;
+
+/** Number of partial refreshes before a full refresh removes the ghosting */
+#define EPD_PARTIAL_MAX 10
+
+extern epd_widget_t scientific_widgets[];
+extern const uint8_t num_scientific_widgets;
 
 extern uint16_t bg_color;
 extern uint16_t txt_color;
 
-extern const uint16_t num_values;
-extern uint16_t voc_values[];
-extern float temp_values[];
-extern float humid_values[];
-extern float baro_values[];
-extern float co2_values[];
-extern uint16_t pm10_values[];
-extern uint16_t pm25_values[];
-extern uint16_t pm100_values[];
-extern uint8_t voc_idx;
-extern uint8_t temp_idx;
-extern uint8_t humid_idx;
-extern uint8_t baro_idx;
-extern uint8_t co2_idx;
-extern uint8_t pm_idx;
+/** Set num_values to 1/4 of the display width */
+constexpr uint16_t num_values = rak14000_layout::width / 4;
+
+// Sensor history, temperature and humidity with 2 decimals, pressure with 1 decimal
+extern SensorHistory<uint16_t, num_values> voc_values;
+extern SensorHistory<float, num_values, 100> temp_values;
+extern SensorHistory<float, num_values, 100> humid_values;
+extern SensorHistory<float, num_values, 10> baro_values;
+extern SensorHistory<float, num_values> co2_values;
+extern SensorHistory<uint16_t, num_values> pm10_values;
+extern SensorHistory<uint16_t, num_values> pm25_values;
+extern SensorHistory<uint16_t, num_values> pm100_values;
+
+/** Channel numbers of the histories in the history log */
+#define HIST_VOC 0
+#define HIST_TEMP 1
+#define HIST_HUMID 2
+#define HIST_BARO 3
+#define HIST_CO2 4
+#define HIST_PM10 5
+#define HIST_PM25 6
+#define HIST_PM100 7
 
 extern char disp_text[60];
 
@@ -66,86 +144,19 @@ extern char *months_txt[];
 // Forward declaration
 void text_rak14000(int16_t x, int16_t y, char *text, uint16_t text_color, uint32_t text_size);
 void scientific_rak14000(void);
+void refresh_widgets_rak14000(epd_widget_t *widgets, uint8_t num_widgets);
+void invalidate_widgets_rak14000(void);
 void voc_rak14000(void);
+void voc_graph_rak14000(void);
 void co2_rak14000(bool has_pm);
+void co2_graph_rak14000(void);
 void pm_rak14000(void);
 void temp_rak14000(bool has_pm, bool has_baro);
 void humid_rak14000(bool has_pm, bool has_baro);
 void baro_rak14000(bool has_pm);
 void icon_rak14000(void);
 void draw_bar_rak14000(uint8_t level, uint16_t x, uint16_t y);
-
-extern unsigned char good_air[];
-extern uint16_t good_air_width;
-extern uint16_t good_air_height;
-extern uint16_t good_air_len;
-
-extern unsigned char bad_air[];
-extern uint16_t bad_air_width;
-extern uint16_t bad_air_height;
-extern uint16_t bad_air_len;
-
-extern unsigned char worried_air[];
-extern uint16_t worried_air_width;
-extern uint16_t worried_air_height;
-extern uint16_t worried_air_len;
-
-extern unsigned char rak_img[];
-extern uint16_t rak_img_width;
-extern uint16_t rak_img_height;
-extern uint16_t rak_img_length;
-
-extern unsigned char celsius_img[];
-extern uint16_t celsius_img_width;
-extern uint16_t celsius_img_height;
-extern uint16_t celsius_img_length;
-
-extern unsigned char humidity_img[];
-extern uint16_t humidity_img_width;
-extern uint16_t humidity_img_height;
-extern uint16_t humidity_img_length;
-
-extern unsigned char co2_img[];
-extern uint16_t co2_img_width;
-extern uint16_t co2_img_height;
-extern uint16_t co2_img_length;
-
-extern unsigned char barometer_img[];
-extern uint16_t barometer_img_width;
-extern uint16_t barometer_img_height;
-extern uint16_t barometer_img_length;
-
-extern unsigned char voc_img[];
-extern uint16_t voc_img_width;
-extern uint16_t voc_img_height;
-extern uint16_t voc_img_length;
-
-extern unsigned char pm_img[];
-extern uint16_t pm_img_width;
-extern uint16_t pm_img_height;
-extern uint16_t pm_img_length;
-
-extern unsigned char built_img[];
-extern uint16_t built_img_width;
-extern uint16_t built_img_height;
-extern uint16_t built_img_length;
-
-extern unsigned char wisblock_img[];
-extern uint16_t wisblock_width;
-extern uint16_t wisblock_height;
-extern uint16_t wisblock_length;
-
-extern uint8_t RAK_EPD_10pt_Bitmaps[];
-
-extern GFXglyph RAK_EPD_10pt_Glyphs[];
-
-extern GFXfont RAK_EPD_10pt;
-
-extern uint8_t RAK_EPD_20pt_Bitmaps[];
-
-extern GFXglyph RAK_EPD_20pt_Glyphs[];
-
-extern GFXfont RAK_EPD_20pt;
+void draw_image_rak14000(int16_t x, int16_t y, const epd_image_t &image, uint16_t color);
 
 #define SMALL_FONT &RAK_EPD_10pt
 #define LARGE_FONT &RAK_EPD_20pt
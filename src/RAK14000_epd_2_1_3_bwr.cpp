@@ -65,18 +65,21 @@ enum
 	DISP_BARO
 };
 
-/** Set num_values to 1/4 of the display width */
-const uint16_t num_values = 400 / 4;
-uint16_t voc_values[num_values] = {0};
-float temp_values[num_values] = {0.0};
-float humid_values[num_values] = {0.0};
-float baro_values[num_values] = {0.0};
-float co2_values[num_values] = {0.0};
-uint8_t voc_idx = 0;
-uint8_t temp_idx = 0;
-uint8_t humid_idx = 0;
-uint8_t baro_idx = 0;
-uint8_t co2_idx = 0;
+/** Sensor history for the graphs, size is set in RAK14000_epd.h */
+SensorHistory<uint16_t, num_values> voc_values;
+SensorHistory<float, num_values, 100> temp_values;
+SensorHistory<float, num_values, 100> humid_values;
+SensorHistory<float, num_values, 10> baro_values;
+SensorHistory<float, num_values> co2_values;
+
+/** Histories saved in the history log, in the order of the HIST_xxx channel numbers */
+history_channel_t history_channels[] = {
+	HISTORY_CHANNEL(voc_values),
+	HISTORY_CHANNEL(temp_values),
+	HISTORY_CHANNEL(humid_values),
+	HISTORY_CHANNEL(baro_values),
+	HISTORY_CHANNEL(co2_values)};
+const uint8_t num_history_channels = sizeof(history_channels) / sizeof(history_channel_t);
 
 char disp_text[60];
 
@@ -118,6 +121,21 @@ char *regions[] = {(char *)"AS923", (char *)"AU915", (char *)"CN470", (char *)"C
 				   (char *)"EU433", (char *)"EU868", (char *)"KR920", (char *)"IN865",
 				   (char *)"US915", (char *)"AS923-2", (char *)"AS923-3", (char *)"AS923-4", (char *)"RU864"};
 
+/** Unpacked image for drivers that need the plain bitmap, fits the RAK logo */
+static uint8_t image_buffer[184 / 8 * 56];
+
+/**
+ * @brief Unpack a compressed image into image_buffer
+ *
+ * @param image compressed image
+ * @return uint8_t* plain bitmap, valid until the next call
+ */
+static uint8_t *unpack_rak14000(const epd_image_t &image)
+{
+	unpack_image(image, image_buffer);
+	return image_buffer;
+}
+
 void rak14000_text(int16_t x, int16_t y, char *text, uint16_t text_color, uint32_t text_size);
 
 void butt_left_int(void)
@@ -183,6 +201,9 @@ void init_rak14000(void)
 	pinMode(RIGHT_BUTTON, INPUT);
 	attachInterrupt(RIGHT_BUTTON, butt_right_int, FALLING);
 
+	// Restore the sensor history before the display task starts
+	history_log_restore();
+
 #if defined NRF52_SERIES || defined ESP32
 	// Create the EPD event semaphore
 	g_epd_sem = xSemaphoreCreateBinary();
@@ -262,10 +283,10 @@ void refresh_rak14000(void)
 
 	if (found_sensors[VOC_ID].found_sensor)
 	{
-		if (voc_idx == 0)
+		if (voc_values.count() == 0)
 		{
 			display.fillRect(0, 0, DEPG_HP.width, DEPG_HP.height, bg_color);
-			display.drawBitmap(DEPG_HP.position1_x, DEPG_HP.position1_y, rak_img, 150, 56, txt_color);
+			display.drawBitmap(DEPG_HP.position1_x, DEPG_HP.position1_y, unpack_rak14000(rak_img), 150, 56, txt_color);
 			rak14000_text(DEPG_HP.position1_x, DEPG_HP.position1_y + 50, (char *)"IoT Made Easy", txt_color, 2);
 			display.display(true);
 
@@ -319,102 +340,32 @@ void refresh_rak14000(void)
 
 void set_voc_rak14000(uint16_t voc_value)
 {
-	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_idx);
-	// Shift values if necessary
-	if (voc_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			voc_values[idx] = voc_values[idx + 1];
-		}
-		voc_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	voc_values[voc_idx] = voc_value;
-
-	// Increase index
-	voc_idx++;
+	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_values.count());
+	history_add(HIST_VOC, voc_values.to_fixed(voc_value));
 }
 
 void set_temp_rak14000(float temp_value)
 {
-	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_idx);
-	// Shift values if necessary
-	if (temp_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			temp_values[idx] = temp_values[idx + 1];
-		}
-		temp_idx = (num_values - 1);
-	}
-
-	// Fill Temperature array
-	temp_values[temp_idx] = temp_value;
-
-	// Increase index
-	temp_idx++;
+	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_values.count());
+	history_add(HIST_TEMP, temp_values.to_fixed(temp_value));
 }
 
 void set_humid_rak14000(float humid_value)
 {
-	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_idx);
-	// Shift values if necessary
-	if (humid_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			humid_values[idx] = humid_values[idx + 1];
-		}
-		humid_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	humid_values[humid_idx] = humid_value;
-
-	// Increase index
-	humid_idx++;
+	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_values.count());
+	history_add(HIST_HUMID, humid_values.to_fixed(humid_value));
 }
 
 void set_co2_rak14000(float co2_value)
 {
-	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_idx);
-	// Shift values if necessary
-	if (co2_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			co2_values[idx] = co2_values[idx + 1];
-		}
-		co2_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	co2_values[co2_idx] = co2_value;
-
-	// Increase index
-	co2_idx++;
+	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_values.count());
+	history_add(HIST_CO2, co2_values.to_fixed(co2_value));
 }
 
 void set_baro_rak14000(float baro_value)
 {
-	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_idx);
-	// Shift values if necessary
-	if (baro_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			baro_values[idx] = baro_values[idx + 1];
-		}
-		baro_idx = (num_values - 1);
-	}
-
-	// Fill Barometer array
-	baro_values[baro_idx] = baro_value;
-
-	// Increase index
-	baro_idx++;
+	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_values.count());
+	history_add(HIST_BARO, baro_values.to_fixed(baro_value));
 }
 
 void voc_rak14000(void)
@@ -428,7 +379,7 @@ void voc_rak14000(void)
 
 	uint16_t use_txt_color = txt_color;
 #if HAS_EPD == 3
-	if (voc_values[voc_idx - 1] > 250)
+	if (voc_values.latest() > 250)
 	{
 		use_txt_color = EPD_RED;
 	}
@@ -448,7 +399,7 @@ void voc_rak14000(void)
 		snprintf(disp_text, 29, "-----");
 	}
 	rak14000_text(x_text, y_text, disp_text, use_txt_color, s_text);
-	snprintf(disp_text, 29, "%d", voc_values[voc_idx - 1]);
+	snprintf(disp_text, 29, "%d", voc_values.latest());
 	rak14000_text(x_text, y_text + 20, disp_text, use_txt_color, s_text);
 }
 
@@ -463,7 +414,7 @@ void co2_rak14000(bool has_pm)
 
 	uint16_t use_txt_color = txt_color;
 #if HAS_EPD == 3
-	if (co2_values[co2_idx - 1] > 2.0)
+	if (co2_values.latest() > 2.0)
 	{
 		use_txt_color = EPD_RED;
 	}
@@ -481,7 +432,7 @@ void co2_rak14000(bool has_pm)
 	rak14000_text(x_text, y_text, disp_text, use_txt_color, s_text);
 	if (found_sensors[CO2_ID].found_sensor)
 	{
-		snprintf(disp_text, 29, "%.2f %%", co2_values[co2_idx - 1]);
+		snprintf(disp_text, 29, "%.2f %%", co2_values.latest());
 		rak14000_text(x_text, y_text + 20, disp_text, use_txt_color, s_text);
 	}
 }
@@ -496,7 +447,7 @@ void temp_rak14000(bool has_pm)
 
 	uint16_t use_txt_color = txt_color;
 #if HAS_EPD == 3
-	if (temp_values[temp_idx - 1] > 40.0)
+	if (temp_values.latest() > 40.0)
 	{
 		use_txt_color = EPD_RED;
 	}
@@ -505,7 +456,7 @@ void temp_rak14000(bool has_pm)
 	display.fillRect(x_text, y_text, w_text, h_text, bg_color);
 	snprintf(disp_text, 29, "Temperature");
 	rak14000_text(x_text, y_text, disp_text, use_txt_color, s_text);
-	snprintf(disp_text, 29, "%.2f %cC", temp_values[temp_idx - 1], (char)247);
+	snprintf(disp_text, 29, "%.2f %cC", temp_values.latest(), (char)247);
 	rak14000_text(x_text, y_text + 20, disp_text, use_txt_color, s_text);
 }
 
@@ -520,7 +471,7 @@ void humid_rak14000(bool has_pm)
 
 	uint16_t use_txt_color = txt_color;
 #if HAS_EPD == 3
-	if (humid_values[humid_idx - 1] > 60.0)
+	if (humid_values.latest() > 60.0)
 	{
 		use_txt_color = EPD_RED;
 	}
@@ -530,7 +481,7 @@ void humid_rak14000(bool has_pm)
 	display.fillRect(x_text, y_text, w_text, h_text, bg_color);
 	snprintf(disp_text, 29, "Humidity");
 	rak14000_text(x_text, y_text, disp_text, use_txt_color, s_text);
-	snprintf(disp_text, 29, "%.2f %%RH", humid_values[humid_idx - 1]);
+	snprintf(disp_text, 29, "%.2f %%RH", humid_values.latest());
 	rak14000_text(x_text, y_text + 20, disp_text, use_txt_color, s_text);
 }
 
@@ -546,7 +497,7 @@ void baro_rak14000(bool has_pm)
 	display.fillRect(x_text, y_text, w_text, h_text, bg_color);
 	snprintf(disp_text, 29, "Barometer");
 	rak14000_text(x_text, y_text, disp_text, txt_color, s_text);
-	snprintf(disp_text, 29, "%.0f mBar", baro_values[baro_idx - 1]);
+	snprintf(disp_text, 29, "%.0f mBar", baro_values.latest());
 	rak14000_text(x_text, y_text + 20, disp_text, txt_color, s_text);
 }
 
@@ -748,7 +699,7 @@ void epd_task(void *pvParameters)
 
 	// Draw Welcome Logo
 	display.fillRect(0, 0, DEPG_HP.width, DEPG_HP.height, bg_color);
-	display.drawBitmap(DEPG_HP.width / 2 - 75, 5, rak_img, 184, 56, txt_color);	 // 184x56
+	display.drawBitmap(DEPG_HP.width / 2 - 75, 5, unpack_rak14000(rak_img), 184, 56, txt_color);	 // 184x56
 
 	display.setTextSize(2);
 	display.getTextBounds((char *)"IoT Made Easy", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
@@ -771,6 +722,9 @@ void epd_task(void *pvParameters)
 #endif
 		{
 			refresh_rak14000();
+			// Write the values of this cycle with one file access, then compact the log
+			history_log_flush();
+			history_log_compact();
 		}
 	}
 }
@@ -48,22 +48,27 @@ unsigned char frame[10800];
 /** Screen orientation. There are 4 levels of rotation: 0 & 2 (Landscape), and 1 & 3 (Portrait) */
 uint8_t scr_orientation = 0;
 
-/** Set num_values to 1/4 of the display width */
-const uint16_t num_values = 360 / 4;
-uint16_t voc_values[num_values] = {0};
-float temp_values[num_values] = {0.0};
-float humid_values[num_values] = {0.0};
-float baro_values[num_values] = {0.0};
-float co2_values[num_values] = {0.0};
-uint16_t pm10_values[num_values] = {0};
-uint16_t pm25_values[num_values] = {0};
-uint16_t pm100_values[num_values] = {0};
-uint8_t voc_idx = 0;
-uint8_t temp_idx = 0;
-uint8_t humid_idx = 0;
-uint8_t baro_idx = 0;
-uint8_t co2_idx = 0;
-uint8_t pm_idx = 0;
+/** Sensor history for the graphs, size is set in RAK14000_epd.h */
+SensorHistory<uint16_t, num_values> voc_values;
+SensorHistory<float, num_values, 100> temp_values;
+SensorHistory<float, num_values, 100> humid_values;
+SensorHistory<float, num_values, 10> baro_values;
+SensorHistory<float, num_values> co2_values;
+SensorHistory<uint16_t, num_values> pm10_values;
+SensorHistory<uint16_t, num_values> pm25_values;
+SensorHistory<uint16_t, num_values> pm100_values;
+
+/** Histories saved in the history log, in the order of the HIST_xxx channel numbers */
+history_channel_t history_channels[] = {
+	HISTORY_CHANNEL(voc_values),
+	HISTORY_CHANNEL(temp_values),
+	HISTORY_CHANNEL(humid_values),
+	HISTORY_CHANNEL(baro_values),
+	HISTORY_CHANNEL(co2_values),
+	HISTORY_CHANNEL(pm10_values),
+	HISTORY_CHANNEL(pm25_values),
+	HISTORY_CHANNEL(pm100_values)};
+const uint8_t num_history_channels = sizeof(history_channels) / sizeof(history_channel_t);
 
 char disp_text[60];
 
@@ -123,6 +128,21 @@ uint16_t w_bar;
 float bar_divider;
 uint16_t spacer;
 
+/** Unpacked image for drivers that need the plain bitmap, fits the RAK logo */
+static uint8_t image_buffer[184 / 8 * 56];
+
+/**
+ * @brief Unpack a compressed image into image_buffer
+ *
+ * @param image compressed image
+ * @return uint8_t* plain bitmap, valid until the next call
+ */
+static uint8_t *unpack_rak14000(const epd_image_t &image)
+{
+	unpack_image(image, image_buffer);
+	return image_buffer;
+}
+
 // Forward declaration
 void rak14000_text(int16_t x, int16_t y, char *text, uint16_t text_color, uint32_t text_size);
 
@@ -135,6 +155,9 @@ void init_rak14000(void)
 	pinMode(POWER_ENABLE, INPUT_PULLUP);
 	digitalWrite(POWER_ENABLE, HIGH);
 
+	// Restore the sensor history before the display task starts
+	history_log_restore();
+
 #if defined NRF52_SERIES || defined ESP32
 	// Create the EPD event semaphore
 	g_epd_sem = xSemaphoreCreateBinary();
@@ -300,22 +323,8 @@ void refresh_rak14000(void)
  */
 void set_voc_rak14000(uint16_t voc_value)
 {
-	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_idx);
-	// Shift values if necessary
-	if (voc_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			voc_values[idx] = voc_values[idx + 1];
-		}
-		voc_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	voc_values[voc_idx] = voc_value;
-
-	// Increase index
-	voc_idx++;
+	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_values.count());
+	history_add(HIST_VOC, voc_values.to_fixed(voc_value));
 }
 
 /**
@@ -325,22 +334,8 @@ void set_voc_rak14000(uint16_t voc_value)
  */
 void set_temp_rak14000(float temp_value)
 {
-	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_idx);
-	// Shift values if necessary
-	if (temp_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			temp_values[idx] = temp_values[idx + 1];
-		}
-		temp_idx = (num_values - 1);
-	}
-
-	// Fill Temperature array
-	temp_values[temp_idx] = temp_value;
-
-	// Increase index
-	temp_idx++;
+	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_values.count());
+	history_add(HIST_TEMP, temp_values.to_fixed(temp_value));
 }
 
 /**
@@ -350,22 +345,8 @@ void set_temp_rak14000(float temp_value)
  */
 void set_humid_rak14000(float humid_value)
 {
-	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_idx);
-	// Shift values if necessary
-	if (humid_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			humid_values[idx] = humid_values[idx + 1];
-		}
-		humid_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	humid_values[humid_idx] = humid_value;
-
-	// Increase index
-	humid_idx++;
+	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_values.count());
+	history_add(HIST_HUMID, humid_values.to_fixed(humid_value));
 }
 
 /**
@@ -375,22 +356,8 @@ void set_humid_rak14000(float humid_value)
  */
 void set_co2_rak14000(float co2_value)
 {
-	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_idx);
-	// Shift values if necessary
-	if (co2_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			co2_values[idx] = co2_values[idx + 1];
-		}
-		co2_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	co2_values[co2_idx] = co2_value;
-
-	// Increase index
-	co2_idx++;
+	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_values.count());
+	history_add(HIST_CO2, co2_values.to_fixed(co2_value));
 }
 
 /**
@@ -400,22 +367,8 @@ void set_co2_rak14000(float co2_value)
  */
 void set_baro_rak14000(float baro_value)
 {
-	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_idx);
-	// Shift values if necessary
-	if (baro_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			baro_values[idx] = baro_values[idx + 1];
-		}
-		baro_idx = (num_values - 1);
-	}
-
-	// Fill Barometer array
-	baro_values[baro_idx] = baro_value;
-
-	// Increase index
-	baro_idx++;
+	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_values.count());
+	history_add(HIST_BARO, baro_values.to_fixed(baro_value));
 }
 
 /**
@@ -427,26 +380,10 @@ void set_baro_rak14000(float baro_value)
  */
 void set_pm_rak14000(uint16_t pm10_env, uint16_t pm25_env, uint16_t pm100_env)
 {
-	MYLOG("EPD", "PM set to %d %d %d  at index %d", pm10_env, pm25_env, pm100_env, pm_idx);
-	// Shift values if necessary
-	if (pm_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			pm10_values[idx] = pm10_values[idx + 1];
-			pm25_values[idx] = pm25_values[idx + 1];
-			pm100_values[idx] = pm100_values[idx + 1];
-		}
-		pm_idx = (num_values - 1);
-	}
-
-	// Fill PM array
-	pm10_values[pm_idx] = pm10_env;
-	pm25_values[pm_idx] = pm25_env;
-	pm100_values[pm_idx] = pm100_env;
-
-	// Increase index
-	pm_idx++;
+	MYLOG("EPD", "PM set to %d %d %d  at index %d", pm10_env, pm25_env, pm100_env, pm10_values.count());
+	history_add(HIST_PM10, pm10_values.to_fixed(pm10_env));
+	history_add(HIST_PM25, pm25_values.to_fixed(pm25_env));
+	history_add(HIST_PM100, pm100_values.to_fixed(pm100_env));
 }
 
 /**
@@ -466,7 +403,7 @@ void voc_rak14000(void)
 	bar_divider = 500.0 / h_bar;
 
 	// Write value
-	SE0352.drawBitmap(32, 32, x_text, y_text, frame, (uint8_t *)voc_img, scr_orientation);
+	SE0352.drawBitmap(32, 32, x_text, y_text, frame, unpack_rak14000(voc_img), scr_orientation);
 
 	if (!voc_valid)
 	{
@@ -474,17 +411,17 @@ void voc_rak14000(void)
 	}
 	else
 	{
-		if (voc_values[voc_idx - 1] > 400)
+		if (voc_values.latest() > 400)
 		{
-			snprintf(disp_text, 29, " !!  VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, " !!  VOC %d", voc_values.latest());
 		}
-		else if (voc_values[voc_idx - 1] > 250)
+		else if (voc_values.latest() > 250)
 		{
-			snprintf(disp_text, 29, " !  VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, " !  VOC %d", voc_values.latest());
 		}
 		else
 		{
-			snprintf(disp_text, 29, "VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, "VOC %d", voc_values.latest());
 		}
 	}
 
@@ -516,12 +453,14 @@ void voc_rak14000(void)
 	{
 		SE0352.clearRect(x_graph, y_graph + h_bar, x_graph + DEPG_HP.width / 2, y_graph, scr_orientation, frame);
 	}
-	for (int idx = 0; idx < num_values; idx++)
+	int idx = 0;
+	for (uint16_t voc_value : voc_values)
 	{
 		SE0352.drawVLine((int16_t)(x_graph + (idx * w_bar)),
-						 (int16_t)(y_graph + ((h_bar) - (voc_values[idx] / bar_divider))),
+						 (int16_t)(y_graph + ((h_bar) - (voc_value / bar_divider))),
 						 (int16_t)(y_graph + h_bar),
 						 scr_orientation, frame);
+		idx++;
 	}
 	SE0352.drawHLine(x_graph, y_graph + h_bar, x_graph + DEPG_HP.width / 2, scr_orientation, frame);
 
@@ -549,23 +488,23 @@ void co2_rak14000(bool has_pm)
 		spacer = 20;
 
 		// Write value
-		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, (uint8_t *)co2_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, unpack_rak14000(co2_img), scr_orientation);
 		snprintf(disp_text, 29, "ppm");
 		txt_w = SE0352.strWidth(disp_text, SMALL_FONT);
 
 		rak14000_text(DEPG_HP.width - txt_w - 1, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
 
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
-			snprintf(disp_text, 29, "!! %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!! %.0f", co2_values.latest());
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
-			snprintf(disp_text, 29, "! %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "! %.0f", co2_values.latest());
 		}
 		else
 		{
-			snprintf(disp_text, 29, "%.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "%.0f", co2_values.latest());
 		}
 
 		txt_w = SE0352.strWidth(disp_text, SMALL_FONT);
@@ -594,15 +533,15 @@ void co2_rak14000(bool has_pm)
 		// Get min and max values => maybe adjust graph to the min and max values
 		int fmin = 2500;
 		int fmax = 0;
-		for (int idx = 0; idx < co2_idx; idx++)
+		for (float co2_value : co2_values)
 		{
-			if (co2_values[idx] <= fmin)
+			if (co2_value <= fmin)
 			{
-				fmin = co2_values[idx];
+				fmin = co2_value;
 			}
-			if (co2_values[idx] >= fmax)
+			if (co2_value >= fmax)
 			{
-				fmax = co2_values[idx];
+				fmax = co2_value;
 			}
 		}
 		// give some margin at the top
@@ -620,19 +559,19 @@ void co2_rak14000(bool has_pm)
 		MYLOG("EPD", "CO2 min %d max %d", fmin, fmax);
 
 		// Write value
-		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, (uint8_t *)co2_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, unpack_rak14000(co2_img), scr_orientation);
 
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
-			snprintf(disp_text, 29, "!!  %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!!  %.0f", co2_values.latest());
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
-			snprintf(disp_text, 29, "!  %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!  %.0f", co2_values.latest());
 		}
 		else
 		{
-			snprintf(disp_text, 29, "%.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "%.0f", co2_values.latest());
 		}
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 		if (partial_refresh_counter != 0)
@@ -667,15 +606,17 @@ void co2_rak14000(bool has_pm)
 		SE0352.drawHLine(DEPG_HP.width / 2 + 5, y_graph + h_bar, DEPG_HP.width / 2 + 10, scr_orientation, frame);
 		SE0352.drawHLine(DEPG_HP.width / 2 + 5, y_graph, DEPG_HP.width / 2 + 10, scr_orientation, frame);
 
-		for (int idx = 0; idx < num_values; idx++)
+		int idx = 0;
+		for (float co2_value : co2_values)
 		{
-			if (co2_values[idx] != 0.0)
+			if (co2_value != 0.0)
 			{
 				SE0352.drawVLine((int16_t)(x_graph + (idx * w_bar)),
-								 (int16_t)(y_graph + ((h_bar) - (co2_values[idx] / bar_divider))),
+								 (int16_t)(y_graph + ((h_bar) - (co2_value / bar_divider))),
 								 (int16_t)(y_graph + h_bar),
 								 scr_orientation, frame);
 			}
+			idx++;
 		}
 		SE0352.drawHLine(x_graph, y_graph + h_bar, x_graph + DEPG_HP.width / 2, scr_orientation, frame);
 
@@ -701,17 +642,17 @@ void pm_rak14000(void)
 	s_text = 2;
 
 	// Write value
-	SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, (uint8_t *)pm_img, scr_orientation);
+	SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, unpack_rak14000(pm_img), scr_orientation);
 
 	snprintf(disp_text, 29, "PM");
 	rak14000_text(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
 
 	// PM 1.0 levels
-	if (pm10_values[pm_idx - 1] > 75)
+	if (pm10_values.latest() > 75)
 	{
 		snprintf(disp_text, 29, "1.0: !!");
 	}
-	else if (pm10_values[pm_idx - 1] > 35)
+	else if (pm10_values.latest() > 35)
 	{
 		snprintf(disp_text, 29, "1.0: !");
 	}
@@ -721,7 +662,7 @@ void pm_rak14000(void)
 	}
 	rak14000_text(x_text, y_text + 60, disp_text, txt_color, s_text);
 
-	snprintf(disp_text, 29, "%d", pm10_values[pm_idx - 1]);
+	snprintf(disp_text, 29, "%d", pm10_values.latest());
 
 	txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 	rak14000_text(DEPG_HP.width - txt_w - 45, y_text + 60, disp_text, txt_color, s_text);
@@ -729,11 +670,11 @@ void pm_rak14000(void)
 	rak14000_text(DEPG_HP.width - 38, y_text + 65, disp_text, txt_color, 1);
 
 	// PM 2.5 levels
-	if (pm25_values[pm_idx - 1] > 75)
+	if (pm25_values.latest() > 75)
 	{
 		snprintf(disp_text, 29, "2.5: !!");
 	}
-	else if (pm25_values[pm_idx - 1] > 35)
+	else if (pm25_values.latest() > 35)
 	{
 		snprintf(disp_text, 29, "2.5: !");
 	}
@@ -743,18 +684,18 @@ void pm_rak14000(void)
 	}
 	rak14000_text(x_text, y_text + 120, disp_text, txt_color, s_text);
 
-	snprintf(disp_text, 29, "%d", pm25_values[pm_idx - 1]);
+	snprintf(disp_text, 29, "%d", pm25_values.latest());
 	txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 	rak14000_text(DEPG_HP.width - txt_w - 45, y_text + 120, disp_text, txt_color, s_text);
 	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
 	rak14000_text(DEPG_HP.width - 38, y_text + 125, disp_text, txt_color, 1);
 
 	// PM 10 levels
-	if (pm100_values[pm_idx - 1] > 199)
+	if (pm100_values.latest() > 199)
 	{
 		snprintf(disp_text, 29, "10: !!");
 	}
-	else if (pm100_values[pm_idx - 1] > 150)
+	else if (pm100_values.latest() > 150)
 	{
 		snprintf(disp_text, 29, "10: !");
 	}
@@ -764,7 +705,7 @@ void pm_rak14000(void)
 	}
 	rak14000_text(x_text, y_text + 180, disp_text, txt_color, s_text);
 
-	snprintf(disp_text, 29, "%d", pm100_values[pm_idx - 1]);
+	snprintf(disp_text, 29, "%d", pm100_values.latest());
 	txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 	rak14000_text(DEPG_HP.width - txt_w - 45, y_text + 180, disp_text, txt_color, s_text);
 	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
@@ -800,14 +741,14 @@ void temp_rak14000(bool has_pm)
 		spacer = 50;
 
 		// Write value
-		SE0352.drawBitmap(32, 32, DEPG_HP.width - (DEPG_HP.width / 4 - 16), y_text, 0, 0, 0, frame, (uint8_t *)celsius_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, DEPG_HP.width - (DEPG_HP.width / 4 - 16), y_text, 0, 0, 0, frame, unpack_rak14000(celsius_img), scr_orientation);
 
 		snprintf(disp_text, 29, "~C");
 		txt_w2 = SE0352.strWidth(disp_text, SMALL_FONT);
 
 		rak14000_text(DEPG_HP.width - txt_w2 - 3, y_text + spacer, disp_text, (uint16_t)txt_color, 1);
 
-		snprintf(disp_text, 29, "%.2f ", temp_values[temp_idx - 1]);
+		snprintf(disp_text, 29, "%.2f ", temp_values.latest());
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 
 		// For partial update only
@@ -828,9 +769,9 @@ void temp_rak14000(bool has_pm)
 	else
 	{
 		// Write value
-		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, (uint8_t *)celsius_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, unpack_rak14000(celsius_img), scr_orientation);
 
-		snprintf(disp_text, 29, "%.2f", temp_values[temp_idx - 1]);
+		snprintf(disp_text, 29, "%.2f", temp_values.latest());
 
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 
@@ -869,14 +810,14 @@ void humid_rak14000(bool has_pm)
 		spacer = 50;
 
 		// Write value
-		SE0352.drawBitmap(32, 32, DEPG_HP.width - (DEPG_HP.width / 4 - 16), y_text, 0, 0, 0, frame, (uint8_t *)humidity_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, DEPG_HP.width - (DEPG_HP.width / 4 - 16), y_text, 0, 0, 0, frame, unpack_rak14000(humidity_img), scr_orientation);
 
 		snprintf(disp_text, 29, "%%RH");
 		txt_w2 = SE0352.strWidth(disp_text, SMALL_FONT);
 
 		rak14000_text(DEPG_HP.width - txt_w2 - 3, y_text + spacer, disp_text, (uint16_t)txt_color, 1);
 
-		snprintf(disp_text, 29, "%.2f ", humid_values[humid_idx - 1]);
+		snprintf(disp_text, 29, "%.2f ", humid_values.latest());
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 
 		// For partial update only
@@ -897,9 +838,9 @@ void humid_rak14000(bool has_pm)
 	else
 	{
 		// Write value
-		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, (uint8_t *)humidity_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, unpack_rak14000(humidity_img), scr_orientation);
 
-		snprintf(disp_text, 29, "%.2f", humid_values[humid_idx - 1]);
+		snprintf(disp_text, 29, "%.2f", humid_values.latest());
 
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 
@@ -944,7 +885,7 @@ void baro_rak14000(bool has_pm)
 		spacer = 50;
 
 		// Write value
-		SE0352.drawBitmap(32, 32, DEPG_HP.width - (DEPG_HP.width / 4 - 16), y_text, 0, 0, 0, frame, (uint8_t *)barometer_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, DEPG_HP.width - (DEPG_HP.width / 4 - 16), y_text, 0, 0, 0, frame, unpack_rak14000(barometer_img), scr_orientation);
 
 		snprintf(disp_text, 29, "mBar");
 		txt_w2 = SE0352.strWidth(disp_text, SMALL_FONT);
@@ -957,7 +898,7 @@ void baro_rak14000(bool has_pm)
 
 		rak14000_text(DEPG_HP.width - txt_w2 - 3, y_text + spacer, disp_text, (uint16_t)txt_color, 1);
 
-		snprintf(disp_text, 29, "%.1f ", baro_values[baro_idx - 1]);
+		snprintf(disp_text, 29, "%.1f ", baro_values.latest());
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 
 		rak14000_text(DEPG_HP.width - txt_w - txt_w2 - 2, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
@@ -972,9 +913,9 @@ void baro_rak14000(bool has_pm)
 	else
 	{
 		// Write value
-		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, (uint8_t *)barometer_img, scr_orientation);
+		SE0352.drawBitmap(32, 32, x_text, y_text, 0, 0, 0, frame, unpack_rak14000(barometer_img), scr_orientation);
 
-		snprintf(disp_text, 29, "%.2f", baro_values[baro_idx - 1]);
+		snprintf(disp_text, 29, "%.2f", baro_values.latest());
 
 		txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
 
@@ -1016,21 +957,21 @@ void epd_task(void *pvParameters)
 	SE0352.refresh();
 
 	// Draw Welcome Logo
-	SE0352.drawBitmap(rak_img_width, rak_img_height, (DEPG_HP.width / 2) - (rak_img_width / 2), 5, frame, (uint8_t *)rak_img, scr_orientation);
+	SE0352.drawBitmap(rak_img.width, rak_img.height, (DEPG_HP.width / 2) - (rak_img.width / 2), 5, frame, unpack_rak14000(rak_img), scr_orientation);
 
 	sprintf(disp_text, (char *)"IoT Made Easy");
 	txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
-	rak14000_text(DEPG_HP.width / 2 - (txt_w / 2), rak_img_height + 5 + 20, disp_text, (uint16_t)txt_color, 2);
+	rak14000_text(DEPG_HP.width / 2 - (txt_w / 2), rak_img.height + 5 + 20, disp_text, (uint16_t)txt_color, 2);
 
 	sprintf(disp_text, (char *)"RAK10702 Air Quality");
 	txt_w = SE0352.strWidth(disp_text, LARGE_FONT);
-	rak14000_text(DEPG_HP.width / 2 - (txt_w / 2), rak_img_height + 5 + 50, disp_text, (uint16_t)txt_color, 2);
+	rak14000_text(DEPG_HP.width / 2 - (txt_w / 2), rak_img.height + 5 + 50, disp_text, (uint16_t)txt_color, 2);
 
-	SE0352.drawBitmap(wisblock_width, wisblock_height, (DEPG_HP.width / 2) - (wisblock_width / 2), rak_img_height + 5 + 60, frame, (uint8_t *)wisblock_img, scr_orientation);
+	SE0352.drawBitmap(wisblock_img.width, wisblock_img.height, (DEPG_HP.width / 2) - (wisblock_img.width / 2), rak_img.height + 5 + 60, frame, unpack_rak14000(wisblock_img), scr_orientation);
 
 	sprintf(disp_text, (char *)"Wait for connect");
 	txt_w = SE0352.strWidth(disp_text, SMALL_FONT);
-	rak14000_text(DEPG_HP.width / 2 - (txt_w / 2), rak_img_height + wisblock_height + 5 + 80, disp_text, (uint16_t)txt_color, 1);
+	rak14000_text(DEPG_HP.width / 2 - (txt_w / 2), rak_img.height + wisblock_img.height + 5 + 80, disp_text, (uint16_t)txt_color, 1);
 
 	SE0352.send(frame);
 	SE0352.refresh();
@@ -1074,6 +1015,9 @@ void epd_task(void *pvParameters)
 #endif
 		{
 			refresh_rak14000();
+			// Write the values of this cycle with one file access, then compact the log
+			history_log_flush();
+			history_log_compact();
 			delay(1000);
 		}
 	}
@@ -16,28 +16,32 @@ uint16_t display_width = 400;
 uint16_t display_height = 300;
 
 // 4.2" EPD with SSD1683
-Adafruit_SSD1681 display(display_height, display_width, EPD_MOSI,
+RAK14000_SSD1681 display(display_height, display_width, EPD_MOSI,
 						 EPD_SCK, EPD_DC, EPD_RESET,
 						 EPD_CS, SRAM_CS, EPD_MISO,
 						 EPD_BUSY);
 
-/** Set num_values to 1/4 of the display width */
-
-const uint16_t num_values = 400 / 4;
-uint16_t voc_values[num_values] = {0};
-float temp_values[num_values] = {0.0};
-float humid_values[num_values] = {0.0};
-float baro_values[num_values] = {0.0};
-float co2_values[num_values] = {0.0};
-uint16_t pm10_values[num_values] = {0};
-uint16_t pm25_values[num_values] = {0};
-uint16_t pm100_values[num_values] = {0};
-uint8_t voc_idx = 0;
-uint8_t temp_idx = 0;
-uint8_t humid_idx = 0;
-uint8_t baro_idx = 0;
-uint8_t co2_idx = 0;
-uint8_t pm_idx = 0;
+/** Sensor history for the graphs, size is set in RAK14000_epd.h */
+SensorHistory<uint16_t, num_values> voc_values;
+SensorHistory<float, num_values, 100> temp_values;
+SensorHistory<float, num_values, 100> humid_values;
+SensorHistory<float, num_values, 10> baro_values;
+SensorHistory<float, num_values> co2_values;
+SensorHistory<uint16_t, num_values> pm10_values;
+SensorHistory<uint16_t, num_values> pm25_values;
+SensorHistory<uint16_t, num_values> pm100_values;
+
+/** Histories saved in the history log, in the order of the HIST_xxx channel numbers */
+history_channel_t history_channels[] = {
+	HISTORY_CHANNEL(voc_values),
+	HISTORY_CHANNEL(temp_values),
+	HISTORY_CHANNEL(humid_values),
+	HISTORY_CHANNEL(baro_values),
+	HISTORY_CHANNEL(co2_values),
+	HISTORY_CHANNEL(pm10_values),
+	HISTORY_CHANNEL(pm25_values),
+	HISTORY_CHANNEL(pm100_values)};
+const uint8_t num_history_channels = sizeof(history_channels) / sizeof(history_channel_t);
 
 char disp_text[60];
 
@@ -65,25 +69,15 @@ uint16_t txt_w;
 uint16_t txt_w2;
 uint16_t txt_h;
 
-// For text and image placements
-uint16_t x_text;
-uint16_t y_text;
-uint16_t s_text;
-uint16_t w_text;
-uint16_t h_text;
-uint16_t x_graph;
-uint16_t y_graph;
-uint16_t h_bar;
-uint16_t w_bar;
-float bar_divider;
-uint16_t spacer;
-
 /** Timer to switch off display */
 SoftwareTimer display_off;
 
 /** UI selector. 0 = scientific, 1 = Icon, 2 = Status */
 uint8_t g_ui_selected = 0;
 
+/** Graph range. 0 = last values, 1 = 24 hours, 2 = 7 days */
+uint8_t g_graph_range = HISTORY_RAW;
+
 /**
  * @brief Initialization of RAK14000 EPD
  *
@@ -95,6 +89,9 @@ void init_rak14000(void)
 
 	g_epd_off = false;
 
+	// Restore the sensor history before the display task starts
+	history_log_restore();
+
 	// Create the EPD event semaphore
 	g_epd_sem = xSemaphoreCreateBinary();
 	// Initialize semaphore
@@ -151,6 +148,80 @@ void text_rak14000(int16_t x, int16_t y, char *text, uint16_t text_color, uint32
 	display.print(text);
 }
 
+/**
+ * @brief Get position and size of a text without touching the display
+ *        Same result as getTextBounds() at cursor 0/0, text size 1 and without wrap.
+ *        For constant texts use small_text_bounds() or large_text_bounds()
+ *
+ * @param font SMALL_FONT or LARGE_FONT
+ * @param text text to measure
+ * @return text_bounds_t position and size, all 0 for an empty text
+ */
+text_bounds_t text_bounds_rak14000(const GFXfont *font, const char *text)
+{
+	int16_t min_x = 0x7FFF, min_y = 0x7FFF, max_x = -1, max_y = -1;
+	int16_t x = 0;
+	for (; *text != 0; text++)
+	{
+		const GFXglyph *glyph = text_glyph(font->glyph, *text);
+		if (glyph == nullptr)
+		{
+			continue;
+		}
+		if (x + glyph->xOffset < min_x)
+		{
+			min_x = x + glyph->xOffset;
+		}
+		if (x + glyph->xOffset + glyph->width - 1 > max_x)
+		{
+			max_x = x + glyph->xOffset + glyph->width - 1;
+		}
+		if (glyph->yOffset < min_y)
+		{
+			min_y = glyph->yOffset;
+		}
+		if (glyph->yOffset + glyph->height - 1 > max_y)
+		{
+			max_y = glyph->yOffset + glyph->height - 1;
+		}
+		x += glyph->xAdvance;
+	}
+	if ((max_x < min_x) || (max_y < min_y))
+	{
+		return {0, 0, 0, 0};
+	}
+	return {min_x, min_y, (uint16_t)(max_x - min_x + 1), (uint16_t)(max_y - min_y + 1)};
+}
+
+/**
+ * @brief Draw a compressed image
+ *        The image is unpacked while it is drawn, like drawBitmap()
+ *        only the set pixels are drawn.
+ *
+ * @param x left side of the image
+ * @param y top of the image
+ * @param image compressed image
+ * @param color color of the set pixels
+ */
+void draw_image_rak14000(int16_t x, int16_t y, const epd_image_t &image, uint16_t color)
+{
+	ImageReader reader(image);
+	for (int16_t row = 0; row < image.height; row++)
+	{
+		for (int16_t col = 0; col < image.width; col += 8)
+		{
+			uint8_t bits = reader.next();
+			for (int16_t bit = col; bits != 0; bit++, bits <<= 1)
+			{
+				if ((bits & 0x80) && (bit < image.width))
+				{
+					display.drawPixel(x + bit, y + row, color);
+				}
+			}
+		}
+	}
+}
+
 /**
  * @brief Clear display content
  *
@@ -181,31 +252,29 @@ bool first_time = true;
 
 char *months_txt[] = {(char *)"Jan", (char *)"Feb", (char *)"Mar", (char *)"Apr", (char *)"May", (char *)"Jun", (char *)"Jul", (char *)"Aug", (char *)"Sep", (char *)"Oct", (char *)"Nov", (char *)"Dec"};
 
+/** The icon and status UI are one widget each */
+static epd_widget_t icon_widgets[] = {epd_widget(icon_rak14000)};
+static epd_widget_t status_widgets[] = {epd_widget(status_ui_rak14000)};
+
 /**
  * @brief Update screen content
+ *        Only changed widgets are redrawn and sent with a partial refresh
  *
  */
 void refresh_rak14000(void)
 {
-	// Clear display buffer
-	clear_rak14000();
-
 	switch (g_ui_selected)
 	{
 	case 0:
-		scientific_rak14000();
+		refresh_widgets_rak14000(scientific_widgets, num_scientific_widgets);
 		break;
 	case 1:
-		icon_rak14000();
+		refresh_widgets_rak14000(icon_widgets, 1);
 		break;
 	case 2:
-		status_ui_rak14000();
+		refresh_widgets_rak14000(status_widgets, 1);
 		break;
 	}
-
-	delay(100);
-	display.display();
-	delay(100);
 }
 
 /**
@@ -216,6 +285,7 @@ void status_rak14000(void)
 {
 	// Clear display buffer
 	clear_rak14000();
+	invalidate_widgets_rak14000();
 
 	if (found_sensors[RTC_ID].found_sensor)
 	{
@@ -226,7 +296,7 @@ void status_rak14000(void)
 				 g_date_time.hour, g_date_time.minute);
 	}
 
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = text_bounds_rak14000(SMALL_FONT, disp_text).w;
 	text_rak14000((display_width / 2) - (txt_w / 2), 1, disp_text, (uint16_t)txt_color, 1);
 }
 
@@ -237,22 +307,8 @@ void status_rak14000(void)
  */
 void set_voc_rak14000(uint16_t voc_value)
 {
-	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_idx);
-	// Shift values if necessary
-	if (voc_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			voc_values[idx] = voc_values[idx + 1];
-		}
-		voc_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	voc_values[voc_idx] = voc_value;
-
-	// Increase index
-	voc_idx++;
+	MYLOG("EPD", "VOC set to %d at index %d", voc_value, voc_values.count());
+	history_add(HIST_VOC, voc_values.to_fixed(voc_value));
 }
 
 /**
@@ -262,22 +318,8 @@ void set_voc_rak14000(uint16_t voc_value)
  */
 void set_temp_rak14000(float temp_value)
 {
-	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_idx);
-	// Shift values if necessary
-	if (temp_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			temp_values[idx] = temp_values[idx + 1];
-		}
-		temp_idx = (num_values - 1);
-	}
-
-	// Fill Temperature array
-	temp_values[temp_idx] = temp_value;
-
-	// Increase index
-	temp_idx++;
+	MYLOG("EPD", "Temp set to %.2f at index %d", temp_value, temp_values.count());
+	history_add(HIST_TEMP, temp_values.to_fixed(temp_value));
 }
 
 /**
@@ -287,22 +329,8 @@ void set_temp_rak14000(float temp_value)
  */
 void set_humid_rak14000(float humid_value)
 {
-	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_idx);
-	// Shift values if necessary
-	if (humid_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			humid_values[idx] = humid_values[idx + 1];
-		}
-		humid_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	humid_values[humid_idx] = humid_value;
-
-	// Increase index
-	humid_idx++;
+	MYLOG("EPD", "Humid set to %.2f at index %d", humid_value, humid_values.count());
+	history_add(HIST_HUMID, humid_values.to_fixed(humid_value));
 }
 
 /**
@@ -312,22 +340,8 @@ void set_humid_rak14000(float humid_value)
  */
 void set_co2_rak14000(float co2_value)
 {
-	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_idx);
-	// Shift values if necessary
-	if (co2_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			co2_values[idx] = co2_values[idx + 1];
-		}
-		co2_idx = (num_values - 1);
-	}
-
-	// Fill VOC array
-	co2_values[co2_idx] = co2_value;
-
-	// Increase index
-	co2_idx++;
+	MYLOG("EPD", "CO2 set to %.2f at index %d", co2_value, co2_values.count());
+	history_add(HIST_CO2, co2_values.to_fixed(co2_value));
 }
 
 /**
@@ -337,22 +351,8 @@ void set_co2_rak14000(float co2_value)
  */
 void set_baro_rak14000(float baro_value)
 {
-	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_idx);
-	// Shift values if necessary
-	if (baro_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			baro_values[idx] = baro_values[idx + 1];
-		}
-		baro_idx = (num_values - 1);
-	}
-
-	// Fill Barometer array
-	baro_values[baro_idx] = baro_value;
-
-	// Increase index
-	baro_idx++;
+	MYLOG("EPD", "Baro set to %.2f at index %d", baro_value, baro_values.count());
+	history_add(HIST_BARO, baro_values.to_fixed(baro_value));
 }
 
 /**
@@ -364,26 +364,10 @@ void set_baro_rak14000(float baro_value)
  */
 void set_pm_rak14000(uint16_t pm10_env, uint16_t pm25_env, uint16_t pm100_env)
 {
-	MYLOG("EPD", "PM set to %d %d %d  at index %d", pm10_env, pm25_env, pm100_env, pm_idx);
-	// Shift values if necessary
-	if (pm_idx == num_values)
-	{
-		for (int idx = 0; idx < (num_values - 1); idx++)
-		{
-			pm10_values[idx] = pm10_values[idx + 1];
-			pm25_values[idx] = pm25_values[idx + 1];
-			pm100_values[idx] = pm100_values[idx + 1];
-		}
-		pm_idx = (num_values - 1);
-	}
-
-	// Fill PM array
-	pm10_values[pm_idx] = pm10_env;
-	pm25_values[pm_idx] = pm25_env;
-	pm100_values[pm_idx] = pm100_env;
-
-	// Increase index
-	pm_idx++;
+	MYLOG("EPD", "PM set to %d %d %d  at index %d", pm10_env, pm25_env, pm100_env, pm10_values.count());
+	history_add(HIST_PM10, pm10_values.to_fixed(pm10_env));
+	history_add(HIST_PM25, pm25_values.to_fixed(pm25_env));
+	history_add(HIST_PM100, pm100_values.to_fixed(pm100_env));
 }
 
 void rak14000_start_screen(bool startup)
@@ -393,10 +377,7 @@ void rak14000_start_screen(bool startup)
 
 	// Draw Welcome Logo
 	display.fillRect(0, 0, display_width, display_height, bg_color);
-	display.drawBitmap(display_width / 2 - 75, 50, rak_img, 184, 56, txt_color); // 184x56
-
-	display.setFont(SMALL_FONT);
-	display.setTextSize(1);
+	draw_image_rak14000(display_width / 2 - 75, 50, rak_img, txt_color); // 184x56
 
 	// If RTC is available, write the date
 	if (found_sensors[RTC_ID].found_sensor)
@@ -407,31 +388,26 @@ void rak14000_start_screen(bool startup)
 		text_rak14000(0, 0, disp_text, (uint16_t)txt_color, 1);
 	}
 
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds((char *)"IoT Made Easy", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = large_text_bounds("IoT Made Easy").w;
 	text_rak14000(display_width / 2 - (txt_w / 2), 110, (char *)"IoT Made Easy", (uint16_t)txt_color, 2);
 
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds((char *)"RAK10702 Air Quality", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = large_text_bounds("RAK10702 Air Quality").w;
 	text_rak14000(display_width / 2 - (txt_w / 2), 150, (char *)"RAK10702 Air Quality", (uint16_t)txt_color, 2);
 
-	display.drawBitmap(display_width / 2 - 63, 190, built_img, 126, 66, txt_color);
+	draw_image_rak14000(display_width / 2 - 63, 190, built_img, txt_color);
 
-	display.setFont(SMALL_FONT);
-	display.setTextSize(1);
 	if (startup)
 	{
-		display.getTextBounds((char *)"Wait for connect", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = small_text_bounds("Wait for connect").w;
 		text_rak14000(display_width / 2 - (txt_w / 2), 260, (char *)"Wait for connect", (uint16_t)txt_color, 1);
 	}
 	else
 	{
-		display.getTextBounds((char *)"Restart", 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = small_text_bounds("Restart").w;
 		text_rak14000(display_width / 2 - (txt_w / 2), 260, (char *)"Restart", (uint16_t)txt_color, 1);
 	}
 	display.display(false);
+	invalidate_widgets_rak14000();
 }
 
 void rak14000_switch_bg(void)
@@ -459,36 +435,8 @@ void epd_task(void *pvParameters)
 
 	rak14000_start_screen();
 
-	// For partial update only
-	// uint16_t counter = 0;
 	while (1)
 	{
-		// For partial update only
-		// display.clearBuffer();
-		// display.setTextSize(4);
-		// display.setTextColor(EPD_BLACK);
-		// display.setCursor(32, 32);
-		// display.print((counter / 1000) % 10);
-		// display.print((counter / 100) % 10);
-		// display.print((counter / 10) % 10);
-		// display.print(counter % 10);
-
-		// if ((counter % 10) == 0)
-		// {
-		// 	MYLOG("EPD", "Full update");
-		// 	display.display(false);
-		// }
-		// else
-		// {
-		// 	MYLOG("EPD", "Partial update");
-		// 	// redraw only 4th digit
-		// 	display.displayPartial(32 + (24 * 3), 32, 32 + (24 * 4), 32 + (4 * 8));
-		// }
-
-		// MYLOG("EPD", "Counter = %d", counter);
-		// counter++;
-		// delay(5000);
-
 		if (xSemaphoreTake(g_epd_sem, portMAX_DELAY) == pdTRUE)
 		{
 			// if (!g_is_unoccupied)
@@ -502,6 +450,9 @@ void epd_task(void *pvParameters)
 				display.powerUp();
 				refresh_rak14000();
 				display.powerDown();
+				// Write the values of this cycle with one file access, then compact the log
+				history_log_flush();
+				history_log_compact();
 				// Start timer to shut down EPD after 5 seconds (give time to refresh full screen)
 				// display_off.start();
 			// }
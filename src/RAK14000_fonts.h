@@ -0,0 +1,327 @@
+/**
+ * @file RAK14000_fonts.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Glyph tables of the EPD fonts and text sizes at compile time
+ *        small_text_bounds() and large_text_bounds() give the same result as
+ *        Adafruit_GFX::getTextBounds() with text size 1 and without line wrap.
+ *        For constant strings they are calculated by the compiler,
+ *        text_bounds_rak14000() does the same at runtime.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RAK14000_FONTS_H
+#define RAK14000_FONTS_H
+
+#include <Adafruit_GFX.h>
+
+/** First and last character of both fonts */
+#define RAK_EPD_FONT_FIRST 0x20
+#define RAK_EPD_FONT_LAST 0x80
+
+constexpr GFXglyph RAK_EPD_10pt_Glyphs[] = {
+	{0, 1, 1, 4, 0, 0},		 // 0x20 ' '
+	{1, 3, 7, 6, 1, -7},	 // 0x21 '!'
+	{4, 4, 3, 6, 1, -7},	 // 0x22 '"'
+	{6, 8, 7, 9, 1, -7},	 // 0x23 '#'
+	{13, 6, 8, 8, 1, -7},	 // 0x24 '$'
+	{19, 10, 7, 11, 1, -7},	 // 0x25 '%'
+	{28, 9, 7, 10, 1, -7},	 // 0x26 '&'
+	{36, 2, 3, 4, 1, -7},	 // 0x27 '''
+	{37, 4, 9, 6, 1, -8},	 // 0x28 '('
+	{42, 4, 9, 6, 1, -8},	 // 0x29 ')'
+	{47, 6, 6, 6, 0, -7},	 // 0x2A '*'
+	{52, 8, 7, 9, 1, -7},	 // 0x2B '+'
+	{59, 3, 3, 5, 1, -2},	 // 0x2C ','
+	{61, 4, 1, 5, 1, -4},	 // 0x2D '-'
+	{62, 3, 2, 5, 1, -2},	 // 0x2E '.'
+	{63, 5, 8, 5, 0, -7},	 // 0x2F '/'
+	{68, 7, 7, 8, 1, -7},	 // 0x30 '0'
+	{75, 7, 7, 8, 1, -7},	 // 0x31 '1'
+	{82, 7, 7, 8, 1, -7},	 // 0x32 '2'
+	{89, 7, 7, 8, 1, -7},	 // 0x33 '3'
+	{96, 7, 7, 8, 1, -7},	 // 0x34 '4'
+	{103, 7, 7, 8, 1, -7},	 // 0x35 '5'
+	{110, 7, 7, 8, 1, -7},	 // 0x36 '6'
+	{117, 7, 7, 8, 1, -7},	 // 0x37 '7'
+	{124, 7, 7, 8, 1, -7},	 // 0x38 '8'
+	{131, 7, 7, 8, 1, -7},	 // 0x39 '9'
+	{138, 3, 5, 5, 1, -5},	 // 0x3A ':'
+	{140, 3, 6, 5, 1, -5},	 // 0x3B ';'
+	{143, 7, 6, 9, 1, -6},	 // 0x3C '<'
+	{149, 7, 3, 9, 1, -5},	 // 0x3D '='
+	{152, 7, 6, 9, 1, -6},	 // 0x3E '>'
+	{158, 5, 7, 7, 1, -7},	 // 0x3F '?'
+	{163, 10, 9, 11, 1, -7}, // 0x40 '@'
+	{175, 9, 7, 10, 1, -7},	 // 0x41 'A'
+	{183, 7, 7, 8, 1, -7},	 // 0x42 'B'
+	{190, 7, 7, 8, 1, -7},	 // 0x43 'C'
+	{197, 8, 7, 9, 1, -7},	 // 0x44 'D'
+	{204, 6, 7, 7, 1, -7},	 // 0x45 'E'
+	{210, 6, 7, 7, 1, -7},	 // 0x46 'F'
+	{216, 8, 7, 9, 1, -7},	 // 0x47 'G'
+	{223, 8, 7, 9, 1, -7},	 // 0x48 'H'
+	{230, 3, 7, 4, 1, -7},	 // 0x49 'I'
+	{233, 4, 9, 4, 0, -7},	 // 0x4A 'J'
+	{238, 8, 7, 8, 1, -7},	 // 0x4B 'K'
+	{245, 6, 7, 7, 1, -7},	 // 0x4C 'L'
+	{251, 9, 7, 10, 1, -7},	 // 0x4D 'M'
+	{259, 8, 7, 9, 1, -7},	 // 0x4E 'N'
+	{266, 8, 7, 9, 1, -7},	 // 0x4F 'O'
+	{273, 7, 7, 8, 1, -7},	 // 0x50 'P'
+	{280, 8, 8, 9, 1, -7},	 // 0x51 'Q'
+	{288, 8, 7, 9, 1, -7},	 // 0x52 'R'
+	{295, 7, 7, 8, 1, -7},	 // 0x53 'S'
+	{302, 7, 7, 8, 1, -7},	 // 0x54 'T'
+	{309, 8, 7, 9, 1, -7},	 // 0x55 'U'
+	{316, 9, 7, 10, 1, -7},	 // 0x56 'V'
+	{324, 11, 7, 12, 1, -7}, // 0x57 'W'
+	{334, 8, 7, 9, 1, -7},	 // 0x58 'X'
+	{341, 9, 7, 8, 0, -7},	 // 0x59 'Y'
+	{349, 7, 7, 8, 1, -7},	 // 0x5A 'Z'
+	{356, 4, 9, 6, 1, -8},	 // 0x5B '['
+	{361, 5, 8, 5, 0, -7},	 // 0x5C '\'
+	{366, 4, 9, 6, 1, -8},	 // 0x5D ']'
+	{371, 7, 3, 9, 1, -7},	 // 0x5E '^'
+	{374, 6, 1, 6, 0, 1},	 // 0x5F '_'
+	{375, 4, 2, 6, 0, -8},	 // 0x60 '`'
+	{376, 7, 5, 8, 1, -5},	 // 0x61 'a'
+	{381, 7, 8, 8, 1, -8},	 // 0x62 'b'
+	{388, 6, 5, 7, 1, -5},	 // 0x63 'c'
+	{392, 7, 8, 8, 1, -8},	 // 0x64 'd'
+	{399, 7, 5, 8, 1, -5},	 // 0x65 'e'
+	{404, 6, 8, 5, 0, -8},	 // 0x66 'f'
+	{410, 7, 7, 8, 1, -5},	 // 0x67 'g'
+	{417, 7, 8, 8, 1, -8},	 // 0x68 'h'
+	{424, 3, 8, 4, 1, -8},	 // 0x69 'i'
+	{427, 4, 10, 4, 0, -8},	 // 0x6A 'j'
+	{432, 7, 8, 8, 1, -8},	 // 0x6B 'k'
+	{439, 3, 8, 4, 1, -8},	 // 0x6C 'l'
+	{442, 11, 5, 12, 1, -5}, // 0x6D 'm'
+	{449, 7, 5, 8, 1, -5},	 // 0x6E 'n'
+	{454, 7, 5, 8, 1, -5},	 // 0x6F 'o'
+	{459, 7, 7, 8, 1, -5},	 // 0x70 'p'
+	{466, 7, 7, 8, 1, -5},	 // 0x71 'q'
+	{473, 5, 5, 6, 1, -5},	 // 0x72 'r'
+	{477, 6, 5, 7, 1, -5},	 // 0x73 's'
+	{481, 6, 7, 6, 0, -7},	 // 0x74 't'
+	{487, 7, 5, 8, 1, -5},	 // 0x75 'u'
+	{492, 7, 5, 8, 1, -5},	 // 0x76 'v'
+	{497, 9, 5, 10, 1, -5},	 // 0x77 'w'
+	{503, 7, 5, 8, 1, -5},	 // 0x78 'x'
+	{508, 7, 7, 8, 1, -5},	 // 0x79 'y'
+	{515, 5, 5, 6, 1, -5},	 // 0x7A 'z'
+	{519, 6, 9, 8, 1, -8},	 // 0x7B '{'
+	{526, 2, 10, 5, 1, -8},	 // 0x7C '|'
+	{529, 6, 9, 8, 2, -8},	 // 0x7D '}'
+	{536, 6, 5, 6, 0, -8},	 // 0x7E '°'
+	{541, 7, 7, 8, 1, -5},	 // 0x7F 'μ'
+	{548, 5, 7, 5, 0, -8}	 // 0x80 '³'
+};
+
+constexpr GFXglyph RAK_EPD_20pt_Glyphs[] = {
+	{0, 1, 1, 8, 0, 0},			 // 0x20 ' '
+	{1, 5, 15, 10, 3, -15},		 // 0x21 '!'
+	{11, 7, 5, 11, 2, -15},		 // 0x22 '"'
+	{16, 15, 15, 18, 1, -15},	 // 0x23 '#'
+	{45, 13, 18, 15, 1, -15},	 // 0x24 '$'
+	{75, 20, 15, 21, 1, -15},	 // 0x25 '%'
+	{113, 16, 15, 18, 1, -15},	 // 0x26 '&'
+	{143, 3, 5, 7, 2, -15},		 // 0x27 '''
+	{145, 7, 18, 10, 2, -15},	 // 0x28 '('
+	{161, 7, 18, 10, 1, -15},	 // 0x29 ')'
+	{177, 11, 9, 11, 0, -15},	 // 0x2A '*'
+	{190, 13, 12, 18, 2, -12},	 // 0x2B '+'
+	{210, 6, 7, 9, 1, -4},		 // 0x2C ','
+	{216, 7, 3, 9, 1, -7},		 // 0x2D '-'
+	{219, 5, 4, 9, 2, -4},		 // 0x2E '.'
+	{222, 8, 16, 8, 0, -15},	 // 0x2F '/'
+	{238, 13, 15, 15, 1, -15},	 // 0x30 '0'
+	{263, 11, 15, 15, 3, -15},	 // 0x31 '1'
+	{284, 12, 15, 15, 2, -15},	 // 0x32 '2'
+	{307, 12, 15, 15, 1, -15},	 // 0x33 '3'
+	{330, 13, 15, 15, 1, -15},	 // 0x34 '4'
+	{355, 12, 15, 15, 2, -15},	 // 0x35 '5'
+	{378, 13, 15, 15, 1, -15},	 // 0x36 '6'
+	{403, 12, 15, 15, 1, -15},	 // 0x37 '7'
+	{426, 13, 15, 15, 1, -15},	 // 0x38 '8'
+	{451, 13, 15, 15, 1, -15},	 // 0x39 '9'
+	{476, 5, 11, 9, 2, -11},	 // 0x3A ':'
+	{483, 6, 14, 9, 1, -11},	 // 0x3B ';'
+	{494, 14, 11, 18, 2, -12},	 // 0x3C '<'
+	{514, 14, 6, 18, 2, -9},	 // 0x3D '='
+	{525, 14, 11, 18, 2, -12},	 // 0x3E '>'
+	{545, 10, 15, 13, 1, -15},	 // 0x3F '?'
+	{564, 18, 18, 21, 1, -15},	 // 0x40 '@'
+	{605, 16, 15, 16, 0, -15},	 // 0x41 'A'
+	{635, 13, 15, 16, 2, -15},	 // 0x42 'B'
+	{660, 13, 15, 16, 1, -15},	 // 0x43 'C'
+	{685, 15, 15, 18, 2, -15},	 // 0x44 'D'
+	{714, 11, 15, 15, 2, -15},	 // 0x45 'E'
+	{735, 11, 15, 15, 2, -15},	 // 0x46 'F'
+	{756, 15, 15, 17, 1, -15},	 // 0x47 'G'
+	{785, 14, 15, 18, 2, -15},	 // 0x48 'H'
+	{812, 5, 15, 8, 2, -15},	 // 0x49 'I'
+	{822, 8, 19, 8, -1, -15},	 // 0x4A 'J'
+	{841, 15, 15, 17, 2, -15},	 // 0x4B 'K'
+	{870, 11, 15, 14, 2, -15},	 // 0x4C 'L'
+	{891, 17, 15, 21, 2, -15},	 // 0x4D 'M'
+	{923, 14, 15, 18, 2, -15},	 // 0x4E 'N'
+	{950, 16, 15, 18, 1, -15},	 // 0x4F 'O'
+	{980, 13, 15, 16, 2, -15},	 // 0x50 'P'
+	{1005, 16, 18, 18, 1, -15},	 // 0x51 'Q'
+	{1041, 14, 15, 16, 2, -15},	 // 0x52 'R'
+	{1068, 13, 15, 15, 1, -15},	 // 0x53 'S'
+	{1093, 15, 15, 15, 0, -15},	 // 0x54 'T'
+	{1122, 14, 15, 17, 2, -15},	 // 0x55 'U'
+	{1149, 16, 15, 16, 0, -15},	 // 0x56 'V'
+	{1179, 22, 15, 23, 1, -15},	 // 0x57 'W'
+	{1221, 16, 15, 16, 0, -15},	 // 0x58 'X'
+	{1251, 17, 15, 15, -1, -15}, // 0x59 'Y'
+	{1283, 14, 15, 16, 1, -15},	 // 0x5A 'Z'
+	{1310, 7, 18, 10, 2, -15},	 // 0x5B '['
+	{1326, 8, 16, 8, 0, -15},	 // 0x5C '\'
+	{1342, 7, 18, 10, 1, -15},	 // 0x5D ']'
+	{1358, 14, 5, 18, 2, -15},	 // 0x5E '^'
+	{1367, 11, 2, 11, 0, 3},	 // 0x5F '_'
+	{1370, 7, 4, 11, 1, -16},	 // 0x60 '`'
+	{1374, 12, 11, 15, 1, -11},	 // 0x61 'a'
+	{1391, 13, 15, 15, 2, -15},	 // 0x62 'b'
+	{1416, 11, 11, 13, 1, -11},	 // 0x63 'c'
+	{1432, 13, 15, 15, 1, -15},	 // 0x64 'd'
+	{1457, 13, 11, 15, 1, -11},	 // 0x65 'e'
+	{1475, 10, 15, 10, 0, -15},	 // 0x66 'f'
+	{1494, 13, 15, 15, 1, -11},	 // 0x67 'g'
+	{1519, 12, 15, 15, 2, -15},	 // 0x68 'h'
+	{1542, 5, 15, 8, 2, -15},	 // 0x69 'i'
+	{1552, 7, 19, 8, 0, -15},	 // 0x6A 'j'
+	{1569, 13, 15, 14, 2, -15},	 // 0x6B 'k'
+	{1594, 5, 15, 8, 2, -15},	 // 0x6C 'l'
+	{1604, 19, 11, 22, 2, -11},	 // 0x6D 'm'
+	{1631, 12, 11, 15, 2, -11},	 // 0x6E 'n'
+	{1648, 13, 11, 15, 1, -11},	 // 0x6F 'o'
+	{1666, 13, 15, 15, 2, -11},	 // 0x70 'p'
+	{1691, 13, 15, 15, 1, -11},	 // 0x71 'q'
+	{1716, 9, 11, 11, 2, -11},	 // 0x72 'r'
+	{1729, 11, 11, 13, 1, -11},	 // 0x73 's'
+	{1745, 11, 14, 11, 0, -14},	 // 0x74 't'
+	{1765, 12, 11, 15, 2, -11},	 // 0x75 'u'
+	{1782, 13, 11, 14, 0, -11},	 // 0x76 'v'
+	{1800, 18, 11, 19, 1, -11},	 // 0x77 'w'
+	{1825, 13, 11, 14, 1, -11},	 // 0x78 'x'
+	{1843, 13, 15, 14, 1, -11},	 // 0x79 'y'
+	{1868, 11, 11, 13, 1, -11},	 // 0x7A 'z'
+	{1884, 10, 18, 15, 3, -15},	 // 0x7B '{'
+	{1907, 3, 20, 8, 3, -15},	 // 0x7C '|'
+	{1915, 10, 18, 15, 2, -15},	 // 0x7D '}'
+	{1938, 8, 8, 12, 2, -16},	 // 0x7E '°'
+	{1946, 13, 15, 15, 1, -11},	 // 0x7F 'μ'
+	{1971, 8, 10, 10, 1, -16}	 // 0x80 '³'
+};
+
+/** Position and size of a text, same as the results of Adafruit_GFX::getTextBounds() */
+typedef struct text_bounds_s
+{
+	int16_t x1;
+	int16_t y1;
+	uint16_t w;
+	uint16_t h;
+} text_bounds_t;
+
+/**
+ * @brief Get the glyph of a character, nullptr if the font does not have it
+ *
+ */
+constexpr const GFXglyph *text_glyph(const GFXglyph *glyphs, char c)
+{
+	return ((uint8_t)c >= RAK_EPD_FONT_FIRST) && ((uint8_t)c <= RAK_EPD_FONT_LAST) ? &glyphs[(uint8_t)c - RAK_EPD_FONT_FIRST] : nullptr;
+}
+
+/**
+ * @brief Leftmost pixel of a text
+ *
+ * @param glyphs glyph table of the font
+ * @param text rest of the text
+ * @param x cursor position of the first character
+ */
+constexpr int16_t text_min_x(const GFXglyph *glyphs, const char *text, int16_t x)
+{
+	return *text == 0 ? 0x7FFF : text_glyph(glyphs, *text) == nullptr ? text_min_x(glyphs, text + 1, x)
+								: (x + text_glyph(glyphs, *text)->xOffset) < text_min_x(glyphs, text + 1, x + text_glyph(glyphs, *text)->xAdvance)
+									? (x + text_glyph(glyphs, *text)->xOffset)
+									: text_min_x(glyphs, text + 1, x + text_glyph(glyphs, *text)->xAdvance);
+}
+
+/**
+ * @brief Rightmost pixel of a text
+ *
+ * @param glyphs glyph table of the font
+ * @param text rest of the text
+ * @param x cursor position of the first character
+ */
+constexpr int16_t text_max_x(const GFXglyph *glyphs, const char *text, int16_t x)
+{
+	return *text == 0 ? -1 : text_glyph(glyphs, *text) == nullptr ? text_max_x(glyphs, text + 1, x)
+						   : (x + text_glyph(glyphs, *text)->xOffset + text_glyph(glyphs, *text)->width - 1) > text_max_x(glyphs, text + 1, x + text_glyph(glyphs, *text)->xAdvance)
+							   ? (x + text_glyph(glyphs, *text)->xOffset + text_glyph(glyphs, *text)->width - 1)
+							   : text_max_x(glyphs, text + 1, x + text_glyph(glyphs, *text)->xAdvance);
+}
+
+/**
+ * @brief Top pixel of a text, relative to the base line
+ *
+ */
+constexpr int16_t text_min_y(const GFXglyph *glyphs, const char *text)
+{
+	return *text == 0 ? 0x7FFF : text_glyph(glyphs, *text) == nullptr ? text_min_y(glyphs, text + 1)
+								: text_glyph(glyphs, *text)->yOffset < text_min_y(glyphs, text + 1) ? text_glyph(glyphs, *text)->yOffset
+																									 : text_min_y(glyphs, text + 1);
+}
+
+/**
+ * @brief Bottom pixel of a text, relative to the base line
+ *
+ */
+constexpr int16_t text_max_y(const GFXglyph *glyphs, const char *text)
+{
+	return *text == 0 ? -1 : text_glyph(glyphs, *text) == nullptr ? text_max_y(glyphs, text + 1)
+						   : (text_glyph(glyphs, *text)->yOffset + text_glyph(glyphs, *text)->height - 1) > text_max_y(glyphs, text + 1)
+							   ? (text_glyph(glyphs, *text)->yOffset + text_glyph(glyphs, *text)->height - 1)
+							   : text_max_y(glyphs, text + 1);
+}
+
+/**
+ * @brief Position and size of a text at cursor position 0/0
+ *
+ * @param glyphs glyph table of the font
+ * @param text text
+ * @return constexpr text_bounds_t like getTextBounds(), all 0 for an empty text
+ */
+constexpr text_bounds_t text_bounds(const GFXglyph *glyphs, const char *text)
+{
+	return {text_max_x(glyphs, text, 0) >= text_min_x(glyphs, text, 0) ? text_min_x(glyphs, text, 0) : (int16_t)0,
+			text_max_y(glyphs, text) >= text_min_y(glyphs, text) ? text_min_y(glyphs, text) : (int16_t)0,
+			text_max_x(glyphs, text, 0) >= text_min_x(glyphs, text, 0) ? (uint16_t)(text_max_x(glyphs, text, 0) - text_min_x(glyphs, text, 0) + 1) : (uint16_t)0,
+			text_max_y(glyphs, text) >= text_min_y(glyphs, text) ? (uint16_t)(text_max_y(glyphs, text) - text_min_y(glyphs, text) + 1) : (uint16_t)0};
+}
+
+/** Bounds of a text in the small font, use it for constant texts */
+constexpr text_bounds_t small_text_bounds(const char *text)
+{
+	return text_bounds(RAK_EPD_10pt_Glyphs, text);
+}
+
+/** Bounds of a text in the large font, use it for constant texts */
+constexpr text_bounds_t large_text_bounds(const char *text)
+{
+	return text_bounds(RAK_EPD_20pt_Glyphs, text);
+}
+
+text_bounds_t text_bounds_rak14000(const GFXfont *font, const char *text);
+
+extern const GFXfont RAK_EPD_10pt;
+extern const GFXfont RAK_EPD_20pt;
+
+#endif // RAK14000_FONTS_H
@@ -19,10 +19,8 @@ void icon_rak14000(void)
 {
 	uint8_t g_air_status = 0;
 
-	x_text = 250;
-	y_text = 35;
-	display.setFont(SMALL_FONT);
-	display.setTextSize(1);
+	constexpr epd_text_pos_t pos = rak14000_layout::icon();
+	int16_t y_text = pos.y;
 
 	if (found_sensors[RTC_ID].found_sensor)
 	{
@@ -54,28 +52,28 @@ void icon_rak14000(void)
 		}
 	}
 
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = text_bounds_rak14000(SMALL_FONT, disp_text).w;
 	text_rak14000((display_width / 2) - (txt_w / 2), 1, disp_text, (uint16_t)txt_color, 1);
 
-	snprintf(disp_text, 29, "Temperature: %.2f~C", temp_values[temp_idx - 1]);
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	snprintf(disp_text, 29, "Temperature: %.2f~C", temp_values.latest());
+	text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 	y_text += 20;
 
-	snprintf(disp_text, 29, "Humidity: %.2f%%RH", humid_values[humid_idx - 1]);
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	snprintf(disp_text, 29, "Humidity: %.2f%%RH", humid_values.latest());
+	text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 	y_text += 20;
 
 	if ((found_sensors[ENV_ID].found_sensor) || (found_sensors[PRESS_ID].found_sensor))
 	{
-		snprintf(disp_text, 29, "Baro: %.2fmBar", baro_values[baro_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		snprintf(disp_text, 29, "Baro: %.2fmBar", baro_values.latest());
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		y_text += 20;
 	}
 
 	if ((found_sensors[LIGHT_ID].found_sensor) || (found_sensors[LIGHT2_ID].found_sensor))
 	{
 		snprintf(disp_text, 29, "Light: %.2f Lux", last_light_lux);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		y_text += 33;
 	}
 
@@ -86,14 +84,14 @@ void icon_rak14000(void)
 		// Get VOC status
 		if (voc_valid)
 		{
-			if (voc_values[voc_idx - 1] > 400)
+			if (voc_values.latest() > 400)
 			{
 				if (g_air_status < 255)
 				{
 					g_air_status = 255;
 				}
 			}
-			else if (voc_values[voc_idx - 1] > 250)
+			else if (voc_values.latest() > 250)
 			{
 				if (g_air_status < 128)
 				{
@@ -101,46 +99,46 @@ void icon_rak14000(void)
 				}
 			}
 		}
-		level = (uint8_t)(voc_values[voc_idx - 1] / 100);
-		snprintf(disp_text, 29, "VOC %d", voc_values[voc_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(voc_values.latest() / 100);
+		snprintf(disp_text, 29, "VOC %d", voc_values.latest());
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
 	}
 
 	if (found_sensors[CO2_ID].found_sensor)
 	{
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
 			}
 		}
-		level = (uint8_t)(co2_values[co2_idx - 1] / 500);
-		snprintf(disp_text, 29, "CO2 %.0f", co2_values[co2_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(co2_values.latest() / 500);
+		snprintf(disp_text, 29, "CO2 %.0f", co2_values.latest());
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
 	}
 	if (found_sensors[PM_ID].found_sensor)
 	{
 		// PM 1.0 levels
-		if (pm10_values[pm_idx - 1] > 75)
+		if (pm10_values.latest() > 75)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm10_values[pm_idx - 1] > 35)
+		else if (pm10_values.latest() > 35)
 		{
 			if (g_air_status < 128)
 			{
@@ -148,14 +146,14 @@ void icon_rak14000(void)
 			}
 		}
 		// PM 2.5 levels
-		if (pm25_values[pm_idx - 1] > 75)
+		if (pm25_values.latest() > 75)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm25_values[pm_idx - 1] > 35)
+		else if (pm25_values.latest() > 35)
 		{
 			if (g_air_status < 128)
 			{
@@ -163,48 +161,48 @@ void icon_rak14000(void)
 			}
 		}
 		// PM 10 levels
-		if (pm100_values[pm_idx - 1] > 199)
+		if (pm100_values.latest() > 199)
 		{
 			if (g_air_status < 255)
 			{
 				g_air_status = 255;
 			}
 		}
-		else if (pm100_values[pm_idx - 1] > 150)
+		else if (pm100_values.latest() > 150)
 		{
 			if (g_air_status < 128)
 			{
 				g_air_status = 128;
 			}
 		}
-		level = (uint8_t)(pm10_values[pm_idx - 1] / 15);
-		snprintf(disp_text, 29, "PM 1.0: %d", pm10_values[pm_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(pm10_values.latest() / 15);
+		snprintf(disp_text, 29, "PM 1.0: %d", pm10_values.latest());
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
-		level = (uint8_t)(pm25_values[pm_idx - 1] / 15);
-		snprintf(disp_text, 29, "PM 2.5: %d", pm25_values[pm_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(pm25_values.latest() / 15);
+		snprintf(disp_text, 29, "PM 2.5: %d", pm25_values.latest());
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
-		level = (uint8_t)(pm100_values[pm_idx - 1] / 40);
-		snprintf(disp_text, 29, "PM 10: %d", pm100_values[pm_idx - 1]);
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		level = (uint8_t)(pm100_values.latest() / 40);
+		snprintf(disp_text, 29, "PM 10: %d", pm100_values.latest());
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		draw_bar_rak14000(level, display_width - 72, y_text);
 		y_text += 33;
 	}
 
 	if (g_air_status == 0)
 	{
-		display.drawBitmap((x_text - good_air_width) / 2, (display_height - 20 - good_air_height) / 2, good_air, good_air_width, good_air_height, txt_color);
+		draw_image_rak14000((pos.x - good_air.width) / 2, (display_height - 20 - good_air.height) / 2, good_air, txt_color);
 	}
 	else if (g_air_status < 255)
 	{
-		display.drawBitmap((x_text - bad_air_width) / 2, (display_height - 20 - bad_air_height) / 2, worried_air, worried_air_width, worried_air_height, txt_color);
+		draw_image_rak14000((pos.x - bad_air.width) / 2, (display_height - 20 - bad_air.height) / 2, worried_air, txt_color);
 	}
 	else
 	{
-		display.drawBitmap((x_text - worried_air_width) / 2, (display_height - 20 - worried_air_height) / 2, bad_air, bad_air_width, bad_air_height, txt_color);
+		draw_image_rak14000((pos.x - worried_air.width) / 2, (display_height - 20 - worried_air.height) / 2, bad_air, txt_color);
 	}
 }
 
@@ -0,0 +1,105 @@
+/**
+ * @file RAK14000_image.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief PackBits compressed images for the EPD
+ *        The images are written by assets/epd_images.py to RAK14000_images.cpp.
+ *        ImageReader unpacks them byte by byte, without a buffer.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RAK14000_IMAGE_H
+#define RAK14000_IMAGE_H
+
+#include <stdint.h>
+
+/** Compressed image, unpacked it has 1 bit per pixel, MSB first and rows padded to full bytes */
+typedef struct epd_image_s
+{
+	const uint8_t *data; // PackBits compressed bitmap
+	uint16_t size;		 // Size of the compressed bitmap
+	uint16_t width;		 // Width in pixel
+	uint16_t height;	 // Height in pixel
+} epd_image_t;
+
+/**
+ * @brief Unpacks a PackBits compressed image byte by byte
+ *        A header byte 0..127 is followed by 1..128 literal bytes,
+ *        a header byte -1..-127 by one byte that is repeated 2..128 times.
+ *
+ */
+class ImageReader
+{
+public:
+	ImageReader(const epd_image_t &image) : _data(image.data), _end(image.data + image.size) {}
+
+	/**
+	 * @brief Get the next unpacked byte
+	 *
+	 * @return uint8_t next byte of the bitmap, 0 after the end of the data
+	 */
+	uint8_t next(void)
+	{
+		while (_count == 0)
+		{
+			if (_data >= _end)
+			{
+				return 0;
+			}
+			int8_t header = (int8_t)*_data++;
+			if (header >= 0)
+			{
+				_count = header + 1;
+				_repeat = false;
+			}
+			else if (header != -128)
+			{
+				_count = 1 - header;
+				_repeat = true;
+				_value = *_data++;
+			}
+		}
+		_count--;
+		return _repeat ? _value : *_data++;
+	}
+
+private:
+	const uint8_t *_data;
+	const uint8_t *_end;
+	uint8_t _count = 0;
+	uint8_t _value = 0;
+	bool _repeat = false;
+};
+
+/**
+ * @brief Unpack a complete image, for drivers that need the plain bitmap
+ *
+ * @param image compressed image
+ * @param buffer receives ((width + 7) / 8) * height bytes
+ */
+inline void unpack_image(const epd_image_t &image, uint8_t *buffer)
+{
+	ImageReader reader(image);
+	uint16_t bytes = ((image.width + 7) / 8) * image.height;
+	for (uint16_t idx = 0; idx < bytes; idx++)
+	{
+		buffer[idx] = reader.next();
+	}
+}
+
+extern const epd_image_t good_air;
+extern const epd_image_t bad_air;
+extern const epd_image_t worried_air;
+extern const epd_image_t rak_img;
+extern const epd_image_t celsius_img;
+extern const epd_image_t humidity_img;
+extern const epd_image_t co2_img;
+extern const epd_image_t barometer_img;
+extern const epd_image_t voc_img;
+extern const epd_image_t pm_img;
+extern const epd_image_t built_img;
+extern const epd_image_t wisblock_img;
+
+#endif // RAK14000_IMAGE_H
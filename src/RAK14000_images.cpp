@@ -0,0 +1,1059 @@
+/**
+ * @file RAK14000_images.cpp
+ * @author Bernd Giesecke (bernd@giesecke.tk)
+ * @brief PackBits compressed images for the EPD display
+ *        Written by assets/epd_images.py from the PBM files in assets/epd, do not edit
+ * @version 0.1
+ * @date 2022-06-25
+ *
+ * @copyright Copyright (c) 2022
+ * Images cortesy of <a href="https://www.flaticon.com/free-icons" title="Freepik - Flaticon">Icons created by Freepik - Flaticon</a>
+ */
+#include "RAK14000_image.h"
+
+/** good_air 248 x 248, 7688 bytes packed to 2825 bytes */
+static const uint8_t good_air_data[] = {
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0xA6, 0x00, 0x02, 0x3F,
+	0xFF, 0xFE, 0xE6, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0xFC, 0xE8, 0x00,
+	0x01, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0x7F, 0xE0, 0xE9, 0x00, 0x01, 0x7F,
+	0xC0, 0xFE, 0x00, 0x01, 0x01, 0xFE, 0xEA, 0x00, 0x01, 0x03, 0xF8, 0xFC,
+	0x00, 0x01, 0x0F, 0xE0, 0xEB, 0x00, 0x00, 0x7F, 0xFA, 0x00, 0x00, 0x7E,
+	0xEC, 0x00, 0x01, 0x01, 0xF0, 0xFA, 0x00, 0x01, 0x0F, 0xC0, 0xED, 0x00,
+	0x01, 0x0F, 0x80, 0xF9, 0x00, 0x00, 0xF8, 0xED, 0x00, 0x00, 0x3C, 0xF8,
+	0x00, 0x00, 0x3E, 0xED, 0x00, 0x00, 0xF0, 0xF8, 0x00, 0x02, 0x07, 0xFF,
+	0xFC, 0xF0, 0x00, 0x01, 0x03, 0xC0, 0xF8, 0x00, 0x03, 0x03, 0xFF, 0xFF,
+	0xC0, 0xF1, 0x00, 0x00, 0x1E, 0xF7, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xF8,
+	0xF1, 0x00, 0x00, 0x78, 0xF7, 0x00, 0xFE, 0xFF, 0x00, 0xFE, 0xF1, 0x00,
+	0x00, 0xE0, 0xF8, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0x00, 0x80, 0xF3, 0x00,
+	0x01, 0x03, 0x80, 0xF8, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0xC0, 0xF3,
+	0x00, 0x00, 0x0F, 0xF7, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0x00, 0xF0, 0xF3,
+	0x00, 0x00, 0x1C, 0xF7, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0xF8, 0xF3,
+	0x00, 0x00, 0x78, 0xF7, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0x00, 0xFC, 0xF3,
+	0x00, 0x00, 0xE0, 0xF7, 0x00, 0xFC, 0xFF, 0x00, 0xFE, 0xF4, 0x00, 0x01,
+	0x01, 0xC0, 0xF8, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0x07,
+	0xF7, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x00, 0x80, 0xF5, 0x00, 0x00, 0x07,
+	0xF7, 0x00, 0x07, 0x03, 0xFF, 0xFF, 0xA0, 0x1F, 0xFF, 0xFF, 0x80, 0xF5,
+	0x00, 0x00, 0x1C, 0xF7, 0x00, 0x07, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
+	0xFF, 0xC0, 0xF5, 0x00, 0x00, 0x38, 0xF7, 0x00, 0x07, 0x07, 0xFF, 0xC0,
+	0x00, 0x00, 0x1F, 0xFF, 0xE0, 0xF5, 0x00, 0x00, 0x70, 0xF7, 0x00, 0x01,
+	0x0F, 0xFE, 0xFE, 0x00, 0x02, 0x07, 0xFF, 0xE0, 0xF5, 0x00, 0x00, 0xE0,
+	0xF7, 0x00, 0x01, 0x0F, 0xF8, 0xFE, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0xF6,
+	0x00, 0x01, 0x01, 0x80, 0xF7, 0x00, 0x01, 0x0F, 0xC0, 0xFD, 0x00, 0x01,
+	0xFF, 0xF0, 0xF6, 0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x0F, 0xFC, 0x00,
+	0x01, 0x7F, 0xF8, 0xF6, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x01, 0x3F, 0xF8,
+	0xF6, 0x00, 0x04, 0x1C, 0x00, 0x07, 0xFF, 0xC0, 0xF4, 0x00, 0x01, 0x19,
+	0xF8, 0xF6, 0x00, 0x04, 0x18, 0x00, 0x7F, 0xFF, 0xF8, 0xF4, 0x00, 0x01,
+	0x0C, 0xF8, 0xF6, 0x00, 0x01, 0x30, 0x01, 0xFE, 0xFF, 0xF4, 0x00, 0x01,
+	0x06, 0x38, 0xF6, 0x00, 0x01, 0x60, 0x07, 0xFE, 0xFF, 0x00, 0xC0, 0xF5,
+	0x00, 0x00, 0x03, 0xF5, 0x00, 0x01, 0xC0, 0x1F, 0xFE, 0xFF, 0x00, 0xF0,
+	0xF5, 0x00, 0x01, 0x01, 0x80, 0xF7, 0x00, 0x02, 0x01, 0x80, 0x7F, 0xFE,
+	0xFF, 0x00, 0xF8, 0xF4, 0x00, 0x00, 0xC0, 0xF7, 0x00, 0x01, 0x03, 0x00,
+	0xFD, 0xFF, 0x00, 0xFE, 0xF4, 0x00, 0x00, 0xE0, 0xF7, 0x00, 0x01, 0x07,
+	0x01, 0xFC, 0xFF, 0xF4, 0x00, 0x00, 0x70, 0xF7, 0x00, 0x01, 0x0C, 0x07,
+	0xFC, 0xFF, 0x00, 0xC0, 0xF5, 0x00, 0x00, 0x18, 0xF7, 0x00, 0x01, 0x18,
+	0x0F, 0xFC, 0xFF, 0x00, 0xE0, 0xF5, 0x00, 0x00, 0x1C, 0xF7, 0x00, 0x01,
+	0x38, 0x1F, 0xFC, 0xFF, 0x00, 0xF0, 0xF5, 0x00, 0x00, 0x0E, 0xF7, 0x00,
+	0x07, 0x30, 0x3F, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xF8, 0xF5, 0x00, 0x00,
+	0x06, 0xF7, 0x00, 0x07, 0x60, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFC,
+	0xF5, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x07, 0xC0, 0x7F, 0xFE, 0x00, 0x00,
+	0x03, 0xFF, 0xFC, 0xF5, 0x00, 0x01, 0x03, 0x80, 0xF9, 0x00, 0x03, 0x01,
+	0xC0, 0xFF, 0xF0, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xF5, 0x00, 0x01, 0x01,
+	0x80, 0xF9, 0x00, 0x03, 0x01, 0x80, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0x3F,
+	0xFF, 0xF4, 0x00, 0x00, 0xC0, 0xF9, 0x00, 0x02, 0x03, 0x00, 0xFE, 0xFD,
+	0x00, 0x01, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x60, 0xF9, 0x00, 0x02, 0x07,
+	0x00, 0xF8, 0xFD, 0x00, 0x02, 0x03, 0xFF, 0x80, 0xF5, 0x00, 0x00, 0x60,
+	0xF9, 0x00, 0x02, 0x06, 0x00, 0x40, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0xF5,
+	0x00, 0x00, 0x30, 0xF9, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x01, 0x3F, 0x80,
+	0xF5, 0x00, 0x00, 0x18, 0xF9, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x01, 0x1F,
+	0x80, 0xF5, 0x00, 0x00, 0x18, 0xF9, 0x00, 0x00, 0x18, 0xFA, 0x00, 0x01,
+	0x07, 0x80, 0xF5, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0x04, 0x30, 0x00, 0x00,
+	0x03, 0xFC, 0xF4, 0x00, 0x04, 0x3F, 0xC0, 0x00, 0x00, 0x06, 0xF9, 0x00,
+	0x02, 0x30, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0xE0, 0xFA, 0x00, 0x00, 0x07,
+	0xFD, 0xFF, 0x02, 0xF8, 0x00, 0x06, 0xF9, 0x00, 0x01, 0x70, 0x00, 0xFC,
+	0xFF, 0x00, 0xFA, 0xFA, 0x00, 0x00, 0x5F, 0xFD, 0xFF, 0x02, 0xFE, 0x00,
+	0x06, 0xF9, 0x00, 0x01, 0x60, 0x07, 0xFB, 0xFF, 0x00, 0xE0, 0xFC, 0x00,
+	0x00, 0x0F, 0xFB, 0xFF, 0x01, 0xC0, 0x03, 0xF9, 0x00, 0x01, 0xC0, 0x1F,
+	0xFB, 0xFF, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x02, 0xF0,
+	0x03, 0x80, 0xFA, 0x00, 0x01, 0xC0, 0x3F, 0xFA, 0xFF, 0x00, 0x80, 0xFE,
+	0x00, 0x00, 0x01, 0xFA, 0xFF, 0x02, 0xFC, 0x01, 0x80, 0xFB, 0x00, 0x02,
+	0x01, 0x80, 0x7F, 0xFA, 0xFF, 0x00, 0xE0, 0xFE, 0x00, 0x00, 0x07, 0xFA,
+	0xFF, 0x02, 0xFE, 0x00, 0xC0, 0xFB, 0x00, 0x01, 0x07, 0x80, 0xF9, 0xFF,
+	0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x01, 0x00, 0xC0, 0xFB,
+	0x00, 0x01, 0x1F, 0xF1, 0xF9, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x3F,
+	0xF9, 0xFF, 0x01, 0x80, 0x60, 0xFB, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0x00,
+	0xFE, 0xFE, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0x01, 0x80, 0x60, 0xFB, 0x00,
+	0x00, 0x7F, 0xF7, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xF8, 0xFF, 0x01, 0xC0,
+	0x70, 0xFC, 0x00, 0x00, 0x01, 0xF6, 0xFF, 0x02, 0x80, 0x00, 0x01, 0xF8,
+	0xFF, 0x01, 0xCF, 0xFC, 0xFC, 0x00, 0x00, 0x01, 0xF6, 0xFF, 0x02, 0xC0,
+	0x00, 0x03, 0xF6, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xF6, 0xFF, 0x02, 0xE0,
+	0x00, 0x07, 0xF6, 0xFF, 0x00, 0x80, 0xFD, 0x00, 0x00, 0x03, 0xF6, 0xFF,
+	0x02, 0xE0, 0x00, 0x0F, 0xF6, 0xFF, 0x00, 0xC0, 0xFD, 0x00, 0x00, 0x07,
+	0xF6, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF6, 0xFF, 0x00, 0xC0, 0xFD, 0x00,
+	0x00, 0x07, 0xF6, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF6, 0xFF, 0x00, 0xE0,
+	0xFD, 0x00, 0x00, 0x07, 0xF6, 0xFF, 0x02, 0xF0, 0x00, 0x1F, 0xF6, 0xFF,
+	0x00, 0xE0, 0xFD, 0x00, 0x00, 0x07, 0xF6, 0xFF, 0x02, 0xF8, 0x00, 0x1F,
+	0xF6, 0xFF, 0x00, 0xE0, 0xFD, 0x00, 0x00, 0x07, 0xF6, 0xFF, 0x02, 0xF8,
+	0x00, 0x1F, 0xF6, 0xFF, 0x00, 0xF0, 0xFD, 0x00, 0x00, 0x07, 0xF6, 0xFF,
+	0x02, 0xF8, 0x00, 0x3F, 0xF6, 0xFF, 0x00, 0xF0, 0xFD, 0x00, 0x00, 0x03,
+	0xF6, 0xFF, 0x02, 0xF8, 0x00, 0x3F, 0xF6, 0xFF, 0x00, 0xF0, 0xFC, 0x00,
+	0xF6, 0xFF, 0x02, 0xF8, 0x00, 0x3F, 0xF6, 0xFF, 0x00, 0xF0, 0xFC, 0x00,
+	0xE8, 0xFF, 0x00, 0xE0, 0xFC, 0x00, 0x00, 0xDF, 0xE9, 0xFF, 0x00, 0xE0,
+	0xFC, 0x00, 0x00, 0xC7, 0xE9, 0xFF, 0x00, 0x80, 0xFC, 0x00, 0x00, 0x81,
+	0xE9, 0xFF, 0x00, 0x80, 0xFD, 0x00, 0x02, 0x01, 0x80, 0x3F, 0xEB, 0xFF,
+	0x01, 0xFC, 0xC0, 0xFD, 0x00, 0x02, 0x01, 0x80, 0x0F, 0xEB, 0xFF, 0x01,
+	0xF0, 0xC0, 0xFD, 0x00, 0x02, 0x01, 0x80, 0x0F, 0xF8, 0xFF, 0x02, 0xF8,
+	0x00, 0x3F, 0xF7, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x02, 0x01, 0x00, 0x0F,
+	0xF8, 0xFF, 0x02, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0x02, 0xFE, 0x00, 0xC0,
+	0xFD, 0x00, 0x02, 0x03, 0x00, 0x0F, 0xEC, 0xFF, 0x02, 0xF0, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x03, 0x00, 0x0F, 0xEC, 0xFF, 0x02, 0xE0, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x03, 0x00, 0x0F, 0xEC, 0xFF, 0x02, 0xE0, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x03, 0x00, 0x0F, 0xEC, 0xFF, 0x02, 0xE0, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x03, 0x00, 0x0F, 0xEC, 0xFF, 0x02, 0xE0, 0x00, 0x60,
+	0xFD, 0x00, 0x02, 0x06, 0x00, 0x07, 0xEC, 0xFF, 0x02, 0xE0, 0x00, 0x20,
+	0xFD, 0x00, 0x02, 0x06, 0x00, 0x07, 0xF7, 0xFF, 0x00, 0xC1, 0xF7, 0xFF,
+	0x02, 0xE0, 0x00, 0x30, 0xFD, 0x00, 0x02, 0x06, 0x00, 0x07, 0xF8, 0xFF,
+	0x02, 0xF8, 0x00, 0x1F, 0xF8, 0xFF, 0x02, 0xE0, 0x00, 0x30, 0xFD, 0x00,
+	0x02, 0x06, 0x00, 0x07, 0xF8, 0xFF, 0x02, 0xF0, 0x00, 0x1F, 0xF8, 0xFF,
+	0x02, 0xC0, 0x00, 0x30, 0xFD, 0x00, 0x02, 0x06, 0x00, 0x07, 0xF8, 0xFF,
+	0x02, 0xF0, 0x00, 0x1F, 0xF8, 0xFF, 0x02, 0xC0, 0x00, 0x30, 0xFD, 0x00,
+	0x02, 0x06, 0x00, 0x03, 0xF8, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF8, 0xFF,
+	0x02, 0xC0, 0x00, 0x30, 0xFD, 0x00, 0x02, 0x06, 0x00, 0x03, 0xF8, 0xFF,
+	0x02, 0xF0, 0x00, 0x0F, 0xF8, 0xFF, 0x02, 0xC0, 0x00, 0x30, 0xFD, 0x00,
+	0x02, 0x04, 0x00, 0x03, 0xF8, 0xFF, 0x02, 0xF0, 0x00, 0x0F, 0xF8, 0xFF,
+	0x02, 0x80, 0x00, 0x30, 0xFD, 0x00, 0x02, 0x04, 0x00, 0x01, 0xF8, 0xFF,
+	0x02, 0xE0, 0x00, 0x0F, 0xF8, 0xFF, 0x02, 0x80, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x0C, 0x00, 0x01, 0xF8, 0xFF, 0x02, 0xE0, 0x00, 0x0F, 0xF8, 0xFF,
+	0x02, 0x80, 0x00, 0x10, 0xFD, 0x00, 0x02, 0x0C, 0x00, 0x01, 0xF8, 0xFF,
+	0x02, 0xE0, 0x00, 0x07, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x10, 0xFD, 0x00,
+	0x02, 0x0C, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0xE0, 0x00, 0x07, 0xF8, 0xFF,
+	0xFF, 0x00, 0x00, 0x18, 0xFD, 0x00, 0x02, 0x0C, 0x00, 0x00, 0xF8, 0xFF,
+	0x02, 0xC0, 0x00, 0x07, 0xF9, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x18, 0xFD,
+	0x00, 0x03, 0x0C, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0x02, 0xC0, 0x00, 0x03,
+	0xF9, 0xFF, 0x03, 0xFE, 0x00, 0x00, 0x18, 0xFD, 0x00, 0x03, 0x0C, 0x00,
+	0x00, 0x3F, 0xF9, 0xFF, 0x02, 0x80, 0x00, 0x01, 0xF9, 0xFF, 0x03, 0xFC,
+	0x00, 0x00, 0x18, 0xFD, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x3F, 0xF9, 0xFF,
+	0x02, 0x80, 0x00, 0x01, 0xF9, 0xFF, 0x03, 0xF8, 0x00, 0x00, 0x18, 0xFD,
+	0x00, 0x03, 0x0C, 0x00, 0x00, 0x1F, 0xF9, 0xFF, 0xFE, 0x00, 0xF9, 0xFF,
+	0x03, 0xF0, 0x00, 0x00, 0x18, 0xFD, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x0F,
+	0xF9, 0xFF, 0xFE, 0x00, 0xF9, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x18, 0xFD,
+	0x00, 0x03, 0x0C, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0x00, 0xFE, 0xFE, 0x00,
+	0x00, 0x7F, 0xFA, 0xFF, 0x03, 0xE0, 0x00, 0x00, 0x18, 0xFD, 0x00, 0x03,
+	0x0C, 0x00, 0x00, 0x03, 0xFA, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x00, 0x7F,
+	0xFA, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x18, 0xFD, 0x00, 0x03, 0x0C, 0x00,
+	0x00, 0x01, 0xFA, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x3F, 0xFA, 0xFF,
+	0x03, 0x80, 0x00, 0x00, 0x18, 0xFD, 0x00, 0x00, 0x0C, 0xFE, 0x00, 0xFA,
+	0xFF, 0x00, 0xF0, 0xFE, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0xFE, 0xFE,
+	0x00, 0x00, 0x18, 0xFD, 0x00, 0x00, 0x0C, 0xFE, 0x00, 0x00, 0x3F, 0xFB,
+	0xFF, 0x00, 0xE0, 0xFE, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x00, 0xFC, 0xFE,
+	0x00, 0x00, 0x18, 0xFD, 0x00, 0x00, 0x0C, 0xFE, 0x00, 0x00, 0x1F, 0xFB,
+	0xFF, 0x00, 0xC0, 0xFE, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x00, 0xF0, 0xFE,
+	0x00, 0x00, 0x10, 0xFD, 0x00, 0x00, 0x0C, 0xFE, 0x00, 0x00, 0x07, 0xFB,
+	0xFF, 0x00, 0x80, 0xFE, 0x00, 0x00, 0x01, 0xFB, 0xFF, 0x00, 0xC0, 0xFE,
+	0x00, 0x00, 0x10, 0xFD, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x01, 0xFC,
+	0xFF, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0xFF, 0xFD, 0x00, 0x00,
+	0x10, 0xFD, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0x00,
+	0xF8, 0xFC, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0xFC, 0xFD, 0x00, 0x00,
+	0x30, 0xFD, 0x00, 0x00, 0x06, 0xFD, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00,
+	0xE0, 0xFC, 0x00, 0x00, 0x07, 0xFD, 0xFF, 0x00, 0xE0, 0xFD, 0x00, 0x00,
+	0x30, 0xFD, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xFA,
+	0x00, 0xFE, 0xFF, 0x00, 0xFE, 0xFC, 0x00, 0x00, 0x30, 0xFD, 0x00, 0x00,
+	0x06, 0xFC, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xF0, 0xFA, 0x00, 0x03, 0x0F,
+	0xFF, 0xFF, 0x80, 0xFC, 0x00, 0x00, 0x30, 0xFD, 0x00, 0x00, 0x06, 0xFB,
+	0x00, 0x02, 0x7F, 0xFF, 0xC0, 0xFA, 0x00, 0x02, 0x03, 0xFF, 0xFE, 0xFB,
+	0x00, 0x00, 0x30, 0xFD, 0x00, 0x00, 0x06, 0xE8, 0x00, 0x00, 0x30, 0xFD,
+	0x00, 0x00, 0x06, 0xE8, 0x00, 0x00, 0x30, 0xFD, 0x00, 0x00, 0x06, 0xE8,
+	0x00, 0x00, 0x20, 0xFD, 0x00, 0x00, 0x02, 0xE8, 0x00, 0x00, 0x60, 0xFD,
+	0x00, 0x00, 0x03, 0xE8, 0x00, 0x00, 0x60, 0xFD, 0x00, 0x00, 0x03, 0xE8,
+	0x00, 0x00, 0x60, 0xFD, 0x00, 0x00, 0x03, 0xE8, 0x00, 0x00, 0x60, 0xFD,
+	0x00, 0x00, 0x03, 0xE8, 0x00, 0x00, 0x60, 0xFD, 0x00, 0x00, 0x01, 0xE8,
+	0x00, 0x00, 0xC0, 0xFD, 0x00, 0x01, 0x01, 0x80, 0xE9, 0x00, 0x00, 0xC0,
+	0xFD, 0x00, 0x01, 0x01, 0x80, 0xE9, 0x00, 0x00, 0xC0, 0xFD, 0x00, 0x01,
+	0x01, 0x80, 0xE9, 0x00, 0x00, 0xC0, 0xFC, 0x00, 0x00, 0x80, 0xE9, 0x00,
+	0x00, 0x80, 0xFC, 0x00, 0x00, 0xC0, 0xEA, 0x00, 0x01, 0x01, 0x80, 0xFC,
+	0x00, 0x00, 0xC0, 0xEA, 0x00, 0x01, 0x01, 0x80, 0xFC, 0x00, 0x00, 0x40,
+	0xEA, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x60, 0xEA, 0x00, 0x00, 0x03,
+	0xFB, 0x00, 0x00, 0x60, 0xEA, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x60,
+	0xEA, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x30, 0xEA, 0x00, 0x00, 0x06,
+	0xFB, 0x00, 0x00, 0x30, 0xFC, 0x00, 0x00, 0x1C, 0xF6, 0x00, 0x00, 0x1C,
+	0xFC, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, 0x30, 0xFC, 0x00, 0x00, 0x7F,
+	0xF6, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x18,
+	0xFC, 0x00, 0x01, 0x7F, 0x80, 0xF7, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+	0x0C, 0xFB, 0x00, 0x00, 0x18, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0xF8, 0x00,
+	0x02, 0x03, 0xFF, 0x80, 0xFD, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x0C,
+	0xFC, 0x00, 0x01, 0xFF, 0xF8, 0xF8, 0x00, 0x02, 0x0F, 0xFF, 0x80, 0xFD,
+	0x00, 0x00, 0x18, 0xFB, 0x00, 0x00, 0x0C, 0xFC, 0x00, 0x01, 0xFF, 0xFC,
+	0xF8, 0x00, 0x01, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x18, 0xFB, 0x00, 0x00,
+	0x04, 0xFC, 0x00, 0x01, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+	0x00, 0x30, 0xFB, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x02, 0x7F, 0xFF, 0xE0,
+	0xFA, 0x00, 0x02, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x30, 0xFB, 0x00,
+	0x00, 0x06, 0xFC, 0x00, 0x02, 0x3F, 0xFF, 0xF8, 0xFA, 0x00, 0x02, 0x0F,
+	0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x70, 0xFB, 0x00, 0x00, 0x03, 0xFC, 0x00,
+	0x02, 0x0F, 0xFF, 0xFE, 0xFA, 0x00, 0x02, 0x3F, 0xFF, 0xF8, 0xFC, 0x00,
+	0x00, 0x60, 0xFB, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x03, 0x07, 0xFF, 0xFF,
+	0xC0, 0xFC, 0x00, 0x03, 0x01, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x00, 0x60,
+	0xFB, 0x00, 0x01, 0x01, 0x80, 0xFD, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xE0,
+	0xFC, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x00, 0xC0, 0xFB,
+	0x00, 0x01, 0x01, 0x80, 0xFD, 0x00, 0x03, 0x01, 0xFF, 0xFF, 0xFE, 0xFC,
+	0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0xC0, 0xFA, 0x00,
+	0x00, 0xC0, 0xFC, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xF8, 0xFE, 0x00, 0x00,
+	0x1F, 0xFE, 0xFF, 0xFC, 0x00, 0x01, 0x01, 0x80, 0xFA, 0x00, 0x00, 0xC0,
+	0xFC, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x02, 0xF0, 0x00, 0x07, 0xFE, 0xFF,
+	0x00, 0xFC, 0xFC, 0x00, 0x01, 0x01, 0x80, 0xFA, 0x00, 0x00, 0x60, 0xFC,
+	0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x00, 0xF8, 0xFC, 0x00, 0x00, 0x03, 0xF9,
+	0x00, 0x00, 0x60, 0xFC, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0xE0, 0xFC,
+	0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x30, 0xFC, 0x00, 0x00, 0x01, 0xF8,
+	0xFF, 0x00, 0xC0, 0xFC, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x18, 0xFB,
+	0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xFB, 0x00, 0x00, 0x0C, 0xF9, 0x00, 0x00,
+	0x18, 0xFB, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0xFC, 0xFB, 0x00, 0x00,
+	0x0C, 0xF9, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x00,
+	0xF8, 0xFB, 0x00, 0x00, 0x18, 0xF9, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00,
+	0x03, 0xFA, 0xFF, 0x00, 0xE0, 0xFB, 0x00, 0x00, 0x38, 0xF9, 0x00, 0x00,
+	0x06, 0xFA, 0x00, 0xFA, 0xFF, 0x00, 0x80, 0xFB, 0x00, 0x00, 0x30, 0xF9,
+	0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xFA, 0x00, 0x00,
+	0x60, 0xF9, 0x00, 0x01, 0x03, 0x80, 0xFB, 0x00, 0x00, 0x1F, 0xFC, 0xFF,
+	0x00, 0xFC, 0xFA, 0x00, 0x00, 0xE0, 0xF9, 0x00, 0x01, 0x01, 0x80, 0xFB,
+	0x00, 0x00, 0x07, 0xFC, 0xFF, 0x00, 0xF0, 0xFA, 0x00, 0x00, 0xC0, 0xF8,
+	0x00, 0x00, 0xC0, 0xFB, 0x00, 0x00, 0x01, 0xFC, 0xFF, 0x00, 0xC0, 0xFB,
+	0x00, 0x01, 0x01, 0x80, 0xF8, 0x00, 0x00, 0x60, 0xFA, 0x00, 0x00, 0x3F,
+	0xFE, 0xFF, 0x00, 0xFE, 0xFA, 0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x70,
+	0xFA, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0xF0, 0xFA, 0x00, 0x00, 0x06,
+	0xF7, 0x00, 0x00, 0x30, 0xF9, 0x00, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00,
+	0x00, 0x0E, 0xF7, 0x00, 0x00, 0x18, 0xF9, 0x00, 0x02, 0x0F, 0xFF, 0xF8,
+	0xF9, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x0C, 0xEE, 0x00, 0x00, 0x18,
+	0xF7, 0x00, 0x00, 0x0E, 0xEE, 0x00, 0x00, 0x30, 0xF7, 0x00, 0x00, 0x07,
+	0xEE, 0x00, 0x00, 0x70, 0xF7, 0x00, 0x01, 0x03, 0x80, 0xEF, 0x00, 0x00,
+	0xE0, 0xF7, 0x00, 0x01, 0x01, 0xC0, 0xF0, 0x00, 0x01, 0x01, 0xC0, 0xF6,
+	0x00, 0x00, 0xE0, 0xF0, 0x00, 0x01, 0x03, 0x80, 0xF6, 0x00, 0x00, 0x60,
+	0xF0, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x30, 0xF0, 0x00, 0x00, 0x0E,
+	0xF5, 0x00, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x1C, 0xF5, 0x00, 0x00, 0x0E,
+	0xF0, 0x00, 0x00, 0x38, 0xF5, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x70,
+	0xF5, 0x00, 0x01, 0x03, 0x80, 0xF1, 0x00, 0x00, 0xE0, 0xF5, 0x00, 0x01,
+	0x01, 0x80, 0xF2, 0x00, 0x01, 0x01, 0xC0, 0xF4, 0x00, 0x00, 0xE0, 0xF2,
+	0x00, 0x01, 0x03, 0x80, 0xF4, 0x00, 0x00, 0x70, 0xF2, 0x00, 0x00, 0x07,
+	0xF3, 0x00, 0x00, 0x38, 0xF2, 0x00, 0x00, 0x0E, 0xF3, 0x00, 0x00, 0x1C,
+	0xF2, 0x00, 0x00, 0x1C, 0xF3, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x70,
+	0xF3, 0x00, 0x01, 0x03, 0x80, 0xF3, 0x00, 0x00, 0xE0, 0xF3, 0x00, 0x01,
+	0x01, 0xC0, 0xF4, 0x00, 0x01, 0x03, 0xC0, 0xF2, 0x00, 0x00, 0x70, 0xF4,
+	0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x38, 0xF4, 0x00, 0x00, 0x1E, 0xF1,
+	0x00, 0x00, 0x0E, 0xF4, 0x00, 0x00, 0x38, 0xF1, 0x00, 0x01, 0x07, 0x80,
+	0xF5, 0x00, 0x00, 0xF0, 0xF1, 0x00, 0x01, 0x01, 0xC0, 0xF6, 0x00, 0x01,
+	0x01, 0xC0, 0xF0, 0x00, 0x00, 0xF0, 0xF6, 0x00, 0x00, 0x07, 0xEF, 0x00,
+	0x00, 0x3C, 0xF6, 0x00, 0x00, 0x1E, 0xEF, 0x00, 0x00, 0x0F, 0xF6, 0x00,
+	0x00, 0x78, 0xEF, 0x00, 0x01, 0x01, 0xE0, 0xF8, 0x00, 0x01, 0x03, 0xC0,
+	0xEE, 0x00, 0x00, 0x7C, 0xF8, 0x00, 0x00, 0x1F, 0xED, 0x00, 0x00, 0x1F,
+	0xF8, 0x00, 0x00, 0x7C, 0xED, 0x00, 0x01, 0x03, 0xE0, 0xFA, 0x00, 0x01,
+	0x03, 0xE0, 0xEC, 0x00, 0x00, 0xFC, 0xFA, 0x00, 0x01, 0x1F, 0x80, 0xEC,
+	0x00, 0x01, 0x1F, 0x80, 0xFC, 0x00, 0x01, 0x01, 0xFC, 0xEB, 0x00, 0x01,
+	0x03, 0xF8, 0xFC, 0x00, 0x01, 0x0F, 0xE0, 0xEA, 0x00, 0x01, 0x3F, 0xC0,
+	0xFE, 0x00, 0x01, 0x01, 0xFE, 0xE9, 0x00, 0x06, 0x03, 0xFF, 0x80, 0x00,
+	0x00, 0xFF, 0xE0, 0xE8, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00, 0xFC, 0xE6,
+	0x00, 0x02, 0x1F, 0xFF, 0xFC, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0xE8, 0x00};
+const epd_image_t good_air = {good_air_data, 2825, 248, 248};
+
+/** bad_air 248 x 248, 7688 bytes packed to 2919 bytes */
+static const uint8_t bad_air_data[] = {
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0xD4, 0x00, 0x02, 0x01, 0xFF, 0xFC, 0xE6, 0x00, 0x00, 0x01,
+	0xFE, 0xFF, 0x00, 0xF0, 0xE7, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0x00, 0xF0,
+	0xE9, 0x00, 0x00, 0x07, 0xFB, 0xFF, 0xE9, 0x00, 0x00, 0x7F, 0xFB, 0xFF,
+	0x00, 0xF0, 0xEB, 0x00, 0x00, 0x03, 0xFA, 0xFF, 0x00, 0xFE, 0xEB, 0x00,
+	0x00, 0x1F, 0xF9, 0xFF, 0x00, 0xC0, 0xEC, 0x00, 0xF8, 0xFF, 0x00, 0xF8,
+	0xED, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00, 0xFE, 0xED, 0x00, 0x00, 0x1F,
+	0xFE, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0x00, 0x80, 0xEE,
+	0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xFE, 0xFF,
+	0x00, 0xC0, 0xEE, 0x00, 0xFE, 0xFF, 0x00, 0xC0, 0xFD, 0x00, 0x03, 0x1F,
+	0xFF, 0xFF, 0xF8, 0xEF, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xFC, 0xFC, 0x00,
+	0x03, 0x01, 0xFF, 0xFF, 0xFC, 0xEF, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xC0,
+	0xFB, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0x80, 0xF0, 0x00, 0x02, 0x3F, 0xFF,
+	0xFE, 0xFA, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x02, 0x7F,
+	0xFF, 0xF0, 0xF9, 0x00, 0x02, 0x7F, 0xFF, 0xF0, 0xF0, 0x00, 0xFF, 0xFF,
+	0x00, 0xC0, 0xF9, 0x00, 0x02, 0x1F, 0xFF, 0xF8, 0xF1, 0x00, 0x02, 0x03,
+	0xFF, 0xFF, 0xF8, 0x00, 0x02, 0x07, 0xFF, 0xFC, 0xF1, 0x00, 0x02, 0x0F,
+	0xFF, 0xF8, 0xF8, 0x00, 0x02, 0x01, 0xFF, 0xFF, 0xF1, 0x00, 0x02, 0x1F,
+	0xFF, 0xE0, 0xF7, 0x00, 0x02, 0x7F, 0xFF, 0x80, 0xF2, 0x00, 0x02, 0x7F,
+	0xFF, 0x80, 0xF7, 0x00, 0x02, 0x1F, 0xFF, 0xC0, 0xF2, 0x00, 0xFF, 0xFF,
+	0xF6, 0x00, 0x02, 0x07, 0xFF, 0xF0, 0xF3, 0x00, 0x02, 0x01, 0xFF, 0xFC,
+	0xF6, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0xF3, 0x00, 0x02, 0x07, 0xFF, 0xF0,
+	0xF5, 0x00, 0x01, 0xFF, 0xFC, 0xF3, 0x00, 0x02, 0x0F, 0xFF, 0xE0, 0xF5,
+	0x00, 0x01, 0x7F, 0xFE, 0xF3, 0x00, 0x02, 0x1F, 0xFF, 0x80, 0xF5, 0x00,
+	0x01, 0x1F, 0xFF, 0xF3, 0x00, 0x01, 0x7F, 0xFE, 0xF4, 0x00, 0x02, 0x07,
+	0xFF, 0xC0, 0xF4, 0x00, 0x01, 0xFF, 0xFC, 0xF4, 0x00, 0x02, 0x03, 0xFF,
+	0xE0, 0xF5, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0xF4, 0x00, 0x02, 0x01, 0xFF,
+	0xF0, 0xF5, 0x00, 0x02, 0x03, 0xFF, 0xE0, 0xF3, 0x00, 0x01, 0x7F, 0xF8,
+	0xF5, 0x00, 0x02, 0x07, 0xFF, 0xC0, 0xF3, 0x00, 0x01, 0x3F, 0xF8, 0xF5,
+	0x00, 0x01, 0x0F, 0xFF, 0xF2, 0x00, 0x01, 0x1F, 0xFE, 0xF5, 0x00, 0x01,
+	0x1F, 0xFE, 0xF2, 0x00, 0x01, 0x0F, 0xFE, 0xF5, 0x00, 0x01, 0x3F, 0xFC,
+	0xF2, 0x00, 0x01, 0x07, 0xFF, 0xF5, 0x00, 0x01, 0x7F, 0xF8, 0xF2, 0x00,
+	0x02, 0x03, 0xFF, 0x80, 0xF6, 0x00, 0x01, 0xFF, 0xF0, 0xF2, 0x00, 0x02,
+	0x01, 0xFF, 0xC0, 0xF7, 0x00, 0x02, 0x01, 0xFF, 0xE0, 0xF1, 0x00, 0x01,
+	0xFF, 0xC0, 0xF7, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0xF1, 0x00, 0x01, 0x7F,
+	0xE0, 0xF7, 0x00, 0x02, 0x07, 0xFF, 0x80, 0xF1, 0x00, 0x01, 0x7F, 0xF0,
+	0xF7, 0x00, 0x01, 0x07, 0xFF, 0xF0, 0x00, 0x01, 0x3F, 0xF8, 0xF7, 0x00,
+	0x01, 0x0F, 0xFE, 0xF0, 0x00, 0x01, 0x1F, 0xF8, 0xF7, 0x00, 0x01, 0x1F,
+	0xFC, 0xF0, 0x00, 0x01, 0x0F, 0xFC, 0xF7, 0x00, 0x01, 0x1F, 0xFC, 0xF0,
+	0x00, 0x01, 0x0F, 0xFC, 0xF7, 0x00, 0x01, 0x3F, 0xF8, 0xF0, 0x00, 0x01,
+	0x07, 0xFE, 0xF7, 0x00, 0x01, 0x7F, 0xF0, 0xF0, 0x00, 0x01, 0x07, 0xFE,
+	0xF7, 0x00, 0x01, 0x7F, 0xE0, 0xFD, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x04,
+	0x01, 0xC0, 0x00, 0x03, 0xFF, 0xF7, 0x00, 0x01, 0xFF, 0xC0, 0xFD, 0x00,
+	0x01, 0xFF, 0xF8, 0xF9, 0x00, 0x04, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xF8,
+	0x00, 0x02, 0x01, 0xFF, 0xC0, 0xFE, 0x00, 0x02, 0x03, 0xFF, 0xFC, 0xF9,
+	0x00, 0x05, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0xF9, 0x00, 0x02, 0x01,
+	0xFF, 0x80, 0xFE, 0x00, 0x02, 0x0F, 0xFF, 0xFF, 0xFA, 0x00, 0x06, 0x01,
+	0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0xF9, 0x00, 0x01, 0x03, 0xFF, 0xFD,
+	0x00, 0x03, 0x1F, 0xE0, 0x3F, 0xC0, 0xFB, 0x00, 0x06, 0x07, 0xF8, 0x0F,
+	0xF0, 0x00, 0xFF, 0xC0, 0xF9, 0x00, 0x01, 0x03, 0xFF, 0xFD, 0x00, 0x03,
+	0x3F, 0x80, 0x07, 0xE0, 0xFB, 0x00, 0x06, 0x1F, 0xC0, 0x01, 0xF8, 0x00,
+	0x7F, 0xC0, 0xF9, 0x00, 0x01, 0x07, 0xFE, 0xFD, 0x00, 0x03, 0x7E, 0x00,
+	0x01, 0xF8, 0xFB, 0x00, 0x06, 0x3F, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0xE0,
+	0xF9, 0x00, 0x01, 0x07, 0xFC, 0xFD, 0x00, 0x03, 0x7C, 0x00, 0x00, 0xFC,
+	0xFB, 0x00, 0x06, 0x7E, 0x00, 0x00, 0x7C, 0x00, 0x3F, 0xE0, 0xF9, 0x00,
+	0x01, 0x0F, 0xFC, 0xFD, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7E, 0xFB, 0x00,
+	0x06, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x3F, 0xF0, 0xF9, 0x00, 0x01, 0x0F,
+	0xF8, 0xFD, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0x01,
+	0xF0, 0x00, 0x00, 0x1E, 0x00, 0x1F, 0xF0, 0xF9, 0x00, 0x01, 0x1F, 0xF0,
+	0xFE, 0x00, 0x05, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0xFD, 0x00, 0x07,
+	0x03, 0xE0, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xF8, 0xF9, 0x00, 0x01, 0x3F,
+	0xF0, 0xFD, 0x00, 0x04, 0x80, 0x00, 0x00, 0x07, 0x80, 0xFD, 0x00, 0x07,
+	0x03, 0xC0, 0x00, 0x00, 0x02, 0x00, 0x0F, 0xF8, 0xF9, 0x00, 0x01, 0x3F,
+	0xE0, 0xFA, 0x00, 0x01, 0x03, 0xC0, 0xFD, 0x00, 0x01, 0x07, 0x80, 0xFD,
+	0x00, 0x01, 0x0F, 0xFC, 0xF9, 0x00, 0x01, 0x7F, 0xE0, 0xFA, 0x00, 0x01,
+	0x01, 0xE0, 0xFD, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0x07, 0xFC, 0xF9,
+	0x00, 0x01, 0x7F, 0xC0, 0xFA, 0x00, 0x01, 0x01, 0xE0, 0xFD, 0x00, 0x00,
+	0x0E, 0xFC, 0x00, 0x01, 0x07, 0xFC, 0xF9, 0x00, 0x01, 0xFF, 0xC0, 0xF9,
+	0x00, 0x00, 0xF0, 0xFD, 0x00, 0x00, 0x1E, 0xFC, 0x00, 0x01, 0x03, 0xFE,
+	0xF9, 0x00, 0x01, 0xFF, 0x80, 0xF9, 0x00, 0x00, 0x70, 0xFD, 0x00, 0x00,
+	0x1C, 0xFC, 0x00, 0x01, 0x03, 0xFE, 0xFA, 0x00, 0x02, 0x01, 0xFF, 0x80,
+	0xF9, 0x00, 0x00, 0x38, 0xFD, 0x00, 0x00, 0x18, 0xFC, 0x00, 0x01, 0x03,
+	0xFE, 0xFA, 0x00, 0x01, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x38, 0xFD, 0x00,
+	0x00, 0x38, 0xFC, 0x00, 0x01, 0x01, 0xFF, 0xFA, 0x00, 0x01, 0x01, 0xFF,
+	0xFA, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0xFD, 0x00, 0x02, 0x3F, 0xFF, 0x80,
+	0xFE, 0x00, 0x01, 0x01, 0xFF, 0xFA, 0x00, 0x01, 0x03, 0xFE, 0xFB, 0x00,
+	0x03, 0x01, 0xFF, 0xFF, 0xF8, 0xFD, 0x00, 0x02, 0x3F, 0xFF, 0xFE, 0xFE,
+	0x00, 0x01, 0x01, 0xFF, 0xFA, 0x00, 0x01, 0x03, 0xFE, 0xFB, 0x00, 0x03,
+	0x3F, 0xFF, 0xFF, 0xF8, 0xFD, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xF0, 0xFE,
+	0x00, 0x01, 0xFF, 0x80, 0xFB, 0x00, 0x01, 0x03, 0xFE, 0xFC, 0x00, 0x00,
+	0x01, 0xFE, 0xFF, 0x00, 0x80, 0xFD, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0xFE,
+	0x00, 0x01, 0xFF, 0x80, 0xFB, 0x00, 0x01, 0x03, 0xFC, 0xFC, 0x00, 0x02,
+	0x07, 0xFF, 0xE0, 0xF9, 0x00, 0x06, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+	0x80, 0xFB, 0x00, 0x01, 0x03, 0xFC, 0xFC, 0x00, 0x01, 0x1F, 0xFC, 0xF7,
+	0x00, 0x05, 0x7F, 0xF0, 0x00, 0x00, 0xFF, 0x80, 0xFB, 0x00, 0x01, 0x03,
+	0xFC, 0xFC, 0x00, 0x01, 0x1F, 0xC0, 0xF7, 0x00, 0x05, 0x07, 0xF0, 0x00,
+	0x00, 0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x0C,
+	0xF5, 0x00, 0x04, 0x60, 0x00, 0x00, 0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x03,
+	0xF8, 0xEC, 0x00, 0x01, 0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x03, 0xF8, 0xEC,
+	0x00, 0x01, 0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x03, 0xF8, 0xEC, 0x00, 0x01,
+	0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x07, 0xF0, 0xEC, 0x00, 0x01, 0x3F, 0xC0,
+	0xFB, 0x00, 0x01, 0x07, 0xF0, 0xEC, 0x00, 0x01, 0x3F, 0xE0, 0xFB, 0x00,
+	0x01, 0x07, 0xF0, 0xEC, 0x00, 0x01, 0x3F, 0xE0, 0xFB, 0x00, 0x01, 0x07,
+	0xE0, 0xEC, 0x00, 0x01, 0x3F, 0xE0, 0xFB, 0x00, 0x01, 0x07, 0xE0, 0xEC,
+	0x00, 0x01, 0x3F, 0xE0, 0xFB, 0x00, 0x01, 0x0F, 0xE0, 0xEC, 0x00, 0x01,
+	0x1F, 0xE0, 0xFB, 0x00, 0x01, 0x0F, 0xE0, 0xEC, 0x00, 0x01, 0x1F, 0xE0,
+	0xFB, 0x00, 0x01, 0x0F, 0xE0, 0xEC, 0x00, 0x01, 0x1F, 0xE0, 0xFB, 0x00,
+	0x01, 0x1F, 0xC0, 0xEC, 0x00, 0x01, 0x1F, 0xE0, 0xFB, 0x00, 0x01, 0x3F,
+	0xC0, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFB, 0x00, 0x01, 0x3F, 0xC0, 0xEC,
+	0x00, 0x01, 0x1F, 0xF0, 0xFB, 0x00, 0x01, 0x3F, 0xC0, 0xEC, 0x00, 0x01,
+	0x1F, 0xF0, 0xFB, 0x00, 0x01, 0x3F, 0xC0, 0xEC, 0x00, 0x01, 0x1F, 0xF0,
+	0xFB, 0x00, 0x01, 0x7F, 0xC0, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFB, 0x00,
+	0x01, 0xFF, 0xC0, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFB, 0x00, 0x01, 0xFF,
+	0x80, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFB, 0x00, 0x01, 0xFF, 0x80, 0xEC,
+	0x00, 0x01, 0x1F, 0xF0, 0xFD, 0x00, 0x03, 0x03, 0x00, 0xFF, 0x80, 0xEC,
+	0x00, 0x01, 0x1F, 0xF0, 0xFD, 0x00, 0x03, 0x1F, 0x00, 0xFF, 0x80, 0xEC,
+	0x00, 0x01, 0x1F, 0xF0, 0xFD, 0x00, 0x03, 0x7F, 0x00, 0xFF, 0x80, 0xEC,
+	0x00, 0x01, 0x1F, 0xF0, 0xFE, 0x00, 0x04, 0x01, 0xFE, 0x00, 0xFF, 0x80,
+	0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFE, 0x00, 0x04, 0x07, 0xF8, 0x00, 0xFF,
+	0x80, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFE, 0x00, 0x04, 0x1F, 0xE0, 0x00,
+	0xFF, 0x80, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFE, 0x00, 0x04, 0x7F, 0x80,
+	0x00, 0xFF, 0x80, 0xEC, 0x00, 0x01, 0x1F, 0xF0, 0xFE, 0x00, 0x04, 0xFE,
+	0x00, 0x00, 0xFF, 0x80, 0xEC, 0x00, 0x09, 0x1F, 0xF0, 0x00, 0x00, 0x03,
+	0xF8, 0x00, 0x00, 0xFF, 0x80, 0xF4, 0x00, 0x04, 0x8F, 0x00, 0x00, 0x02,
+	0x78, 0xFE, 0x00, 0x09, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+	0xFF, 0x80, 0xF6, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x02, 0x80, 0x7E, 0x7E,
+	0xFE, 0x00, 0x09, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0xFF,
+	0x80, 0xF7, 0x00, 0x01, 0x0E, 0x3F, 0xFE, 0xFF, 0x0A, 0xF9, 0xFF, 0x3F,
+	0x80, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x01, 0xFF,
+	0x80, 0xF8, 0x00, 0x01, 0x01, 0xE0, 0xFA, 0xFF, 0x07, 0xC0, 0x00, 0x00,
+	0x1F, 0xE0, 0x00, 0x00, 0xFC, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0xF8, 0x00,
+	0x00, 0x0F, 0xF9, 0xFF, 0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x03,
+	0xF8, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0xF8, 0x00, 0x00, 0x3F, 0xF9, 0xFF,
+	0x07, 0xF0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x01,
+	0xFF, 0xC0, 0xF8, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0x07, 0xF8, 0x00, 0x00,
+	0x1F, 0xE0, 0x00, 0x0F, 0xE0, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0xF9, 0x00,
+	0x00, 0x01, 0xF8, 0xFF, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x1F,
+	0x80, 0xFE, 0x00, 0x01, 0x7F, 0xC0, 0xF9, 0x00, 0x00, 0x03, 0xF8, 0xFF,
+	0x06, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x7F, 0xFD, 0x00, 0x01, 0x7F,
+	0xC0, 0xF9, 0x00, 0x00, 0x07, 0xFA, 0xFF, 0x08, 0xF0, 0x0F, 0xFE, 0x00,
+	0x00, 0x3F, 0xE0, 0x00, 0xFC, 0xFD, 0x00, 0x01, 0x3F, 0xC0, 0xF9, 0x00,
+	0x00, 0x0F, 0xFA, 0xFF, 0x08, 0xE0, 0x0F, 0xFF, 0xC0, 0x00, 0x3F, 0xE0,
+	0x03, 0xF0, 0xFD, 0x00, 0x01, 0x3F, 0xC0, 0xF9, 0x00, 0x00, 0x0F, 0xFA,
+	0xFF, 0x08, 0xC0, 0x3F, 0xFF, 0xF0, 0x00, 0x3F, 0xE0, 0x07, 0xE0, 0xFD,
+	0x00, 0x01, 0x3F, 0xC0, 0xF9, 0x00, 0x00, 0x0F, 0xFA, 0xFF, 0x08, 0x80,
+	0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xC0, 0xFD, 0x00, 0x01, 0x3F,
+	0xE0, 0xF9, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x07, 0x01, 0xFF, 0xFF, 0xFC,
+	0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x01, 0x3F, 0xE0, 0xF9, 0x00, 0x00,
+	0x1F, 0xFB, 0xFF, 0x07, 0xFE, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xC0,
+	0xFB, 0x00, 0x01, 0x3F, 0xE0, 0xF9, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x01,
+	0xFC, 0x07, 0xFE, 0xFF, 0x02, 0x00, 0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x3F,
+	0xE0, 0xF9, 0x00, 0x00, 0x0F, 0xFB, 0xFF, 0x01, 0xF8, 0x0F, 0xFE, 0xFF,
+	0x02, 0x00, 0x7F, 0x80, 0xFB, 0x00, 0x01, 0x1F, 0xE0, 0xF9, 0x00, 0x00,
+	0x0F, 0xFB, 0xFF, 0x07, 0xF8, 0x1F, 0xFF, 0xCF, 0xFF, 0x80, 0xFF, 0x80,
+	0xFB, 0x00, 0x01, 0x1F, 0xF0, 0xF9, 0x00, 0x00, 0x07, 0xFB, 0xFF, 0x07,
+	0xF0, 0x3F, 0xFE, 0x01, 0xFF, 0x80, 0xFF, 0x80, 0xFB, 0x00, 0x01, 0x1F,
+	0xF0, 0xF9, 0x00, 0x00, 0x03, 0xFB, 0xFF, 0x07, 0xF0, 0x3F, 0xF8, 0x00,
+	0xFF, 0xC0, 0xFF, 0x80, 0xFB, 0x00, 0x01, 0x1F, 0xF0, 0xF9, 0x00, 0x00,
+	0x01, 0xFB, 0xFF, 0x06, 0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xFA,
+	0x00, 0x01, 0x0F, 0xF8, 0xF8, 0x00, 0xFB, 0xFF, 0x06, 0xE0, 0xFF, 0xE0,
+	0x07, 0xFF, 0xC1, 0xFF, 0xFE, 0x00, 0x05, 0x01, 0xF0, 0x00, 0x00, 0x0F,
+	0xF8, 0xF8, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x06, 0xC1, 0xFF, 0xC0, 0x3F,
+	0xFF, 0xF9, 0xFF, 0xFE, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xF8,
+	0xF8, 0x00, 0x00, 0x1F, 0xFC, 0xFF, 0x03, 0xDF, 0xFF, 0x80, 0x7F, 0xFE,
+	0xFF, 0xFF, 0x00, 0x06, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFC, 0xF8,
+	0x00, 0x00, 0x07, 0xFA, 0xFF, 0x00, 0xC0, 0xFE, 0xFF, 0x09, 0xFE, 0x00,
+	0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFC, 0xF8, 0x00, 0x00, 0x01,
+	0xFA, 0xFF, 0x00, 0xF1, 0xFE, 0xFF, 0x04, 0xFE, 0x00, 0x03, 0xFF, 0xF0,
+	0xFE, 0x00, 0x01, 0x07, 0xFC, 0xF7, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0x00,
+	0xF3, 0xFE, 0xFF, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0xFD, 0x00, 0x01, 0x03,
+	0xFE, 0xF7, 0x00, 0x00, 0x0F, 0xF7, 0xFF, 0x03, 0xFC, 0x00, 0x3F, 0xC0,
+	0xFD, 0x00, 0x01, 0x03, 0xFE, 0xF6, 0x00, 0xFF, 0xFF, 0x01, 0xF8, 0x7F,
+	0xFD, 0xFF, 0x04, 0x83, 0xFF, 0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x01, 0x03,
+	0xFF, 0xF5, 0x00, 0x01, 0x70, 0x00, 0xFD, 0xFF, 0x05, 0xFE, 0x00, 0xFF,
+	0xFC, 0x00, 0x38, 0xFC, 0x00, 0x01, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x03,
+	0xFD, 0xFF, 0x03, 0xFC, 0x00, 0x7F, 0xF8, 0xFA, 0x00, 0x01, 0x01, 0xFF,
+	0xF4, 0x00, 0x08, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xF8,
+	0xF9, 0x00, 0x01, 0xFF, 0x80, 0xF5, 0x00, 0x08, 0x0F, 0xFF, 0xE0, 0x03,
+	0xFF, 0xF0, 0x00, 0x3F, 0xF0, 0xF9, 0x00, 0x01, 0xFF, 0x80, 0xF5, 0x00,
+	0x08, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xE0, 0x00, 0x3F, 0xF0, 0xF9, 0x00,
+	0x01, 0x7F, 0xC0, 0xF5, 0x00, 0x08, 0x1F, 0xFE, 0x00, 0x07, 0xFF, 0xC0,
+	0x00, 0x1F, 0xF0, 0xF9, 0x00, 0x01, 0x7F, 0xC0, 0xF5, 0x00, 0x08, 0x3F,
+	0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0xF9, 0x00, 0x01, 0x3F,
+	0xE0, 0xF5, 0x00, 0x08, 0x3F, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F,
+	0xF0, 0xF9, 0x00, 0x01, 0x3F, 0xF0, 0xF5, 0x00, 0x08, 0x7F, 0xE0, 0x00,
+	0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xF9, 0x00, 0x01, 0x3F, 0xF0, 0xF5,
+	0x00, 0x08, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0xF9,
+	0x00, 0x01, 0x1F, 0xF8, 0xF5, 0x00, 0x08, 0x7F, 0xC0, 0x01, 0xFF, 0xFE,
+	0x00, 0x00, 0x1F, 0xF0, 0xF9, 0x00, 0x01, 0x0F, 0xFC, 0xF5, 0x00, 0x0A,
+	0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0xE0, 0x1F, 0xF0, 0x00, 0xFE, 0xFB,
+	0x00, 0x01, 0x0F, 0xFC, 0xF5, 0x00, 0x0B, 0xFF, 0x80, 0x0F, 0xFF, 0xFC,
+	0x03, 0xF8, 0x1F, 0xF0, 0x00, 0xFF, 0xE0, 0xFC, 0x00, 0x01, 0x07, 0xFE,
+	0xF5, 0x00, 0x0B, 0xFF, 0x80, 0x3F, 0xFF, 0xF8, 0x0F, 0xF8, 0x1F, 0xE0,
+	0x00, 0xFF, 0xFC, 0xFC, 0x00, 0x01, 0x07, 0xFF, 0xF5, 0x00, 0x0C, 0x7F,
+	0x80, 0xFF, 0xFF, 0xF8, 0x1F, 0xFC, 0x3F, 0xE0, 0x00, 0x1F, 0xFF, 0x80,
+	0xFD, 0x00, 0x02, 0x03, 0xFF, 0x80, 0xF6, 0x00, 0x0C, 0x7F, 0xC1, 0xFF,
+	0xFF, 0xF8, 0x7F, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0xFD, 0x00,
+	0x02, 0x01, 0xFF, 0x80, 0xF6, 0x00, 0x0C, 0x7F, 0xC3, 0xFF, 0xFF, 0xF3,
+	0xFF, 0xFC, 0x3F, 0xE0, 0x00, 0x00, 0x0F, 0xFC, 0xFD, 0x00, 0x02, 0x01,
+	0xFF, 0xC0, 0xF6, 0x00, 0x01, 0x7F, 0xE3, 0xFD, 0xFF, 0x06, 0xF8, 0x3F,
+	0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0xF6, 0x00,
+	0x08, 0x3F, 0xF3, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x7F, 0xC0, 0xFE, 0x00,
+	0x01, 0x7F, 0xC0, 0xFD, 0x00, 0x01, 0x7F, 0xF0, 0xF6, 0x00, 0x08, 0x3F,
+	0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xC0, 0xFE, 0x00, 0x01, 0x1F,
+	0xF0, 0xFD, 0x00, 0x01, 0x3F, 0xF8, 0xF6, 0x00, 0x08, 0x1F, 0xFF, 0xFE,
+	0x0F, 0xFF, 0xFF, 0x80, 0x7F, 0xC0, 0xFE, 0x00, 0x01, 0x03, 0xFC, 0xFD,
+	0x00, 0x01, 0x3F, 0xFC, 0xF6, 0x00, 0x08, 0x0F, 0xFF, 0xF8, 0x07, 0xFF,
+	0xFF, 0x00, 0xFF, 0xC0, 0xFD, 0x00, 0x00, 0xFE, 0xFD, 0x00, 0x01, 0x1F,
+	0xFE, 0xF6, 0x00, 0x08, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0xFF,
+	0x80, 0xFD, 0x00, 0x01, 0x3F, 0x80, 0xFE, 0x00, 0x01, 0x0F, 0xFF, 0xF6,
+	0x00, 0x09, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x10,
+	0xFE, 0x00, 0x01, 0x0F, 0xE0, 0xFE, 0x00, 0x02, 0x07, 0xFF, 0x80, 0xF7,
+	0x00, 0x09, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x3C,
+	0xFE, 0x00, 0x01, 0x03, 0xF8, 0xFE, 0x00, 0x02, 0x03, 0xFF, 0xE0, 0xF6,
+	0x00, 0x01, 0xFF, 0xF0, 0xFE, 0x00, 0x03, 0x01, 0xFF, 0x00, 0x3F, 0xFD,
+	0x00, 0x00, 0xFE, 0xFE, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0xF6, 0x00, 0x01,
+	0x7F, 0xF0, 0xFE, 0x00, 0x04, 0x03, 0xFF, 0x00, 0x1F, 0x80, 0xFE, 0x00,
+	0x01, 0x3F, 0x80, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0xF6, 0x00, 0x01, 0x3F,
+	0xF8, 0xFE, 0x00, 0x04, 0x03, 0xFE, 0x00, 0x0F, 0xC0, 0xFE, 0x00, 0x01,
+	0x1F, 0xC0, 0xFE, 0x00, 0x01, 0x7F, 0xFC, 0xF6, 0x00, 0x01, 0x1F, 0xFC,
+	0xFE, 0x00, 0x04, 0x07, 0xFE, 0x00, 0x07, 0xE0, 0xFE, 0x00, 0x01, 0x03,
+	0xF0, 0xFE, 0x00, 0x01, 0x3F, 0xFF, 0xF6, 0x00, 0x01, 0x0F, 0xFE, 0xFE,
+	0x00, 0x04, 0x0F, 0xFC, 0x00, 0x03, 0xE0, 0xFE, 0x00, 0x01, 0x01, 0xFC,
+	0xFE, 0x00, 0x02, 0x1F, 0xFF, 0x80, 0xF7, 0x00, 0x01, 0x0F, 0xFF, 0xFE,
+	0x00, 0x04, 0x1F, 0xFC, 0x00, 0x01, 0xF0, 0xFD, 0x00, 0x00, 0x7E, 0xFE,
+	0x00, 0x02, 0x0F, 0xFF, 0xC0, 0xF7, 0x00, 0x09, 0x07, 0xFF, 0xC0, 0x00,
+	0x00, 0x3F, 0xF8, 0x00, 0x00, 0xF0, 0xFD, 0x00, 0x00, 0x3E, 0xFE, 0x00,
+	0x02, 0x03, 0xFF, 0xF0, 0xF7, 0x00, 0x09, 0x03, 0xFF, 0xF0, 0x00, 0x00,
+	0x7F, 0xF0, 0x00, 0x00, 0x78, 0xFD, 0x00, 0x00, 0x0C, 0xFE, 0x00, 0x02,
+	0x01, 0xFF, 0xF8, 0xF7, 0x00, 0x09, 0x01, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
+	0xF0, 0x00, 0x00, 0x10, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0xF6, 0x00, 0xFF,
+	0xFF, 0x03, 0xC0, 0x0F, 0xFF, 0xE0, 0xF5, 0x00, 0x02, 0x7F, 0xFF, 0x80,
+	0xF7, 0x00, 0x00, 0x7F, 0xFD, 0xFF, 0x00, 0xC0, 0xF5, 0x00, 0x02, 0x1F,
+	0xFF, 0xE0, 0xF7, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0x00, 0x80, 0xF5, 0x00,
+	0x02, 0x0F, 0xFF, 0xF8, 0xF7, 0x00, 0x00, 0x0F, 0xFD, 0xFF, 0xF4, 0x00,
+	0x02, 0x03, 0xFF, 0xFE, 0xF7, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x00, 0xFE,
+	0xF4, 0x00, 0x03, 0x01, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x00, 0x01, 0xFE,
+	0xFF, 0x00, 0xFC, 0xF3, 0x00, 0x02, 0x7F, 0xFF, 0xF0, 0xF8, 0x00, 0x00,
+	0x07, 0xFE, 0xFF, 0x00, 0xF0, 0xF3, 0x00, 0x02, 0x7F, 0xFF, 0xF0, 0xF8,
+	0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0xE0, 0xF3, 0x00, 0x03, 0x1F, 0xFF,
+	0xFF, 0x80, 0xF9, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF2, 0x00, 0x03, 0x03,
+	0xFF, 0xFF, 0xF0, 0xFA, 0x00, 0x04, 0x03, 0xFF, 0xFF, 0xDF, 0xF0, 0xF2,
+	0x00, 0x00, 0x01, 0xFE, 0xFF, 0xFA, 0x00, 0x02, 0x3F, 0xFF, 0xFF, 0xEF,
+	0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0x01, 0xFF, 0xFF,
+	0xFC, 0xEF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0x80, 0xFD, 0x00, 0x03,
+	0x3F, 0xFF, 0xFF, 0xF0, 0xEF, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0xFE,
+	0xFE, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0xC0, 0xEE, 0x00, 0xF6, 0xFF,
+	0xED, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0x00, 0xFC, 0xED, 0x00, 0x00, 0x03,
+	0xF8, 0xFF, 0x00, 0xE0, 0xEC, 0x00, 0x00, 0x7F, 0xF9, 0xFF, 0xEB, 0x00,
+	0x00, 0x0F, 0xFA, 0xFF, 0x00, 0xF8, 0xEA, 0x00, 0xFA, 0xFF, 0x00, 0xC0,
+	0xEA, 0x00, 0x00, 0x0F, 0xFC, 0xFF, 0x00, 0xFC, 0xE8, 0x00, 0x00, 0x3F,
+	0xFE, 0xFF, 0x01, 0x7F, 0x80, 0xE7, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x90, 0x00};
+const epd_image_t bad_air = {bad_air_data, 2919, 248, 248};
+
+/** worried_air 248 x 248, 7688 bytes packed to 3107 bytes */
+static const uint8_t worried_air_data[] = {
+	0x81, 0x00, 0xD9, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0xFC, 0xE8, 0x00,
+	0x00, 0x0F, 0xFC, 0xFF, 0x00, 0xF0, 0xEA, 0x00, 0x00, 0x02, 0xFA, 0xFF,
+	0x00, 0x40, 0xEB, 0x00, 0x00, 0x1F, 0xFA, 0xFF, 0x00, 0xF8, 0xEB, 0x00,
+	0xF8, 0xFF, 0xEC, 0x00, 0x00, 0x07, 0xF8, 0xFF, 0x00, 0xE0, 0xED, 0x00,
+	0x00, 0x3F, 0xF8, 0xFF, 0x00, 0xFC, 0xED, 0x00, 0x00, 0x3F, 0xF8, 0xFF,
+	0x00, 0xFE, 0xEE, 0x00, 0x00, 0x01, 0xFD, 0xFF, 0x02, 0xC0, 0x00, 0x03,
+	0xFD, 0xFF, 0x00, 0x80, 0xEF, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x00, 0xC0,
+	0xFE, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0xF0, 0xEF, 0x00, 0x03, 0x3F,
+	0xFF, 0xFF, 0xF0, 0xFC, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFC, 0xEF, 0x00,
+	0xFF, 0xFF, 0x00, 0xFE, 0xFA, 0x00, 0x02, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
+	0x03, 0x03, 0xFF, 0xFF, 0xF0, 0xFA, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xC0,
+	0xF1, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0x80, 0xFA, 0x00, 0x03, 0x01, 0xFF,
+	0xFF, 0xF0, 0xF1, 0x00, 0x02, 0x3F, 0xFF, 0xFC, 0xF8, 0x00, 0x02, 0x3F,
+	0xFF, 0xFC, 0xF2, 0x00, 0x03, 0x01, 0xFF, 0xFF, 0xE0, 0xF8, 0x00, 0x03,
+	0x07, 0xFF, 0xFF, 0x80, 0xF3, 0x00, 0x03, 0x01, 0xFF, 0xFF, 0x80, 0xF8,
+	0x00, 0x03, 0x01, 0xFF, 0xFF, 0x80, 0xF3, 0x00, 0x02, 0x07, 0xFF, 0xFE,
+	0xF6, 0x00, 0x02, 0x7F, 0xFF, 0xE0, 0xF3, 0x00, 0x02, 0x0F, 0xFF, 0xF0,
+	0xF6, 0x00, 0x02, 0x0F, 0xFF, 0xF0, 0xF3, 0x00, 0x02, 0x3F, 0xFF, 0xC0,
+	0xF6, 0x00, 0x02, 0x03, 0xFF, 0xFC, 0xF3, 0x00, 0xFF, 0xFF, 0xF4, 0x00,
+	0x01, 0xFF, 0xFE, 0xF4, 0x00, 0x02, 0x01, 0xFF, 0xFE, 0xF4, 0x00, 0x02,
+	0x7F, 0xFF, 0x80, 0xF5, 0x00, 0x02, 0x07, 0xFF, 0xF8, 0xF4, 0x00, 0x02,
+	0x0F, 0xFF, 0xE0, 0xF5, 0x00, 0x02, 0x0F, 0xFF, 0xE0, 0xF4, 0x00, 0x02,
+	0x07, 0xFF, 0xF0, 0xF5, 0x00, 0x02, 0x1F, 0xFF, 0x80, 0xF4, 0x00, 0x02,
+	0x01, 0xFF, 0xF8, 0xF5, 0x00, 0x01, 0x7F, 0xFF, 0xF2, 0x00, 0x01, 0xFF,
+	0xFE, 0xF5, 0x00, 0x01, 0xFF, 0xFC, 0xF2, 0x00, 0x01, 0x3F, 0xFF, 0xF6,
+	0x00, 0x02, 0x01, 0xFF, 0xF8, 0xF2, 0x00, 0x02, 0x1F, 0xFF, 0x80, 0xF7,
+	0x00, 0x02, 0x03, 0xFF, 0xE0, 0xF2, 0x00, 0x02, 0x07, 0xFF, 0xC0, 0xF7,
+	0x00, 0x02, 0x07, 0xFF, 0xC0, 0xF2, 0x00, 0x02, 0x03, 0xFF, 0xE0, 0xF7,
+	0x00, 0x02, 0x0F, 0xFF, 0x80, 0xF2, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0xF7,
+	0x00, 0x01, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0xF7, 0x00, 0x01,
+	0x3F, 0xFE, 0xF0, 0x00, 0x01, 0x7F, 0xFC, 0xF7, 0x00, 0x01, 0x7F, 0xFC,
+	0xF0, 0x00, 0x01, 0x3F, 0xFE, 0xF7, 0x00, 0x01, 0xFF, 0xF8, 0xF0, 0x00,
+	0x01, 0x1F, 0xFF, 0xF8, 0x00, 0x02, 0x01, 0xFF, 0xF0, 0xF0, 0x00, 0x02,
+	0x0F, 0xFF, 0x80, 0xF9, 0x00, 0x02, 0x01, 0xFF, 0xC0, 0xF0, 0x00, 0x02,
+	0x07, 0xFF, 0x80, 0xF9, 0x00, 0x02, 0x07, 0xFF, 0x80, 0xF0, 0x00, 0x02,
+	0x01, 0xFF, 0xE0, 0xF9, 0x00, 0x02, 0x07, 0xFF, 0x80, 0xF0, 0x00, 0x02,
+	0x01, 0xFF, 0xE0, 0xF9, 0x00, 0x01, 0x0F, 0xFF, 0xEE, 0x00, 0x01, 0xFF,
+	0xF0, 0xF9, 0x00, 0x01, 0x1F, 0xFE, 0xEE, 0x00, 0x01, 0x7F, 0xF8, 0xF9,
+	0x00, 0x01, 0x3F, 0xFC, 0xEE, 0x00, 0x01, 0x3F, 0xFC, 0xF9, 0x00, 0x01,
+	0x7F, 0xF8, 0xEE, 0x00, 0x01, 0x1F, 0xFE, 0xF9, 0x00, 0x01, 0x7F, 0xF0,
+	0xEE, 0x00, 0x01, 0x0F, 0xFE, 0xF9, 0x00, 0x01, 0xFF, 0xE0, 0xEE, 0x00,
+	0x01, 0x07, 0xFF, 0xFA, 0x00, 0x02, 0x03, 0xFF, 0xC0, 0xEE, 0x00, 0x02,
+	0x03, 0xFF, 0xC0, 0xFB, 0x00, 0x01, 0x07, 0xFF, 0xEC, 0x00, 0x01, 0xFF,
+	0xE0, 0xFB, 0x00, 0x01, 0x07, 0xFE, 0xEC, 0x00, 0x01, 0x7F, 0xE0, 0xFB,
+	0x00, 0x01, 0x0F, 0xFC, 0xEC, 0x00, 0x01, 0x3F, 0xF0, 0xFB, 0x00, 0x01,
+	0x1F, 0xFC, 0xEC, 0x00, 0x01, 0x3F, 0xF8, 0xFB, 0x00, 0x01, 0x1F, 0xF8,
+	0xEC, 0x00, 0x01, 0x1F, 0xF8, 0xFB, 0x00, 0x01, 0x3F, 0xF0, 0xEC, 0x00,
+	0x01, 0x0F, 0xFC, 0xFB, 0x00, 0x01, 0x7F, 0xE0, 0xEC, 0x00, 0x01, 0x07,
+	0xFE, 0xFB, 0x00, 0x01, 0xFF, 0xC0, 0xEC, 0x00, 0x01, 0x03, 0xFF, 0xFB,
+	0x00, 0x01, 0xFF, 0xC0, 0xEC, 0x00, 0x01, 0x03, 0xFF, 0xFC, 0x00, 0x02,
+	0x01, 0xFF, 0x80, 0xEC, 0x00, 0x02, 0x01, 0xFF, 0x80, 0xFD, 0x00, 0x01,
+	0x03, 0xFF, 0xEA, 0x00, 0x01, 0xFF, 0xC0, 0xFD, 0x00, 0x01, 0x03, 0xFF,
+	0xEA, 0x00, 0x01, 0xFF, 0xC0, 0xFD, 0x00, 0x01, 0x07, 0xFE, 0xEA, 0x00,
+	0x01, 0x7F, 0xE0, 0xFD, 0x00, 0x01, 0x07, 0xFE, 0xEA, 0x00, 0x01, 0x7F,
+	0xE0, 0xFD, 0x00, 0x01, 0x0F, 0xFC, 0xEA, 0x00, 0x01, 0x3F, 0xF0, 0xFD,
+	0x00, 0x01, 0x0F, 0xFC, 0xEA, 0x00, 0x01, 0x1F, 0xF0, 0xFD, 0x00, 0x01,
+	0x1F, 0xF8, 0xEA, 0x00, 0x01, 0x1F, 0xF8, 0xFD, 0x00, 0x01, 0x1F, 0xF0,
+	0xEA, 0x00, 0x01, 0x0F, 0xF8, 0xFD, 0x00, 0x01, 0x3F, 0xF0, 0xEA, 0x00,
+	0x01, 0x0F, 0xFC, 0xFD, 0x00, 0x01, 0x3F, 0xE0, 0xEA, 0x00, 0x01, 0x07,
+	0xFC, 0xFD, 0x00, 0x01, 0x7F, 0xE0, 0xEA, 0x00, 0x01, 0x07, 0xFE, 0xFD,
+	0x00, 0x01, 0x7F, 0xC0, 0xEA, 0x00, 0x01, 0x03, 0xFE, 0xFD, 0x00, 0x01,
+	0x7F, 0xC0, 0xEA, 0x00, 0x01, 0x03, 0xFE, 0xFD, 0x00, 0x01, 0xFF, 0x80,
+	0xEA, 0x00, 0x01, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0xEA, 0x00,
+	0x01, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0x01, 0xFF, 0xE8, 0x00, 0x05, 0xFF,
+	0x80, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+	0x01, 0xFF, 0xE8, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFE, 0xE8,
+	0x00, 0x05, 0x7F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xE8, 0x00, 0x05, 0x7F,
+	0xC0, 0x00, 0x00, 0x03, 0xFC, 0xE8, 0x00, 0x05, 0x3F, 0xC0, 0x00, 0x00,
+	0x07, 0xFC, 0xE8, 0x00, 0x05, 0x3F, 0xE0, 0x00, 0x00, 0x07, 0xFC, 0xFC,
+	0x00, 0x01, 0x03, 0xF8, 0xF6, 0x00, 0x01, 0x1F, 0xC0, 0xFC, 0x00, 0x05,
+	0x3F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0xFC, 0x00, 0x01, 0x1F, 0xFF, 0xF6,
+	0x00, 0x01, 0xFF, 0xF8, 0xFC, 0x00, 0x05, 0x1F, 0xE0, 0x00, 0x00, 0x0F,
+	0xF8, 0xFC, 0x00, 0x02, 0x7F, 0xFF, 0xC0, 0xF8, 0x00, 0x02, 0x03, 0xFF,
+	0xFE, 0xFC, 0x00, 0x05, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFC, 0x00,
+	0xFF, 0xFF, 0x00, 0xE0, 0xF8, 0x00, 0x02, 0x07, 0xFF, 0xFF, 0xFC, 0x00,
+	0x05, 0x1F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xFD, 0x00, 0x03, 0x01, 0xFF,
+	0xFF, 0xF0, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0x80, 0xFD, 0x00, 0x05,
+	0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0xFD, 0x00, 0x03, 0x03, 0xFF, 0xFF,
+	0xFC, 0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x05, 0x0F,
+	0xF8, 0x00, 0x00, 0x1F, 0xE0, 0xFD, 0x00, 0x03, 0x07, 0xFF, 0xFF, 0xFC,
+	0xF8, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xE0, 0xFD, 0x00, 0x05, 0x07, 0xF8,
+	0x00, 0x00, 0x1F, 0xE0, 0xFD, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFE, 0xF8,
+	0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xF0, 0xFD, 0x00, 0x05, 0x07, 0xF8, 0x00,
+	0x00, 0x3F, 0xE0, 0xFD, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0xFE, 0xF8, 0x00,
+	0xFE, 0xFF, 0x00, 0xF8, 0xFD, 0x00, 0x05, 0x07, 0xFC, 0x00, 0x00, 0x3F,
+	0xE0, 0xFD, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF8, 0x00, 0xFE, 0xFF, 0x00,
+	0xF8, 0xFD, 0x00, 0x05, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFD, 0x00,
+	0x00, 0x1F, 0xFE, 0xFF, 0xF8, 0x00, 0xFE, 0xFF, 0x00, 0xF8, 0xFD, 0x00,
+	0x05, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0xFD, 0x00, 0x00, 0x3F, 0xFE,
+	0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0xFC, 0xFD,
+	0x00, 0x05, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x00, 0x3F,
+	0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0xFC,
+	0xFD, 0x00, 0x05, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0xC0, 0xFD, 0x00, 0x00,
+	0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x00,
+	0xFC, 0xFD, 0x00, 0x05, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0xFD, 0x00,
+	0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01, 0xFE, 0xFF,
+	0x00, 0xFC, 0xFD, 0x00, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0xFD,
+	0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01, 0xFE,
+	0xFF, 0x00, 0xFC, 0xFD, 0x00, 0x05, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x80,
+	0xFD, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01,
+	0xFE, 0xFF, 0x00, 0xFC, 0xFD, 0x00, 0x05, 0x01, 0xFF, 0x00, 0x00, 0xFF,
+	0x80, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00,
+	0x01, 0xFE, 0xFF, 0x00, 0xFC, 0xFD, 0x00, 0x05, 0x01, 0xFF, 0x00, 0x00,
+	0xFF, 0x80, 0xFD, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00,
+	0x00, 0x01, 0xFE, 0xFF, 0x00, 0xFC, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00,
+	0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00,
+	0x01, 0xFE, 0xFF, 0x00, 0xFC, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
+	0xFC, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00, 0x80, 0xFA, 0x00, 0x00, 0x01,
+	0xFE, 0xFF, 0x00, 0xFC, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xFC,
+	0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0xFE, 0xFF, 0x00, 0xFC, 0xFC,
+	0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0xFF,
+	0xF8, 0x00, 0xFE, 0xFF, 0x00, 0xF8, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x01,
+	0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0xF8, 0x00, 0xFE, 0xFF, 0x00,
+	0xF8, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0x0F,
+	0xFF, 0xFF, 0xFE, 0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xF0, 0xFC, 0x00,
+	0x03, 0xFF, 0x80, 0x01, 0xFE, 0xFC, 0x00, 0x03, 0x07, 0xFF, 0xFF, 0xFE,
+	0xF8, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xE0, 0xFC, 0x00, 0x03, 0x7F, 0x80,
+	0x01, 0xFE, 0xFC, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xF8, 0xF8, 0x00, 0x03,
+	0x1F, 0xFF, 0xFF, 0xC0, 0xFC, 0x00, 0x03, 0x7F, 0x80, 0x01, 0xFE, 0xFC,
+	0x00, 0x03, 0x01, 0xFF, 0xFF, 0xF0, 0xF8, 0x00, 0x03, 0x0F, 0xFF, 0xFF,
+	0x80, 0xFC, 0x00, 0x03, 0x7F, 0x80, 0x03, 0xFE, 0xFB, 0x00, 0x02, 0x7F,
+	0xFF, 0xC0, 0xF8, 0x00, 0x02, 0x03, 0xFF, 0xFE, 0xFB, 0x00, 0x03, 0x7F,
+	0xC0, 0x03, 0xFE, 0xFB, 0x00, 0x01, 0x0F, 0xFF, 0xF6, 0x00, 0x01, 0xFF,
+	0xF8, 0xFB, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xFA, 0x00, 0x00, 0xF0,
+	0xF6, 0x00, 0x00, 0x07, 0xFA, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6,
+	0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03,
+	0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F,
+	0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00,
+	0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE,
+	0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0,
+	0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03,
+	0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6,
+	0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03,
+	0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F,
+	0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00,
+	0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE,
+	0xE6, 0x00, 0x03, 0x7F, 0xC0, 0x03, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0x80,
+	0x01, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0x80, 0x01, 0xFE, 0xE6, 0x00, 0x03,
+	0x7F, 0x80, 0x01, 0xFE, 0xE6, 0x00, 0x03, 0x7F, 0x80, 0x01, 0xFF, 0xE6,
+	0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0xE6, 0x00, 0x03, 0xFF, 0x80, 0x01,
+	0xFF, 0xE6, 0x00, 0x03, 0xFF, 0x80, 0x00, 0xFF, 0xE6, 0x00, 0x03, 0xFF,
+	0x00, 0x00, 0xFF, 0xE6, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xE6, 0x00,
+	0x04, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0xE8, 0x00, 0x05, 0x01, 0xFF, 0x00,
+	0x00, 0xFF, 0x80, 0xE8, 0x00, 0x05, 0x01, 0xFF, 0x00, 0x00, 0x7F, 0x80,
+	0xE8, 0x00, 0x05, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0xE8, 0x00, 0x05,
+	0x01, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0xE8, 0x00, 0x05, 0x01, 0xFE, 0x00,
+	0x00, 0x7F, 0xC0, 0xFB, 0x00, 0x01, 0x0F, 0xFF, 0xFD, 0x00, 0x01, 0x3F,
+	0xF8, 0xFD, 0x00, 0x01, 0xFF, 0xF0, 0xFC, 0x00, 0x05, 0x03, 0xFE, 0x00,
+	0x00, 0x3F, 0xC0, 0xFB, 0x00, 0x02, 0x3F, 0xFF, 0xC0, 0xFE, 0x00, 0xFF,
+	0xFF, 0xFE, 0x00, 0x02, 0x07, 0xFF, 0xFC, 0xFC, 0x00, 0x05, 0x03, 0xFC,
+	0x00, 0x00, 0x3F, 0xE0, 0xFB, 0x00, 0x0D, 0x7F, 0xFF, 0xF0, 0x00, 0x00,
+	0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0xFC, 0x00, 0x05,
+	0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0xFC, 0x00, 0x0F, 0x01, 0xFF, 0xFF,
+	0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+	0x80, 0xFD, 0x00, 0x05, 0x07, 0xFC, 0x00, 0x00, 0x3F, 0xE0, 0xFC, 0x00,
+	0x0F, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00,
+	0x00, 0x3F, 0xFF, 0xFF, 0x80, 0xFD, 0x00, 0x05, 0x07, 0xFC, 0x00, 0x00,
+	0x1F, 0xE0, 0xFC, 0x00, 0x0F, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F,
+	0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0xFD, 0x00, 0x05,
+	0x07, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0xFF,
+	0xFF, 0x00, 0x05, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFE, 0xFF, 0x00,
+	0xE0, 0xFD, 0x00, 0x05, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xF0, 0xFC, 0x00,
+	0x00, 0x1F, 0xFE, 0xFF, 0x07, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
+	0x01, 0xFE, 0xFF, 0x00, 0xF0, 0xFD, 0x00, 0x05, 0x0F, 0xF8, 0x00, 0x00,
+	0x1F, 0xF0, 0xFC, 0x00, 0x0F, 0x3F, 0xFF, 0x9F, 0xFF, 0xC0, 0x00, 0xFF,
+	0xFC, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0xF8, 0xFD, 0x00, 0x05,
+	0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xF8, 0xFC, 0x00, 0x0F, 0x3F, 0xFC, 0x03,
+	0xFF, 0xE0, 0x01, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x3F,
+	0xFC, 0xFD, 0x00, 0x05, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFD, 0x00,
+	0x10, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x07, 0xFF,
+	0xE0, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xFD, 0x00, 0x05, 0x1F, 0xF0, 0x00,
+	0x00, 0x07, 0xF8, 0xFD, 0x00, 0x04, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFE,
+	0xFF, 0x01, 0x80, 0x01, 0xFE, 0xFF, 0x04, 0xFE, 0x00, 0x0F, 0xFF, 0xF8,
+	0xFE, 0x00, 0x05, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0xFD, 0x00, 0x04,
+	0x7F, 0xFF, 0xE0, 0x00, 0x3F, 0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0xFF, 0x04,
+	0xFC, 0x00, 0x07, 0xFF, 0xFC, 0xFE, 0x00, 0x05, 0x1F, 0xE0, 0x00, 0x00,
+	0x07, 0xFC, 0xFD, 0x00, 0xFF, 0xFF, 0x0F, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
+	0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFE, 0xFE,
+	0x00, 0x05, 0x3F, 0xE0, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0x00, 0x12, 0x01,
+	0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF,
+	0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x05, 0x7F, 0xC0, 0x00,
+	0x00, 0x03, 0xFC, 0xFE, 0x00, 0x12, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x07,
+	0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+	0xFF, 0xFE, 0x00, 0x05, 0x3F, 0xC0, 0x00, 0x00, 0x03, 0xFE, 0xFE, 0x00,
+	0x12, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+	0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x05, 0x7F,
+	0xC0, 0x00, 0x00, 0x01, 0xFE, 0xFE, 0x00, 0x0D, 0x01, 0xFF, 0xF8, 0x00,
+	0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00,
+	0x01, 0x3F, 0xFF, 0xFE, 0x00, 0x05, 0x7F, 0x80, 0x00, 0x00, 0x01, 0xFF,
+	0xFE, 0x00, 0x02, 0x01, 0xFF, 0xE0, 0xFE, 0x00, 0x07, 0x7F, 0xFF, 0x80,
+	0x00, 0x00, 0x03, 0xFF, 0xFE, 0xFE, 0x00, 0x01, 0x1F, 0xFF, 0xFE, 0x00,
+	0x05, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x00, 0x7F, 0xFD,
+	0x00, 0x01, 0x0F, 0xF8, 0xFD, 0x00, 0x01, 0x3F, 0xE0, 0xFE, 0x00, 0x01,
+	0x01, 0xFC, 0xFE, 0x00, 0x01, 0xFF, 0x80, 0xFE, 0x00, 0x01, 0xFF, 0x80,
+	0xEA, 0x00, 0x01, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0xFF, 0x80, 0xEA, 0x00,
+	0x01, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x7F, 0xC0, 0xEA, 0x00, 0x01, 0x03,
+	0xFE, 0xFD, 0x00, 0x01, 0x7F, 0xE0, 0xEA, 0x00, 0x01, 0x07, 0xFE, 0xFD,
+	0x00, 0x01, 0x3F, 0xE0, 0xEA, 0x00, 0x01, 0x07, 0xFC, 0xFD, 0x00, 0x01,
+	0x1F, 0xF0, 0xEA, 0x00, 0x01, 0x0F, 0xFC, 0xFD, 0x00, 0x01, 0x1F, 0xF0,
+	0xEA, 0x00, 0x01, 0x0F, 0xF8, 0xFD, 0x00, 0x01, 0x0F, 0xF8, 0xEA, 0x00,
+	0x01, 0x1F, 0xF0, 0xFD, 0x00, 0x01, 0x0F, 0xFC, 0xEA, 0x00, 0x01, 0x3F,
+	0xF0, 0xFD, 0x00, 0x01, 0x07, 0xFC, 0xEA, 0x00, 0x01, 0x3F, 0xE0, 0xFD,
+	0x00, 0x01, 0x07, 0xFE, 0xEA, 0x00, 0x01, 0x7F, 0xE0, 0xFD, 0x00, 0x01,
+	0x03, 0xFE, 0xEA, 0x00, 0x01, 0x7F, 0xC0, 0xFD, 0x00, 0x01, 0x03, 0xFF,
+	0xEA, 0x00, 0x01, 0xFF, 0xC0, 0xFD, 0x00, 0x02, 0x01, 0xFF, 0x80, 0xEC,
+	0x00, 0x02, 0x01, 0xFF, 0x80, 0xFD, 0x00, 0x02, 0x01, 0xFF, 0x80, 0xEC,
+	0x00, 0x02, 0x01, 0xFF, 0x80, 0xFC, 0x00, 0x01, 0xFF, 0xC0, 0xEC, 0x00,
+	0x01, 0x03, 0xFF, 0xFB, 0x00, 0x01, 0x7F, 0xE0, 0xEC, 0x00, 0x01, 0x07,
+	0xFE, 0xFB, 0x00, 0x01, 0x7F, 0xE0, 0xEC, 0x00, 0x01, 0x07, 0xFE, 0xFB,
+	0x00, 0x01, 0x3F, 0xF0, 0xEC, 0x00, 0x01, 0x0F, 0xFC, 0xFB, 0x00, 0x01,
+	0x3F, 0xF8, 0xEC, 0x00, 0x01, 0x1F, 0xFC, 0xFB, 0x00, 0x01, 0x1F, 0xFC,
+	0xEC, 0x00, 0x01, 0x3F, 0xF8, 0xFB, 0x00, 0x01, 0x0F, 0xFC, 0xEC, 0x00,
+	0x01, 0x3F, 0xF0, 0xFB, 0x00, 0x01, 0x07, 0xFE, 0xEC, 0x00, 0x01, 0x7F,
+	0xE0, 0xFB, 0x00, 0x01, 0x07, 0xFF, 0xEC, 0x00, 0x01, 0xFF, 0xE0, 0xFB,
+	0x00, 0x02, 0x03, 0xFF, 0x80, 0xEE, 0x00, 0x02, 0x01, 0xFF, 0xC0, 0xFB,
+	0x00, 0x02, 0x01, 0xFF, 0xC0, 0xEE, 0x00, 0x02, 0x03, 0xFF, 0x80, 0xFB,
+	0x00, 0x02, 0x01, 0xFF, 0xC0, 0xEE, 0x00, 0x02, 0x03, 0xFF, 0x80, 0xFA,
+	0x00, 0x01, 0xFF, 0xE0, 0xEE, 0x00, 0x01, 0x07, 0xFF, 0xF9, 0x00, 0x01,
+	0x7F, 0xF8, 0xEE, 0x00, 0x01, 0x1F, 0xFE, 0xF9, 0x00, 0x01, 0x3F, 0xF8,
+	0xEE, 0x00, 0x01, 0x1F, 0xFC, 0xF9, 0x00, 0x01, 0x1F, 0xFC, 0xEE, 0x00,
+	0x01, 0x3F, 0xF8, 0xF9, 0x00, 0x01, 0x0F, 0xFE, 0xEE, 0x00, 0x01, 0x7F,
+	0xF0, 0xF9, 0x00, 0x01, 0x07, 0xFF, 0xEE, 0x00, 0x01, 0xFF, 0xF0, 0xF9,
+	0x00, 0x02, 0x03, 0xFF, 0x80, 0xF0, 0x00, 0x02, 0x01, 0xFF, 0xC0, 0xF9,
+	0x00, 0x02, 0x01, 0xFF, 0xC0, 0xF0, 0x00, 0x02, 0x03, 0xFF, 0x80, 0xF9,
+	0x00, 0x02, 0x01, 0xFF, 0xE0, 0xF0, 0x00, 0x02, 0x07, 0xFF, 0x80, 0xF8,
+	0x00, 0x01, 0xFF, 0xF0, 0xF0, 0x00, 0x01, 0x0F, 0xFF, 0xF7, 0x00, 0x01,
+	0x7F, 0xF8, 0xF0, 0x00, 0x01, 0x1F, 0xFE, 0xF7, 0x00, 0x01, 0x3F, 0xFE,
+	0xF0, 0x00, 0x01, 0x7F, 0xFC, 0xF7, 0x00, 0x01, 0x0F, 0xFF, 0xF0, 0x00,
+	0x01, 0xFF, 0xF8, 0xF7, 0x00, 0x02, 0x0F, 0xFF, 0x80, 0xF2, 0x00, 0x02,
+	0x01, 0xFF, 0xF0, 0xF7, 0x00, 0x02, 0x03, 0xFF, 0xF0, 0xF2, 0x00, 0x02,
+	0x0F, 0xFF, 0xC0, 0xF7, 0x00, 0x02, 0x01, 0xFF, 0xF8, 0xF2, 0x00, 0x02,
+	0x1F, 0xFF, 0x80, 0xF7, 0x00, 0x02, 0x01, 0xFF, 0xF8, 0xF2, 0x00, 0x02,
+	0x1F, 0xFF, 0x80, 0xF6, 0x00, 0x01, 0x7F, 0xFE, 0xF2, 0x00, 0x01, 0x7F,
+	0xFE, 0xF5, 0x00, 0x01, 0x3F, 0xFF, 0xF2, 0x00, 0x01, 0xFF, 0xFC, 0xF5,
+	0x00, 0x02, 0x1F, 0xFF, 0xC0, 0xF4, 0x00, 0x02, 0x03, 0xFF, 0xF8, 0xF5,
+	0x00, 0x02, 0x0F, 0xFF, 0xE0, 0xF4, 0x00, 0x02, 0x07, 0xFF, 0xF0, 0xF5,
+	0x00, 0x02, 0x03, 0xFF, 0xF8, 0xF4, 0x00, 0x02, 0x1F, 0xFF, 0xC0, 0xF5,
+	0x00, 0x02, 0x01, 0xFF, 0xFE, 0xF4, 0x00, 0x02, 0x7F, 0xFF, 0x80, 0xF4,
+	0x00, 0x02, 0x7F, 0xFF, 0x80, 0xF6, 0x00, 0x02, 0x01, 0xFF, 0xFE, 0xF3,
+	0x00, 0x02, 0x3F, 0xFF, 0xE0, 0xF6, 0x00, 0x02, 0x07, 0xFF, 0xFC, 0xF3,
+	0x00, 0x02, 0x0F, 0xFF, 0xF8, 0xF6, 0x00, 0x02, 0x1F, 0xFF, 0xF0, 0xF3,
+	0x00, 0x02, 0x07, 0xFF, 0xFE, 0xF6, 0x00, 0x02, 0x7F, 0xFF, 0xE0, 0xF3,
+	0x00, 0x03, 0x01, 0xFF, 0xFF, 0x80, 0xF8, 0x00, 0x03, 0x01, 0xFF, 0xFF,
+	0x80, 0xF2, 0x00, 0xFF, 0xFF, 0x00, 0xF0, 0xF8, 0x00, 0x02, 0x0F, 0xFF,
+	0xFF, 0xF1, 0x00, 0x02, 0x3F, 0xFF, 0xFC, 0xF8, 0x00, 0x02, 0x3F, 0xFF,
+	0xFC, 0xF1, 0x00, 0x02, 0x2F, 0xFF, 0xFE, 0xF8, 0x00, 0xFF, 0xFF, 0x00,
+	0xF4, 0xF1, 0x00, 0x03, 0x0F, 0xFF, 0xFF, 0x80, 0xFA, 0x00, 0x03, 0x01,
+	0xFF, 0xFF, 0xF0, 0xF1, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xF0, 0xFA, 0x00,
+	0x03, 0x0F, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0xFA,
+	0x00, 0x02, 0x7F, 0xFF, 0xFF, 0xEF, 0x00, 0x03, 0x3F, 0xFF, 0xFF, 0xE0,
+	0xFC, 0x00, 0x03, 0x07, 0xFF, 0xFF, 0xFC, 0xEF, 0x00, 0x03, 0x0F, 0xFF,
+	0xFF, 0xFE, 0xFC, 0x00, 0x03, 0x7F, 0xFF, 0xFF, 0xF0, 0xEF, 0x00, 0x00,
+	0x03, 0xFE, 0xFF, 0x00, 0xF8, 0xFE, 0x00, 0x00, 0x1F, 0xFE, 0xFF, 0x00,
+	0xC0, 0xEE, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0x00, 0xFE, 0xED, 0x00, 0x00,
+	0x1F, 0xF8, 0xFF, 0x00, 0xF8, 0xED, 0x00, 0x00, 0x03, 0xF8, 0xFF, 0x00,
+	0xC0, 0xEC, 0x00, 0x00, 0x7F, 0xFA, 0xFF, 0x00, 0xFE, 0xEB, 0x00, 0x00,
+	0x07, 0xFA, 0xFF, 0x00, 0xE0, 0xEA, 0x00, 0xFA, 0xFF, 0xE9, 0x00, 0x00,
+	0x0F, 0xFC, 0xFF, 0x00, 0xF0, 0xE8, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0x00,
+	0xFC, 0xE6, 0x00, 0x02, 0x7F, 0xFF, 0xFE, 0x81, 0x00, 0xB9, 0x00};
+const epd_image_t worried_air = {worried_air_data, 3107, 248, 248};
+
+/** rak_img 184 x 56, 1288 bytes packed to 993 bytes */
+static const uint8_t rak_img_data[] = {
+	0xFD, 0x00, 0x00, 0xF8, 0xEC, 0x00, 0x01, 0x0F, 0xFF, 0xEC, 0x00, 0x02,
+	0x7F, 0xFF, 0x80, 0xEE, 0x00, 0x03, 0x01, 0xFF, 0xFF, 0x80, 0xEE, 0x00,
+	0x03, 0x07, 0xFF, 0xFF, 0x80, 0xEE, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0x80,
+	0xEE, 0x00, 0x02, 0x3F, 0xFF, 0xFF, 0xED, 0x00, 0x02, 0x7F, 0xFF, 0xC2,
+	0xED, 0x00, 0x01, 0xFF, 0xF8, 0xEC, 0x00, 0x02, 0xFF, 0xE3, 0xFF, 0xFE,
+	0x00, 0x00, 0x01, 0xFE, 0xFF, 0x13, 0x80, 0x00, 0x00, 0x7F, 0xC0, 0x00,
+	0x1F, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0x80, 0x00,
+	0x00, 0x03, 0xFE, 0xFF, 0x13, 0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F,
+	0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x03, 0xFF, 0x3F, 0xFF, 0x80, 0x00, 0x00,
+	0x03, 0xFE, 0xFF, 0x13, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x1F, 0xF0,
+	0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x03,
+	0xFE, 0xFF, 0x13, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x1F, 0xF0, 0x00,
+	0xFF, 0xE0, 0x00, 0x07, 0xF9, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x03, 0xFE,
+	0xFF, 0x13, 0xFC, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x03, 0xFF,
+	0xC0, 0x00, 0x07, 0xF3, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x03, 0xFE, 0xFF,
+	0x13, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x07, 0xFF, 0x80,
+	0x00, 0x01, 0xE1, 0xFE, 0x07, 0x3F, 0xC0, 0x00, 0x03, 0xFE, 0xFF, 0x66,
+	0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x1F, 0xF0, 0x0F, 0xFF, 0x00, 0x00,
+	0x1C, 0x44, 0x40, 0xF0, 0x7F, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF,
+	0x00, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x1F, 0xFE, 0x00, 0x3C, 0x7F,
+	0x1F, 0x1F, 0xFF, 0x3F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00,
+	0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xF0, 0x3F, 0xFC, 0x00, 0x7F, 0x7F, 0xBF,
+	0xBF, 0xFF, 0x9F, 0xF8, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x07,
+	0xFF, 0xFC, 0x00, 0x1F, 0xF0, 0x7F, 0xF8, 0x00, 0x7F, 0x3F, 0x7F, 0xDF,
+	0xFF, 0x8F, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFB,
+	0xFC, 0x00, 0x1F, 0xF0, 0xFF, 0xF0, 0x00, 0xFE, 0x7F, 0x7F, 0xDF, 0xFF,
+	0x87, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xFB, 0xFE,
+	0x00, 0x1F, 0xF1, 0xFF, 0xC0, 0x00, 0xFE, 0x7F, 0x7F, 0xDF, 0xFF, 0x93,
+	0xFE, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF3, 0xFE, 0x00,
+	0x1F, 0xF3, 0xFF, 0x80, 0x00, 0xFE, 0x7F, 0x7F, 0xDF, 0xFF, 0xB9, 0xFF,
+	0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xF1, 0xFE, 0x00, 0x1F,
+	0xE7, 0xFF, 0x00, 0x00, 0xFF, 0x7F, 0x7F, 0xDF, 0xFE, 0x3C, 0xFF, 0x00,
+	0x03, 0xFE, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xE1, 0xFF, 0x00, 0x1F, 0xEF,
+	0xFE, 0x00, 0x00, 0xFF, 0x7F, 0x7F, 0xC0, 0x00, 0x7C, 0xFF, 0x80, 0x03,
+	0xFE, 0x00, 0x03, 0xFE, 0x00, 0x1F, 0xE1, 0xFF, 0x80, 0x1F, 0xFF, 0xFE,
+	0x00, 0x00, 0xFF, 0x7F, 0x7F, 0xC0, 0x01, 0xBE, 0xFF, 0x80, 0x03, 0xFE,
+	0x00, 0x0F, 0xFC, 0x00, 0x3F, 0xE1, 0x0F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0x7F, 0x7F, 0xC0, 0x7F, 0xBF, 0x7F, 0xC0, 0x03, 0xFE,
+	0xFF, 0x13, 0xFC, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80,
+	0x00, 0x7F, 0xBF, 0x7F, 0xC0, 0x7F, 0xBF, 0x3F, 0xC0, 0x03, 0xFE, 0xFF,
+	0x13, 0xF8, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x80, 0x00,
+	0x7F, 0xBF, 0x3F, 0xC0, 0x7F, 0x9F, 0x3F, 0xC0, 0x03, 0xFE, 0xFF, 0x13,
+	0xE0, 0x00, 0x7F, 0x80, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x3F,
+	0x9F, 0xBF, 0xC0, 0x7F, 0x9F, 0xBF, 0xC0, 0x03, 0xFE, 0xFF, 0x13, 0xC0,
+	0x00, 0xFF, 0x80, 0x7F, 0xC0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xCF,
+	0xB0, 0x00, 0x7F, 0x9F, 0x9F, 0xE0, 0x03, 0xFE, 0xFF, 0x13, 0xF8, 0x00,
+	0x7F, 0x80, 0x3F, 0xE0, 0x1F, 0xFF, 0x7F, 0xE0, 0x00, 0x3F, 0xCF, 0xC0,
+	0x00, 0x7F, 0x9F, 0x9F, 0xE0, 0x03, 0xFE, 0xFF, 0x2F, 0xFC, 0x00, 0xFF,
+	0x00, 0x3F, 0xE0, 0x1F, 0xFE, 0x3F, 0xF0, 0x00, 0x1F, 0xE7, 0x9F, 0xFF,
+	0x7F, 0x9F, 0x9F, 0xE0, 0x03, 0xFE, 0x00, 0x3F, 0xFC, 0x01, 0xFF, 0x40,
+	0x3F, 0xE0, 0x1F, 0xFC, 0x3F, 0xF8, 0x00, 0x1F, 0xF3, 0x3F, 0xFF, 0x7F,
+	0x9F, 0x9F, 0xE0, 0x03, 0xFE, 0x00, 0x0F, 0xFC, 0x01, 0xFE, 0xFF, 0x13,
+	0xF0, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x0F, 0xFB, 0x7F, 0xFF, 0x7F, 0x9F,
+	0x9F, 0xE0, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x01, 0xFE, 0xFF, 0x13, 0xF0,
+	0x1F, 0xF0, 0x1F, 0xFE, 0x00, 0x0F, 0xFC, 0x7F, 0xFF, 0x7F, 0x9F, 0x9F,
+	0xC0, 0x03, 0xFE, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0xFF, 0x13, 0xF0, 0x1F,
+	0xE0, 0x0F, 0xFE, 0x00, 0x07, 0xFE, 0x7F, 0xFF, 0x3F, 0xBF, 0x9F, 0xC0,
+	0x03, 0xFE, 0x00, 0x01, 0xFE, 0x03, 0xFE, 0xFF, 0x13, 0xF8, 0x1F, 0xF0,
+	0x07, 0xFF, 0x00, 0x03, 0xFF, 0x7F, 0xFF, 0xBF, 0xBF, 0x9F, 0xC0, 0x03,
+	0xFE, 0x00, 0x01, 0xFE, 0x07, 0xFE, 0xFF, 0x13, 0xF8, 0x1F, 0xF0, 0x03,
+	0xFF, 0x80, 0x01, 0xFF, 0x1F, 0xFF, 0x1F, 0x9F, 0x87, 0x00, 0x03, 0xFE,
+	0x00, 0x01, 0xFE, 0x07, 0xFE, 0xFF, 0x7F, 0xF8, 0x1F, 0xF0, 0x03, 0xFF,
+	0xC0, 0x00, 0xFF, 0xC3, 0xE0, 0x46, 0x47, 0x00, 0x00, 0x03, 0xFE, 0x00,
+	0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x07, 0xFC, 0x1F, 0xF0, 0x01, 0xFF, 0xC0,
+	0x00, 0x7F, 0x38, 0x0F, 0xF0, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01,
+	0xFF, 0x07, 0xF8, 0x00, 0x07, 0xFE, 0x1F, 0xF0, 0x00, 0xFF, 0xE0, 0x00,
+	0x1F, 0x7F, 0xFF, 0xF9, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF,
+	0x0F, 0xF8, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0x07,
+	0x7F, 0xFF, 0xF3, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x1F,
+	0xF8, 0x00, 0x03, 0xFE, 0x1F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x01, 0x7F,
+	0xFF, 0xE7, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x01, 0xFF, 0x1F, 0xF0,
+	0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
+	0x9F, 0xF0, 0x00, 0x3D, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x1F, 0xF0,
+	0x00, 0x01, 0xFF, 0x1F, 0xF0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0xFE,
+	0x3F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFF, 0x3F, 0xE0, 0x00,
+	0x01, 0xFF, 0x1F, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xF8, 0xFF,
+	0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF, 0xBF, 0xE0, 0x00, 0x00,
+	0xFF, 0xBF, 0xF0, 0x00, 0x0F, 0xFE, 0xFE, 0x00, 0x06, 0x07, 0xFF, 0xC0,
+	0x00, 0x00, 0x01, 0x68, 0xFE, 0x00, 0x00, 0x20, 0xF5, 0x00, 0x02, 0x3F,
+	0xFF, 0xC0, 0xEE, 0x00, 0x03, 0x1F, 0xFF, 0xFF, 0x80, 0xEE, 0x00, 0x02,
+	0x3F, 0xFF, 0xFE, 0xED, 0x00, 0x02, 0x7F, 0xFF, 0xFC, 0xED, 0x00, 0x02,
+	0x7F, 0xFF, 0xF0, 0xED, 0x00, 0x02, 0x3F, 0xFF, 0xC0, 0xED, 0x00, 0x01,
+	0x1F, 0xFE, 0xEC, 0x00, 0x01, 0x07, 0xF0, 0xEE, 0x00};
+const epd_image_t rak_img = {rak_img_data, 993, 184, 56};
+
+/** celsius_img 32 x 32, 128 bytes packed to 126 bytes */
+static const uint8_t celsius_img_data[] = {
+	0x01, 0x00, 0x06, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x71, 0x1F, 0x80,
+	0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x19, 0x80,
+	0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0x19, 0x80,
+	0x00, 0x00, 0x19, 0x80, 0x00, 0x0F, 0x99, 0x80, 0x00, 0x00, 0x19, 0x80,
+	0x00, 0x01, 0x99, 0x80, 0x00, 0x01, 0x99, 0x80, 0x00, 0x00, 0x19, 0x8F,
+	0x38, 0x07, 0x99, 0x89, 0x38, 0x00, 0x19, 0x99, 0x80, 0x00, 0x19, 0x98,
+	0x00, 0x03, 0x99, 0x98, 0x00, 0x00, 0x19, 0x98, 0x00, 0x00, 0x99, 0x99,
+	0x80, 0x00, 0x99, 0x89, 0x00, 0x07, 0x99, 0x8F, 0x00, 0x0F, 0x99, 0x80,
+	0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x30, 0xC0,
+	0x00, 0x00, 0x30, 0xC0, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x3F, 0xC0,
+	0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00};
+const epd_image_t celsius_img = {celsius_img_data, 126, 32, 32};
+
+/** humidity_img 32 x 32, 128 bytes packed to 129 bytes */
+static const uint8_t humidity_img_data[] = {
+	0x7F, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x03, 0xC0,
+	0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x0C, 0x30,
+	0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x38, 0x1C, 0x00, 0x00, 0x70, 0x0E,
+	0x00, 0x00, 0x60, 0x06, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x01, 0x80, 0x01,
+	0x80, 0x01, 0x9E, 0x01, 0x80, 0x03, 0x3F, 0x00, 0xC0, 0x07, 0x33, 0x0C,
+	0xE0, 0x06, 0x33, 0x1C, 0x60, 0x06, 0x3F, 0x38, 0x60, 0x0C, 0x1E, 0x70,
+	0x30, 0x0C, 0x00, 0xE0, 0x30, 0x0C, 0x01, 0xC0, 0x30, 0x0C, 0x03, 0x80,
+	0x30, 0x0C, 0x07, 0x00, 0x30, 0x0C, 0x0E, 0x78, 0x30, 0x06, 0x1C, 0xFC,
+	0x60, 0x06, 0x38, 0xCC, 0x60, 0x07, 0x30, 0xCC, 0xE0, 0x03, 0x00, 0xF8,
+	0xC0, 0x01, 0x80, 0x71, 0x80, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x78, 0x1E,
+	0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x07, 0xE0, 0x00};
+const epd_image_t humidity_img = {humidity_img_data, 129, 32, 32};
+
+/** co2_img 32 x 32, 128 bytes packed to 94 bytes */
+static const uint8_t co2_img_data[] = {
+	0xDC, 0x00, 0x5A, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x70,
+	0x1C, 0x00, 0x00, 0x60, 0x0E, 0x00, 0x00, 0xC0, 0x06, 0x00, 0x00, 0xC0,
+	0x03, 0x00, 0x01, 0x80, 0x03, 0x80, 0x01, 0x80, 0x03, 0xF0, 0x01, 0x80,
+	0x00, 0x38, 0x1F, 0x80, 0x00, 0x0C, 0x3C, 0x9C, 0x38, 0x06, 0x70, 0x3F,
+	0x7E, 0x02, 0x60, 0x20, 0x46, 0x03, 0xC0, 0x60, 0xC2, 0x03, 0xC0, 0x60,
+	0xC2, 0x03, 0xC0, 0x32, 0x66, 0x03, 0xC0, 0x1E, 0x7C, 0xC3, 0xC0, 0x00,
+	0x00, 0x86, 0x60, 0x00, 0x00, 0xC6, 0x70, 0x00, 0x00, 0x1C, 0x3F, 0xFF,
+	0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80};
+const epd_image_t co2_img = {co2_img_data, 94, 32, 32};
+
+/** barometer_img 32 x 32, 128 bytes packed to 129 bytes */
+static const uint8_t barometer_img_data[] = {
+	0x7F, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0xF0, 0x0F,
+	0x00, 0x03, 0x80, 0x01, 0xC0, 0x07, 0x0F, 0xF0, 0xE0, 0x0C, 0x3F, 0xFC,
+	0x30, 0x18, 0xF1, 0x8F, 0x18, 0x19, 0xC0, 0x03, 0x98, 0x33, 0xC0, 0x03,
+	0xCC, 0x63, 0xC1, 0x83, 0xC6, 0x66, 0x01, 0x80, 0x66, 0x66, 0x01, 0x80,
+	0x66, 0x4C, 0x01, 0x80, 0x32, 0xCC, 0x01, 0x80, 0x33, 0xCC, 0x03, 0xC0,
+	0x33, 0xCF, 0x06, 0x60, 0xF3, 0xCF, 0x06, 0x60, 0xF3, 0xCC, 0x03, 0xC0,
+	0x33, 0xCC, 0x03, 0xC0, 0x33, 0x4C, 0x06, 0x60, 0x32, 0x66, 0x07, 0xE0,
+	0x66, 0x66, 0x03, 0xC0, 0x66, 0x63, 0xC0, 0x03, 0xC6, 0x33, 0xC0, 0x03,
+	0xCC, 0x19, 0x9B, 0x71, 0x98, 0x18, 0x1B, 0x58, 0x18, 0x0C, 0x1D, 0x70,
+	0x30, 0x07, 0x15, 0x58, 0xE0, 0x03, 0x85, 0x61, 0xC0, 0x00, 0xE0, 0x07,
+	0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xE0, 0x00};
+const epd_image_t barometer_img = {barometer_img_data, 129, 32, 32};
+
+/** voc_img 32 x 32, 128 bytes packed to 129 bytes */
+static const uint8_t voc_img_data[] = {
+	0x7F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0E, 0x70, 0x00, 0x00, 0x1C, 0x39,
+	0xF0, 0x00, 0x30, 0x0F, 0x30, 0x00, 0xE3, 0xC7, 0x30, 0x01, 0x8F, 0x71,
+	0xB0, 0x07, 0x1E, 0x38, 0xF0, 0x0E, 0x38, 0x1E, 0x70, 0x18, 0xF0, 0x07,
+	0x18, 0x71, 0xC0, 0x03, 0xCE, 0xE3, 0x80, 0x01, 0xE7, 0x8E, 0x00, 0x00,
+	0x79, 0x9C, 0x00, 0x00, 0x1D, 0xF8, 0x07, 0x80, 0x17, 0x08, 0x0C, 0x80,
+	0x10, 0x08, 0x08, 0x5C, 0x10, 0x08, 0x00, 0xB2, 0x10, 0x08, 0xFF, 0xA2,
+	0x10, 0x08, 0x00, 0x02, 0x10, 0x08, 0xFF, 0xFE, 0x10, 0x08, 0x00, 0x00,
+	0x10, 0x08, 0x7F, 0xE0, 0x10, 0x08, 0x00, 0x18, 0x10, 0x08, 0x00, 0x08,
+	0x10, 0x08, 0x00, 0x88, 0x10, 0x08, 0x00, 0xD8, 0x10, 0x08, 0x00, 0x30,
+	0x10, 0x08, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00,
+	0x10, 0x08, 0x00, 0x00, 0x10, 0x07, 0xFF, 0xFF, 0xF0};
+const epd_image_t voc_img = {voc_img_data, 129, 32, 32};
+
+/** pm_img 32 x 32, 128 bytes packed to 114 bytes */
+static const uint8_t pm_img_data[] = {
+	0xF0, 0x00, 0x6E, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1C,
+	0x38, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x61,
+	0x86, 0x00, 0x00, 0x63, 0xC6, 0x00, 0x00, 0x63, 0xC6, 0x00, 0x00, 0xE1,
+	0x87, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x18, 0x18, 0xC0, 0x03, 0x3C,
+	0x3C, 0xC0, 0x0F, 0x3C, 0x3C, 0xF0, 0x1C, 0x18, 0x18, 0x38, 0x18, 0x00,
+	0x00, 0x18, 0x31, 0x81, 0x81, 0x8C, 0x33, 0xC3, 0xC3, 0xCC, 0x33, 0xC3,
+	0xC3, 0xCC, 0x31, 0x81, 0x81, 0x8C, 0x18, 0x00, 0x00, 0x18, 0x1C, 0x18,
+	0x18, 0x38, 0x0F, 0x3C, 0x3C, 0xF0, 0x03, 0x3C, 0x3C, 0xC0, 0x03, 0x18,
+	0x18, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x01, 0x84, 0x21, 0x80, 0x00, 0xFF,
+	0xFF, 0x00, 0x00, 0x7B, 0xDE, 0x00};
+const epd_image_t pm_img = {pm_img_data, 114, 32, 32};
+
+/** built_img 126 x 66, 1056 bytes packed to 711 bytes */
+static const uint8_t built_img_data[] = {
+	0xCF, 0x00, 0xFF, 0xFF, 0x02, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0x07, 0x00,
+	0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0xFF, 0x01, 0x00, 0x07,
+	0xFE, 0xFF, 0x07, 0x80, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFE,
+	0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC,
+	0x00, 0x00, 0x03, 0xFE, 0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x01, 0x80, 0x0F,
+	0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE,
+	0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC,
+	0x00, 0x00, 0x03, 0xFE, 0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x01, 0x80, 0x0F,
+	0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFE,
+	0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFC,
+	0x00, 0x00, 0x07, 0xFE, 0xFF, 0x01, 0xC0, 0x1F, 0xFE, 0xFF, 0x06, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xF8, 0xFF, 0x06, 0xE0, 0x1F, 0xFF,
+	0xFF, 0xFC, 0x00, 0x3F, 0xF4, 0xFF, 0x02, 0xFE, 0x00, 0x3F, 0xF3, 0xFF,
+	0x01, 0xF0, 0x7F, 0xF3, 0xFF, 0x01, 0xFC, 0x7F, 0xF3, 0xFF, 0x01, 0xFC,
+	0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3,
+	0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01,
+	0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F,
+	0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF,
+	0x0B, 0xFE, 0x7F, 0xFF, 0xC1, 0xFF, 0xED, 0xFF, 0xFF, 0xFB, 0xFB, 0xFE,
+	0x0F, 0xFD, 0xFF, 0x7F, 0xFE, 0x7F, 0xFF, 0xC0, 0x7F, 0xEC, 0xDF, 0xFF,
+	0xFB, 0x33, 0xFE, 0x07, 0xCF, 0x39, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xDF,
+	0x7F, 0xFC, 0xCF, 0xFF, 0xFF, 0x33, 0xFE, 0x73, 0x8F, 0x33, 0xBF, 0xFF,
+	0xFE, 0x7F, 0xFF, 0xDE, 0x6E, 0x6C, 0x87, 0xCD, 0xDA, 0x10, 0x3E, 0x73,
+	0x87, 0x27, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xC0, 0xEE, 0x6C, 0xDF, 0xC8,
+	0x9B, 0x33, 0x3E, 0x43, 0x37, 0x0F, 0xF0, 0xFF, 0xFE, 0x7F, 0xFF, 0xDE,
+	0x6E, 0x6C, 0xDF, 0xEA, 0xBB, 0x3B, 0xBE, 0x07, 0x33, 0x07, 0xE7, 0xFF,
+	0xFE, 0x7F, 0xFF, 0xDF, 0x6E, 0x6C, 0xDF, 0xEA, 0xBB, 0x3B, 0xBE, 0x63,
+	0x03, 0x23, 0xF1, 0xFF, 0xFE, 0x7F, 0xFF, 0xDE, 0x6E, 0x6C, 0xDF, 0xE2,
+	0x3B, 0x3B, 0xBE, 0x72, 0x03, 0x33, 0xFE, 0x7F, 0xFE, 0x7F, 0xFF, 0xC0,
+	0xE0, 0x6C, 0xC7, 0xF3, 0x7B, 0x13, 0xBE, 0x72, 0x79, 0x31, 0xE7, 0x7F,
+	0x01, 0xFE, 0x7F, 0xF9, 0xFF, 0x07, 0xFE, 0x72, 0x79, 0x38, 0xF0, 0xFF,
+	0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F,
+	0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x02, 0xFE, 0x7F, 0xFF, 0xFD,
+	0x00, 0x00, 0x1F, 0xF9, 0xFF, 0x02, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00,
+	0x1F, 0xF9, 0xFF, 0x02, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xF9,
+	0xFF, 0x7F, 0xFE, 0x7F, 0xFF, 0x1C, 0x38, 0x30, 0x00, 0x18, 0x03, 0xE3,
+	0xFC, 0x07, 0xF0, 0x71, 0xE1, 0xFF, 0xFE, 0x7F, 0xFF, 0x1C, 0x38, 0x77,
+	0x00, 0x18, 0x03, 0xE3, 0xF8, 0x03, 0xC0, 0x11, 0xC3, 0xFF, 0xFE, 0x7F,
+	0xFF, 0x1C, 0x3C, 0x77, 0x00, 0x18, 0xF3, 0xE3, 0xF8, 0xF1, 0xC7, 0x11,
+	0x87, 0xFF, 0xFE, 0x7F, 0xFF, 0x0C, 0x7C, 0x70, 0x1C, 0x18, 0xF3, 0xE3,
+	0xF1, 0xF8, 0x8F, 0x91, 0x8F, 0xFF, 0xFE, 0x7F, 0xFF, 0x0E, 0x7C, 0x67,
+	0x7F, 0x18, 0xF3, 0xE3, 0xF1, 0xF8, 0x8F, 0xF1, 0x1F, 0xFF, 0xFE, 0x7F,
+	0xFF, 0x0E, 0x6C, 0xE6, 0x63, 0x98, 0x00, 0x63, 0xF3, 0xFC, 0x9F, 0xF0,
+	0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0x0E, 0x6E, 0xE6, 0xE1, 0x18, 0x00, 0x63,
+	0xF3, 0xFC, 0x9F, 0xF0, 0x1F, 0xFF, 0xFE, 0x7F, 0xFF, 0x06, 0xEE, 0xC6,
+	0x7C, 0x18, 0x00, 0x63, 0xF3, 0xFC, 0x9F, 0xF0, 0x0F, 0xFF, 0x52, 0xFE,
+	0x7F, 0xFF, 0x07, 0xC7, 0xC6, 0x3F, 0x18, 0xFE, 0x63, 0xF1, 0xFC, 0x8F,
+	0xF1, 0x8F, 0xFF, 0xFE, 0x7F, 0xFF, 0x07, 0xC7, 0xC6, 0x07, 0x98, 0xFE,
+	0x63, 0xF1, 0xF8, 0x8F, 0x91, 0xC7, 0xFF, 0xFE, 0x7F, 0xFF, 0x07, 0xC7,
+	0xC6, 0xC3, 0x98, 0xFE, 0x63, 0xF8, 0xF1, 0xC7, 0x11, 0xE3, 0xFF, 0xFE,
+	0x7F, 0xFF, 0x03, 0xC7, 0x86, 0xE3, 0x98, 0x00, 0x60, 0x08, 0x01, 0xC0,
+	0x11, 0xE1, 0xFF, 0xFE, 0x7F, 0xFF, 0x03, 0x83, 0x86, 0x7F, 0x18, 0x00,
+	0x60, 0x0E, 0x07, 0xF0, 0x71, 0xF1, 0xFF, 0xFE, 0x7F, 0xFF, 0xFD, 0x00,
+	0x00, 0x1F, 0xF9, 0xFF, 0x02, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x1F,
+	0xF9, 0xFF, 0x02, 0xFE, 0x7F, 0xFF, 0xFD, 0x00, 0x00, 0x1F, 0xF9, 0xFF,
+	0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE,
+	0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3,
+	0xFF, 0x00, 0xFE};
+const epd_image_t built_img = {built_img_data, 711, 126, 66};
+
+/** wisblock_img 128 x 72, 1152 bytes packed to 655 bytes */
+static const uint8_t wisblock_img_data[] = {
+	0x06, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0xFF, 0x07, 0x00,
+	0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x01, 0x00, 0x07,
+	0xFE, 0xFF, 0x07, 0x80, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFE,
+	0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE,
+	0x00, 0x00, 0x07, 0xFE, 0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x01, 0x80, 0x0F,
+	0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE,
+	0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE,
+	0x00, 0x00, 0x07, 0xFE, 0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0xFF, 0x01, 0x80, 0x0F,
+	0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFE,
+	0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE,
+	0x00, 0x00, 0x07, 0xFE, 0xFF, 0x01, 0x80, 0x0F, 0xFE, 0xFF, 0x07, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0x01, 0xC0, 0x1F,
+	0xFE, 0xFF, 0x06, 0xC0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xF8, 0xFF,
+	0x06, 0xE0, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xF3, 0xFF, 0x01, 0x00,
+	0x7F, 0xF3, 0xFF, 0x00, 0xF8, 0xF2, 0xFF, 0x00, 0xFE, 0xF2, 0xFF, 0x00,
+	0xFE, 0x81, 0xFF, 0xCF, 0xFF, 0x00, 0x83, 0xFD, 0xFF, 0xFF, 0xFB, 0x01,
+	0xFE, 0x0F, 0xFA, 0xFF, 0x0B, 0x80, 0xFF, 0xCD, 0xFF, 0xFF, 0xFB, 0x3B,
+	0xFE, 0x07, 0xEF, 0xBD, 0xDF, 0xFD, 0xFF, 0x0B, 0xBE, 0xFF, 0xFC, 0xDF,
+	0xFF, 0xFF, 0x33, 0xFE, 0x73, 0xCF, 0x99, 0xDF, 0xFD, 0xFF, 0x0B, 0xBE,
+	0xFF, 0xFD, 0x8F, 0xFF, 0xFF, 0x33, 0xFE, 0x7B, 0x87, 0xB3, 0xDF, 0xFD,
+	0xFF, 0x0B, 0xBC, 0xCE, 0xCD, 0x87, 0xCD, 0xDA, 0x10, 0x3E, 0x73, 0x97,
+	0xB7, 0xDF, 0xFD, 0xFF, 0x0C, 0x81, 0xDE, 0xED, 0xDF, 0xC8, 0x9B, 0x33,
+	0xBE, 0x43, 0x3B, 0x8F, 0xF8, 0x7F, 0xFE, 0xFF, 0x0B, 0xBE, 0xDE, 0xCD,
+	0xDF, 0xEA, 0xBB, 0x3B, 0xBE, 0x07, 0xBB, 0x83, 0xF3, 0xFD, 0xFF, 0x0B,
+	0xBE, 0xDE, 0xCD, 0xDF, 0xEA, 0xBB, 0x3B, 0xBE, 0x73, 0x03, 0xB1, 0xF8,
+	0xFD, 0xFF, 0x0C, 0xBC, 0xDE, 0xCD, 0xDF, 0xE2, 0x3B, 0x3B, 0xBE, 0x7B,
+	0x03, 0xBB, 0xFF, 0x3F, 0xFE, 0xFF, 0x0C, 0x81, 0xC0, 0xCC, 0xC7, 0xF3,
+	0x7B, 0x13, 0xBE, 0x73, 0x7D, 0xB9, 0xF3, 0xBF, 0xF7, 0xFF, 0x05, 0xFE,
+	0x73, 0x7D, 0xBC, 0x78, 0x7F, 0xAF, 0xFF, 0x00, 0xFE, 0xFD, 0x00, 0x00,
+	0x1F, 0xF7, 0xFF, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00,
+	0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x0C, 0xFE, 0x3C, 0x78, 0x70,
+	0x00, 0x18, 0x03, 0xE3, 0xFC, 0x07, 0xF8, 0x78, 0xF0, 0xFE, 0xFF, 0x0C,
+	0xFE, 0x38, 0x78, 0xF7, 0x00, 0x18, 0x03, 0xE3, 0xF8, 0x03, 0xC0, 0x19,
+	0xE1, 0xFE, 0xFF, 0x0C, 0xFE, 0x38, 0x7C, 0xF7, 0x00, 0x18, 0xF3, 0xE3,
+	0xF8, 0xF1, 0xE7, 0x98, 0xC3, 0xFE, 0xFF, 0x0C, 0xFE, 0x18, 0xFC, 0xF0,
+	0x1C, 0x18, 0xF3, 0xE3, 0xF1, 0xF8, 0xCF, 0xD8, 0xC7, 0xFE, 0xFF, 0x0C,
+	0xFE, 0x1C, 0xFC, 0xEF, 0x7F, 0x18, 0xF3, 0xE3, 0xF1, 0xF8, 0xCF, 0xF9,
+	0x8F, 0xFE, 0xFF, 0x0C, 0xFE, 0x1E, 0xD9, 0xEE, 0x67, 0x98, 0x00, 0x63,
+	0xF3, 0xFC, 0xDF, 0xF8, 0x1F, 0xFE, 0xFF, 0x0C, 0xFE, 0x1E, 0xCD, 0xEE,
+	0xE3, 0x98, 0x00, 0x63, 0xF3, 0xFE, 0xDF, 0xF8, 0x1F, 0xFE, 0xFF, 0x0C,
+	0xFE, 0x1C, 0xDC, 0xCE, 0xF9, 0x18, 0x00, 0x63, 0xF3, 0xFC, 0xDF, 0xF8,
+	0x0F, 0xFE, 0xFF, 0x0C, 0xFE, 0x0F, 0xCF, 0xCE, 0x7E, 0x18, 0xFE, 0x63,
+	0xF3, 0xFE, 0xDF, 0xF8, 0x87, 0xFE, 0xFF, 0x0C, 0xFE, 0x0F, 0x8F, 0xCE,
+	0x3F, 0x18, 0xFE, 0x63, 0xF1, 0xFC, 0xCF, 0xF9, 0xC7, 0xFE, 0xFF, 0x0C,
+	0xFE, 0x0F, 0xCF, 0xCE, 0x07, 0x98, 0xFE, 0x63, 0xF1, 0xF8, 0xCF, 0xD8,
+	0xE3, 0xFE, 0xFF, 0x0C, 0xFE, 0x0F, 0xCF, 0xCE, 0xC3, 0x98, 0xFE, 0x63,
+	0xF8, 0xF1, 0xE7, 0x99, 0xF1, 0xFE, 0xFF, 0x0C, 0xFE, 0x07, 0xCF, 0x8E,
+	0xE3, 0x98, 0x00, 0x60, 0x08, 0x01, 0xE0, 0x18, 0xF0, 0xFE, 0xFF, 0x0C,
+	0xFE, 0x07, 0x87, 0x8E, 0xFF, 0x18, 0x00, 0x60, 0x0E, 0x07, 0xF8, 0x78,
+	0xF8, 0xFE, 0xFF, 0x00, 0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00,
+	0xFE, 0xFD, 0x00, 0x00, 0x1F, 0xF7, 0xFF, 0x00, 0xFE, 0xFD, 0x00, 0x00,
+	0x1F, 0x98, 0xFF, 0x00, 0x7F, 0xF3, 0xFF, 0x01, 0xFE, 0x7F, 0xF3, 0xFF,
+	0x01, 0xFE, 0x1F, 0xF3, 0xFF, 0x00, 0xF8};
+const epd_image_t wisblock_img = {wisblock_img_data, 655, 128, 72};
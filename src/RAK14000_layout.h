@@ -0,0 +1,122 @@
+/**
+ * @file RAK14000_layout.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Positions of the values and graphs on the EPD
+ *        The layout is calculated at compile time from the display size,
+ *        rak14000_layout selects the layout of the display in use.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RAK14000_LAYOUT_H
+#define RAK14000_LAYOUT_H
+
+#include <stdint.h>
+
+/** Position of a sensor value */
+typedef struct epd_text_pos_s
+{
+	int16_t x;		// Left side of the icon
+	int16_t y;		// Top of the icon
+	uint8_t size;	// Text size, 1 = small font, 2 = large font
+	int16_t spacer; // Offset of the value from the icon or the second column
+} epd_text_pos_t;
+
+/** Position of a graph */
+typedef struct epd_graph_pos_s
+{
+	int16_t x;	   // Left side
+	int16_t y;	   // Top
+	int16_t w;	   // Width
+	int16_t h;	   // Height
+	int16_t w_bar; // Distance of the columns
+	float divider; // Value per pixel, 0 if the scale depends on the values
+} epd_graph_pos_t;
+
+/**
+ * @brief Layout of the UIs for a display size
+ *
+ * @tparam W display width in landscape orientation
+ * @tparam H display height in landscape orientation
+ */
+template <uint16_t W, uint16_t H>
+struct epd_layout
+{
+	static constexpr uint16_t width = W;
+	static constexpr uint16_t height = H;
+
+	/** VOC value, top left */
+	static constexpr epd_text_pos_t voc(void)
+	{
+		return {2, 10, 2, 0};
+	}
+
+	/** VOC graph below the VOC value, 0 to 500 */
+	static constexpr epd_graph_pos_t voc_graph(void)
+	{
+		return {0, 60, W / 2, H / 2 - 60, 2, 500.0f / (H / 2 - 60)};
+	}
+
+	/** CO2 value, top right with PM sensor, else in the lower left half */
+	static constexpr epd_text_pos_t co2(bool has_pm)
+	{
+		return has_pm ? epd_text_pos_t{W / 2 + 53, 15, 2, 20} : epd_text_pos_t{2, H / 2, 2, 0};
+	}
+
+	/** CO2 graph below the CO2 value, only without PM sensor */
+	static constexpr epd_graph_pos_t co2_graph(void)
+	{
+		return {0, H / 2 + 60, W / 2, H / 2 - 62, 2, 0};
+	}
+
+	/** PM values, right side */
+	static constexpr epd_text_pos_t pm(void)
+	{
+		return {W / 2 + 53, H / 4, 2, 0};
+	}
+
+	/** Temperature, lower left with PM sensor, else top right */
+	static constexpr epd_text_pos_t temp(bool has_pm, bool has_baro)
+	{
+		return !has_pm ? epd_text_pos_t{W / 2 + 53, 12, 2, 50}
+			   : has_baro ? epd_text_pos_t{25, H / 2 + 10, 2, 60}
+						  : epd_text_pos_t{25, H / 4 + 105, 2, 60};
+	}
+
+	/** Humidity, lower left with PM sensor, else middle right */
+	static constexpr epd_text_pos_t humid(bool has_pm, bool has_baro)
+	{
+		return !has_pm ? epd_text_pos_t{W / 2 + 53, H / 3 + 15, 2, 50}
+			   : has_baro ? epd_text_pos_t{25, H / 2 + (H / 2 / 3) + 10, 2, 60}
+						  : epd_text_pos_t{25, (H / 4) + 165, 2, 60};
+	}
+
+	/** Barometric pressure, lower left with PM sensor, else bottom right */
+	static constexpr epd_text_pos_t baro(bool has_pm)
+	{
+		return !has_pm ? epd_text_pos_t{W / 2 + 53, H / 3 * 2 + 15, 2, 50}
+					   : epd_text_pos_t{25, H / 2 + (H / 2 / 3 * 2) + 10, 2, 60};
+	}
+
+	/** First line of the values in the icon UI */
+	static constexpr epd_text_pos_t icon(void)
+	{
+		return {250, 35, 1, 0};
+	}
+
+	/** First line of the status UI, spacer is the value column */
+	static constexpr epd_text_pos_t status(bool lorawan)
+	{
+		return {10, 15, 1, (int16_t)(lorawan ? 125 : 150)};
+	}
+};
+
+#if HAS_EPD == 4
+typedef epd_layout<360, 240> rak14000_layout;
+#else
+typedef epd_layout<400, 300> rak14000_layout;
+#endif
+
+#endif // RAK14000_LAYOUT_H
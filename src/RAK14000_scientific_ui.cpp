@@ -15,35 +15,378 @@
 
 #include "RAK14000_epd.h"
 
-void scientific_rak14000(void)
+/**
+ * @brief Draw hourly or daily rollups as bars
+ *     The bar is filled up to the mean value, the frame above
+ *     shows the range between min and max.
+ *
+ * @param rollups hours() or days() of a sensor history
+ * @param offset value at the bottom of the graph
+ * @param pos position of the graph
+ * @param divider value per pixel
+ */
+template <class R>
+static void draw_rollups(const R &rollups, float offset, const epd_graph_pos_t &pos, float divider)
+{
+	uint16_t w_period = pos.w / R::capacity();
+
+	for (uint8_t idx = 0; idx < rollups.count(); idx++)
+	{
+		float min = rollups[idx].min > offset ? rollups[idx].min - offset : 0;
+		float max = rollups[idx].max > offset ? rollups[idx].max - offset : 0;
+		float mean = rollups[idx].mean > offset ? rollups[idx].mean - offset : 0;
+		int16_t x = pos.x + idx * w_period + 1;
+		int16_t y_min = pos.y + pos.h - (int16_t)(min / divider);
+		int16_t y_max = pos.y + pos.h - (int16_t)(max / divider);
+		int16_t y_mean = pos.y + pos.h - (int16_t)(mean / divider);
+
+		display.fillRect(x, y_mean, w_period - 2, pos.y + pos.h - y_mean, txt_color);
+		display.drawRect(x, y_max, w_period - 2, y_min - y_max + 1, txt_color);
+	}
+}
+
+/**
+ * @brief Get the highest value of hourly or daily rollups
+ *
+ * @param rollups hours() or days() of a sensor history
+ * @return float highest max value
+ */
+template <class R>
+static float rollups_max(const R &rollups)
+{
+	float result = 0;
+	for (uint8_t idx = 0; idx < rollups.count(); idx++)
+	{
+		if (rollups[idx].max > result)
+		{
+			result = rollups[idx].max;
+		}
+	}
+	return result;
+}
+
+/** Raw value graphs as they are in the frame buffer */
+static epd_graph_t voc_graph;
+static epd_graph_t co2_graph;
+
+/** Positions of the graphs */
+static constexpr epd_graph_pos_t voc_pos = rak14000_layout::voc_graph();
+static constexpr epd_graph_pos_t co2_pos = rak14000_layout::co2_graph();
+
+/**
+ * @brief Draw one column of a raw value graph
+ *
+ * @param graph graph layout
+ * @param idx column, 0 = oldest value
+ * @param value value of the column
+ */
+static void draw_column(const epd_graph_t &graph, uint16_t idx, float value)
+{
+	if (value >= graph.offset)
+	{
+		display.drawLine((int16_t)(graph.x + (idx * graph.w_bar)),
+						 (int16_t)(graph.y + ((graph.h) - ((value - graph.offset) / graph.divider))),
+						 (int16_t)(graph.x + (idx * graph.w_bar)),
+						 (int16_t)(graph.y + graph.h),
+						 graph.color);
+	}
+}
+
+/**
+ * @brief Check if a column stays below the top of the graph
+ *        Higher columns cannot be scrolled
+ *
+ */
+static bool column_fits(const epd_graph_t &graph, float value)
+{
+	return (value < graph.offset) || (((value - graph.offset) / graph.divider) <= graph.h);
+}
+
+/**
+ * @brief Draw the graph of a sensor for the selected time range
+ *
+ * @param history sensor history
+ * @param offset value at the bottom of the graph
+ * @param pos position of the graph
+ * @param divider value per pixel
+ * @param graph saves the raw value graph for scrolling
+ */
+template <class H>
+static void draw_history(const H &history, float offset, const epd_graph_pos_t &pos, float divider, epd_graph_t &graph)
+{
+	graph.valid = false;
+	switch (g_graph_range)
+	{
+	case HISTORY_HOURS:
+		draw_rollups(history.hours(), offset, pos, divider);
+		text_rak14000(pos.x + pos.w + 15, pos.y + pos.h / 2 - 3, (char *)"24h", txt_color, 1);
+		break;
+	case HISTORY_DAYS:
+		draw_rollups(history.days(), offset, pos, divider);
+		text_rak14000(pos.x + pos.w + 15, pos.y + pos.h / 2 - 3, (char *)"7d", txt_color, 1);
+		break;
+	default:
+	{
+		graph = {true, history.pushed(), history.count(), pos.x, pos.y,
+				 pos.h, pos.w_bar, divider, offset, txt_color};
+		int idx = 0;
+		for (float value : history)
+		{
+			graph.valid = graph.valid && column_fits(graph, value);
+			draw_column(graph, idx, value);
+			idx++;
+		}
+	}
+	break;
+	}
+}
+
+/**
+ * @brief Scroll a raw value graph and draw only the new values
+ *        The old columns are moved left in the frame buffer. The graph has to be
+ *        drawn again if the scale changed or a new value is higher than the graph.
+ *
+ * @param graph graph as it is in the frame buffer
+ * @param history sensor history
+ * @param divider value per pixel of the current scale
+ * @param changed returns the changed area, empty if there is no new value
+ * @return true graph is up to date
+ * @return false graph has to be drawn again
+ */
+template <class H>
+static bool scroll_graph(epd_graph_t &graph, const H &history, float divider, epd_box_t *changed)
 {
-	bool has_pm = found_sensors[PM_ID].found_sensor;
-	bool has_baro = false;
-	if ((found_sensors[ENV_ID].found_sensor) || (found_sensors[PRESS_ID].found_sensor))
+	if (!graph.valid || (g_graph_range != HISTORY_RAW) || (graph.divider != divider) || (graph.color != txt_color))
+	{
+		return false;
+	}
+
+	// Until the history is full, new columns are added at the right side
+	uint16_t added = history.pushed() - graph.pushed;
+	uint16_t count = history.count();
+	if ((added > count) || (graph.count + added < count) ||
+		((count < H::capacity()) && (graph.count + added != count)))
 	{
-		has_baro = true;
+		return false;
 	}
+	for (uint16_t idx = count - added; idx < count; idx++)
+	{
+		if (!column_fits(graph, history[idx]))
+		{
+			return false;
+		}
+	}
+	if (added == 0)
+	{
+		*changed = {0, 0, -1, -1};
+		return true;
+	}
+
+	uint16_t shift = graph.count + added - count;
+	int16_t x_new = graph.x + (count - added) * graph.w_bar;
+	if (shift != 0)
+	{
+		display.scroll_left(graph.x, graph.y, H::capacity() * graph.w_bar, graph.h, shift * graph.w_bar);
+	}
+	display.fillRect(x_new, graph.y, added * graph.w_bar, graph.h, bg_color);
+	for (uint16_t idx = count - added; idx < count; idx++)
+	{
+		draw_column(graph, idx, history[idx]);
+	}
+
+	*changed = {shift != 0 ? graph.x : x_new, graph.y, (int16_t)(graph.x + count * graph.w_bar - 1), (int16_t)(graph.y + graph.h)};
+	graph.pushed = history.pushed();
+	graph.count = count;
+	return true;
+}
+
+/**
+ * @brief Get the top of the CO2 graph from the values
+ *
+ * @return int highest value of the graph in ppm
+ */
+static int co2_graph_max(void)
+{
+	// Get min and max values => maybe adjust graph to the min and max values
+	int fmin = 2500;
+	int fmax = 0;
+	for (float co2_value : co2_values)
+	{
+		if (co2_value <= fmin)
+		{
+			fmin = co2_value;
+		}
+		if (co2_value >= fmax)
+		{
+			fmax = co2_value;
+		}
+	}
+	// Peaks of the hours or days can be higher than the last values
+	if (g_graph_range == HISTORY_HOURS)
+	{
+		fmax = max(fmax, (int)rollups_max(co2_values.hours()));
+	}
+	else if (g_graph_range == HISTORY_DAYS)
+	{
+		fmax = max(fmax, (int)rollups_max(co2_values.days()));
+	}
+	// give some margin at the top
+	fmax += 50;
+
+	// give some margin at the bottom
+	if (fmin > 50)
+	{
+		fmin -= 50;
+	}
+	// make it an even number
+	fmax = ((fmax / 100) + 1) * 100;
+
+	MYLOG("EPD", "CO2 min %d max %d", fmin, fmax);
+	return fmax;
+}
+
+/**
+ * @brief Get the value per pixel of the CO2 graph
+ *
+ * @param fmax highest value of the graph in ppm
+ * @return float ppm per pixel, full ppm only
+ */
+static float co2_divider(int fmax)
+{
+	return fmax / co2_pos.h;
+}
+
+/**
+ * @brief Check if a barometric pressure sensor is available
+ *
+ */
+static bool has_baro(void)
+{
+	return (found_sensors[ENV_ID].found_sensor) || (found_sensors[PRESS_ID].found_sensor);
+}
+
+/**
+ * @brief Widget for the VOC value
+ *
+ */
+static void voc_widget(void)
+{
 	if (found_sensors[VOC_ID].found_sensor)
 	{
 		voc_rak14000();
 	}
+}
+
+/**
+ * @brief Widget for the VOC graph
+ *
+ */
+static void voc_graph_widget(void)
+{
+	voc_graph.valid = false;
+	if (found_sensors[VOC_ID].found_sensor)
+	{
+		voc_graph_rak14000();
+	}
+}
+
+/**
+ * @brief Scroll the VOC graph
+ *
+ * @param changed returns the changed area
+ * @return true graph is up to date
+ * @return false graph has to be drawn again
+ */
+static bool voc_graph_scroll(epd_box_t *changed)
+{
+	return scroll_graph(voc_graph, voc_values, voc_pos.divider, changed);
+}
+
+/**
+ * @brief Widget for the CO2 value
+ *
+ */
+static void co2_widget(void)
+{
 	if (found_sensors[CO2_ID].found_sensor)
 	{
-		co2_rak14000(has_pm);
+		co2_rak14000(found_sensors[PM_ID].found_sensor);
 	}
-	temp_rak14000(has_pm, has_baro);
-	humid_rak14000(has_pm, has_baro);
-	if (has_baro)
+}
+
+/**
+ * @brief Widget for the CO2 graph, only shown without PM sensor
+ *
+ */
+static void co2_graph_widget(void)
+{
+	co2_graph.valid = false;
+	if ((found_sensors[CO2_ID].found_sensor) && (!found_sensors[PM_ID].found_sensor))
 	{
-		baro_rak14000(has_pm);
+		co2_graph_rak14000();
 	}
+}
+
+/**
+ * @brief Scroll the CO2 graph
+ *
+ * @param changed returns the changed area
+ * @return true graph is up to date
+ * @return false graph has to be drawn again
+ */
+static bool co2_graph_scroll(epd_box_t *changed)
+{
+	return scroll_graph(co2_graph, co2_values, co2_divider(co2_graph_max()), changed);
+}
+
+/**
+ * @brief Widget for the temperature value
+ *
+ */
+static void temp_widget(void)
+{
+	temp_rak14000(found_sensors[PM_ID].found_sensor, has_baro());
+}
+
+/**
+ * @brief Widget for the humidity value
+ *
+ */
+static void humid_widget(void)
+{
+	humid_rak14000(found_sensors[PM_ID].found_sensor, has_baro());
+}
+
+/**
+ * @brief Widget for the barometric pressure value
+ *
+ */
+static void baro_widget(void)
+{
+	if (has_baro())
+	{
+		baro_rak14000(found_sensors[PM_ID].found_sensor);
+	}
+}
+
+/**
+ * @brief Widget for the PM values
+ *
+ */
+static void pm_widget(void)
+{
 	if (found_sensors[PM_ID].found_sensor)
 	{
 		pm_rak14000();
 	}
+}
 
-	display.setFont(SMALL_FONT);
-	display.setTextSize(1);
+/**
+ * @brief Widget for the header with date, time and battery
+ *
+ */
+static void header_widget(void)
+{
 	if (found_sensors[RTC_ID].found_sensor)
 	{
 		read_rak12002();
@@ -74,12 +417,18 @@ void scientific_rak14000(void)
 		}
 	}
 
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = text_bounds_rak14000(SMALL_FONT, disp_text).w;
 	text_rak14000((display_width / 2) - (txt_w / 2), 1, disp_text, (uint16_t)txt_color, 1);
+}
 
+/**
+ * @brief Widget for the separator lines
+ *
+ */
+static void lines_widget(void)
+{
 	if (found_sensors[PM_ID].found_sensor)
 	{
-		pm_rak14000();
 		display.drawLine(0, display_height / 2 + 3, display_width / 2 + 50, display_height / 2 + 3, (uint16_t)txt_color);
 		display.drawLine(display_width / 2 + 50, display_height / 5, display_width, display_height / 5, (uint16_t)txt_color);
 		display.drawLine(display_width / 2 + 50, 10, display_width / 2 + 50, display_height, (uint16_t)txt_color);
@@ -92,23 +441,42 @@ void scientific_rak14000(void)
 	}
 }
 
+/** Widgets of the scientific UI, in drawing order */
+epd_widget_t scientific_widgets[] = {
+	epd_widget(voc_widget),
+	epd_widget(voc_graph_widget, voc_graph_scroll),
+	epd_widget(co2_widget),
+	epd_widget(co2_graph_widget, co2_graph_scroll),
+	epd_widget(temp_widget),
+	epd_widget(humid_widget),
+	epd_widget(baro_widget),
+	epd_widget(pm_widget),
+	epd_widget(header_widget),
+	epd_widget(lines_widget)};
+const uint8_t num_scientific_widgets = sizeof(scientific_widgets) / sizeof(epd_widget_t);
+
+/**
+ * @brief Draw the complete scientific UI
+ *
+ */
+void scientific_rak14000(void)
+{
+	for (uint8_t idx = 0; idx < num_scientific_widgets; idx++)
+	{
+		scientific_widgets[idx].draw();
+	}
+}
+
 /**
  * @brief Update display for VOC values
  *
  */
 void voc_rak14000(void)
 {
-	x_text = 2;
-	y_text = 10;
-	s_text = 2;
-	x_graph = 0;
-	y_graph = 60;
-	h_bar = display_height / 2 - 60;
-	w_bar = 2;
-	bar_divider = 500.0 / h_bar;
+	constexpr epd_text_pos_t pos = rak14000_layout::voc();
 
 	// Write value
-	display.drawBitmap(x_text, y_text, voc_img, 32, 32, txt_color);
+	draw_image_rak14000(pos.x, pos.y, voc_img, txt_color);
 
 	if (!voc_valid)
 	{
@@ -116,42 +484,41 @@ void voc_rak14000(void)
 	}
 	else
 	{
-		if (voc_values[voc_idx - 1] > 400)
+		if (voc_values.latest() > 400)
 		{
-			snprintf(disp_text, 29, " !!  VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, " !!  VOC %d", voc_values.latest());
 		}
-		else if (voc_values[voc_idx - 1] > 250)
+		else if (voc_values.latest() > 250)
 		{
-			snprintf(disp_text, 29, " !  VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, " !  VOC %d", voc_values.latest());
 		}
 		else
 		{
-			snprintf(disp_text, 29, "VOC %d", voc_values[voc_idx - 1]);
+			snprintf(disp_text, 29, "VOC %d", voc_values.latest());
 		}
 	}
-	text_rak14000(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
+	text_rak14000(pos.x + 40, pos.y + 20, disp_text, txt_color, pos.size);
+}
+
+/**
+ * @brief Update display for VOC graph
+ *
+ */
+void voc_graph_rak14000(void)
+{
+	constexpr int16_t x_axis = voc_pos.x + voc_pos.w;
+	constexpr int16_t y_bottom = voc_pos.y + voc_pos.h;
 
-	text_rak14000(display_width / 2 + 15, y_graph + h_bar - 7, (char *)"0", txt_color, 1);
-	text_rak14000(display_width / 2 + 15, y_graph - 7, (char *)"500", txt_color, 1);
+	text_rak14000(x_axis + 15, y_bottom - 7, (char *)"0", txt_color, 1);
+	text_rak14000(x_axis + 15, voc_pos.y - 7, (char *)"500", txt_color, 1);
 
-	display.drawLine(display_width / 2 + 10, y_graph + h_bar, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-	display.drawLine(display_width / 2 + 5, y_graph + h_bar, display_width / 2 + 10, y_graph + h_bar, (uint16_t)txt_color);
-	display.drawLine(display_width / 2 + 5, y_graph, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
+	display.drawLine(x_axis + 10, y_bottom, x_axis + 10, voc_pos.y, (uint16_t)txt_color);
+	display.drawLine(x_axis + 5, y_bottom, x_axis + 10, y_bottom, (uint16_t)txt_color);
+	display.drawLine(x_axis + 5, voc_pos.y, x_axis + 10, voc_pos.y, (uint16_t)txt_color);
 
 	// Draw VOC values
-	for (int idx = 0; idx < num_values; idx++)
-	{
-		display.drawLine((int16_t)(x_graph + (idx * w_bar)),
-						 (int16_t)(y_graph + ((h_bar) - (voc_values[idx] / bar_divider))),
-						 (int16_t)(x_graph + (idx * w_bar)),
-						 (int16_t)(y_graph + h_bar),
-						 txt_color);
-	}
-	display.drawLine(x_graph, y_graph + h_bar, x_graph + display_width / 2, y_graph + h_bar, (uint16_t)txt_color);
-
-	// For partial update only
-	// MYLOG("EPD", "Updating x1 %d y1 %d x2 %d y2 %d", x_text, y_text, x_text + w_text, y_text + h_text);
-	// display.displayPartial(x_text, y_text, x_text + w_text, y_text + h_text);
+	draw_history(voc_values, 0, voc_pos, voc_pos.divider, voc_graph);
+	display.drawLine(voc_pos.x, y_bottom, x_axis, y_bottom, (uint16_t)txt_color);
 }
 
 /**
@@ -164,158 +531,104 @@ void voc_rak14000(void)
  */
 void co2_rak14000(bool has_pm)
 {
+	const epd_text_pos_t pos = rak14000_layout::co2(has_pm);
 	if (has_pm)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = 15;
-		s_text = 2;
-		spacer = 20;
-
 		// Write value
-		display.drawBitmap(x_text, y_text, co2_img, 32, 32, txt_color);
+		draw_image_rak14000(pos.x, pos.y, co2_img, txt_color);
 
 		snprintf(disp_text, 29, "ppm");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = small_text_bounds("ppm").w;
 
-		text_rak14000(display_width - txt_w - 1, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(display_width - txt_w - 1, pos.y + pos.spacer + 4, disp_text, (uint16_t)txt_color, 1);
 
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
-			snprintf(disp_text, 29, "!! %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!! %.0f", co2_values.latest());
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
-			snprintf(disp_text, 29, "! %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "! %.0f", co2_values.latest());
 		}
 		else
 		{
-			snprintf(disp_text, 29, "%.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "%.0f", co2_values.latest());
 		}
 
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
+		txt_w2 = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(display_width - txt_w - txt_w2 - 4, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(display_width - txt_w - txt_w2 - 4, pos.y + pos.spacer, disp_text, (uint16_t)txt_color, pos.size);
 	}
 	else
 	{
-		x_text = 2;
-		y_text = display_height / 2;
-		s_text = 2;
-		x_graph = 0;
-		y_graph = display_height / 2 + 60;
-		h_bar = display_height / 2 - 62;
-		w_bar = 2;
-		bar_divider = 2500 / h_bar;
-
-		// Get min and max values => maybe adjust graph to the min and max values
-		int fmin = 2500;
-		int fmax = 0;
-		for (int idx = 0; idx < co2_idx; idx++)
-		{
-			if (co2_values[idx] <= fmin)
-			{
-				fmin = co2_values[idx];
-			}
-			if (co2_values[idx] >= fmax)
-			{
-				fmax = co2_values[idx];
-			}
-		}
-		// give some margin at the top
-		fmax += 50;
-
-		// give some margin at the bottom
-		if (fmin > 50)
-		{
-			fmin -= 50;
-		}
-		// make it an even number
-		fmax = ((fmax / 100) + 1) * 100;
-		bar_divider = fmax / h_bar;
-
-		MYLOG("EPD", "CO2 min %d max %d", fmin, fmax);
-
 		// Write value
-		display.drawBitmap(x_text, y_text, co2_img, 32, 32, txt_color);
+		draw_image_rak14000(pos.x, pos.y, co2_img, txt_color);
 
-		if (co2_values[co2_idx - 1] > 1500)
+		if (co2_values.latest() > 1500)
 		{
-			snprintf(disp_text, 29, "!!  %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!!  %.0f", co2_values.latest());
 		}
-		else if (co2_values[co2_idx - 1] > 1000)
+		else if (co2_values.latest() > 1000)
 		{
-			snprintf(disp_text, 29, "!  %.0f", co2_values[co2_idx - 1]);
+			snprintf(disp_text, 29, "!  %.0f", co2_values.latest());
 		}
 		else
 		{
-			snprintf(disp_text, 29, "%.0f", co2_values[co2_idx - 1]);
-		}
-		text_rak14000(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
-
-		text_rak14000(x_text + 40 + txt_w2 + 3, y_text + 24, (char *)"ppm", txt_color, 1);
-
-		sprintf(disp_text, "%d", fmax);
-		text_rak14000(display_width / 2 + 15, y_graph + h_bar - 17, (char *)"200", txt_color, 1);
-		text_rak14000(display_width / 2 + 15, y_graph + h_bar - 7, (char *)"ppm", txt_color, 1);
-		// text_rak14000(display_width / 2 + 15, y_graph + h_bar - 7, (char *)"0ppm", txt_color, 1);
-		text_rak14000(display_width / 2 + 15, y_graph - 7, disp_text, txt_color, 1);
-		text_rak14000(display_width / 2 + 15, y_graph + 3, (char *)"ppm", txt_color, 1);
-
-		display.drawLine(display_width / 2 + 10, y_graph + h_bar, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-		display.drawLine(display_width / 2 + 5, y_graph + h_bar, display_width / 2 + 10, y_graph + h_bar, (uint16_t)txt_color);
-		display.drawLine(display_width / 2 + 5, y_graph, display_width / 2 + 10, y_graph, (uint16_t)txt_color);
-
-		// Draw CO2 values
-		for (int idx = 0; idx < num_values; idx++)
-		{
-			// if (co2_values[idx] != 0.0)
-			if (co2_values[idx] >= 200.0)
-			{
-				display.drawLine((int16_t)(x_graph + (idx * w_bar)),
-								 //  (int16_t)(y_graph + ((h_bar) - (co2_values[idx] / bar_divider))),
-								 (int16_t)(y_graph + ((h_bar) - ((co2_values[idx] - 200) / bar_divider))),
-								 (int16_t)(x_graph + (idx * w_bar)),
-								 (int16_t)(y_graph + h_bar),
-								 txt_color);
-			}
+			snprintf(disp_text, 29, "%.0f", co2_values.latest());
 		}
-		display.drawLine(x_graph, y_graph + h_bar, x_graph + display_width / 2, y_graph + h_bar, (uint16_t)txt_color);
+		text_rak14000(pos.x + 40, pos.y + 20, disp_text, txt_color, pos.size);
+		txt_w2 = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		// For partial update only
-		// MYLOG("EPD", "Updating x1 %d y1 %d x2 %d y2 %d", x_text, y_text, x_text + w_text, y_text + h_text);
-		// display.displayPartial(x_text, y_text, x_text + w_text, y_text + h_text);
+		text_rak14000(pos.x + 40 + txt_w2 + 3, pos.y + 24, (char *)"ppm", txt_color, 1);
 	}
 }
 
+/**
+ * @brief Update display for CO2 graph, only used if no PM sensor is connected
+ *
+ */
+void co2_graph_rak14000(void)
+{
+	constexpr int16_t x_axis = co2_pos.x + co2_pos.w;
+	constexpr int16_t y_bottom = co2_pos.y + co2_pos.h;
+	int fmax = co2_graph_max();
+
+	sprintf(disp_text, "%d", fmax);
+	text_rak14000(x_axis + 15, y_bottom - 17, (char *)"200", txt_color, 1);
+	text_rak14000(x_axis + 15, y_bottom - 7, (char *)"ppm", txt_color, 1);
+	// text_rak14000(x_axis + 15, y_bottom - 7, (char *)"0ppm", txt_color, 1);
+	text_rak14000(x_axis + 15, co2_pos.y - 7, disp_text, txt_color, 1);
+	text_rak14000(x_axis + 15, co2_pos.y + 3, (char *)"ppm", txt_color, 1);
+
+	display.drawLine(x_axis + 10, y_bottom, x_axis + 10, co2_pos.y, (uint16_t)txt_color);
+	display.drawLine(x_axis + 5, y_bottom, x_axis + 10, y_bottom, (uint16_t)txt_color);
+	display.drawLine(x_axis + 5, co2_pos.y, x_axis + 10, co2_pos.y, (uint16_t)txt_color);
+
+	// Draw CO2 values, graph starts at 200ppm
+	draw_history(co2_values, 200, co2_pos, co2_divider(fmax), co2_graph);
+	display.drawLine(co2_pos.x, y_bottom, x_axis, y_bottom, (uint16_t)txt_color);
+}
+
 /**
  * @brief Update display with particle matter values
  *
  */
 void pm_rak14000(void)
 {
-	x_text = display_width / 2 + 53;
-	y_text = display_height / 4;
-	s_text = 2;
+	constexpr epd_text_pos_t pos = rak14000_layout::pm();
 
 	// Write value
-	display.drawBitmap(x_text, y_text, pm_img, 32, 32, txt_color);
+	draw_image_rak14000(pos.x, pos.y, pm_img, txt_color);
 
 	snprintf(disp_text, 29, "PM");
-	text_rak14000(x_text + 40, y_text + 20, disp_text, txt_color, s_text);
+	text_rak14000(pos.x + 40, pos.y + 20, disp_text, txt_color, pos.size);
 
 	// PM 1.0 levels
-	if (pm10_values[pm_idx - 1] > 75)
+	if (pm10_values.latest() > 75)
 	{
 		snprintf(disp_text, 29, "1.0: !!");
 	}
-	else if (pm10_values[pm_idx - 1] > 35)
+	else if (pm10_values.latest() > 35)
 	{
 		snprintf(disp_text, 29, "1.0: !");
 	}
@@ -323,22 +636,20 @@ void pm_rak14000(void)
 	{
 		snprintf(disp_text, 29, "1.0:");
 	}
-	text_rak14000(x_text, y_text + 60, disp_text, txt_color, s_text);
+	text_rak14000(pos.x, pos.y + 60, disp_text, txt_color, pos.size);
 
-	snprintf(disp_text, 29, "%d", pm10_values[pm_idx - 1]);
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000(display_width - txt_w - 45, y_text + 60, disp_text, txt_color, s_text);
+	snprintf(disp_text, 29, "%d", pm10_values.latest());
+	txt_w = text_bounds_rak14000(LARGE_FONT, disp_text).w;
+	text_rak14000(display_width - txt_w - 45, pos.y + 60, disp_text, txt_color, pos.size);
 	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
-	text_rak14000(display_width - 38, y_text + 65, disp_text, txt_color, 1);
+	text_rak14000(display_width - 38, pos.y + 65, disp_text, txt_color, 1);
 
 	// PM 2.5 levels
-	if (pm25_values[pm_idx - 1] > 75)
+	if (pm25_values.latest() > 75)
 	{
 		snprintf(disp_text, 29, "2.5: !!");
 	}
-	else if (pm25_values[pm_idx - 1] > 35)
+	else if (pm25_values.latest() > 35)
 	{
 		snprintf(disp_text, 29, "2.5: !");
 	}
@@ -346,22 +657,20 @@ void pm_rak14000(void)
 	{
 		snprintf(disp_text, 29, "2.5:");
 	}
-	text_rak14000(x_text, y_text + 120, disp_text, txt_color, s_text);
+	text_rak14000(pos.x, pos.y + 120, disp_text, txt_color, pos.size);
 
-	snprintf(disp_text, 29, "%d", pm25_values[pm_idx - 1]);
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000(display_width - txt_w - 45, y_text + 120, disp_text, txt_color, s_text);
+	snprintf(disp_text, 29, "%d", pm25_values.latest());
+	txt_w = text_bounds_rak14000(LARGE_FONT, disp_text).w;
+	text_rak14000(display_width - txt_w - 45, pos.y + 120, disp_text, txt_color, pos.size);
 	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
-	text_rak14000(display_width - 38, y_text + 125, disp_text, txt_color, 1);
+	text_rak14000(display_width - 38, pos.y + 125, disp_text, txt_color, 1);
 
 	// PM 10 levels
-	if (pm100_values[pm_idx - 1] > 199)
+	if (pm100_values.latest() > 199)
 	{
 		snprintf(disp_text, 29, "10: !!");
 	}
-	else if (pm100_values[pm_idx - 1] > 150)
+	else if (pm100_values.latest() > 150)
 	{
 		snprintf(disp_text, 29, "10: !");
 	}
@@ -369,15 +678,13 @@ void pm_rak14000(void)
 	{
 		snprintf(disp_text, 29, "10:");
 	}
-	text_rak14000(x_text, y_text + 180, disp_text, txt_color, s_text);
+	text_rak14000(pos.x, pos.y + 180, disp_text, txt_color, pos.size);
 
-	snprintf(disp_text, 29, "%d", pm100_values[pm_idx - 1]);
-	display.setFont(LARGE_FONT);
-	display.setTextSize(1);
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
-	text_rak14000(display_width - txt_w - 45, y_text + 180, disp_text, txt_color, s_text);
+	snprintf(disp_text, 29, "%d", pm100_values.latest());
+	txt_w = text_bounds_rak14000(LARGE_FONT, disp_text).w;
+	text_rak14000(display_width - txt_w - 45, pos.y + 180, disp_text, txt_color, pos.size);
 	snprintf(disp_text, 29, "%cg/m%c", 0x7F, 0x80);
-	text_rak14000(display_width - 38, y_text + 185, disp_text, txt_color, 1);
+	text_rak14000(display_width - 38, pos.y + 185, disp_text, txt_color, 1);
 }
 
 /**
@@ -390,58 +697,37 @@ void pm_rak14000(void)
  */
 void temp_rak14000(bool has_pm, bool has_baro)
 {
-	x_text = 25;
-	if (has_baro)
-	{
-		y_text = display_height / 2 + 10;
-	}
-	else
-	{
-		y_text = display_height / 4 + 105;
-	}
-	s_text = 2;
-	spacer = 60;
+	const epd_text_pos_t pos = rak14000_layout::temp(has_pm, has_baro);
 
 	// If PM sensor is not available, position is different
 	if (!has_pm)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = 12;
-		s_text = 2;
-		spacer = 50;
-
 		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, celsius_img, 32, 32, txt_color);
+		draw_image_rak14000(display_width - (display_width / 4 - 16), pos.y, celsius_img, txt_color);
 
 		snprintf(disp_text, 29, "~C");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = small_text_bounds("~C").w;
 
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(display_width - txt_w - 3, pos.y + pos.spacer + 4, disp_text, (uint16_t)txt_color, 1);
 
-		snprintf(disp_text, 29, "%.2f ", temp_values[temp_idx - 1]);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
+		snprintf(disp_text, 29, "%.2f ", temp_values.latest());
+		txt_w2 = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(display_width - txt_w - txt_w2 - 6, pos.y + pos.spacer, disp_text, (uint16_t)txt_color, pos.size);
 	}
 	else
 	{
 		// Write value
-		display.drawBitmap(x_text, y_text, celsius_img, 32, 32, txt_color);
+		draw_image_rak14000(pos.x, pos.y, celsius_img, txt_color);
 
-		snprintf(disp_text, 29, "%.2f", temp_values[temp_idx - 1]);
+		snprintf(disp_text, 29, "%.2f", temp_values.latest());
 
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(pos.x + pos.spacer, pos.y + 16, disp_text, (uint16_t)txt_color, pos.size);
 
 		snprintf(disp_text, 29, "~C");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(pos.x + pos.spacer + txt_w + 4, pos.y + 16 + 4, disp_text, (uint16_t)txt_color, 1);
 	}
 }
 
@@ -455,58 +741,37 @@ void temp_rak14000(bool has_pm, bool has_baro)
  */
 void humid_rak14000(bool has_pm, bool has_baro)
 {
-	x_text = 25;
-	if (has_baro)
-	{
-		y_text = display_height / 2 + (display_height / 2 / 3) + 10;
-	}
-	else
-	{
-		y_text = (display_height / 4) + 165;
-	}
-	s_text = 2;
-	spacer = 60;
+	const epd_text_pos_t pos = rak14000_layout::humid(has_pm, has_baro);
 
 	// If PM sensor is not available, position is different
 	if (!has_pm)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = display_height / 3 + 15;
-		s_text = 2;
-		spacer = 50;
-
 		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, humidity_img, 32, 32, txt_color);
+		draw_image_rak14000(display_width - (display_width / 4 - 16), pos.y, humidity_img, txt_color);
 
 		snprintf(disp_text, 29, "%%RH");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = small_text_bounds("%RH").w;
 
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(display_width - txt_w - 3, pos.y + pos.spacer + 4, disp_text, (uint16_t)txt_color, 1);
 
-		snprintf(disp_text, 29, "%.2f ", humid_values[humid_idx - 1]);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
+		snprintf(disp_text, 29, "%.2f ", humid_values.latest());
+		txt_w2 = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(display_width - txt_w - txt_w2 - 6, pos.y + pos.spacer, disp_text, (uint16_t)txt_color, pos.size);
 	}
 	else
 	{
 		// Write value
-		display.drawBitmap(x_text, y_text, humidity_img, 32, 32, txt_color);
+		draw_image_rak14000(pos.x, pos.y, humidity_img, txt_color);
 
-		snprintf(disp_text, 29, "%.2f", humid_values[humid_idx - 1]);
+		snprintf(disp_text, 29, "%.2f", humid_values.latest());
 
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(pos.x + pos.spacer, pos.y + 16, disp_text, (uint16_t)txt_color, pos.size);
 
 		snprintf(disp_text, 29, "%%RH");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(pos.x + pos.spacer + txt_w + 4, pos.y + 16 + 4, disp_text, (uint16_t)txt_color, 1);
 	}
 }
 
@@ -518,50 +783,36 @@ void humid_rak14000(bool has_pm, bool has_baro)
  */
 void baro_rak14000(bool has_pm)
 {
-	x_text = 25;
-	y_text = display_height / 2 + (display_height / 2 / 3 * 2) + 10;
-	s_text = 2;
-	spacer = 60;
+	const epd_text_pos_t pos = rak14000_layout::baro(has_pm);
 
 	// If PM sensor is not available, position is different
 	if (!has_pm)
 	{
-		x_text = display_width / 2 + 53;
-		y_text = display_height / 3 * 2 + 15;
-		s_text = 2;
-		spacer = 50;
-
 		// Write value
-		display.drawBitmap(display_width - (display_width / 4 - 16), y_text, barometer_img, 32, 32, txt_color);
+		draw_image_rak14000(display_width - (display_width / 4 - 16), pos.y, barometer_img, txt_color);
 
 		snprintf(disp_text, 29, "mBar");
-		display.setFont(SMALL_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = small_text_bounds("mBar").w;
 
-		text_rak14000(display_width - txt_w - 3, y_text + spacer + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(display_width - txt_w - 3, pos.y + pos.spacer + 4, disp_text, (uint16_t)txt_color, 1);
 
-		snprintf(disp_text, 29, "%.1f ", baro_values[baro_idx - 1]);
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w2, &txt_h);
+		snprintf(disp_text, 29, "%.1f ", baro_values.latest());
+		txt_w2 = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(display_width - txt_w - txt_w2 - 6, y_text + spacer, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(display_width - txt_w - txt_w2 - 6, pos.y + pos.spacer, disp_text, (uint16_t)txt_color, pos.size);
 	}
 	else
 	{
 		// Write value
-		display.drawBitmap(x_text, y_text, barometer_img, 32, 32, txt_color);
+		draw_image_rak14000(pos.x, pos.y, barometer_img, txt_color);
 
-		snprintf(disp_text, 29, "%.2f", baro_values[baro_idx - 1]);
+		snprintf(disp_text, 29, "%.2f", baro_values.latest());
 
-		display.setFont(LARGE_FONT);
-		display.setTextSize(1);
-		display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+		txt_w = text_bounds_rak14000(LARGE_FONT, disp_text).w;
 
-		text_rak14000(x_text + spacer, y_text + 16, disp_text, (uint16_t)txt_color, s_text);
+		text_rak14000(pos.x + pos.spacer, pos.y + 16, disp_text, (uint16_t)txt_color, pos.size);
 
 		snprintf(disp_text, 29, "mBar");
-		text_rak14000(x_text + spacer + txt_w + 4, y_text + 16 + 4, disp_text, (uint16_t)txt_color, 1);
+		text_rak14000(pos.x + pos.spacer + txt_w + 4, pos.y + 16 + 4, disp_text, (uint16_t)txt_color, 1);
 	}
 }
@@ -0,0 +1,365 @@
+/**
+ * @file RAK14000_widgets.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Widget based screen update for the 4.2" EPD
+ *        Each widget is measured without drawing, only widgets with changed pixels
+ *        are cleared and drawn again. The area of all changed widgets is sent
+ *        with one partial refresh. Every EPD_PARTIAL_MAX partial refreshes,
+ *        after a UI switch or a color switch a full refresh is done.
+ *        Graphs scroll their pixels in the frame buffer and draw only the new values.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_EPD.h>
+
+#include "RAK14000_epd.h"
+
+/** Maximum number of widgets of one UI */
+#define EPD_MAX_WIDGETS 16
+
+/** Widgets shown on the display, nullptr forces a full refresh */
+static epd_widget_t *shown_widgets = nullptr;
+
+/** Background color of the last full refresh */
+static uint16_t shown_bg_color = EPD_WHITE;
+
+/** Partial refreshes since the last full refresh */
+static uint8_t partial_count = 0;
+
+/**
+ * @brief Set a pixel and collect the area and hash of the drawing
+ *
+ * @param x x position
+ * @param y y position
+ * @param color pixel color
+ */
+void RAK14000_SSD1681::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+	if (_mode != EPD_TRACK_OFF)
+	{
+		if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+		{
+			return;
+		}
+		_box.x1 = x < _box.x1 ? x : _box.x1;
+		_box.y1 = y < _box.y1 ? y : _box.y1;
+		_box.x2 = x > _box.x2 ? x : _box.x2;
+		_box.y2 = y > _box.y2 ? y : _box.y2;
+		// FNV-1a over position and color
+		_hash = (_hash ^ (uint32_t)((x << 16) | y)) * 16777619UL;
+		_hash = (_hash ^ color) * 16777619UL;
+		if (_mode == EPD_TRACK_MEASURE)
+		{
+			return;
+		}
+	}
+	Adafruit_SSD1681::drawPixel(x, y, color);
+}
+
+/**
+ * @brief Start a new collection of area and hash
+ *
+ * @param mode EPD_TRACK_OFF, EPD_TRACK_DRAW or EPD_TRACK_MEASURE
+ */
+void RAK14000_SSD1681::track(uint8_t mode)
+{
+	_mode = mode;
+	_box = {0x7FFF, 0x7FFF, -1, -1};
+	_hash = 2166136261UL;
+}
+
+/**
+ * @brief Get the bit of a pixel in the frame buffer
+ *        Same layout as Adafruit_EPD::drawPixel, columns of the panel are
+ *        padded to full bytes
+ *
+ * @param x x position
+ * @param y y position
+ * @return uint32_t bit number, MSB of the first byte is 0
+ */
+uint32_t RAK14000_SSD1681::bit_index(int16_t x, int16_t y)
+{
+	uint32_t column = ((uint32_t)HEIGHT + 7) & ~7UL;
+	switch (getRotation())
+	{
+	case 1:
+		return (uint32_t)y * column + x;
+	case 2:
+		return (uint32_t)x * column + (HEIGHT - 1 - y);
+	case 3:
+		return (uint32_t)(WIDTH - 1 - y) * column + (HEIGHT - 1 - x);
+	default:
+		return (uint32_t)(WIDTH - 1 - x) * column + y;
+	}
+}
+
+/**
+ * @brief Copy a run of bits inside the frame buffer, the runs may overlap
+ *
+ * @param dst first bit of the destination
+ * @param src first bit of the source
+ * @param num number of bits
+ */
+void RAK14000_SSD1681::copy_bits(uint32_t dst, uint32_t src, uint32_t num)
+{
+	if (num == 0)
+	{
+		return;
+	}
+	int32_t first = dst / 8;
+	int32_t last = (dst + num - 1) / 8;
+	// Copy away from the overlap
+	int32_t step = src > dst ? 1 : -1;
+	int32_t byte = step > 0 ? first : last;
+	for (int32_t done = 0; done <= last - first; done++, byte += step)
+	{
+		uint32_t start = (uint32_t)byte * 8;
+		uint8_t mask = 0xFF;
+		if (start < dst)
+		{
+			mask &= 0xFF >> (dst - start);
+		}
+		if (start + 8 > dst + num)
+		{
+			mask &= 0xFF << (start + 8 - dst - num);
+		}
+
+		// 8 source bits for this byte, can start in front of the buffer for the first byte
+		int32_t pos = (int32_t)start + ((int32_t)src - (int32_t)dst);
+		int32_t src_byte = pos >= 0 ? pos / 8 : -((7 - pos) / 8);
+		uint8_t shift = pos - src_byte * 8;
+		uint16_t word = 0;
+		if ((src_byte >= 0) && ((uint32_t)src_byte < buffer1_size))
+		{
+			word = buffer1[src_byte] << 8;
+		}
+		if ((src_byte + 1 >= 0) && ((uint32_t)(src_byte + 1) < buffer1_size))
+		{
+			word |= buffer1[src_byte + 1];
+		}
+		uint8_t bits = (uint8_t)(word >> (8 - shift));
+
+		buffer1[byte] = (buffer1[byte] & ~mask) | (bits & mask);
+	}
+}
+
+/**
+ * @brief Move the pixels of an area to the left
+ *        Works on whole bytes of the frame buffer instead of single pixels.
+ *        The dx columns at the right side keep their old pixels.
+ *
+ * @param x left side of the area
+ * @param y top of the area
+ * @param w width of the area
+ * @param h height of the area
+ * @param dx number of pixels to move
+ */
+void RAK14000_SSD1681::scroll_left(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx)
+{
+	if ((x < 0) || (y < 0) || (x + w > width()) || (y + h > height()) || (dx <= 0) || (dx >= w))
+	{
+		return;
+	}
+
+	switch (getRotation())
+	{
+	case 1:
+		// A row is one run of bits, x ascending
+		for (int16_t row = y; row < y + h; row++)
+		{
+			copy_bits(bit_index(x, row), bit_index(x + dx, row), w - dx);
+		}
+		break;
+	case 3:
+		// A row is one run of bits, x descending
+		for (int16_t row = y; row < y + h; row++)
+		{
+			copy_bits(bit_index(x + w - dx - 1, row), bit_index(x + w - 1, row), w - dx);
+		}
+		break;
+	case 2:
+		// A column is one run of bits, y descending
+		for (int16_t col = x; col < x + w - dx; col++)
+		{
+			copy_bits(bit_index(col, y + h - 1), bit_index(col + dx, y + h - 1), h);
+		}
+		break;
+	default:
+		// A column is one run of bits, y ascending
+		for (int16_t col = x; col < x + w - dx; col++)
+		{
+			copy_bits(bit_index(col, y), bit_index(col + dx, y), h);
+		}
+		break;
+	}
+}
+
+/**
+ * @brief Check if an area is empty
+ *
+ */
+static bool box_empty(const epd_box_t &box)
+{
+	return (box.x2 < box.x1) || (box.y2 < box.y1);
+}
+
+/**
+ * @brief Add an area to another area
+ *
+ * @param box area that is extended
+ * @param add area to add
+ */
+static void box_add(epd_box_t &box, const epd_box_t &add)
+{
+	if (box_empty(add))
+	{
+		return;
+	}
+	if (box_empty(box))
+	{
+		box = add;
+		return;
+	}
+	box.x1 = add.x1 < box.x1 ? add.x1 : box.x1;
+	box.y1 = add.y1 < box.y1 ? add.y1 : box.y1;
+	box.x2 = add.x2 > box.x2 ? add.x2 : box.x2;
+	box.y2 = add.y2 > box.y2 ? add.y2 : box.y2;
+}
+
+/**
+ * @brief Check if two areas overlap
+ *
+ */
+static bool box_overlap(const epd_box_t &a, const epd_box_t &b)
+{
+	return !box_empty(a) && !box_empty(b) && (a.x1 <= b.x2) && (b.x1 <= a.x2) && (a.y1 <= b.y2) && (b.y1 <= a.y2);
+}
+
+/**
+ * @brief Draw a widget and remember its area and hash
+ *
+ * @param widget widget to draw
+ */
+static void draw_widget(epd_widget_t &widget)
+{
+	display.track(EPD_TRACK_DRAW);
+	widget.draw();
+	widget.box = display.tracked_box();
+	widget.hash = display.tracked_hash();
+	display.track(EPD_TRACK_OFF);
+}
+
+/**
+ * @brief Force a full refresh with the next update
+ *        Needed after the screen was drawn without widgets
+ *
+ */
+void invalidate_widgets_rak14000(void)
+{
+	shown_widgets = nullptr;
+}
+
+/**
+ * @brief Update the screen with the widgets of a UI
+ *        A new UI or a new background color is drawn completely with a full refresh.
+ *        Otherwise only the changed widgets are drawn and refreshed.
+ *
+ * @param widgets widgets of the UI, in drawing order
+ * @param num_widgets number of widgets
+ */
+void refresh_widgets_rak14000(epd_widget_t *widgets, uint8_t num_widgets)
+{
+	num_widgets = num_widgets > EPD_MAX_WIDGETS ? EPD_MAX_WIDGETS : num_widgets;
+
+	if ((widgets != shown_widgets) || (bg_color != shown_bg_color) || (partial_count >= EPD_PARTIAL_MAX))
+	{
+		clear_rak14000();
+		for (uint8_t idx = 0; idx < num_widgets; idx++)
+		{
+			draw_widget(widgets[idx]);
+		}
+		MYLOG("EPD", "Full refresh");
+		display.display();
+		shown_widgets = widgets;
+		shown_bg_color = bg_color;
+		partial_count = 0;
+		return;
+	}
+
+	// Find the widgets that changed, the old and the new area have to be cleared
+	epd_box_t cleared[EPD_MAX_WIDGETS];
+	epd_box_t refresh = {0, 0, -1, -1};
+	for (uint8_t idx = 0; idx < num_widgets; idx++)
+	{
+		cleared[idx] = {0, 0, -1, -1};
+
+		// Widgets that can scroll are updated in the buffer, without measuring
+		epd_box_t scrolled = {0, 0, -1, -1};
+		if ((widgets[idx].scroll != nullptr) && widgets[idx].scroll(&scrolled))
+		{
+			if (!box_empty(scrolled))
+			{
+				box_add(widgets[idx].box, scrolled);
+				widgets[idx].hash = 0;
+				box_add(refresh, scrolled);
+			}
+			continue;
+		}
+
+		display.track(EPD_TRACK_MEASURE);
+		widgets[idx].draw();
+		epd_box_t box = display.tracked_box();
+		uint32_t hash = display.tracked_hash();
+		display.track(EPD_TRACK_OFF);
+		if (hash != widgets[idx].hash)
+		{
+			cleared[idx] = widgets[idx].box;
+			box_add(cleared[idx], box);
+			box_add(refresh, cleared[idx]);
+		}
+	}
+	if (box_empty(refresh))
+	{
+		MYLOG("EPD", "No change");
+		return;
+	}
+
+	for (uint8_t idx = 0; idx < num_widgets; idx++)
+	{
+		if (!box_empty(cleared[idx]))
+		{
+			display.fillRect(cleared[idx].x1, cleared[idx].y1, cleared[idx].x2 - cleared[idx].x1 + 1, cleared[idx].y2 - cleared[idx].y1 + 1, bg_color);
+		}
+	}
+
+	// Draw the changed widgets and the unchanged widgets that were partly cleared
+	for (uint8_t idx = 0; idx < num_widgets; idx++)
+	{
+		bool changed = !box_empty(cleared[idx]);
+		bool redraw = changed;
+		for (uint8_t clear_idx = 0; clear_idx < num_widgets; clear_idx++)
+		{
+			redraw |= box_overlap(widgets[idx].box, cleared[clear_idx]);
+		}
+		if (redraw)
+		{
+			uint32_t hash = widgets[idx].hash;
+			draw_widget(widgets[idx]);
+			// A value that is read again while drawing can differ from the measured one
+			if (changed || (widgets[idx].hash != hash))
+			{
+				box_add(refresh, widgets[idx].box);
+			}
+		}
+	}
+
+	MYLOG("EPD", "Partial refresh %d %d %d %d", refresh.x1, refresh.y1, refresh.x2, refresh.y2);
+	display.displayPartial(refresh.x1, refresh.y1, refresh.x2, refresh.y2);
+	partial_count++;
+}
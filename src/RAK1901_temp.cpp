@@ -29,12 +29,14 @@ bool _has_last_values = false;
  */
 bool init_rak1901(void)
 {
-	Wire.setClock(100000); // Wire.setClock(400000);
+	i2c_bus_acquire(TEMP_ID);
 	if (shtc3.begin(Wire) != SHTC3_Status_Nominal)
 	{
 		MYLOG("T_H", "Could not initialize SHTC3");
+		i2c_bus_release(TEMP_ID);
 		return false;
 	}
+	i2c_bus_release(TEMP_ID);
 	return true;
 }
 
@@ -46,6 +48,7 @@ bool init_rak1901(void)
  */
 void read_rak1901(void)
 {
+	i2c_bus_acquire(TEMP_ID);
 	MYLOG("T_H", "Reading SHTC3");
 	shtc3.update();
 
@@ -74,6 +77,7 @@ void read_rak1901(void)
 		_last_humid = 0.0;
 		_has_last_values = false;
 	}
+	i2c_bus_release(TEMP_ID);
 }
 
 /**
@@ -109,8 +113,10 @@ void get_rak1901_values(float *values)
  */
 void start_up_rak1901(void)
 {
+	i2c_bus_acquire(TEMP_ID);
 	shtc3.wake(false);
 	shtc3.update();
+	i2c_bus_release(TEMP_ID);
 }
 
 /**
@@ -119,5 +125,7 @@ void start_up_rak1901(void)
  */
 void shut_down_rak1901(void)
 {
+	i2c_bus_acquire(TEMP_ID);
 	shtc3.sleep(true);
+	i2c_bus_release(TEMP_ID);
 }
\ No newline at end of file
@@ -22,19 +22,34 @@ LPS35HW lps;
  */
 bool init_rak1902(void)
 {
+	i2c_bus_acquire(PRESS_ID);
 	Wire.begin();
 	if (!lps.begin(&Wire))
 	{
 		MYLOG("PRESS", "Could not initialize LPS2X on Wire");
+		i2c_bus_release(PRESS_ID);
 		return false;
 	}
 
 	lps.setLowPower(true);
 	lps.setOutputRate(LPS35HW::OutputRate_75Hz);	   // 75 Hz sample rate
 	lps.setLowPassFilter(LPS35HW::LowPassFilter_ODR9); // default is off
+	i2c_bus_release(PRESS_ID);
 	return true;
 }
 
+/**
+ * @brief Start a barometric pressure reading
+ *     The sensor is already running at 75Hz since it was
+ *     woken up, it only needs some time for a fresh sample
+ *
+ * @return uint32_t time in ms until the result can be read
+ */
+uint32_t start_rak1902(void)
+{
+	return 100;
+}
+
 /**
  * @brief Read the barometric pressure
  *     Data is added to Cayenne LPP payload as channel
@@ -43,10 +58,9 @@ bool init_rak1902(void)
  */
 void read_rak1902(void)
 {
+	i2c_bus_acquire(PRESS_ID);
 	MYLOG("PRESS", "Reading LPS22HB");
 
-	// Give the sensor some time to read
-	delay(100);
 	float pressure = lps.readPressure(); // hPa
 
 	// Switch back to low power mode
@@ -60,6 +74,7 @@ void read_rak1902(void)
 #if HAS_EPD > 0
 	set_baro_rak14000(pressure);
 #endif
+	i2c_bus_release(PRESS_ID);
 }
 
 /**
@@ -71,7 +86,10 @@ float get_rak1902(void)
 {
 	delay(500); // Give the sensor some time
 
-	return lps.readPressure(); // hPa
+	i2c_bus_acquire(PRESS_ID);
+	float pressure = lps.readPressure(); // hPa
+	i2c_bus_release(PRESS_ID);
+	return pressure;
 }
 
 /**
@@ -80,8 +98,10 @@ float get_rak1902(void)
  */
 void startup_rak1902(void)
 {
+	i2c_bus_acquire(PRESS_ID);
 	lps.setLowPower(false);						 // Disable low power mode
 	lps.setOutputRate(LPS35HW::OutputRate_75Hz); // 75 Hz sample rate
+	i2c_bus_release(PRESS_ID);
 }
 
 /**
@@ -90,6 +110,8 @@ void startup_rak1902(void)
  */
 void shut_down_rak1902(void)
 {
+	i2c_bus_acquire(PRESS_ID);
 	lps.setLowPower(true);
 	lps.setOutputRate(LPS35HW::OutputRate_OneShot); // 75 Hz sample rate
+	i2c_bus_release(PRESS_ID);
 }
\ No newline at end of file
@@ -24,10 +24,12 @@ ClosedCube_OPT3001 opt3001;
  */
 bool init_rak1903(void)
 {
+	i2c_bus_acquire(LIGHT_ID);
 	Wire.begin();
 	if (opt3001.begin(OPT3001_ADDRESS) != NO_ERROR)
 	{
 		MYLOG("LIGHT", "Could not initialize SHTC3");
+		i2c_bus_release(LIGHT_ID);
 		return false;
 	}
 
@@ -42,8 +44,10 @@ bool init_rak1903(void)
 	if (errorConfig != NO_ERROR)
 	{
 		MYLOG("LIGHT", "Could not configure OPT3001");
+		i2c_bus_release(LIGHT_ID);
 		return false;
 	}
+	i2c_bus_release(LIGHT_ID);
 	return true;
 }
 
@@ -55,6 +59,7 @@ bool init_rak1903(void)
  */
 void read_rak1903()
 {
+	i2c_bus_acquire(LIGHT_ID);
 	MYLOG("LIGHT", "Reading OPT3001");
 	OPT3001 result = opt3001.readResult();
 	if (result.error == NO_ERROR)
@@ -70,6 +75,7 @@ void read_rak1903()
 		MYLOG("LIGHT", "Error reading OPT3001");
 		g_solution_data.addLuminosity(LPP_CHANNEL_LIGHT, 0);
 	}
+	i2c_bus_release(LIGHT_ID);
 }
 
 /**
@@ -93,6 +93,7 @@ void bsec_read_wakeup(void)
  */
 bool init_rak1906_bsec(void)
 {
+	i2c_bus_acquire(ENV_ID);
 	Wire.begin();
 
 	iaqSensor.begin(BME680_I2C_ADDR_PRIMARY, Wire);
@@ -102,6 +103,7 @@ bool init_rak1906_bsec(void)
 	if (!check_rak1906_status())
 	{
 		MYLOG("BSEC", "Status error");
+		i2c_bus_release(ENV_ID);
 		return false;
 	}
 
@@ -112,6 +114,7 @@ bool init_rak1906_bsec(void)
 	if (!check_rak1906_status())
 	{
 		MYLOG("BSEC", "Status error");
+		i2c_bus_release(ENV_ID);
 		return false;
 	}
 
@@ -126,6 +129,7 @@ bool init_rak1906_bsec(void)
 	#ifdef ARDUINO_ARCH_RP2040
 		bsec_read_timer.attach(bsec_read_wakeup, (microseconds)(150000000));
 	#endif
+	i2c_bus_release(ENV_ID);
 	do_read_rak1906_bsec();
 
 	return check_rak1906_status();
@@ -224,6 +228,7 @@ bool check_rak1906_status(void)
  */
 bool do_read_rak1906_bsec(void)
 {
+	i2c_bus_acquire(ENV_ID);
 	MYLOG("BSEC", "Start reading BME680");
 	if (iaqSensor.run())
 	{
@@ -241,6 +246,7 @@ bool do_read_rak1906_bsec(void)
 	{
 		MYLOG("BSEC", "No data available");
 	}
+	i2c_bus_release(ENV_ID);
 	return check_rak1906_status();
 }
 #endif // USE_BSEC == 1
\ No newline at end of file
@@ -34,11 +34,13 @@ float _last_pressure_rak1906 = 0;
  */
 bool init_rak1906(void)
 {
+	i2c_bus_acquire(ENV_ID);
 	Wire.begin();
 
 	if (!bme.begin(0x76))
 	{
 		MYLOG("BME", "Could not find a valid BME680 sensor, check wiring!");
+		i2c_bus_release(ENV_ID);
 		return false;
 	}
 
@@ -52,17 +54,38 @@ bool init_rak1906(void)
 	bme.setGasHeater(0, 0); // switch off
 	MYLOG("BME", "Setup BME680 sensor finished");
 
+	i2c_bus_release(ENV_ID);
 	return true;
 }
 
 /**
  * @brief Start sensing on the BME6860
  *
+ * @return uint32_t time in ms until the measurement is finished
  */
-void start_rak1906(void)
+uint32_t start_rak1906(void)
 {
+	i2c_bus_acquire(ENV_ID);
 	MYLOG("BME", "Start BME reading");
-	bme.beginReading();
+	unsigned long end_time = bme.beginReading();
+	if ((end_time == 0) || (end_time < millis()))
+	{
+		i2c_bus_release(ENV_ID);
+		return 0;
+	}
+	i2c_bus_release(ENV_ID);
+	return end_time - millis();
+}
+
+/**
+ * @brief Check if the BME680 measurement is finished
+ *
+ * @return true if the result can be read
+ * @return false if the measurement is still running
+ */
+bool ready_rak1906(void)
+{
+	return bme.remainingReadingMillis() <= 0;
 }
 
 /**
@@ -77,21 +100,11 @@ void start_rak1906(void)
  */
 bool read_rak1906()
 {
-	time_t wait_start = millis();
-	bool read_success = false;
-	while ((millis() - wait_start) < 5000)
-	{
-		if (bme.endReading())
-		{
-			read_success = true;
-			break;
-		}
-		delay(100);
-	}
-
-	if (!read_success)
+	i2c_bus_acquire(ENV_ID);
+	if (!bme.endReading())
 	{
 		MYLOG("BME", "BME680 read failed");
+		i2c_bus_release(ENV_ID);
 		return false;
 	}
 
@@ -115,6 +128,7 @@ bool read_rak1906()
 	set_baro_rak14000(bme.pressure / 100.0);
 #endif
 
+	i2c_bus_release(ENV_ID);
 	return true;
 }
 
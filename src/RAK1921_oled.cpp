@@ -47,6 +47,7 @@ SSD1306Wire oled_display(0x3c, PIN_WIRE_SDA, PIN_WIRE_SCL, GEOMETRY_128_64, &Wir
  */
 bool init_rak1921(void)
 {
+	i2c_bus_acquire(OLED_ID);
 	Wire.begin();
 
 	delay(500); // Give display reset some time
@@ -62,6 +63,7 @@ bool init_rak1921(void)
 	oled_display.display();
 	// taskEXIT_CRITICAL();
 
+	i2c_bus_release(OLED_ID);
 	return true;
 }
 
@@ -70,6 +72,7 @@ bool init_rak1921(void)
  */
 void rak1921_write_header(char *header_line)
 {
+	i2c_bus_acquire(OLED_ID);
 	// taskENTER_CRITICAL();
 	oled_display.setFont(ArialMT_Plain_10);
 
@@ -86,6 +89,7 @@ void rak1921_write_header(char *header_line)
 	oled_display.drawLine(0, 11, 128, 11);
 	oled_display.display();
 	// taskEXIT_CRITICAL();
+	i2c_bus_release(OLED_ID);
 }
 
 /**
@@ -122,6 +126,7 @@ void rak1921_add_line(char *line)
  */
 void rak1921_show(void)
 {
+	i2c_bus_acquire(OLED_ID);
 	oled_display.setColor(BLACK);
 	oled_display.fillRect(0, STATUS_BAR_HEIGHT + 1, OLED_WIDTH, OLED_HEIGHT);
 
@@ -133,4 +138,5 @@ void rak1921_show(void)
 		oled_display.drawString(0, (line * LINE_HEIGHT) + STATUS_BAR_HEIGHT + 1, disp_buffer[line]);
 	}
 	oled_display.display();
+	i2c_bus_release(OLED_ID);
 }
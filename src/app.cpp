@@ -42,6 +42,18 @@ bool low_batt_protection = false;
 /** LoRaWAN packet */
 WisCayenne g_solution_data(255);
 
+/** P2P short address, 0 = use the DevEUI as P2P header */
+uint16_t g_p2p_short_addr = 0;
+
+/** P2P frame for packets that are not in g_solution_data */
+static uint8_t p2p_frame[255];
+
+/** Selected payload format, PAYLOAD_LPP or PAYLOAD_COMPACT */
+uint8_t g_payload_format = PAYLOAD_LPP;
+
+/** Buffer for the compact payload */
+uint8_t compact_packet[COMPACT_MAX_SIZE];
+
 char disp_txt[64] = {0};
 
 /**
@@ -71,6 +83,9 @@ void setup_app(void)
 	pinMode(WB_IO2, OUTPUT);
 	digitalWrite(WB_IO2, HIGH);
 
+	// The bus is shared with the display task
+	i2c_bus_init();
+
 	// Scan the I2C interfaces for devices
 	find_modules();
 
@@ -110,6 +125,25 @@ bool init_app(void)
 	// Get the battery check setting
 	read_batt_settings();
 
+	// Get the payload format setting
+	read_payload_settings();
+
+	// Get the number of samples per uplink
+	read_batch_settings();
+
+	// Get the channel priorities of the payload planner
+	read_priority_settings();
+
+	// Get the heartbeat and the channel deltas of the change driven reporting
+	read_report_settings();
+
+	// Get the P2P short address, the P2P header is written in front of the packet
+	read_p2p_settings();
+	g_solution_data.reserveHeader(P2P_HEADER_MAX);
+
+	// Get the sensors disabled by downlink or AT command
+	read_sensor_settings();
+
 	AT_PRINTF("============================\n");
 	AT_PRINTF("Air Quality Sensor\n");
 	AT_PRINTF("Built with RAK's WisBlock\n");
@@ -141,9 +175,12 @@ bool init_app(void)
 		rak1921_add_line(disp_txt);
 	}
 
-	// Prepare timer to send after the sensors were awake for 30 seconds
+	// Prepare timer to send after the sensors are ready, period is set by schedule_sending()
 	delayed_sending.begin(30000, send_delayed, NULL, false);
 
+	// Prepare timer for the history dump requested by downlink
+	init_downlink_cmd();
+
 	if (!g_lorawan_settings.lorawan_enable)
 	{
 		api_wake_loop(STATUS);
@@ -155,165 +192,352 @@ bool init_app(void)
 }
 
 /**
- * @brief Application specific event handler
- *        Requires as minimum the handling of STATUS event
- *        Here you handle as well your application specific events
+ * @brief Start the timer for the SEND_NOW event
+ *
+ * @param wait_ms time in ms until SEND_NOW
  */
-void app_event_handler(void)
+void schedule_sending(uint32_t wait_ms)
 {
-	if ((g_task_event_type & STATUS) == STATUS)
+#ifdef NRF52_SERIES
+	delayed_sending.stop();
+	delayed_sending.setPeriod(wait_ms);
+	delayed_sending.start();
+#endif
+#ifdef ESP32
+	delayed_sending.attach_ms(wait_ms, send_delayed);
+#endif
+}
+
+/**
+ * @brief Size of the P2P header
+ *
+ * @return uint8_t P2P_SHORT_ADDR_SIZE if a short address is set, otherwise P2P_HEADER_MAX for the DevEUI
+ */
+uint8_t p2p_header_size(void)
+{
+	return g_p2p_short_addr != 0 ? P2P_SHORT_ADDR_SIZE : P2P_HEADER_MAX;
+}
+
+/**
+ * @brief Write the P2P header, the short address or the DevEUI
+ *
+ * @param header buffer for the header, at least P2P_HEADER_MAX bytes
+ * @return uint8_t size of the header
+ */
+static uint8_t p2p_header(uint8_t *header)
+{
+	if (g_p2p_short_addr != 0)
 	{
-		MYLOG("APP", "Wake-up, power up sensors");
-		power_modules(true);
-		g_task_event_type &= N_STATUS;
-		delayed_sending.start();
+		header[0] = (uint8_t)(g_p2p_short_addr >> 8);
+		header[1] = (uint8_t)(g_p2p_short_addr);
 	}
-
-	// Timer triggered event
-	if ((g_task_event_type & SEND_NOW) == SEND_NOW)
+	else
 	{
-		g_task_event_type &= N_SEND_NOW;
-		MYLOG("APP", "Start reading and sending");
+		memcpy(header, g_lorawan_settings.node_device_eui, P2P_HEADER_MAX);
+	}
+	return p2p_header_size();
+}
 
-// #if USE_BSEC == 0
-// 		/*********************************************/
-// 		/** Select between Bosch BSEC algorithm for  */
-// 		/** IAQ index or simple T/H/P readings       */
-// 		/*********************************************/
-// 		if (found_sensors[ENV_ID].found_sensor) // Using simple T/H/P readings
-// 		{
-// 			// Startup the BME680
-// 			start_rak1906();
-// 		}
-// #endif
-// 		if (found_sensors[PRESS_ID].found_sensor)
-// 		{
-// 			// Startup the LPS22HB
-// 			start_rak1902();
-// 		}
+/**
+ * @brief Finish a sensor cycle without uplink
+ *
+ */
+static void skip_uplink(void)
+{
+#if HAS_EPD > 0
+	// There is no TX finished event, refresh the display now
+	wake_rak14000();
+#endif
+	g_solution_data.reset();
+	power_modules(false);
+}
 
-// #if defined NRF52_SERIES || defined ESP32
-// 		// If BLE is enabled, restart Advertising
-// 		if (g_enable_ble)
-// 		{
-// 			restart_advertising(15);
-// 		}
-// #endif
+/**
+ * @brief Add the battery level, send the packet and power down the sensors
+ *        Called after all sensor values are in the payload
+ *
+ */
+void send_sensor_data(void)
+{
+	// Get battery level
+	float batt_level_f = read_batt();
+	g_solution_data.addVoltage(LPP_CHANNEL_BATT, batt_level_f / 1000.0);
 
-		// Reset the packet
-		g_solution_data.reset();
+	if (found_sensors[OLED_ID].found_sensor)
+	{
+		if (found_sensors[RTC_ID].found_sensor)
+		{
+			read_rak12002();
+			snprintf(disp_txt, 64, "%d:%02d Bat %.3fV", g_date_time.hour, g_date_time.minute, batt_level_f / 1000);
+		}
+		else
+		{
+			snprintf(disp_txt, 64, "Battery %.3fV", batt_level_f / 1000);
+		}
+		rak1921_add_line(disp_txt);
+	}
 
-		if (!low_batt_protection)
+	// Protection against battery drain if battery check is enabled
+	if (battery_check_enabled)
+	{
+		if (batt_level_f < 2900)
 		{
-			MYLOG("APP", "Start reading the sensors");
-			// Get values from the connected modules
-			get_sensor_values();
+			// Battery is very low, change send time to 1 hour to protect battery
+			low_batt_protection = true; // Set low_batt_protection active
+			api_timer_restart(1 * 60 * 60 * 1000);
+			MYLOG("APP", "Battery protection activated");
 		}
+		else if ((batt_level_f > 4100) && low_batt_protection)
+		{
+			// Battery is higher than 4V, change send time back to original setting
+			low_batt_protection = false;
+			api_timer_restart(g_lorawan_settings.send_repeat_time);
+			MYLOG("APP", "Battery protection deactivated");
+		}
+	}
 
-		// Get battery level
-		float batt_level_f = read_batt();
-		g_solution_data.addVoltage(LPP_CHANNEL_BATT, batt_level_f / 1000.0);
+	uint8_t *packet = g_solution_data.getBuffer();
+	uint8_t packet_size = g_solution_data.getSize();
 
-		if (found_sensors[OLED_ID].found_sensor)
+	// Skip the uplink if no value changed enough, unless the heartbeat is due or values are kept
+	if (!report_due(packet, packet_size) && (plan_carry_size() == 0))
+	{
+		skip_uplink();
+		return;
+	}
+
+	// Send what fits into the current data rate, keep the rest for the next uplink
+	bool batching = (g_batch_samples > 1) || (batch_count() != 0);
+	uint8_t max_payload = plan_max_payload();
+	uint8_t max_sample = batching ? batch_max_sample(max_payload) : max_payload;
+	packet_size = plan_payload(packet, packet_size, max_sample, &packet);
+
+	// The values count as reported only after the uplink was enqueued
+	uint8_t *report_packet = packet;
+	uint8_t report_size = packet_size;
+	bool sent = false;
+
+	if (g_payload_format == PAYLOAD_COMPACT)
+	{
+		// Convert to compact payload, send as Cayenne LPP if a value is not in the schema
+		uint8_t compact_size = compact_encode(packet, packet_size, compact_packet, sizeof(compact_packet));
+		if (compact_size != 0)
 		{
-			if (found_sensors[RTC_ID].found_sensor)
-			{
-				read_rak12002();
-				snprintf(disp_txt, 64, "%d:%02d Bat %.3fV", g_date_time.hour, g_date_time.minute, batt_level_f / 1000);
-			}
-			else
-			{
-				snprintf(disp_txt, 64, "Battery %.3fV", batt_level_f / 1000);
-			}
-			rak1921_add_line(disp_txt);
+			packet = compact_packet;
+			packet_size = compact_size;
 		}
+	}
 
-		// Protection against battery drain if battery check is enabled
-		if (battery_check_enabled)
+	bool batch_sent = false;
+	if (batching)
+	{
+		// Collect the sample, send only if the batch is complete
+		if (!batch_add(packet, packet_size, max_payload))
 		{
-			if (batt_level_f < 2900)
-			{
-				// Battery is very low, change send time to 1 hour to protect battery
-				low_batt_protection = true; // Set low_batt_protection active
-				api_timer_restart(1 * 60 * 60 * 1000);
-				MYLOG("APP", "Battery protection activated");
-			}
-			else if ((batt_level_f > 4100) && low_batt_protection)
-			{
-				// Battery is higher than 4V, change send time back to original setting
-				low_batt_protection = false;
-				api_timer_restart(g_lorawan_settings.send_repeat_time);
-				MYLOG("APP", "Battery protection deactivated");
-			}
+			// The sample is in the frame
+			plan_sent();
+			skip_uplink();
+			return;
 		}
+		packet_size = batch_frame(&packet);
+		batch_sent = true;
+	}
 
-		MYLOG("APP", "Packetsize %d", g_solution_data.getSize());
-		if (g_lorawan_settings.lorawan_enable)
+	MYLOG("APP", "Packetsize %d", packet_size);
+	if (g_lorawan_settings.lorawan_enable)
+	{
+		lmh_error_status result = send_lora_packet(packet, packet_size);
+		switch (result)
 		{
-			lmh_error_status result = send_lora_packet(g_solution_data.getBuffer(), g_solution_data.getSize());
-			switch (result)
+		case LMH_SUCCESS:
+			sent = true;
+			if (found_sensors[OLED_ID].found_sensor)
 			{
-			case LMH_SUCCESS:
-				if (found_sensors[OLED_ID].found_sensor)
+				if (found_sensors[RTC_ID].found_sensor)
+				{
+					read_rak12002();
+					snprintf(disp_txt, 64, "%d:%02d Pkg %d b", g_date_time.hour, g_date_time.minute, packet_size);
+				}
+				else
 				{
-					if (found_sensors[RTC_ID].found_sensor)
-					{
-						read_rak12002();
-						snprintf(disp_txt, 64, "%d:%02d Pkg %d b", g_date_time.hour, g_date_time.minute, g_solution_data.getSize());
-					}
-					else
-					{
-						snprintf(disp_txt, 64, "Packet sent %d b", g_solution_data.getSize());
-					}
-					rak1921_add_line(disp_txt);
+					snprintf(disp_txt, 64, "Packet sent %d b", packet_size);
 				}
-				MYLOG("APP", "Packet enqueued");
-				break;
-			case LMH_BUSY:
-				MYLOG("APP", "LoRa transceiver is busy");
-				AT_PRINTF("+EVT:BUSY\n");
-				break;
-			case LMH_ERROR:
-				AT_PRINTF("+EVT:SIZE_ERROR\n");
-				MYLOG("APP", "Packet error, too big to send with current DR");
-				break;
+				rak1921_add_line(disp_txt);
 			}
+			MYLOG("APP", "Packet enqueued");
+			break;
+		case LMH_BUSY:
+			MYLOG("APP", "LoRa transceiver is busy");
+			AT_PRINTF("+EVT:BUSY\n");
+			break;
+		case LMH_ERROR:
+			AT_PRINTF("+EVT:SIZE_ERROR\n");
+			MYLOG("APP", "Packet error, too big to send with current DR");
+			break;
+		}
+	}
+	else
+	{
+		uint8_t header[P2P_HEADER_MAX];
+		uint8_t header_size = p2p_header(header);
+		uint8_t *frame;
+		if (packet == g_solution_data.getBuffer())
+		{
+			// Write the header into the reserved space in front of the Cayenne LPP packet
+			frame = g_solution_data.setHeader(header, header_size);
 		}
 		else
 		{
-			uint8_t packet_buffer[g_solution_data.getSize() + 8];
-			memcpy(packet_buffer, g_lorawan_settings.node_device_eui, 8);
-			memcpy(&packet_buffer[8], g_solution_data.getBuffer(), g_solution_data.getSize());
+			// Compact, planned or batched packet
+			memcpy(p2p_frame, header, header_size);
+			memcpy(&p2p_frame[header_size], packet, packet_size);
+			frame = p2p_frame;
+		}
 
-			// Send packet over LoRa
-			if (send_p2p_packet(packet_buffer, g_solution_data.getSize() + 8))
+		// Send packet over LoRa
+		if (send_p2p_packet(frame, packet_size + header_size))
+		{
+			sent = true;
+			if (found_sensors[OLED_ID].found_sensor)
 			{
-				if (found_sensors[OLED_ID].found_sensor)
+				if (found_sensors[RTC_ID].found_sensor)
 				{
-					if (found_sensors[RTC_ID].found_sensor)
-					{
-						read_rak12002();
-						snprintf(disp_txt, 64, "%d:%02d Pkg %d b", g_date_time.hour, g_date_time.minute, g_solution_data.getSize());
-					}
-					else
-					{
-						snprintf(disp_txt, 64, "Packet sent %d b", g_solution_data.getSize());
-					}
-					rak1921_add_line(disp_txt);
+					read_rak12002();
+					snprintf(disp_txt, 64, "%d:%02d Pkg %d b", g_date_time.hour, g_date_time.minute, packet_size);
 				}
-				MYLOG("APP", "Packet enqueued");
+				else
+				{
+					snprintf(disp_txt, 64, "Packet sent %d b", packet_size);
+				}
+				rak1921_add_line(disp_txt);
 			}
-			else
+			MYLOG("APP", "Packet enqueued");
+		}
+		else
+		{
+			AT_PRINTF("+EVT:SIZE_ERROR\n");
+			MYLOG("APP", "Packet too big");
+		}
+	}
+	if (sent)
+	{
+		// In a batch the sample is sent with this frame or as the first record of the next frame
+		report_sent(report_packet, report_size);
+		plan_sent();
+	}
+
+	// Reset the packet
+	g_solution_data.reset();
+	if (batch_sent && sent)
+	{
+		// A frame that was not sent is kept and sent with the next sample
+		batch_clear();
+	}
+
+	// Power down the modules
+	power_modules(false);
+}
+
+/**
+ * @brief Application specific event handler
+ *        Requires as minimum the handling of STATUS event
+ *        Here you handle as well your application specific events
+ */
+void app_event_handler(void)
+{
+	if ((g_task_event_type & STATUS) == STATUS)
+	{
+		MYLOG("APP", "Wake-up, power up sensors");
+		power_modules(true);
+		g_task_event_type &= N_STATUS;
+
+		// Send as soon as all sensors are ready
+		uint32_t wait_ms = sensors_ready_wait();
+		if (wait_ms == 0)
+		{
+			api_wake_loop(SEND_NOW);
+		}
+		else
+		{
+			schedule_sending(wait_ms);
+		}
+	}
+
+	// Timer triggered event
+	if ((g_task_event_type & SEND_NOW) == SEND_NOW)
+	{
+		g_task_event_type &= N_SEND_NOW;
+		// Check if all sensors are ready, otherwise check again later
+		uint32_t wait_ms = sensors_ready_wait();
+		if (wait_ms != 0)
+		{
+			MYLOG("APP", "Sensors not ready, wait %ld ms", wait_ms);
+			schedule_sending(wait_ms);
+		}
+		else
+		{
+			MYLOG("APP", "Start reading and sending");
+
+// #if USE_BSEC == 0
+// 			/*********************************************/
+// 			/** Select between Bosch BSEC algorithm for  */
+// 			/** IAQ index or simple T/H/P readings       */
+// 			/*********************************************/
+// 			if (found_sensors[ENV_ID].found_sensor) // Using simple T/H/P readings
+// 			{
+// 				// Startup the BME680
+// 				start_rak1906();
+// 			}
+// #endif
+// 			if (found_sensors[PRESS_ID].found_sensor)
+// 			{
+// 				// Startup the LPS22HB
+// 				start_rak1902();
+// 			}
+
+// #if defined NRF52_SERIES || defined ESP32
+// 			// If BLE is enabled, restart Advertising
+// 			if (g_enable_ble)
+// 			{
+// 				restart_advertising(15);
+// 			}
+// #endif
+
+			// Reset the packet
+			g_solution_data.reset();
+
+			bool values_complete = true;
+			if (!low_batt_protection)
+			{
+				MYLOG("APP", "Start reading the sensors");
+				// Get values from the connected modules, slow sensors are collected on ACQ_POLL events
+				values_complete = get_sensor_values();
+			}
+
+			if (values_complete)
 			{
-				AT_PRINTF("+EVT:SIZE_ERROR\n");
-				MYLOG("APP", "Packet too big");
+				send_sensor_data();
 			}
 		}
-		// Reset the packet
-		g_solution_data.reset();
+	}
+
+	// Sensor acquisition poll event
+	if ((g_task_event_type & ACQ_POLL) == ACQ_POLL)
+	{
+		g_task_event_type &= N_ACQ_POLL;
+
+		if (poll_sensor_values())
+		{
+			send_sensor_data();
+		}
+	}
 
-		// Power down the modules
-		power_modules(false);
+	// History dump requested by downlink
+	if ((g_task_event_type & HIST_DUMP) == HIST_DUMP)
+	{
+		g_task_event_type &= N_HIST_DUMP;
+
+		send_history_dump();
 	}
 
 	// VOC read request event
@@ -475,67 +699,18 @@ void lora_data_handler(void)
 	{
 		g_task_event_type &= N_LORA_DATA;
 		MYLOG("APP", "Received package over LoRa");
-		// Check if uplink was a send frequency change command
-		if ((g_last_fport == 3) && (g_rx_data_len == 6))
-		{
-			if (g_rx_lora_data[0] == 0xAA)
-			{
-				if (g_rx_lora_data[1] == 0x55)
-				{
-					uint32_t new_send_frequency = 0;
-					new_send_frequency |= (uint32_t)(g_rx_lora_data[2]) << 24;
-					new_send_frequency |= (uint32_t)(g_rx_lora_data[3]) << 16;
-					new_send_frequency |= (uint32_t)(g_rx_lora_data[4]) << 8;
-					new_send_frequency |= (uint32_t)(g_rx_lora_data[5]);
-
-					MYLOG("APP", "Received new send frequency %ld s\n", new_send_frequency);
-					// Save the new send frequency
-					g_lorawan_settings.send_repeat_time = new_send_frequency * 1000;
-
-					// Set the timer to the new send frequency
-					api_timer_restart(g_lorawan_settings.send_repeat_time);
-					// Save the new send frequency
-					save_settings();
-				}
-			}
-		}
+		// Check if downlink was a configuration command
+		downlink_cmd_handler(g_last_fport, g_rx_lora_data, g_rx_data_len);
 
 		if (g_lorawan_settings.lorawan_enable)
 		{
-			// AT_PRINTF("+EVT:RX_1, RSSI %d, SNR %d\n", g_last_rssi, g_last_snr);
-			// AT_PRINTF("+EVT:%d:", g_last_fport);
-			// for (int idx = 0; idx < g_rx_data_len; idx++)
-			// {
-			// 	AT_PRINTF("%02X", g_rx_lora_data[idx]);
-			// }
-			// AT_PRINTF("\n");
-
-			char rx_msg[512] = {0};
-			int len = sprintf(rx_msg, "+EVT:RX_1:%d:%d:UNICAST:%d:", g_last_rssi, g_last_snr, g_last_fport);
-			for (int idx = 0; idx < g_rx_data_len; idx++)
-			{
-				sprintf(&rx_msg[len] , "%02X", g_rx_lora_data[idx]);
-				len +=2;
-			}
-			AT_PRINTF("%s\n", rx_msg);
+			AT_PRINTF("+EVT:RX_1:%d:%d:UNICAST:%d:", g_last_rssi, g_last_snr, g_last_fport);
+			at_print_hex(g_rx_lora_data, g_rx_data_len);
 		}
 		else
 		{
-			// AT_PRINTF("+EVT:RXP2P, RSSI %d, SNR %d\n", g_last_rssi, g_last_snr);
-			// AT_PRINTF("+EVT:");
-			// for (int idx = 0; idx < g_rx_data_len; idx++)
-			// {
-			// 	AT_PRINTF("%02X", g_rx_lora_data[idx]);
-			// }
-			// AT_PRINTF("\n");
-			char rx_msg[512] = {0};
-			int len = sprintf(rx_msg, "+EVT:RXP2P:%d:%d:", g_last_rssi, g_last_snr);
-			for (int idx = 0; idx < g_rx_data_len; idx++)
-			{
-				sprintf(&rx_msg[len], "%02X", g_rx_lora_data[idx]);
-				len += 2;
-			}
-			AT_PRINTF("%s\n", rx_msg);
+			AT_PRINTF("+EVT:RXP2P:%d:%d:", g_last_rssi, g_last_snr);
+			at_print_hex(g_rx_lora_data, g_rx_data_len);
 		}
 	}
 }
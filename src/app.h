@@ -117,6 +117,8 @@ using namespace std::chrono;
 void setup_app(void);
 bool init_app(void);
 void app_event_handler(void);
+void schedule_sending(uint32_t wait_ms);
+void send_sensor_data(void);
 void ble_data_handler(void) __attribute__((weak));
 void lora_data_handler(void);
 void init_user_at(void);
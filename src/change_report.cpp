@@ -0,0 +1,180 @@
+/**
+ * @file change_report.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Send an uplink only if a value changed or the heartbeat is due
+ *        Each value is compared with the last sent value of its channel.
+ *        The delta is in the resolution of the Cayenne LPP value, e.g. 0.1 °C for a temperature.
+ *        A delta of 0 means the channel does not trigger an uplink.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+
+/** Maximum time between two uplinks in seconds, 0 = send every sample */
+uint32_t g_report_heartbeat = 0;
+
+/** Change per LPP channel that triggers an uplink */
+uint16_t g_report_delta[PLAN_NUM_CHANNELS];
+
+/** Last sent value per channel */
+static int32_t last_value[PLAN_NUM_CHANNELS];
+
+/** Channels with a last sent value */
+static uint64_t last_valid = 0;
+
+/** Time of the last sent sample */
+static uint32_t last_report_ms = 0;
+
+/** Number of samples that were not sent */
+static uint16_t skipped = 0;
+
+/** Default delta per LPP channel */
+static const struct
+{
+	uint8_t channel;
+	uint16_t delta;
+} default_delta[] = {
+	{LPP_CHANNEL_HUMID, 10},		 // 5 %RH
+	{LPP_CHANNEL_TEMP, 10},			 // 1 °C
+	{LPP_CHANNEL_PRESS, 20},		 // 2 hPa
+	{LPP_CHANNEL_LIGHT, 100},		 // 100 lux
+	{LPP_CHANNEL_HUMID_2, 10},		 // 5 %RH
+	{LPP_CHANNEL_TEMP_2, 10},		 // 1 °C
+	{LPP_CHANNEL_PRESS_2, 20},		 // 2 hPa
+	{LPP_CHANNEL_GAS_2, 1000},		 // IAQ 10
+	{LPP_CHANNEL_LIGHT2, 100},		 // 100 lux
+	{LPP_CHANNEL_VOC, 10},			 // VOC index 10
+	{LPP_CHANNEL_CO2_2, 50},		 // 50 ppm
+	{LPP_CHANNEL_CO2_Temp_2, 10},	 // 1 °C
+	{LPP_CHANNEL_CO2_HUMID_2, 10},	 // 5 %RH
+	{LPP_CHANNEL_PM_1_0, 5},		 // 5 ug/m3
+	{LPP_CHANNEL_PM_2_5, 5},		 // 5 ug/m3
+	{LPP_CHANNEL_PM_10_0, 5},		 // 5 ug/m3
+};
+
+/**
+ * @brief Set all channel deltas to the default values
+ *        Channels without default delta do not trigger an uplink
+ *
+ */
+void report_default_deltas(void)
+{
+	memset(g_report_delta, 0, sizeof(uint16_t) * PLAN_NUM_CHANNELS);
+	for (auto &entry : default_delta)
+	{
+		g_report_delta[entry.channel] = entry.delta;
+	}
+}
+
+/**
+ * @brief Walk through the values of a Cayenne LPP packet
+ *
+ * @param lpp Cayenne LPP packet
+ * @param size size of the packet
+ * @param pos position of the next value, updated to the following value
+ * @param channel set to the channel of the value
+ * @param value set to the value in LPP resolution
+ * @return true if a value was found
+ * @return false if the end of the packet or an unknown data type was found
+ */
+static bool next_value(const uint8_t *lpp, uint8_t size, uint8_t *pos, uint8_t *channel, int32_t *value)
+{
+	if (*pos + 2 > size)
+	{
+		return false;
+	}
+	bool is_signed;
+	uint8_t data_size = lpp_type_size(lpp[*pos + 1], &is_signed);
+	if ((data_size == 0) || (*pos + 2 + data_size > size))
+	{
+		return false;
+	}
+	*channel = lpp[*pos] < PLAN_NUM_CHANNELS ? lpp[*pos] : 0;
+	*value = 0;
+	for (uint8_t idx = 0; idx < data_size; idx++)
+	{
+		*value = (*value << 8) | lpp[*pos + 2 + idx];
+	}
+	if (is_signed && (*value & (1L << (data_size * 8 - 1))))
+	{
+		*value -= 1L << (data_size * 8);
+	}
+	*pos += 2 + data_size;
+	return true;
+}
+
+/**
+ * @brief Check if the sample has to be sent
+ *
+ * @param lpp Cayenne LPP packet with the new values
+ * @param size size of the packet
+ * @return true if change reporting is off, the heartbeat is due or a value changed more than its delta
+ * @return false if the sample can be skipped
+ */
+bool report_due(const uint8_t *lpp, uint8_t size)
+{
+	if ((g_report_heartbeat == 0) || (last_valid == 0))
+	{
+		return true;
+	}
+
+	// Allow half a send interval of jitter, otherwise the heartbeat is one interval late
+	uint32_t elapsed_ms = millis() - last_report_ms + g_lorawan_settings.send_repeat_time / 2;
+	if (elapsed_ms / 1000 >= g_report_heartbeat)
+	{
+		MYLOG("REPORT", "Heartbeat");
+		return true;
+	}
+
+	uint8_t pos = 0;
+	uint8_t channel;
+	int32_t value;
+	while (next_value(lpp, size, &pos, &channel, &value))
+	{
+		if (g_report_delta[channel] == 0)
+		{
+			continue;
+		}
+		if (((last_valid & (1ULL << channel)) == 0) || (abs(value - last_value[channel]) >= g_report_delta[channel]))
+		{
+			MYLOG("REPORT", "Channel %d changed", channel);
+			return true;
+		}
+	}
+
+	skipped++;
+	MYLOG("REPORT", "No change, skipped %d samples", skipped);
+	return false;
+}
+
+/**
+ * @brief Remember the sent values
+ *
+ * @param lpp Cayenne LPP packet that is sent
+ * @param size size of the packet
+ */
+void report_sent(const uint8_t *lpp, uint8_t size)
+{
+	uint8_t pos = 0;
+	uint8_t channel;
+	int32_t value;
+	while (next_value(lpp, size, &pos, &channel, &value))
+	{
+		last_value[channel] = value;
+		last_valid |= 1ULL << channel;
+	}
+	last_report_ms = millis();
+}
+
+/**
+ * @brief Number of samples that were not sent
+ *
+ * @return uint16_t number of skipped samples since power up
+ */
+uint16_t report_skipped(void)
+{
+	return skipped;
+}
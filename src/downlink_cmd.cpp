@@ -0,0 +1,340 @@
+/**
+ * @file downlink_cmd.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Binary configuration commands over LoRaWAN downlinks
+ *        Command format: 1 byte 0xAA, 1 byte opcode, parameters MSB first
+ *        The commands are in a table with fPort, opcode and the allowed parameter length.
+ *        New commands are added to the table only.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+#include "sensor_history.h"
+
+/** First byte of every command */
+#define DL_CMD_HEADER 0xAA
+
+/** Size of the history dump header, format ID, channel, range, scale and count */
+#define HIST_DUMP_HEADER 6
+
+/** Maximum number of values in a history dump */
+#define HIST_DUMP_MAX_VALUES 120
+
+/** Timer to send the history dump after the RX windows are closed */
+#ifdef NRF52_SERIES
+SoftwareTimer dump_timer;
+#endif
+#ifdef ESP32
+Ticker dump_timer;
+#endif
+
+/** Requested history dump */
+static uint8_t dump_channel = 0;
+static uint8_t dump_range = HISTORY_RAW;
+
+/** History dump frame */
+static uint8_t dump_frame[HIST_DUMP_HEADER + HIST_DUMP_MAX_VALUES * 2];
+
+/** Command table entry */
+typedef struct downlink_cmd_s
+{
+	uint8_t fport;										 // fPort of the command
+	uint8_t opcode;										 // Second byte of the command
+	uint8_t min_len;									 // Minimum parameter length
+	uint8_t max_len;									 // Maximum parameter length
+	bool (*handler)(const uint8_t *param, uint8_t len); // Returns false if a parameter is invalid
+	const char *name;									 // Name for the log
+} downlink_cmd_t;
+
+/**
+ * @brief Get a MSB first value from the parameters
+ *
+ * @param param parameters
+ * @param size number of bytes
+ * @return uint32_t value
+ */
+static uint32_t get_msb(const uint8_t *param, uint8_t size)
+{
+	uint32_t value = 0;
+	for (uint8_t idx = 0; idx < size; idx++)
+	{
+		value = (value << 8) | param[idx];
+	}
+	return value;
+}
+
+/**
+ * @brief Set the send interval, AA 55 + 4 bytes interval in seconds
+ *
+ */
+static bool dl_send_interval(const uint8_t *param, uint8_t len)
+{
+	if (len != 4)
+	{
+		return false;
+	}
+	uint32_t new_send_frequency = get_msb(param, 4);
+	if (new_send_frequency == 0)
+	{
+		return false;
+	}
+	MYLOG("DL", "Received new send frequency %ld s", new_send_frequency);
+	g_lorawan_settings.send_repeat_time = new_send_frequency * 1000;
+	api_timer_restart(g_lorawan_settings.send_repeat_time);
+	save_settings();
+	return true;
+}
+
+/**
+ * @brief Set the heartbeat, AA 56 + 4 bytes heartbeat in seconds
+ *
+ */
+static bool dl_heartbeat(const uint8_t *param, uint8_t len)
+{
+	if (len != 4)
+	{
+		return false;
+	}
+	g_report_heartbeat = get_msb(param, 4);
+	MYLOG("DL", "Received new heartbeat %ld s", g_report_heartbeat);
+	save_report_settings();
+	return true;
+}
+
+/**
+ * @brief Set the delta of a channel, AA 57 + channel + 2 bytes delta
+ *
+ */
+static bool dl_delta(const uint8_t *param, uint8_t len)
+{
+	if ((len != 3) || (param[0] == 0) || (param[0] >= PLAN_NUM_CHANNELS))
+	{
+		return false;
+	}
+	g_report_delta[param[0]] = get_msb(&param[1], 2);
+	MYLOG("DL", "Received new delta %d for channel %d", g_report_delta[param[0]], param[0]);
+	save_report_settings();
+	return true;
+}
+
+/**
+ * @brief Select the display UI, AA 58 + UI + optional graph range
+ *
+ */
+static bool dl_ui(const uint8_t *param, uint8_t len)
+{
+	if ((len < 1) || (len > 2) || (param[0] > 1) || ((len == 2) && (param[1] > HISTORY_DAYS)))
+	{
+		return false;
+	}
+	g_ui_selected = param[0];
+	if (len == 2)
+	{
+		g_graph_range = param[1];
+	}
+	save_ui_settings(g_ui_selected);
+	MYLOG("DL", "Received UI %d graph range %d", g_ui_selected, g_graph_range);
+#if HAS_EPD > 0
+	wake_rak14000();
+#endif
+	return true;
+}
+
+/**
+ * @brief Enable or disable the battery protection, AA 59 + 0 or 1
+ *
+ */
+static bool dl_battery_check(const uint8_t *param, uint8_t len)
+{
+	if ((len != 1) || (param[0] > 1))
+	{
+		return false;
+	}
+	battery_check_enabled = param[0] == 1;
+	MYLOG("DL", "Battery check %s", battery_check_enabled ? "enabled" : "disabled");
+	save_batt_settings(battery_check_enabled);
+	return true;
+}
+
+/**
+ * @brief Enable or disable a sensor, AA 5A + sensor ID + 0 or 1
+ *
+ */
+static bool dl_sensor(const uint8_t *param, uint8_t len)
+{
+	if ((len != 2) || (param[0] >= NUM_SENSOR_ENTRIES) || (param[1] > 1))
+	{
+		return false;
+	}
+	if (param[1] == 1)
+	{
+		g_sensors_disabled &= ~(1ULL << param[0]);
+	}
+	else
+	{
+		g_sensors_disabled |= 1ULL << param[0];
+	}
+	MYLOG("DL", "Sensor ID %d %s", param[0], param[1] == 1 ? "enabled" : "disabled");
+	save_sensor_settings();
+	return true;
+}
+
+/**
+ * @brief Timer callback for the history dump
+ *
+ */
+#ifdef NRF52_SERIES
+static void dump_timeout(TimerHandle_t unused)
+{
+	dump_timer.stop();
+	api_wake_loop(HIST_DUMP);
+}
+#endif
+#ifdef ESP32
+static void dump_timeout(void)
+{
+	api_wake_loop(HIST_DUMP);
+}
+#endif
+
+/**
+ * @brief Request a history dump, AA 5B + history channel + range
+ *        The dump is sent after the RX windows are closed
+ *
+ */
+static bool dl_history(const uint8_t *param, uint8_t len)
+{
+	if ((len != 2) || (param[0] >= num_history_channels) || (param[1] > HISTORY_DAYS))
+	{
+		return false;
+	}
+	dump_channel = param[0];
+	dump_range = param[1];
+	MYLOG("DL", "History dump of channel %d range %d requested", dump_channel, dump_range);
+#ifdef NRF52_SERIES
+	dump_timer.stop();
+	dump_timer.setPeriod(HIST_DUMP_DELAY_MS);
+	dump_timer.start();
+#endif
+#ifdef ESP32
+	dump_timer.once_ms(HIST_DUMP_DELAY_MS, dump_timeout);
+#endif
+	return true;
+}
+
+/** Command table */
+static const downlink_cmd_t downlink_cmds[] = {
+	// fPort, opcode, min length, max length, handler, name
+	{3, 0x55, 4, 4, dl_send_interval, "send interval"},
+	{3, 0x56, 4, 4, dl_heartbeat, "heartbeat"},
+	{3, 0x57, 3, 3, dl_delta, "delta"},
+	{3, 0x58, 1, 2, dl_ui, "UI"},
+	{3, 0x59, 1, 1, dl_battery_check, "battery check"},
+	{3, 0x5A, 2, 2, dl_sensor, "sensor enable"},
+	{3, 0x5B, 2, 2, dl_history, "history dump"},
+};
+
+/**
+ * @brief Initialize the history dump timer
+ *
+ */
+void init_downlink_cmd(void)
+{
+#ifdef NRF52_SERIES
+	dump_timer.begin(HIST_DUMP_DELAY_MS, dump_timeout, NULL, false);
+#endif
+}
+
+/**
+ * @brief Find and execute a downlink command
+ *
+ * @param fport fPort of the downlink
+ * @param data downlink payload
+ * @param len size of the payload
+ * @return true if a command was executed
+ * @return false if the downlink is not a command or its parameters are invalid
+ */
+bool downlink_cmd_handler(uint8_t fport, const uint8_t *data, uint8_t len)
+{
+	if ((len < 2) || (data[0] != DL_CMD_HEADER))
+	{
+		return false;
+	}
+
+	for (const downlink_cmd_t &cmd : downlink_cmds)
+	{
+		if ((cmd.fport != fport) || (cmd.opcode != data[1]))
+		{
+			continue;
+		}
+		uint8_t param_len = len - 2;
+		if ((param_len < cmd.min_len) || (param_len > cmd.max_len))
+		{
+			MYLOG("DL", "Wrong length %d for %s", param_len, cmd.name);
+			return false;
+		}
+		if (!cmd.handler(&data[2], param_len))
+		{
+			MYLOG("DL", "Invalid parameter for %s", cmd.name);
+			return false;
+		}
+		return true;
+	}
+	MYLOG("DL", "Unknown command %02X on fPort %d", data[1], fport);
+	return false;
+}
+
+/**
+ * @brief Send the requested history dump
+ *        Frame format:
+ *        1 byte format ID 0xD1
+ *        1 byte history channel
+ *        1 byte range, 0 = last values, 1 = hourly means, 2 = daily means
+ *        2 bytes scale, value = int16 / scale
+ *        1 byte number of values
+ *        2 bytes per value, MSB first, oldest first
+ *
+ */
+void send_history_dump(void)
+{
+	if (!g_lorawan_settings.lorawan_enable)
+	{
+		MYLOG("DL", "History dump only over LoRaWAN");
+		return;
+	}
+
+	// With a full MAC command queue the data rate might not even allow the header
+	uint8_t max_payload = plan_max_payload();
+	if (max_payload < HIST_DUMP_HEADER)
+	{
+		MYLOG("DL", "History dump does not fit, max payload %d", max_payload);
+		return;
+	}
+	uint8_t max_values = (max_payload - HIST_DUMP_HEADER) / 2;
+	max_values = max_values > HIST_DUMP_MAX_VALUES ? HIST_DUMP_MAX_VALUES : max_values;
+
+	int16_t values[HIST_DUMP_MAX_VALUES];
+	int16_t scale = 1;
+	uint8_t count = history_values(dump_channel, dump_range, values, max_values, &scale);
+
+	dump_frame[0] = HIST_DUMP_FORMAT_ID;
+	dump_frame[1] = dump_channel;
+	dump_frame[2] = dump_range;
+	dump_frame[3] = (uint8_t)(scale >> 8);
+	dump_frame[4] = (uint8_t)(scale);
+	dump_frame[5] = count;
+	for (uint8_t idx = 0; idx < count; idx++)
+	{
+		dump_frame[HIST_DUMP_HEADER + idx * 2] = (uint8_t)(values[idx] >> 8);
+		dump_frame[HIST_DUMP_HEADER + idx * 2 + 1] = (uint8_t)(values[idx]);
+	}
+
+	MYLOG("DL", "History dump with %d values", count);
+	if (send_lora_packet(dump_frame, HIST_DUMP_HEADER + count * 2, HIST_DUMP_PORT) != LMH_SUCCESS)
+	{
+		MYLOG("DL", "History dump failed");
+	}
+}
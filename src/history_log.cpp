@@ -0,0 +1,406 @@
+/**
+ * @file history_log.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Persistent sensor history
+ *        The new values of a sensor cycle are collected in RAM and appended
+ *        as one CRC checked record to a log file.
+ *        When the log is too large it is replaced by snapshots of the
+ *        history objects. On boot the log is read once from start to end,
+ *        a record with a wrong CRC (power loss during write) ends the log.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+#include "RAK14000_epd.h"
+
+#ifdef NRF52_SERIES
+#include <Adafruit_LittleFS.h>
+#include <InternalFileSystem.h>
+using namespace Adafruit_LittleFS_Namespace;
+
+/** Filename of the history log */
+static const char log_name[] = "HIST";
+
+/** Filename of the log while it is compacted */
+static const char compact_name[] = "HIST.NEW";
+
+/** File for the history log */
+File history_file(InternalFS);
+
+/** Log size that triggers the compaction */
+#define HISTORY_LOG_MAX 8192
+
+/** Largest record payload, time and the biggest history object */
+#define HISTORY_REC_MAX 1024
+
+/** Record types */
+#define HISTORY_REC_SAMPLE 0x53	  // One new value, int16_t value + uint32_t time, written by older versions
+#define HISTORY_REC_CYCLE 0x43	  // New values of a sensor cycle, uint32_t time + uint8_t channel and int16_t value per value
+#define HISTORY_REC_SNAPSHOT 0x48 // Complete history object, uint32_t time + object
+
+/** Record header, followed by len bytes payload and the CRC16 over header and payload */
+typedef struct history_rec_s
+{
+	uint8_t type;
+	uint8_t channel; // Number of values for HISTORY_REC_CYCLE
+	uint16_t len;
+} history_rec_t;
+
+/** Buffer for the record payload */
+static uint8_t rec_buffer[HISTORY_REC_MAX];
+
+/** Flag if the log needs to be compacted */
+static bool compact_needed = false;
+
+/** Maximum number of values in a cycle record */
+#define HISTORY_CYCLE_MAX 16
+
+/** Size of one value in a cycle record, channel and value */
+#define HISTORY_CYCLE_VALUE 3
+
+/** Values of the current sensor cycle that are not in the log yet */
+static uint8_t cycle_values[HISTORY_CYCLE_MAX * HISTORY_CYCLE_VALUE];
+static uint8_t cycle_count = 0;
+static uint32_t cycle_time = 0;
+#endif
+
+/** Offset between millis() and the history time, continues the time of the log after reboot */
+static uint32_t time_base = 0;
+
+/** Mutex for the histories and the log */
+static SemaphoreHandle_t history_mutex = NULL;
+
+/**
+ * @brief Lock the histories and the log
+ *
+ */
+static void history_lock(void)
+{
+	if (history_mutex == NULL)
+	{
+		history_mutex = xSemaphoreCreateMutex();
+	}
+	xSemaphoreTake(history_mutex, portMAX_DELAY);
+}
+
+/**
+ * @brief Get the history time
+ *     Time in ms that continues across reboots, the time the device
+ *     was off is not counted
+ *
+ * @return uint32_t time in ms
+ */
+uint32_t history_time(void)
+{
+	return time_base + millis();
+}
+
+#ifdef NRF52_SERIES
+/**
+ * @brief CRC16 CCITT
+ *
+ * @param crc start value or CRC of the previous data
+ * @param data data
+ * @param len length of data
+ * @return uint16_t CRC
+ */
+static uint16_t crc16(uint16_t crc, const uint8_t *data, uint16_t len)
+{
+	for (uint16_t idx = 0; idx < len; idx++)
+	{
+		crc ^= (uint16_t)data[idx] << 8;
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+/**
+ * @brief Write one record with CRC to an open file
+ *
+ * @param file open file
+ * @param type record type
+ * @param channel channel number
+ * @param part1 first part of the payload
+ * @param len1 size of first part
+ * @param part2 second part of the payload, can be NULL
+ * @param len2 size of second part
+ * @return true if the complete record was written
+ */
+static bool write_record(File &file, uint8_t type, uint8_t channel, const void *part1, uint16_t len1, const void *part2, uint16_t len2)
+{
+	history_rec_t header = {type, channel, (uint16_t)(len1 + len2)};
+	uint16_t crc = crc16(0xFFFF, (uint8_t *)&header, sizeof(header));
+	crc = crc16(crc, (const uint8_t *)part1, len1);
+	crc = crc16(crc, (const uint8_t *)part2, len2);
+
+	size_t written = file.write((uint8_t *)&header, sizeof(header));
+	written += file.write((const uint8_t *)part1, len1);
+	if (len2 != 0)
+	{
+		written += file.write((const uint8_t *)part2, len2);
+	}
+	written += file.write((uint8_t *)&crc, sizeof(crc));
+	return written == (sizeof(header) + len1 + len2 + sizeof(crc));
+}
+
+/**
+ * @brief Append the collected values of the sensor cycle as one record to the log
+ *     The history mutex must be taken
+ *
+ */
+static void write_cycle(void)
+{
+	if (cycle_count == 0)
+	{
+		return;
+	}
+	if (history_file.open(log_name, FILE_O_WRITE))
+	{
+		write_record(history_file, HISTORY_REC_CYCLE, cycle_count, &cycle_time, sizeof(cycle_time), cycle_values, cycle_count * HISTORY_CYCLE_VALUE);
+		if (history_file.size() > HISTORY_LOG_MAX)
+		{
+			compact_needed = true;
+		}
+		history_file.close();
+	}
+	cycle_count = 0;
+}
+#endif
+
+/**
+ * @brief Add a new value to a history and collect it for the log
+ *     The values are written with history_log_flush(). If a channel
+ *     gets a second value, the values collected before are written first.
+ *
+ * @param channel index in history_channels[]
+ * @param value value in the fixed point format of the history
+ */
+void history_add(uint8_t channel, int16_t value)
+{
+	if (channel >= num_history_channels)
+	{
+		return;
+	}
+
+	history_lock();
+	uint32_t time_ms = history_time();
+	history_channels[channel].push_fixed(value, time_ms);
+
+#ifdef NRF52_SERIES
+	// A new cycle started before the last one was written
+	for (uint8_t idx = 0; idx < cycle_count; idx++)
+	{
+		if (cycle_values[idx * HISTORY_CYCLE_VALUE] == channel)
+		{
+			write_cycle();
+			break;
+		}
+	}
+	if (cycle_count == HISTORY_CYCLE_MAX)
+	{
+		write_cycle();
+	}
+	if (cycle_count == 0)
+	{
+		cycle_time = time_ms;
+	}
+	uint8_t *entry = &cycle_values[cycle_count * HISTORY_CYCLE_VALUE];
+	entry[0] = channel;
+	memcpy(&entry[1], &value, sizeof(value));
+	cycle_count++;
+#endif
+	xSemaphoreGive(history_mutex);
+}
+
+/**
+ * @brief Write the values of the sensor cycle to the log
+ *     Called from the display task after the refresh, one open and close per cycle.
+ *
+ */
+void history_log_flush(void)
+{
+#ifdef NRF52_SERIES
+	history_lock();
+	write_cycle();
+	xSemaphoreGive(history_mutex);
+#endif
+}
+
+/**
+ * @brief Restore the histories from the log
+ *     Reads the log once from start to end. A damaged record at the
+ *     end of the log is cut off, so new records are appended to valid data.
+ *
+ */
+void history_log_restore(void)
+{
+#ifdef NRF52_SERIES
+	history_lock();
+
+	// A compaction was interrupted after the old log was deleted
+	if (!InternalFS.exists(log_name) && InternalFS.exists(compact_name))
+	{
+		InternalFS.rename(compact_name, log_name);
+	}
+	InternalFS.remove(compact_name);
+
+	if (!history_file.open(log_name, FILE_O_READ))
+	{
+		xSemaphoreGive(history_mutex);
+		return;
+	}
+
+	uint32_t last_time = 0;
+	uint32_t valid_end = 0;
+	uint16_t num_records = 0;
+	history_rec_t header;
+	uint16_t crc;
+	while (history_file.read(&header, sizeof(header)) == sizeof(header))
+	{
+		if ((header.len > HISTORY_REC_MAX) || (header.len < sizeof(uint32_t)) ||
+			(history_file.read(rec_buffer, header.len) != header.len) ||
+			(history_file.read(&crc, sizeof(crc)) != sizeof(crc)) ||
+			(crc != crc16(crc16(0xFFFF, (uint8_t *)&header, sizeof(header)), rec_buffer, header.len)))
+		{
+			break;
+		}
+		valid_end = history_file.position();
+		num_records++;
+
+		if ((header.type != HISTORY_REC_CYCLE) && (header.channel >= num_history_channels))
+		{
+			continue;
+		}
+		uint32_t time_ms;
+		if ((header.type == HISTORY_REC_SAMPLE) && (header.len == sizeof(int16_t) + sizeof(uint32_t)))
+		{
+			int16_t value;
+			memcpy(&value, rec_buffer, sizeof(value));
+			memcpy(&time_ms, &rec_buffer[sizeof(value)], sizeof(time_ms));
+			history_channels[header.channel].push_fixed(value, time_ms);
+		}
+		else if ((header.type == HISTORY_REC_CYCLE) && (header.len == sizeof(uint32_t) + header.channel * HISTORY_CYCLE_VALUE))
+		{
+			memcpy(&time_ms, rec_buffer, sizeof(time_ms));
+			for (uint8_t idx = 0; idx < header.channel; idx++)
+			{
+				uint8_t *entry = &rec_buffer[sizeof(time_ms) + idx * HISTORY_CYCLE_VALUE];
+				if (entry[0] < num_history_channels)
+				{
+					int16_t value;
+					memcpy(&value, &entry[1], sizeof(value));
+					history_channels[entry[0]].push_fixed(value, time_ms);
+				}
+			}
+		}
+		else if ((header.type == HISTORY_REC_SNAPSHOT) && (header.len == sizeof(uint32_t) + history_channels[header.channel].size))
+		{
+			memcpy(&time_ms, rec_buffer, sizeof(time_ms));
+			memcpy(history_channels[header.channel].history, &rec_buffer[sizeof(time_ms)], history_channels[header.channel].size);
+		}
+		else
+		{
+			continue;
+		}
+		if ((int32_t)(time_ms - last_time) > 0)
+		{
+			last_time = time_ms;
+		}
+	}
+
+	uint32_t log_size = history_file.size();
+	history_file.close();
+
+	if (valid_end < log_size)
+	{
+		MYLOG("HIST", "Cut damaged log at %ld of %ld bytes", valid_end, log_size);
+		if (history_file.open(log_name, FILE_O_WRITE))
+		{
+			history_file.truncate(valid_end);
+			history_file.close();
+		}
+	}
+	compact_needed = valid_end > HISTORY_LOG_MAX;
+
+	// Continue with the time of the last record
+	time_base = last_time - millis();
+	MYLOG("HIST", "Restored %d records, %ld bytes", num_records, valid_end);
+
+	xSemaphoreGive(history_mutex);
+#endif
+}
+
+/**
+ * @brief Get the newest values of a history in fixed point format, oldest first
+ *
+ * @param channel history channel
+ * @param range HISTORY_RAW for raw values, HISTORY_HOURS or HISTORY_DAYS for the means
+ * @param values buffer for the values
+ * @param max size of the buffer
+ * @param scale set to the fixed point factor, value = fixed point value / scale
+ * @return uint8_t number of values
+ */
+uint8_t history_values(uint8_t channel, uint8_t range, int16_t *values, uint8_t max, int16_t *scale)
+{
+	*scale = 1;
+	if (channel >= num_history_channels)
+	{
+		return 0;
+	}
+	history_lock();
+	uint8_t count = history_channels[channel].fixed_values(range, values, max, scale);
+	xSemaphoreGive(history_mutex);
+	return count;
+}
+
+/**
+ * @brief Replace the log with snapshots of all histories if it is too large
+ *     Called from the display task after the refresh. The new log is written
+ *     to a second file that replaces the old log only after it is complete.
+ *
+ */
+void history_log_compact(void)
+{
+#ifdef NRF52_SERIES
+	if (!compact_needed)
+	{
+		return;
+	}
+
+	history_lock();
+	InternalFS.remove(compact_name);
+	if (history_file.open(compact_name, FILE_O_WRITE))
+	{
+		bool success = true;
+		uint32_t time_ms = history_time();
+		for (uint8_t channel = 0; channel < num_history_channels; channel++)
+		{
+			success &= write_record(history_file, HISTORY_REC_SNAPSHOT, channel, &time_ms, sizeof(time_ms),
+									history_channels[channel].history, history_channels[channel].size);
+		}
+		history_file.close();
+
+		if (success)
+		{
+			// The snapshots include the values that were not written yet
+			cycle_count = 0;
+			InternalFS.remove(log_name);
+			InternalFS.rename(compact_name, log_name);
+			compact_needed = false;
+			MYLOG("HIST", "Log compacted");
+		}
+		else
+		{
+			InternalFS.remove(compact_name);
+			MYLOG("HIST", "Log compaction failed");
+		}
+	}
+	xSemaphoreGive(history_mutex);
+#endif
+}
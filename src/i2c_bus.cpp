@@ -0,0 +1,291 @@
+/**
+ * @file i2c_bus.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Shared I2C bus handling
+ *        Selects the I2C clock per device, serializes the access
+ *        from the app and the display task and measures the
+ *        access time per device.
+ *        Raw bus accesses are submitted as transactions to a queue,
+ *        they are retried on NACK and call a completion callback.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+
+/** Clock currently set on the bus, 0 = unknown */
+static uint32_t bus_clock = 0;
+
+/** Start time of the current access in us */
+static uint32_t access_start = 0;
+
+/** Mutex to serialize the bus access */
+static SemaphoreHandle_t bus_mutex = NULL;
+
+/** Access statistics per entry of found_sensors[] */
+i2c_stats_t i2c_stats[NUM_SENSOR_ENTRIES];
+
+/** Queue of pending transactions */
+static i2c_trans_t *trans_queue[I2C_QUEUE_SIZE];
+/** Index of the oldest pending transaction */
+static uint8_t queue_head = 0;
+/** Number of pending transactions */
+static uint8_t queue_count = 0;
+
+/**
+ * @brief Create the bus mutex
+ *        Must be called from setup_app() before the first bus access
+ *        and before the display task is started
+ *
+ */
+void i2c_bus_init(void)
+{
+	if (bus_mutex == NULL)
+	{
+		bus_mutex = xSemaphoreCreateMutex();
+	}
+}
+
+/**
+ * @brief Lock the bus mutex
+ *
+ */
+static void bus_lock(void)
+{
+	xSemaphoreTake(bus_mutex, portMAX_DELAY);
+}
+
+/**
+ * @brief Set the I2C clock if it is different from the current one
+ *
+ * @param clock new I2C clock in Hz
+ */
+void i2c_bus_set_clock(uint32_t clock)
+{
+	if (clock != bus_clock)
+	{
+		Wire.setClock(clock);
+		bus_clock = clock;
+	}
+}
+
+/**
+ * @brief Get access to the I2C bus for a device
+ *        Switches the bus to the maximum clock of the device
+ *
+ * @param sensor_id index of the device in found_sensors[]
+ */
+void i2c_bus_acquire(uint8_t sensor_id)
+{
+	bus_lock();
+
+	i2c_bus_set_clock((uint32_t)found_sensors[sensor_id].i2c_khz * 1000);
+	access_start = micros();
+}
+
+/**
+ * @brief Release the I2C bus and update the statistics of the device
+ *
+ * @param sensor_id index of the device in found_sensors[]
+ */
+void i2c_bus_release(uint8_t sensor_id)
+{
+	uint32_t access_time = micros() - access_start;
+
+	i2c_stats[sensor_id].accesses++;
+	i2c_stats[sensor_id].total_us += access_time;
+	if (access_time > i2c_stats[sensor_id].max_us)
+	{
+		i2c_stats[sensor_id].max_us = access_time;
+	}
+
+	xSemaphoreGive(bus_mutex);
+}
+
+/**
+ * @brief Print the clock and access times of all found devices
+ *
+ */
+void i2c_bus_report(void)
+{
+	for (uint8_t idx = 0; idx < NUM_SENSOR_ENTRIES; idx++)
+	{
+		if (found_sensors[idx].found_sensor)
+		{
+			uint32_t avg_us = 0;
+			if (i2c_stats[idx].accesses != 0)
+			{
+				avg_us = (uint32_t)(i2c_stats[idx].total_us / i2c_stats[idx].accesses);
+			}
+			AT_PRINTF("0x%02X %dkHz n=%lu avg=%luus max=%luus\n", found_sensors[idx].i2c_addr, found_sensors[idx].i2c_khz,
+					  (unsigned long)i2c_stats[idx].accesses, (unsigned long)avg_us, (unsigned long)i2c_stats[idx].max_us);
+		}
+	}
+}
+
+/**
+ * @brief Add a transaction to the queue
+ *        The transaction is executed by the next call of i2c_bus_run(),
+ *        the structure must stay valid until then.
+ *
+ * @param trans transaction
+ * @return true if the transaction was queued
+ * @return false if the queue is full
+ */
+bool i2c_bus_submit(i2c_trans_t *trans)
+{
+	bool queued = false;
+
+	bus_lock();
+	if (queue_count < I2C_QUEUE_SIZE)
+	{
+		trans->success = false;
+		trans->submit_us = micros();
+		trans_queue[(queue_head + queue_count) % I2C_QUEUE_SIZE] = trans;
+		queue_count++;
+		queued = true;
+	}
+	xSemaphoreGive(bus_mutex);
+	return queued;
+}
+
+/**
+ * @brief Execute one transaction on the bus, retry on NACK
+ *        Must be called with the bus acquired for the device
+ *
+ * @param trans transaction
+ */
+static void execute_transaction(i2c_trans_t *trans)
+{
+	uint8_t address = found_sensors[trans->sensor_id].i2c_addr;
+	i2c_stats_t *stats = &i2c_stats[trans->sensor_id];
+
+	for (uint8_t attempt = 0; attempt <= trans->retries; attempt++)
+	{
+		if (attempt != 0)
+		{
+			stats->retries++;
+		}
+
+		bool ack = true;
+		if ((trans->tx_len != 0) || (trans->rx_len == 0))
+		{
+			Wire.beginTransmission(address);
+			if (trans->tx_len != 0)
+			{
+				Wire.write(trans->tx_buf, trans->tx_len);
+			}
+			ack = (Wire.endTransmission() == 0);
+		}
+		if (ack && (trans->rx_len != 0))
+		{
+			// On the nRF52 the whole read is a single TWIM EasyDMA transfer into the TwoWire buffer
+			ack = (Wire.requestFrom(address, trans->rx_len) == trans->rx_len);
+			for (uint8_t idx = 0; ack && (idx < trans->rx_len); idx++)
+			{
+				trans->rx_buf[idx] = Wire.read();
+			}
+		}
+
+		if (ack)
+		{
+			stats->bytes += trans->tx_len + trans->rx_len;
+			trans->success = true;
+			return;
+		}
+		stats->nacks++;
+	}
+}
+
+/**
+ * @brief Execute all queued transactions in the order they were submitted
+ *        The completion callbacks are called after the bus is released,
+ *        a callback can submit new transactions.
+ *
+ * @return uint8_t number of failed transactions
+ */
+uint8_t i2c_bus_run(void)
+{
+	uint8_t failed = 0;
+
+	while (1)
+	{
+		bus_lock();
+		if (queue_count == 0)
+		{
+			xSemaphoreGive(bus_mutex);
+			break;
+		}
+		i2c_trans_t *trans = trans_queue[queue_head];
+		queue_head = (queue_head + 1) % I2C_QUEUE_SIZE;
+		queue_count--;
+		xSemaphoreGive(bus_mutex);
+
+		i2c_bus_acquire(trans->sensor_id);
+		execute_transaction(trans);
+		i2c_bus_release(trans->sensor_id);
+
+		i2c_stats_t *stats = &i2c_stats[trans->sensor_id];
+		uint32_t latency = micros() - trans->submit_us;
+		stats->transactions++;
+		if (latency > stats->max_latency)
+		{
+			stats->max_latency = latency;
+		}
+
+		if (!trans->success)
+		{
+			failed++;
+		}
+		if (trans->done_cb != NULL)
+		{
+			trans->done_cb(trans);
+		}
+	}
+	return failed;
+}
+
+/**
+ * @brief Submit a transaction and wait until it is finished
+ *
+ * @param trans transaction
+ * @return true if the device ACKed all bytes
+ * @return false if the transaction failed or the queue is full
+ */
+bool i2c_bus_transfer(i2c_trans_t *trans)
+{
+	if (!i2c_bus_submit(trans))
+	{
+		return false;
+	}
+	i2c_bus_run();
+	return trans->success;
+}
+
+/**
+ * @brief Print the transaction counters of all found devices
+ *
+ */
+void i2c_bus_stats_report(void)
+{
+	for (uint8_t idx = 0; idx < NUM_SENSOR_ENTRIES; idx++)
+	{
+		if (found_sensors[idx].found_sensor)
+		{
+			AT_PRINTF("0x%02X trans=%lu bytes=%lu nack=%lu retry=%lu worst=%luus\n", found_sensors[idx].i2c_addr,
+					  (unsigned long)i2c_stats[idx].transactions, (unsigned long)i2c_stats[idx].bytes, (unsigned long)i2c_stats[idx].nacks,
+					  (unsigned long)i2c_stats[idx].retries, (unsigned long)i2c_stats[idx].max_latency);
+		}
+	}
+}
+
+/**
+ * @brief Reset the access and transaction counters of all devices
+ *
+ */
+void i2c_bus_stats_clear(void)
+{
+	memset(i2c_stats, 0, sizeof(i2c_stats));
+}
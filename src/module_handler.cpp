@@ -10,66 +10,353 @@
  */
 #include "app.h"
 #include "module_handler.h"
+#ifdef NRF52_SERIES
+#include <Adafruit_LittleFS.h>
+#include <InternalFileSystem.h>
+using namespace Adafruit_LittleFS_Namespace;
+#endif
 
 /**
  * @brief List of all supported WisBlock modules
  *
  */
-sensors_t found_sensors[] = {
-	// I2C address , I2C bus, found?
-	{0x18, false}, //  0 ✔ RAK1904 accelerometer
-	{0x44, false}, //  1 ✔ RAK1903 light sensor
-	{0x42, false}, //  2 ✔ RAK12500 GNSS sensor
-	{0x5c, false}, //  3 ✔ RAK1902 barometric pressure sensor
-	{0x70, false}, //  4 ✔ RAK1901 temperature & humidity sensor
-	{0x76, false}, //  5 ✔ RAK1906 environment sensor
-	{0x20, false}, //  6 ✔ RAK12035 soil moisture sensor !! address conflict with RAK13003
-	{0x10, false}, //  7 ✔ RAK12010 light sensor
-	{0x51, false}, //  8 ✔ RAK12004 MQ2 CO2 gas sensor !! conflict with RAK15000
-	{0x50, false}, //  9 ✔ RAK15000 EEPROM !! conflict with RAK12008
-	{0x2C, false}, // 10 ✔ RAK12008 SCT31 CO2 gas sensor
-	{0x55, false}, // 11 ✔ RAK12009 MQ3 Alcohol gas sensor
-	{0x29, false}, // 12 ✔ RAK12014 Laser ToF sensor
-	{0x52, false}, // 13 ✔ RAK12002 RTC module !! conflict with RAK15000
-	{0x04, false}, // 14 ✔ RAK14003 LED bargraph module
-	{0x59, false}, // 15 ✔ RAK12047 VOC sensor !! conflict with RAK13600, RAK13003, RAK5814
-	{0x68, false}, // 16 ✔ RAK12025 Gyroscope address !! conflict with RAK1905
-	{0x73, false}, // 17 ✔ RAK14008 Gesture sensor
-	{0x3C, false}, // 18 ✔ RAK1921 OLED display
-	{0x53, false}, // 19 ✔ RAK12019 LTR390 light sensor !! conflict with RAK15000
-	{0x28, false}, // 20 ✔ RAK14002 Touch Button module
-	{0x41, false}, // 21 ✔ RAK16000 DC current sensor
-	{0x68, false}, // 22 ✔ RAK1905 MPU9250 9DOF sensor !! conflict with RAK12025
-	{0x61, false}, // 23 ✔ RAK12037 CO2 sensor !! conflict with RAK16001
-	{0x3A, false}, // 24 ✔ RAK12003 IR temperature sensor
-	{0x68, false}, // 25 ✔ RAK12040 AMG8833 temperature array sensor
-	{0x69, false}, // 26 ✔ RAK12034 BMX160 9DOF sensor
-	{0x1D, false}, // 27 ✔ RAK12032 ADXL313 accelerometer
-	{0x12, false}, // 28 ✔ RAK12039 PMSA003I particle matter sensor
-	{0x57, false}, // 29 RAK12012 MAX30102 heart rate sensor
-	{0x54, false}, // 30 RAK12016 Flex sensor
-	{0x47, false}, // 31 RAK13004 PWM expander module
-	{0x38, false}, // 32 RAK14001 RGB LED module
-	{0x5F, false}, // 33 RAK14004 Keypad interface
-	{0x61, false}, // 34 RAK16001 ADC sensor !! conflict with RAK12037
-	{0x59, false}, // 35 RAK13600 NFC !! conflict with RAK12047, RAK13600, RAK5814
-	{0x59, false}, // 36 RAK16002 Coulomb sensor !! conflict with RAK13600, RAK12047, RAK5814
-	{0x20, false}, // 37 RAK13003 IO expander module !! conflict with RAK12035
-	{0x59, false}, // 38 ✔ RAK5814 ACC608 encryption module (limited I2C speed 100000) !! conflict with RAK12047, RAK13600, RAK13003
+sensors_t found_sensors[NUM_SENSOR_ENTRIES] = {
+	// I2C address, max I2C clock kHz, found?
+	{0x18, 100, false}, //  0 ✔ RAK1904 accelerometer
+	{0x44, 100, false}, //  1 ✔ RAK1903 light sensor
+	{0x42, 100, false}, //  2 ✔ RAK12500 GNSS sensor
+	{0x5c, 100, false}, //  3 ✔ RAK1902 barometric pressure sensor
+	{0x70, 400, false}, //  4 ✔ RAK1901 temperature & humidity sensor
+	{0x76, 100, false}, //  5 ✔ RAK1906 environment sensor
+	{0x20, 100, false}, //  6 ✔ RAK12035 soil moisture sensor !! address conflict with RAK13003
+	{0x10, 100, false}, //  7 ✔ RAK12010 light sensor
+	{0x51, 100, false}, //  8 ✔ RAK12004 MQ2 CO2 gas sensor !! conflict with RAK15000
+	{0x50, 100, false}, //  9 ✔ RAK15000 EEPROM !! conflict with RAK12008
+	{0x2C, 100, false}, // 10 ✔ RAK12008 SCT31 CO2 gas sensor
+	{0x55, 100, false}, // 11 ✔ RAK12009 MQ3 Alcohol gas sensor
+	{0x29, 100, false}, // 12 ✔ RAK12014 Laser ToF sensor
+	{0x52, 400, false}, // 13 ✔ RAK12002 RTC module !! conflict with RAK15000
+	{0x04, 100, false}, // 14 ✔ RAK14003 LED bargraph module
+	{0x59, 400, false}, // 15 ✔ RAK12047 VOC sensor !! conflict with RAK13600, RAK13003, RAK5814
+	{0x68, 100, false}, // 16 ✔ RAK12025 Gyroscope address !! conflict with RAK1905
+	{0x73, 100, false}, // 17 ✔ RAK14008 Gesture sensor
+	{0x3C, 400, false}, // 18 ✔ RAK1921 OLED display
+	{0x53, 100, false}, // 19 ✔ RAK12019 LTR390 light sensor !! conflict with RAK15000
+	{0x28, 100, false}, // 20 ✔ RAK14002 Touch Button module
+	{0x41, 100, false}, // 21 ✔ RAK16000 DC current sensor
+	{0x68, 100, false}, // 22 ✔ RAK1905 MPU9250 9DOF sensor !! conflict with RAK12025
+	{0x61, 100, false}, // 23 ✔ RAK12037 CO2 sensor !! conflict with RAK16001
+	{0x3A, 100, false}, // 24 ✔ RAK12003 IR temperature sensor
+	{0x68, 100, false}, // 25 ✔ RAK12040 AMG8833 temperature array sensor
+	{0x69, 100, false}, // 26 ✔ RAK12034 BMX160 9DOF sensor
+	{0x1D, 100, false}, // 27 ✔ RAK12032 ADXL313 accelerometer
+	{0x12, 100, false}, // 28 ✔ RAK12039 PMSA003I particle matter sensor
+	{0x57, 100, false}, // 29 RAK12012 MAX30102 heart rate sensor
+	{0x54, 100, false}, // 30 RAK12016 Flex sensor
+	{0x47, 100, false}, // 31 RAK13004 PWM expander module
+	{0x38, 100, false}, // 32 RAK14001 RGB LED module
+	{0x5F, 100, false}, // 33 RAK14004 Keypad interface
+	{0x61, 100, false}, // 34 RAK16001 ADC sensor !! conflict with RAK12037
+	{0x59, 100, false}, // 35 RAK13600 NFC !! conflict with RAK12047, RAK13600, RAK5814
+	{0x59, 100, false}, // 36 RAK16002 Coulomb sensor !! conflict with RAK13600, RAK12047, RAK5814
+	{0x20, 100, false}, // 37 RAK13003 IO expander module !! conflict with RAK12035
+	{0x59, 100, false}, // 38 ✔ RAK5814 ACC608 encryption module (limited I2C speed 100000) !! conflict with RAK12047, RAK13600, RAK13003
 };
 
 /** Flag if sensors are powered down */
 bool g_sensors_off = false;
 
+/** Sensors disabled by downlink, bit n = sensor ID n */
+uint64_t g_sensors_disabled = 0;
+
+/**
+ * @brief Check if a sensor is present and not disabled
+ *
+ * @param sensor_id index in found_sensors[]
+ * @return true if the sensor is read
+ * @return false if the sensor is not present or disabled
+ */
+bool sensor_active(uint8_t sensor_id)
+{
+	return found_sensors[sensor_id].found_sensor && ((g_sensors_disabled & (1ULL << sensor_id)) == 0);
+}
+
+/**
+ * @brief Sensors that need time between starting a measurement and reading the result.
+ *        All of them are started at the same time, the MCU sleeps until the next
+ *        result is expected instead of waiting in delay() loops
+ *
+ */
+typedef struct acq_sensor_s
+{
+	uint8_t sensor_id;		 // Index in found_sensors[]
+	uint32_t (*start)(void); // Start a measurement, returns time in ms until the result is expected
+	bool (*ready)(void);	 // Check if the result is available, NULL if the start time is sufficient
+	void (*collect)(void);	 // Read the result and add it to the payload
+	uint16_t poll_ms;		 // Poll interval if the result is not ready yet
+	uint16_t timeout_ms;	 // Give up if there is no result after this time
+} acq_sensor_t;
+
+#if USE_BSEC == 0
+/**
+ * @brief Read the BME680 result, the payload is filled by read_rak1906()
+ *
+ */
+static void collect_rak1906(void)
+{
+	read_rak1906();
+}
+#endif
+
+/** List of sensors handled by the acquisition engine */
+static const acq_sensor_t acq_sensors[] = {
+	{PRESS_ID, start_rak1902, NULL, read_rak1902, 20, 1000},
+#if USE_BSEC == 0
+	{ENV_ID, start_rak1906, ready_rak1906, collect_rak1906, 100, 5000},
+#endif
+	{CO2_ID, NULL, ready_rak12037, read_rak12037, 500, 10000},
+	{PM_ID, start_rak12039, NULL, read_rak12039, 100, 1000},
+};
+
+/** Number of sensors handled by the acquisition engine */
+#define ACQ_NUM_SENSORS (sizeof(acq_sensors) / sizeof(acq_sensor_t))
+
+/** Bit mask of sensors with a pending measurement */
+static uint8_t acq_pending = 0;
+/** Start time of the acquisition */
+static uint32_t acq_start_time = 0;
+/** Time when each pending sensor should be polled next */
+static uint32_t acq_next_poll[ACQ_NUM_SENSORS];
+
+/**
+ * @brief Warm-up requirements of sensors after power_modules(true).
+ *        Sending starts as soon as all present sensors are ready
+ *        or reached their upper bound
+ *
+ */
+typedef struct warmup_sensor_s
+{
+	uint8_t sensor_id;	 // Index in found_sensors[]
+	uint32_t warmup_ms;	 // Minimum time after power up
+	bool (*ready)(void); // Readiness check after the warm-up time, NULL if the warm-up time is sufficient
+	uint16_t poll_ms;	 // Poll interval of the readiness check
+	uint32_t max_ms;	 // Upper bound, send even if the sensor is not ready
+} warmup_sensor_t;
+
+/** List of sensors that need time after power up */
+static const warmup_sensor_t warmup_sensors[] = {
+	{CO2_ID, 0, ready_rak12037, 500, 30000},	// SCD30 has a new measurement
+	{PM_ID, 30000, ready_rak12039, 500, 35000}, // PMSA003I fan needs 30 seconds for stable readings
+};
+
+/** Number of sensors with warm-up requirements */
+#define WARMUP_NUM_SENSORS (sizeof(warmup_sensors) / sizeof(warmup_sensor_t))
+
+/** Time when the sensors were powered up */
+static uint32_t sensors_on_time = 0;
+
+/** Timer to wake up the loop when the next result is expected */
+#ifdef NRF52_SERIES
+SoftwareTimer acq_timer;
+#endif
+#ifdef ESP32
+Ticker acq_timer;
+#endif
+#ifdef ARDUINO_ARCH_RP2040
+mbed::Timeout acq_timer;
+#endif
+
+/**
+ * @brief Timer callback to wake up the loop with the ACQ_POLL event
+ *
+ * @param unused
+ */
+#ifdef NRF52_SERIES
+void acq_poll_wakeup(TimerHandle_t unused)
+{
+	api_wake_loop(ACQ_POLL);
+}
+#endif
+#if defined ESP32 || defined ARDUINO_ARCH_RP2040
+void acq_poll_wakeup(void)
+{
+	api_wake_loop(ACQ_POLL);
+}
+#endif
+
+/**
+ * @brief Start the one-shot timer for the next poll
+ *
+ * @param wait_ms time until the next poll
+ */
+static void acq_schedule(uint32_t wait_ms)
+{
+	if (wait_ms == 0)
+	{
+		wait_ms = 1;
+	}
+#ifdef NRF52_SERIES
+	acq_timer.stop();
+	acq_timer.setPeriod(wait_ms);
+	acq_timer.start();
+#endif
+#ifdef ESP32
+	acq_timer.once_ms(wait_ms, acq_poll_wakeup);
+#endif
+#ifdef ARDUINO_ARCH_RP2040
+	acq_timer.attach(acq_poll_wakeup, (std::chrono::milliseconds)wait_ms);
+#endif
+}
+
+/**
+ * @brief I2C devices that need time after power up before they answer
+ *
+ */
+typedef struct slow_device_s
+{
+	uint8_t i2c_addr;	 // I2C address
+	uint16_t startup_ms; // Maximum time after power up until the device answers
+} slow_device_t;
+
+/** List of I2C devices with long start-up time */
+static const slow_device_t slow_devices[] = {
+	{0x12, 10000}, // RAK12039 takes up to 10 seconds before it responds on I2C
+	{0x61, 2000},  // RAK12037 needs up to 2 seconds after power up
+};
+
+/** Number of devices with long start-up time */
+#define NUM_SLOW_DEVICES (sizeof(slow_devices) / sizeof(slow_device_t))
+
+/** Maximum number of devices in the bus map */
+#define BUS_MAP_SIZE 16
+
+/** Marker for a valid bus map */
+#define BUS_MAP_MARK 0xB5
+
+#ifdef NRF52_SERIES
+/** Filename to save the I2C bus map */
+static const char bus_map_name[] = "BUSMAP";
+
+/** File to save the I2C bus map */
+File bus_map_file(InternalFS);
+#endif
+
+/**
+ * @brief Read the I2C bus map of the last boot from flash
+ *
+ * @param bus_map array for the found I2C addresses
+ * @return uint8_t number of addresses, 0xFF if no valid bus map was found
+ */
+static uint8_t read_bus_map(uint8_t *bus_map)
+{
+#ifdef NRF52_SERIES
+	uint8_t header[2];
+	if (!bus_map_file.open(bus_map_name, FILE_O_READ))
+	{
+		return 0xFF;
+	}
+	if ((bus_map_file.read(header, 2) != 2) || (header[0] != BUS_MAP_MARK) || (header[1] > BUS_MAP_SIZE) || (bus_map_file.read(bus_map, header[1]) != header[1]))
+	{
+		bus_map_file.close();
+		return 0xFF;
+	}
+	bus_map_file.close();
+	return header[1];
+#else
+	return 0xFF;
+#endif
+}
+
 /**
- * @brief Scan both I2C bus for devices
+ * @brief Save the I2C bus map to flash
+ *
+ * @param bus_map array with the found I2C addresses
+ * @param num_dev number of addresses
+ */
+static void save_bus_map(uint8_t *bus_map, uint8_t num_dev)
+{
+#ifdef NRF52_SERIES
+	uint8_t header[2] = {BUS_MAP_MARK, num_dev};
+	InternalFS.remove(bus_map_name);
+	if (bus_map_file.open(bus_map_name, FILE_O_WRITE))
+	{
+		bus_map_file.write(header, 2);
+		bus_map_file.write(bus_map, num_dev);
+		bus_map_file.close();
+		MYLOG("SCAN", "Saved bus map with %d devices", num_dev);
+	}
+#endif
+}
+
+/**
+ * @brief Delete the I2C bus map, the next boot makes a full discovery
+ *
+ */
+void clear_bus_map(void)
+{
+#ifdef NRF52_SERIES
+	InternalFS.remove(bus_map_name);
+#endif
+}
+
+/**
+ * @brief Get the start-up time of a device
+ *
+ * @param address I2C address
+ * @return uint16_t start-up time in ms, 0 if the device answers immediately
+ */
+static uint16_t startup_time(uint8_t address)
+{
+	for (uint8_t idx = 0; idx < NUM_SLOW_DEVICES; idx++)
+	{
+		if (slow_devices[idx].i2c_addr == address)
+		{
+			return slow_devices[idx].startup_ms;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Check if a device answers on the I2C bus
+ *
+ * @param sensor_id index of the device in found_sensors[]
+ * @param wait_until if not 0, repeat the check until this time (millis())
+ * @return true if the device answered
+ * @return false if the device did not answer
+ */
+static bool probe_i2c(uint8_t sensor_id, uint32_t wait_until)
+{
+	i2c_trans_t probe = {sensor_id, NULL, 0, NULL, 0, 0, NULL, NULL};
+	while (1)
+	{
+		if (i2c_bus_transfer(&probe))
+		{
+			return true;
+		}
+		if ((int32_t)(wait_until - millis()) <= 0)
+		{
+			return false;
+		}
+		delay(50);
+	}
+}
+
+/**
+ * @brief Find the I2C devices listed in found_sensors[]
+ *        Only the addresses of supported modules are probed. Devices with a long
+ *        start-up time are probed last, while they wake up the other devices are
+ *        already found. The detected bus map is saved in flash, on the next boot
+ *        only the devices in the bus map are probed and only their start-up time
+ *        is waited for. Slow devices that are not in the bus map are probed once
+ *        without waiting. To find a module that was added, use AT+RESCAN.
  *
  */
 void find_modules(void)
 {
-	// Scan the I2C interfaces for devices
-	byte error;
 	uint8_t num_dev = 0;
+	uint8_t found_addr[BUS_MAP_SIZE];
+	uint8_t bus_map[BUS_MAP_SIZE];
 
 	MYLOG("SCAN", "Start search for modules");
 
@@ -81,56 +368,100 @@ void find_modules(void)
 	pinMode(WB_IO6, OUTPUT);
 	// Sensor on
 	digitalWrite(WB_IO6, HIGH);
-	delay(500);
+	uint32_t power_on_time = millis();
+
+	uint8_t bus_map_len = read_bus_map(bus_map);
+	bool warm_boot = (bus_map_len != 0xFF);
 
 	Wire.begin();
-	// Some modules support only 100kHz
-	Wire.setClock(100000);
-	for (byte address = 1; address < 127; address++)
+	// Some modules support only 100kHz, the probes switch to the clock of each device
+	i2c_bus_set_clock(100000);
+
+	// Probe the fast devices first, then wait for the slow devices
+	for (uint8_t slow = 0; slow < 2; slow++)
 	{
-		// RAK12039 takes up to 5 seconds before it responds on I2C
-		if (address == 0x12)
+		for (uint8_t idx = 0; idx < NUM_SENSOR_ENTRIES; idx++)
 		{
-			time_t wait_sensor = millis();
-			MYLOG("SCAN", "RAK12039 scan start %ld ms", millis());
-			while (1)
+			uint8_t address = found_sensors[idx].i2c_addr;
+			uint16_t startup_ms = startup_time(address);
+			if ((startup_ms != 0) != (slow == 1))
+			{
+				continue;
+			}
+
+			// Some modules share an address, the first entry is the one that is used
+			bool duplicate = false;
+			for (uint8_t prev = 0; prev < idx; prev++)
 			{
-				delay(500);
-				Wire.beginTransmission(address);
-				error = Wire.endTransmission();
-				if (error == 0)
+				if (found_sensors[prev].i2c_addr == address)
 				{
-					MYLOG("SCAN", "RAK12039 answered at %ld ms", millis());
+					duplicate = true;
 					break;
 				}
-				if ((millis() - wait_sensor) > 10000)
+			}
+			if (duplicate)
+			{
+				continue;
+			}
+
+			// On a warm boot, probe only the devices that were found before
+			bool in_map = !warm_boot;
+			for (uint8_t map_idx = 0; warm_boot && (map_idx < bus_map_len); map_idx++)
+			{
+				if (bus_map[map_idx] == address)
 				{
-					MYLOG("SCAN", "RAK12039 timeout after 10000 ms");
+					in_map = true;
 					break;
 				}
 			}
-		}
-		Wire.beginTransmission(address);
-		error = Wire.endTransmission();
-		if (error == 0)
-		{
-			MYLOG("SCAN", "Found sensor at I2C1 0x%02X", address);
-			for (uint8_t i = 0; i < sizeof(found_sensors) / sizeof(sensors_t); i++)
+			if (!in_map && (startup_ms == 0))
+			{
+				continue;
+			}
+
+			// Wait for a slow device only if it was found before, others are probed once
+			uint32_t wait_until = 0;
+			if (in_map && (startup_ms != 0))
+			{
+				wait_until = power_on_time + startup_ms;
+			}
+
+			if (probe_i2c(idx, wait_until))
 			{
-				if (address == found_sensors[i].i2c_addr)
+				MYLOG("SCAN", "Found sensor at I2C1 0x%02X after %ld ms", address, millis() - power_on_time);
+				found_sensors[idx].found_sensor = true;
+				if (num_dev < BUS_MAP_SIZE)
 				{
-					found_sensors[i].found_sensor = true;
-					break;
+					found_addr[num_dev] = address;
 				}
+				num_dev++;
 			}
-			num_dev++;
 		}
 	}
 
-	Wire.setClock(100000); /// \todo Wire.setClock(400000);
+	// Check if the bus map is still valid, only the first BUS_MAP_SIZE devices are saved
+	uint8_t map_len = num_dev < BUS_MAP_SIZE ? num_dev : BUS_MAP_SIZE;
+	bool map_changed = !warm_boot || (map_len != bus_map_len);
+	for (uint8_t idx = 0; !map_changed && (idx < map_len); idx++)
+	{
+		map_changed = true;
+		for (uint8_t map_idx = 0; map_idx < bus_map_len; map_idx++)
+		{
+			if (found_addr[idx] == bus_map[map_idx])
+			{
+				map_changed = false;
+				break;
+			}
+		}
+	}
+
+	if (map_changed)
+	{
+		save_bus_map(found_addr, map_len);
+	}
 
 	MYLOG("SCAN", "Found %d sensors", num_dev);
-	for (uint8_t i = 0; i < sizeof(found_sensors) / sizeof(sensors_t); i++)
+	for (uint8_t i = 0; i < NUM_SENSOR_ENTRIES; i++)
 	{
 		if (found_sensors[i].found_sensor)
 		{
@@ -244,6 +575,14 @@ void find_modules(void)
 	{
 		Wire.end();
 	}
+
+#ifdef NRF52_SERIES
+	// Prepare the timer for the sensor acquisition
+	acq_timer.begin(100, acq_poll_wakeup, NULL, false);
+#endif
+
+	// Sensors are powered up by their initialization
+	sensors_on_time = millis();
 }
 
 /**
@@ -301,7 +640,10 @@ void announce_modules(void)
 	if (found_sensors[CO2_ID].found_sensor)
 	{
 		AT_PRINTF("+EVT:RAK12037 OK\n");
-		read_rak12037();
+		if (ready_rak12037())
+		{
+			read_rak12037();
+		}
 	}
 
 	if (found_sensors[PM_ID].found_sensor)
@@ -316,25 +658,101 @@ void announce_modules(void)
 	}
 }
 
+/**
+ * @brief Check if all present sensors are ready for reading
+ *
+ * @return uint32_t 0 if all sensors are ready, otherwise the time in ms until the next check
+ */
+uint32_t sensors_ready_wait(void)
+{
+	if (g_sensors_off)
+	{
+		return 0;
+	}
+
+	uint32_t on_time = millis() - sensors_on_time;
+
+	// Readiness checks are useless until the longest warm-up time has passed
+	uint32_t wait_ms = 0;
+	for (uint8_t idx = 0; idx < WARMUP_NUM_SENSORS; idx++)
+	{
+		if (sensor_active(warmup_sensors[idx].sensor_id) && (on_time < warmup_sensors[idx].warmup_ms))
+		{
+			if ((warmup_sensors[idx].warmup_ms - on_time) > wait_ms)
+			{
+				wait_ms = warmup_sensors[idx].warmup_ms - on_time;
+			}
+		}
+	}
+	if (wait_ms != 0)
+	{
+		return wait_ms;
+	}
+
+	wait_ms = 0xFFFFFFFF;
+	for (uint8_t idx = 0; idx < WARMUP_NUM_SENSORS; idx++)
+	{
+		if (!sensor_active(warmup_sensors[idx].sensor_id) || (on_time >= warmup_sensors[idx].max_ms))
+		{
+			continue;
+		}
+		if ((warmup_sensors[idx].ready != NULL) && !warmup_sensors[idx].ready())
+		{
+			uint32_t poll_ms = warmup_sensors[idx].poll_ms;
+			if ((warmup_sensors[idx].max_ms - on_time) < poll_ms)
+			{
+				poll_ms = warmup_sensors[idx].max_ms - on_time;
+			}
+			if (poll_ms < wait_ms)
+			{
+				wait_ms = poll_ms;
+			}
+		}
+	}
+	if (wait_ms == 0xFFFFFFFF)
+	{
+		MYLOG("APP", "Sensors ready after %ld ms", on_time);
+		return 0;
+	}
+	return wait_ms;
+}
+
 /**
  * @brief Read values from the found modules
+ *        Sensors that deliver their values immediately are read directly.
+ *        Sensors that need time for a measurement are started and
+ *        collected later by poll_sensor_values()
  *
+ * @return true if all values are in the payload
+ * @return false if measurements are pending, wait for ACQ_POLL event
  */
-void get_sensor_values(void)
+bool get_sensor_values(void)
 {
-	if (found_sensors[TEMP_ID].found_sensor)
+	acq_pending = 0;
+	acq_start_time = millis();
+
+	// Start all sensors that need time for a measurement
+	for (uint8_t idx = 0; idx < ACQ_NUM_SENSORS; idx++)
 	{
-		// Read environment data
-		read_rak1901();
+		if (sensor_active(acq_sensors[idx].sensor_id))
+		{
+			uint32_t wait_ms = 0;
+			if (acq_sensors[idx].start != NULL)
+			{
+				wait_ms = acq_sensors[idx].start();
+			}
+			acq_next_poll[idx] = acq_start_time + wait_ms;
+			acq_pending |= (1 << idx);
+		}
 	}
 
-	if (found_sensors[BAR_ID].found_sensor)
+	if (sensor_active(TEMP_ID))
 	{
-		// Read barometer data
-		read_rak1902();
+		// Read environment data
+		read_rak1901();
 	}
 
-	if (found_sensors[LIGHT_ID].found_sensor)
+	if (sensor_active(LIGHT_ID))
 	{
 		// Read environment data
 		read_rak1903();
@@ -345,49 +763,88 @@ void get_sensor_values(void)
 	/** IAQ index or simple T/H/P readings       */
 	/*********************************************/
 #if USE_BSEC == 1
-	if (found_sensors[ENV_ID].found_sensor) // USING BOSCH BSEC
+	if (sensor_active(ENV_ID)) // USING BOSCH BSEC
 	{
 		// Get last IAQ
 		read_rak1906_bsec();
 	}
-#else
-	// RAK1906 needs time to get correct value. Reading was already started and results will be gotten in app.cpp
-	if (found_sensors[ENV_ID].found_sensor)
-	{
-		// Start reading environment data
-		read_rak1906();
-	}
 #endif
 
-	if (found_sensors[CO2_ID].found_sensor)
-	{
-		// Get the CO2 sensor values
-		read_rak12037();
-	}
-
-	if (found_sensors[LIGHT2_ID].found_sensor)
+	if (sensor_active(LIGHT2_ID))
 	{
 		// Read environment data
 		read_rak12010();
 	}
 
-	if (found_sensors[UVL_ID].found_sensor)
+	if (sensor_active(UVL_ID))
 	{
 		// Get the LTR390 sensor values
 		read_rak12019();
 	}
 
-	if (found_sensors[PM_ID].found_sensor)
+	if (sensor_active(VOC_ID))
 	{
-		// Get the particle matter sensor values
-		read_rak12039();
+		// Get the voc sensor values
+		read_rak12047();
 	}
 
-	if (found_sensors[VOC_ID].found_sensor)
+	if (acq_pending == 0)
 	{
-		// Get the voc sensor values
-		read_rak12047();
+		return true;
 	}
+
+	// Results might be ready already after reading the other sensors
+	return poll_sensor_values();
+}
+
+/**
+ * @brief Check the pending measurements and collect the results
+ *        Called on ACQ_POLL event
+ *
+ * @return true if all values are in the payload
+ * @return false if measurements are still pending, the timer is restarted
+ */
+bool poll_sensor_values(void)
+{
+	uint32_t now = millis();
+	uint32_t next_poll = 0xFFFFFFFF;
+
+	for (uint8_t idx = 0; idx < ACQ_NUM_SENSORS; idx++)
+	{
+		if ((acq_pending & (1 << idx)) == 0)
+		{
+			continue;
+		}
+		if ((int32_t)(now - acq_next_poll[idx]) >= 0)
+		{
+			if ((acq_sensors[idx].ready == NULL) || acq_sensors[idx].ready())
+			{
+				acq_sensors[idx].collect();
+				acq_pending &= ~(1 << idx);
+				continue;
+			}
+			if ((now - acq_start_time) >= acq_sensors[idx].timeout_ms)
+			{
+				MYLOG("ACQ", "Timeout on sensor ID %d", acq_sensors[idx].sensor_id);
+				acq_pending &= ~(1 << idx);
+				continue;
+			}
+			acq_next_poll[idx] = now + acq_sensors[idx].poll_ms;
+		}
+		if ((acq_next_poll[idx] - now) < next_poll)
+		{
+			next_poll = acq_next_poll[idx] - now;
+		}
+	}
+
+	if (acq_pending == 0)
+	{
+		MYLOG("ACQ", "All sensors read after %ld ms", millis() - acq_start_time);
+		return true;
+	}
+
+	acq_schedule(next_poll);
+	return false;
 }
 
 /**
@@ -496,5 +953,6 @@ void power_modules(bool switch_on)
 	if (switch_on)
 	{
 		g_sensors_off = false;
+		sensors_on_time = millis();
 	}
 }
@@ -35,19 +35,82 @@ void send_delayed(void);
 #define N_VOC_REQ        0b1101111111111111
 #define TOUCH_EVENT      0b0001000000000000
 #define N_TOUCH_EVENT    0b1110111111111111
+#define HIST_DUMP        0b0000100000000000
+#define N_HIST_DUMP      0b1111011111111111
+#define ACQ_POLL         0b0000010000000000
+#define N_ACQ_POLL       0b1111101111111111
 #define BSEC_REQ         0b0000001000000000
 #define N_BSEC_REQ       0b1111110111111111
 
 typedef struct sensors_s
 {
 	uint8_t i2c_addr;  // I2C address
+	uint16_t i2c_khz;  // Maximum I2C clock in kHz
 	bool found_sensor; // Flag if sensor is present
 } sensors_t;
 
-extern sensors_t found_sensors[];
+/** Number of entries in found_sensors[] */
+#define NUM_SENSOR_ENTRIES 39
+
+extern sensors_t found_sensors[NUM_SENSOR_ENTRIES];
+
+/** Sensors disabled by downlink, bit n = sensor ID n */
+extern uint64_t g_sensors_disabled;
+bool sensor_active(uint8_t sensor_id);
+
+/** I2C access statistics per device */
+typedef struct i2c_stats_s
+{
+	uint32_t accesses;	   // Number of bus accesses
+	uint64_t total_us;	   // Sum of all access times
+	uint32_t max_us;	   // Longest access time
+	uint32_t transactions; // Number of queued transactions
+	uint32_t bytes;		   // Bytes transferred by transactions
+	uint32_t nacks;		   // Transaction attempts that got a NACK
+	uint32_t retries;	   // Repeated transaction attempts
+	uint32_t max_latency;  // Longest time from submit to completion in us
+} i2c_stats_t;
+
+extern i2c_stats_t i2c_stats[NUM_SENSOR_ENTRIES];
+
+/** I2C transaction, write tx_buf then read into rx_buf */
+typedef struct i2c_trans_s i2c_trans_t;
+
+/** Completion callback of a transaction */
+typedef void (*i2c_done_cb_t)(i2c_trans_t *trans);
+
+struct i2c_trans_s
+{
+	uint8_t sensor_id;	   // Index of the device in found_sensors[]
+	const uint8_t *tx_buf; // Data to write, can be NULL if tx_len is 0
+	uint8_t tx_len;		   // Number of bytes to write
+	uint8_t *rx_buf;	   // Buffer for the read data, can be NULL if rx_len is 0
+	uint8_t rx_len;		   // Number of bytes to read
+	uint8_t retries;	   // Number of retries after a NACK
+	i2c_done_cb_t done_cb; // Called after the transaction finished, can be NULL
+	void *user;			   // Free for the caller, e.g. for the callback
+	bool success;		   // Result, set when the transaction finished
+	uint32_t submit_us;	   // Time of submit, set by i2c_bus_submit()
+};
+
+/** Maximum number of pending transactions */
+#define I2C_QUEUE_SIZE 16
+
+/** Shared I2C bus */
+void i2c_bus_init(void);
+void i2c_bus_set_clock(uint32_t clock);
+void i2c_bus_acquire(uint8_t sensor_id);
+void i2c_bus_release(uint8_t sensor_id);
+void i2c_bus_report(void);
+bool i2c_bus_submit(i2c_trans_t *trans);
+uint8_t i2c_bus_run(void);
+bool i2c_bus_transfer(i2c_trans_t *trans);
+void i2c_bus_stats_report(void);
+void i2c_bus_stats_clear(void);
 
 // LoRaWAN stuff
 #include "wisblock_cayenne.h"
+#include "wisblock_compact.h"
 // Cayenne LPP Channel numbers per sensor value
 #define LPP_CHANNEL_BATT 1			   // Base Board
 #define LPP_CHANNEL_HUMID 2			   // RAK1901
@@ -94,6 +157,43 @@ extern sensors_t found_sensors[];
 
 extern WisCayenne g_solution_data;
 
+// LoRa P2P header
+#define P2P_HEADER_MAX 8	  // DevEUI
+#define P2P_SHORT_ADDR_SIZE 2 // Short address
+extern uint16_t g_p2p_short_addr;
+uint8_t p2p_header_size(void);
+extern uint8_t g_payload_format;
+
+// Batched uplinks
+#define BATCH_FORMAT_ID 0xB1   // First byte of a batch frame
+#define BATCH_MAX_SIZE 222	   // Maximum frame size
+#define BATCH_MAX_SAMPLES 32   // Maximum samples per frame
+extern uint8_t g_batch_samples;
+uint8_t batch_max_sample(uint8_t max_size);
+bool batch_add(const uint8_t *packet, uint8_t size, uint8_t max_size);
+uint8_t batch_frame(uint8_t **frame);
+void batch_clear(void);
+uint8_t batch_count(void);
+
+// Payload planner
+#define PLAN_NUM_CHANNELS 64 // LPP channels with a priority
+#define PLAN_MAX_PRIO 15	 // Highest channel priority
+#define PLAN_DEFAULT_PRIO 2	 // Priority of channels without default priority
+extern uint8_t g_channel_priority[];
+void plan_default_priorities(void);
+uint8_t plan_max_payload(void);
+uint8_t plan_payload(uint8_t *lpp, uint8_t size, uint8_t max_size, uint8_t **packet);
+void plan_sent(void);
+uint8_t plan_carry_size(void);
+
+// Change driven reporting
+extern uint32_t g_report_heartbeat;
+extern uint16_t g_report_delta[];
+void report_default_deltas(void);
+bool report_due(const uint8_t *lpp, uint8_t size);
+void report_sent(const uint8_t *lpp, uint8_t size);
+uint16_t report_skipped(void);
+
 // Index for known I2C devices
 #define ACC_ID 0	   // RAK1904 accelerometer
 #define LIGHT_ID 1	   // RAK1903 light sensor
@@ -130,14 +230,15 @@ bool init_rak1901(void);
 void read_rak1901(void);
 void get_rak1901_values(float *values);
 bool init_rak1902(void);
-void start_rak1902(void);
+uint32_t start_rak1902(void);
 void read_rak1902(void);
 float get_rak1902(void);
 bool init_rak1903(void);
 void read_rak1903();
 #if USE_BSEC == 0
 bool init_rak1906(void);
-void start_rak1906(void);
+uint32_t start_rak1906(void);
+bool ready_rak1906(void);
 bool read_rak1906(void);
 void get_rak1906_values(float *values);
 #else
@@ -154,13 +255,17 @@ void rak1921_write_header(char *header_line);
 bool init_rak12002(void);
 void set_rak12002(uint16_t year, uint8_t month, uint8_t date, uint8_t hour, uint8_t minute);
 void read_rak12002(void);
+uint32_t get_rak12002_epoch(void);
 bool init_rak12010(void);
 void read_rak12010();
 bool init_rak12019(void);
 void read_rak12019();
 bool init_rak12037(void);
+bool ready_rak12037(void);
 void read_rak12037(void);
 bool init_rak12039(void);
+uint32_t start_rak12039(void);
+bool ready_rak12039(void);
 void read_rak12039(void);
 bool init_rak12047(void);
 void read_rak12047(void);
@@ -168,8 +273,11 @@ void do_read_rak12047(void);
 extern float last_light_lux;
 
 void find_modules(void);
+void clear_bus_map(void);
 void announce_modules(void);
-void get_sensor_values(void);
+uint32_t sensors_ready_wait(void);
+bool get_sensor_values(void);
+bool poll_sensor_values(void);
 
 // RAK14000 EPD stuff
 void init_rak14000(void);
@@ -197,6 +305,7 @@ void startup_rak14000(void);
 void switch_ui(void);
 extern bool g_epd_off;
 extern uint8_t g_ui_selected;
+extern uint8_t g_graph_range;
 
 // Sensor power functions
 void power_modules(bool switch_on);
@@ -230,6 +339,30 @@ void read_batt_settings(void);
 void save_batt_settings(bool check_batt_enables);
 void read_ui_settings(void);
 void save_ui_settings(uint8_t ui_selected);
+void read_payload_settings(void);
+void save_payload_settings(uint8_t payload_format);
+void read_batch_settings(void);
+void save_batch_settings(uint8_t batch_samples);
+void read_priority_settings(void);
+void save_priority_settings(void);
+void read_report_settings(void);
+void save_report_settings(void);
+void read_p2p_settings(void);
+void save_p2p_settings(void);
+void read_sensor_settings(void);
+void save_sensor_settings(void);
+
+// AT output
+#define AT_HEX_CHUNK 32 // Hex characters per AT_PRINTF call
+void at_print_hex(const uint8_t *data, uint16_t len);
+
+// Downlink commands
+#define HIST_DUMP_FORMAT_ID 0xD1 // First byte of a history dump
+#define HIST_DUMP_PORT 4		 // fPort of the history dump
+#define HIST_DUMP_DELAY_MS 5000	 // Delay between the downlink and the history dump
+void init_downlink_cmd(void);
+bool downlink_cmd_handler(uint8_t fport, const uint8_t *data, uint8_t len);
+void send_history_dump(void);
 
 extern bool g_sensors_off;
 /** Latitude/Longitude value union */
@@ -0,0 +1,293 @@
+/**
+ * @file payload_planner.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Fit the sensor values into the maximum payload of the current data rate
+ *        The values are sent by priority. Values that do not fit are kept
+ *        and sent with the next uplink, every uplink they wait raises their priority.
+ *        A new value of a channel replaces the kept value.
+ *        If the uplink is not sent, all planned values are kept.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+
+/** Priority increase per uplink a value had to wait */
+#define PLAN_AGE_STEP 4
+
+/** Maximum number of values in one sample */
+#define PLAN_MAX_ITEMS 32
+
+/** Priority per LPP channel, 0 = lowest, PLAN_MAX_PRIO = highest */
+uint8_t g_channel_priority[PLAN_NUM_CHANNELS];
+
+/** Number of uplinks a channel had to wait */
+static uint8_t deferred[PLAN_NUM_CHANNELS] = {0};
+
+/** Values that are kept for the next uplink, Cayenne LPP format */
+static uint8_t carry_buffer[255];
+static uint8_t carry_size = 0;
+
+/** Values that did not fit into the planned uplink, they are kept after plan_sent() */
+static uint8_t sent_carry[255];
+static uint8_t sent_carry_size = 0;
+
+/** Channels in the planned uplink, bit n = channel n */
+static uint64_t planned_channels = 0;
+
+/** Planned payload, Cayenne LPP format */
+static uint8_t plan_buffer[255];
+
+/** Buffer for the size check of the compact payload */
+static uint8_t check_buffer[COMPACT_MAX_SIZE];
+
+/** One value of the sample */
+struct plan_item_s
+{
+	const uint8_t *data; // Channel, type and value
+	uint8_t size;		 // Size including channel and type
+	uint8_t score;		 // Priority plus waiting time
+};
+
+/** Default priority per LPP channel */
+static const struct
+{
+	uint8_t channel;
+	uint8_t priority;
+} default_priority[] = {
+	{LPP_CHANNEL_VOC, 12},
+	{LPP_CHANNEL_CO2_2, 12},
+	{LPP_CHANNEL_PM_2_5, 11},
+	{LPP_CHANNEL_PM_10_0, 10},
+	{LPP_CHANNEL_PM_1_0, 9},
+	{LPP_CHANNEL_GAS_2, 9},
+	{LPP_CHANNEL_TEMP, 8},
+	{LPP_CHANNEL_TEMP_2, 8},
+	{LPP_CHANNEL_CO2_Temp_2, 7},
+	{LPP_CHANNEL_HUMID, 7},
+	{LPP_CHANNEL_HUMID_2, 7},
+	{LPP_CHANNEL_CO2_HUMID_2, 6},
+	{LPP_CHANNEL_PRESS, 5},
+	{LPP_CHANNEL_PRESS_2, 5},
+	{LPP_CHANNEL_BATT, 4},
+};
+
+/**
+ * @brief Set all channel priorities to the default values
+ *        Channels without default priority get PLAN_DEFAULT_PRIO
+ *
+ */
+void plan_default_priorities(void)
+{
+	memset(g_channel_priority, PLAN_DEFAULT_PRIO, PLAN_NUM_CHANNELS);
+	for (auto &entry : default_priority)
+	{
+		g_channel_priority[entry.channel] = entry.priority;
+	}
+}
+
+/**
+ * @brief Get the maximum payload size of the next uplink
+ *
+ * @return uint8_t maximum payload size
+ */
+uint8_t plan_max_payload(void)
+{
+	if (!g_lorawan_settings.lorawan_enable)
+	{
+		// LoRa P2P, the packet follows the DevEUI or the short address
+		return 255 - p2p_header_size();
+	}
+	// The LoRaMAC knows the data rate, the region and the size of pending MAC commands
+	LoRaMacTxInfo_t tx_info;
+	LoRaMacQueryTxPossible(0, &tx_info);
+	return tx_info.CurrentPayloadSize;
+}
+
+/**
+ * @brief Size of a Cayenne LPP packet in the selected payload format
+ *
+ * @param lpp Cayenne LPP packet
+ * @param size size of the LPP packet
+ * @return uint8_t size of the packet that will be sent
+ */
+static uint8_t encoded_size(const uint8_t *lpp, uint8_t size)
+{
+	if (g_payload_format == PAYLOAD_COMPACT)
+	{
+		uint8_t compact_size = compact_encode(lpp, size, check_buffer, sizeof(check_buffer));
+		if (compact_size != 0)
+		{
+			return compact_size;
+		}
+	}
+	return size;
+}
+
+/**
+ * @brief Split a Cayenne LPP packet into values
+ *
+ * @param lpp Cayenne LPP packet
+ * @param size size of the LPP packet
+ * @param items list of values, new values are added to the end
+ * @param num_items number of values in the list
+ * @return true if the packet could be split
+ * @return false if the packet has an unknown data type
+ */
+static bool split_items(const uint8_t *lpp, uint8_t size, plan_item_s *items, uint8_t *num_items)
+{
+	uint8_t pos = 0;
+	while (pos + 2 <= size)
+	{
+		bool is_signed;
+		uint8_t data_size = lpp_type_size(lpp[pos + 1], &is_signed);
+		if ((data_size == 0) || (pos + 2 + data_size > size) || (*num_items == PLAN_MAX_ITEMS))
+		{
+			return false;
+		}
+		uint8_t channel = lpp[pos] < PLAN_NUM_CHANNELS ? lpp[pos] : 0;
+		uint16_t score = g_channel_priority[channel] + deferred[channel] * PLAN_AGE_STEP;
+		items[*num_items].data = &lpp[pos];
+		items[*num_items].size = 2 + data_size;
+		items[*num_items].score = score > 255 ? 255 : score;
+		(*num_items)++;
+		pos += 2 + data_size;
+	}
+	return true;
+}
+
+/**
+ * @brief Select the values for the next uplink
+ *        The values with the highest priority that fit into max_size are selected.
+ *        Until plan_sent() is called all values are kept for the next uplink,
+ *        an uplink that could not be sent is planned again with the next sample.
+ *
+ * @param lpp Cayenne LPP packet with the new values
+ * @param size size of the LPP packet
+ * @param max_size maximum size of the uplink in the selected payload format
+ * @param packet set to the planned Cayenne LPP packet
+ * @return uint8_t size of the planned Cayenne LPP packet
+ */
+uint8_t plan_payload(uint8_t *lpp, uint8_t size, uint8_t max_size, uint8_t **packet)
+{
+	plan_item_s items[PLAN_MAX_ITEMS];
+	uint8_t num_items = 0;
+
+	// Fast path, everything fits
+	if ((carry_size == 0) && (encoded_size(lpp, size) <= max_size))
+	{
+		memcpy(carry_buffer, lpp, size);
+		carry_size = size;
+		sent_carry_size = 0;
+		planned_channels = 0;
+		*packet = lpp;
+		return size;
+	}
+
+	if (!split_items(lpp, size, items, &num_items))
+	{
+		MYLOG("PLAN", "Unknown data type, send unchanged");
+		memcpy(sent_carry, carry_buffer, carry_size);
+		sent_carry_size = carry_size;
+		planned_channels = 0;
+		*packet = lpp;
+		return size;
+	}
+
+	// Add the kept values of channels that have no new value
+	uint8_t num_new = num_items;
+	plan_item_s kept[PLAN_MAX_ITEMS];
+	uint8_t num_kept = 0;
+	split_items(carry_buffer, carry_size, kept, &num_kept);
+	for (uint8_t idx = 0; (idx < num_kept) && (num_items < PLAN_MAX_ITEMS); idx++)
+	{
+		bool replaced = false;
+		for (uint8_t new_idx = 0; new_idx < num_new; new_idx++)
+		{
+			replaced |= items[new_idx].data[0] == kept[idx].data[0];
+		}
+		if (!replaced)
+		{
+			items[num_items++] = kept[idx];
+		}
+	}
+
+	// Sort by score, keep the order of the packet for the same score
+	for (uint8_t idx = 1; idx < num_items; idx++)
+	{
+		plan_item_s item = items[idx];
+		int8_t pos = idx - 1;
+		while ((pos >= 0) && (items[pos].score < item.score))
+		{
+			items[pos + 1] = items[pos];
+			pos--;
+		}
+		items[pos + 1] = item;
+	}
+
+	// Take the values that fit, the others wait one more uplink
+	uint8_t plan_size = 0;
+	sent_carry_size = 0;
+	planned_channels = 0;
+	for (uint8_t idx = 0; idx < num_items; idx++)
+	{
+		uint8_t channel = items[idx].data[0] < PLAN_NUM_CHANNELS ? items[idx].data[0] : 0;
+		memcpy(&plan_buffer[plan_size], items[idx].data, items[idx].size);
+		if (encoded_size(plan_buffer, plan_size + items[idx].size) <= max_size)
+		{
+			plan_size += items[idx].size;
+			planned_channels |= 1ULL << channel;
+		}
+		else if (sent_carry_size + items[idx].size <= sizeof(sent_carry))
+		{
+			memcpy(&sent_carry[sent_carry_size], items[idx].data, items[idx].size);
+			sent_carry_size += items[idx].size;
+		}
+		if (deferred[channel] < 255)
+		{
+			deferred[channel]++;
+		}
+	}
+
+	// Keep all values until the uplink was sent, the items do not point into carry_buffer anymore
+	uint8_t rest_size = sent_carry_size < sizeof(carry_buffer) - plan_size ? sent_carry_size : sizeof(carry_buffer) - plan_size;
+	memcpy(carry_buffer, plan_buffer, plan_size);
+	memcpy(&carry_buffer[plan_size], sent_carry, rest_size);
+	carry_size = plan_size + rest_size;
+
+	MYLOG("PLAN", "Max %d bytes, sending %d bytes LPP, kept %d bytes", max_size, plan_size, sent_carry_size);
+	*packet = plan_buffer;
+	return plan_size;
+}
+
+/**
+ * @brief The planned uplink was sent
+ *        Only the values that did not fit are kept for the next uplink.
+ *
+ */
+void plan_sent(void)
+{
+	for (uint8_t channel = 0; channel < PLAN_NUM_CHANNELS; channel++)
+	{
+		if (planned_channels & (1ULL << channel))
+		{
+			deferred[channel] = 0;
+		}
+	}
+	memcpy(carry_buffer, sent_carry, sent_carry_size);
+	carry_size = sent_carry_size;
+	sent_carry_size = 0;
+	planned_channels = 0;
+}
+
+/**
+ * @brief Size of the values kept for the next uplink
+ *
+ * @return uint8_t size in Cayenne LPP format
+ */
+uint8_t plan_carry_size(void)
+{
+	return carry_size;
+}
@@ -52,86 +52,78 @@ void status_ui_rak14000(void)
 		}
 	}
 
-	display.getTextBounds(disp_text, 0, 0, &txt_x1, &txt_y1, &txt_w, &txt_h);
+	txt_w = text_bounds_rak14000(SMALL_FONT, disp_text).w;
 	text_rak14000((display_width / 2) - (txt_w / 2), 1, disp_text, (uint16_t)txt_color, 1);
 
-	x_text = 10;
-	y_text = 15;
-	if (g_lorawan_settings.lorawan_enable)
-	{
-		x_graph = 125;
-	}
-	else
-	{
-		x_graph = 150;
-	}
+	const epd_text_pos_t pos = rak14000_layout::status(g_lorawan_settings.lorawan_enable);
+	int16_t y_text = pos.y;
 	display.setFont(SMALL_FONT);
 	display.setTextSize(1);
 
 	snprintf(disp_text, 29, "Device LoRa/LoRaWAN Status:");
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 	y_text += 15;
 
 	snprintf(disp_text, 29, "Send Interval:");
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 	snprintf(disp_text, 29, "%ld s", g_lorawan_settings.send_repeat_time / 1000);
-	text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+	text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 	y_text += 15;
 
 	// snprintf(disp_text, 29, "Device Power:");
-	// text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	// text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 	// snprintf(disp_text, 29, "%s", g_is_using_battery ? "Battery" : "External supply");
-	// text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+	// text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 	// y_text += 15;
 
 	snprintf(disp_text, 29, "Mode:");
-	text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+	text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 	snprintf(disp_text, 29, "%s", g_lorawan_settings.lorawan_enable ? "LPWAN" : "P2P");
-	text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+	text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 	y_text += 15;
 
 	if (g_lorawan_settings.lorawan_enable)
 	{
 		snprintf(disp_text, 29, "Auto Join:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.auto_join ? "Enabled" : "Disabled");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "Network:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lpwan_has_joined ? "Joined" : "Not joined");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "Join Mode:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.otaa_enabled ? "OTAA" : "ABP");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		if (g_lorawan_settings.otaa_enabled)
 		{
 			snprintf(disp_text, 29, "Device EUI:");
-			text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%02X%02X%02X%02X%02X%02X%02X%02X", g_lorawan_settings.node_device_eui[0], g_lorawan_settings.node_device_eui[1],
 					 g_lorawan_settings.node_device_eui[2], g_lorawan_settings.node_device_eui[3],
 					 g_lorawan_settings.node_device_eui[4], g_lorawan_settings.node_device_eui[5],
 					 g_lorawan_settings.node_device_eui[6], g_lorawan_settings.node_device_eui[7]);
-			text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 
 			snprintf(disp_text, 29, "Application EUI:");
-			text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%02X%02X%02X%02X%02X%02X%02X%02X", g_lorawan_settings.node_app_eui[0], g_lorawan_settings.node_app_eui[1],
 					 g_lorawan_settings.node_app_eui[2], g_lorawan_settings.node_app_eui[3],
 					 g_lorawan_settings.node_app_eui[4], g_lorawan_settings.node_app_eui[5],
 					 g_lorawan_settings.node_app_eui[6], g_lorawan_settings.node_app_eui[7]);
-			text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 
 			snprintf(disp_text, 29, "Application Key:");
-			text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X",
 					 g_lorawan_settings.node_app_key[0], g_lorawan_settings.node_app_key[1],
 					 g_lorawan_settings.node_app_key[2], g_lorawan_settings.node_app_key[3],
@@ -141,19 +133,19 @@ void status_ui_rak14000(void)
 					 g_lorawan_settings.node_app_key[10], g_lorawan_settings.node_app_key[11],
 					 g_lorawan_settings.node_app_key[12], g_lorawan_settings.node_app_key[13],
 					 g_lorawan_settings.node_app_key[14], g_lorawan_settings.node_app_key[15]);
-			text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 		}
 		else
 		{
 			snprintf(disp_text, 29, "Device Address:");
-			text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%08lX", g_lorawan_settings.node_dev_addr);
-			text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 
 			snprintf(disp_text, 29, "Network Session Key:");
-			text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X",
 					 g_lorawan_settings.node_nws_key[0], g_lorawan_settings.node_nws_key[1],
 					 g_lorawan_settings.node_nws_key[2], g_lorawan_settings.node_nws_key[3],
@@ -163,11 +155,11 @@ void status_ui_rak14000(void)
 					 g_lorawan_settings.node_nws_key[10], g_lorawan_settings.node_nws_key[11],
 					 g_lorawan_settings.node_nws_key[12], g_lorawan_settings.node_nws_key[13],
 					 g_lorawan_settings.node_nws_key[14], g_lorawan_settings.node_nws_key[15]);
-			text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 
 			snprintf(disp_text, 29, "Application Session Key:");
-			text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X%02X",
 					 g_lorawan_settings.node_apps_key[0], g_lorawan_settings.node_apps_key[1],
 					 g_lorawan_settings.node_apps_key[2], g_lorawan_settings.node_apps_key[3],
@@ -177,62 +169,62 @@ void status_ui_rak14000(void)
 					 g_lorawan_settings.node_apps_key[10], g_lorawan_settings.node_apps_key[11],
 					 g_lorawan_settings.node_apps_key[12], g_lorawan_settings.node_apps_key[13],
 					 g_lorawan_settings.node_apps_key[14], g_lorawan_settings.node_apps_key[15]);
-			text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 		}
 
 		snprintf(disp_text, 29, "Datarate:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.data_rate);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "TX Power:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.tx_power);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "Device Class:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.lora_class == 0 ? "Class A" : "Class C");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "ADR:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.otaa_enabled ? "Enabled" : "Disabled");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "Upload type:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.confirmed_msg_enabled ? "Confirmed" : "Unconfirmed");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "fPort:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.app_port);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "Dutycycle:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.duty_cycle_enabled ? "Enabled" : "Disabled");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "Network type:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", g_lorawan_settings.public_network ? "Public" : "Private");
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "LoRaWAN Region:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", region_names[g_lorawan_settings.lora_region]);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 
 		switch (g_lorawan_settings.lora_region)
 		{
@@ -241,9 +233,9 @@ void status_ui_rak14000(void)
 		case 8:
 		case 12:
 			snprintf(disp_text, 29, "Subband:");
-			text_rak14000(x_text + 200, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + 200, y_text, disp_text, txt_color, 1);
 			snprintf(disp_text, 29, "%d", g_lorawan_settings.subband_channels);
-			text_rak14000(x_text + 300, y_text, disp_text, txt_color, 1);
+			text_rak14000(pos.x + 300, y_text, disp_text, txt_color, 1);
 			y_text += 15;
 			break;
 		}
@@ -251,45 +243,45 @@ void status_ui_rak14000(void)
 	else
 	{
 		snprintf(disp_text, 29, "P2P frequency:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%ld", g_lorawan_settings.p2p_frequency);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "P2P TX Power:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.p2p_tx_power);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "P2P Bandwidth:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%s", bandwidths[g_lorawan_settings.p2p_bandwidth]);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "P2P Spreading Factor:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.p2p_sf);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "P2P Coding Rate:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.p2p_cr);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "P2P Preamble length:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.p2p_preamble_len);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 
 		snprintf(disp_text, 29, "P2P Symbol Timeout:");
-		text_rak14000(x_text, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x, y_text, disp_text, txt_color, 1);
 		snprintf(disp_text, 29, "%d", g_lorawan_settings.p2p_symbol_timeout);
-		text_rak14000(x_text + x_graph, y_text, disp_text, txt_color, 1);
+		text_rak14000(pos.x + pos.spacer, y_text, disp_text, txt_color, 1);
 		y_text += 15;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+/**
+ * @file ring_buffer.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Fixed size ring buffer for the display history
+ *        Values are stored as fixed point int16_t, value * SCALE
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdint.h>
+
+/**
+ * @brief Ring buffer of the last SIZE values
+ *        push() overwrites the oldest value when the buffer is full.
+ *        Index 0 and begin() are the oldest value.
+ *
+ * @tparam T type of the values handed in and out (float, uint16_t, ...)
+ * @tparam SIZE number of values
+ * @tparam SCALE fixed point factor, e.g. 100 stores 2 decimals
+ */
+template <typename T, uint16_t SIZE, int16_t SCALE = 1>
+class RingBuffer
+{
+public:
+	static_assert(SIZE > 0, "RingBuffer needs at least one entry");
+	static_assert(SCALE > 0, "RingBuffer scale must be positive");
+
+	/**
+	 * @brief Iterator from the oldest to the newest value
+	 *
+	 */
+	class iterator
+	{
+	public:
+		iterator(const RingBuffer *buffer, uint16_t idx) : _buffer(buffer), _idx(idx) {}
+		T operator*() const { return (*_buffer)[_idx]; }
+		iterator &operator++()
+		{
+			_idx++;
+			return *this;
+		}
+		bool operator!=(const iterator &other) const { return _idx != other._idx; }
+
+	private:
+		const RingBuffer *_buffer;
+		uint16_t _idx;
+	};
+
+	/**
+	 * @brief Add a value, replaces the oldest value if the buffer is full
+	 *
+	 * @param value new value
+	 */
+	void push(T value)
+	{
+		push_fixed(to_fixed(value));
+	}
+
+	/**
+	 * @brief Add a value that is already in fixed point format
+	 *
+	 * @param value value * SCALE
+	 */
+	void push_fixed(int16_t value)
+	{
+		_values[_head] = value;
+		_head = (_head + 1) % SIZE;
+		if (_count < SIZE)
+		{
+			_count++;
+		}
+		_pushed++;
+	}
+
+	/**
+	 * @brief Get a value
+	 *
+	 * @param idx 0 = oldest value
+	 * @return T value, 0 if idx is not filled yet
+	 */
+	T operator[](uint16_t idx) const
+	{
+		if (idx >= _count)
+		{
+			return (T)0;
+		}
+		return from_fixed(_values[(_head + SIZE - _count + idx) % SIZE]);
+	}
+
+	/**
+	 * @brief Get the newest value
+	 *
+	 * @return T newest value, 0 if the buffer is empty
+	 */
+	T latest(void) const
+	{
+		if (_count == 0)
+		{
+			return (T)0;
+		}
+		return from_fixed(_values[(_head + SIZE - 1) % SIZE]);
+	}
+
+	/** Number of stored values */
+	uint16_t count(void) const { return _count; }
+
+	/** Number of values pushed since the start or the last clear(), wraps at 65536 */
+	uint16_t pushed(void) const { return _pushed; }
+
+	/** Maximum number of values */
+	static constexpr uint16_t capacity(void) { return SIZE; }
+
+	/** Remove all values and restart the pushed count */
+	void clear(void)
+	{
+		_head = 0;
+		_count = 0;
+		_pushed = 0;
+	}
+
+	iterator begin(void) const { return iterator(this, 0); }
+	iterator end(void) const { return iterator(this, _count); }
+
+	/**
+	 * @brief Convert to fixed point, limited to the int16_t range
+	 *
+	 */
+	static int16_t to_fixed(T value)
+	{
+		float scaled = (float)value * SCALE;
+		if (scaled >= 32767.0f)
+		{
+			return 32767;
+		}
+		if (scaled <= -32768.0f)
+		{
+			return -32768;
+		}
+		return (int16_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+	}
+
+	/**
+	 * @brief Convert from fixed point
+	 *
+	 */
+	static T from_fixed(int16_t value)
+	{
+		return (T)((float)value / SCALE);
+	}
+
+private:
+	int16_t _values[SIZE] = {0};
+	uint16_t _head = 0;
+	uint16_t _count = 0;
+	uint16_t _pushed = 0;
+};
+
+#endif // RING_BUFFER_H
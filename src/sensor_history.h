@@ -0,0 +1,251 @@
+/**
+ * @file sensor_history.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Sensor history with raw values and hourly and daily min/max/mean
+ *        The RAM size is fixed, independent of the send interval
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <Arduino.h>
+#include "ring_buffer.h"
+
+/** Time range of the graphs */
+#define HISTORY_RAW 0	// Last raw values
+#define HISTORY_HOURS 1 // Last 24 hours
+#define HISTORY_DAYS 2	// Last 7 days
+
+/**
+ * @brief Raw values plus rollups for hours and days
+ *        Works as RingBuffer for the raw values, each value is added
+ *        to the current hour and day as well. A period starts with its
+ *        first value and is closed by the first value after it ended.
+ *
+ * @tparam T type of the values handed in and out
+ * @tparam SIZE number of raw values
+ * @tparam SCALE fixed point factor, e.g. 100 stores 2 decimals
+ */
+template <typename T, uint16_t SIZE, int16_t SCALE = 1>
+class SensorHistory : public RingBuffer<T, SIZE, SCALE>
+{
+	typedef RingBuffer<T, SIZE, SCALE> raw_t;
+
+public:
+	/** Min, max and mean of one period */
+	struct rollup_t
+	{
+		T min;
+		T max;
+		T mean;
+	};
+
+	/**
+	 * @brief Rollups of the last NUM periods, the running period is the newest entry
+	 *
+	 * @tparam NUM number of periods
+	 * @tparam PERIOD_MS length of a period in ms
+	 */
+	template <uint8_t NUM, uint32_t PERIOD_MS>
+	class Rollups
+	{
+	public:
+		/**
+		 * @brief Add a value to the running period, close the period if it ended
+		 *
+		 * @param value fixed point value
+		 * @param now_ms time of the value
+		 */
+		void add(int16_t value, uint32_t now_ms)
+		{
+			if ((_running.count != 0) && ((uint32_t)(now_ms - _running.start_ms) >= PERIOD_MS))
+			{
+				_periods[_head].min = _running.min;
+				_periods[_head].max = _running.max;
+				_periods[_head].mean = (int16_t)(_running.sum / _running.count);
+				_head = (_head + 1) % (NUM - 1);
+				if (_closed < (NUM - 1))
+				{
+					_closed++;
+				}
+				_running.count = 0;
+			}
+			if (_running.count == 0)
+			{
+				_running.min = value;
+				_running.max = value;
+				_running.sum = 0;
+				_running.start_ms = now_ms;
+			}
+			_running.min = value < _running.min ? value : _running.min;
+			_running.max = value > _running.max ? value : _running.max;
+			_running.sum += value;
+			_running.count++;
+		}
+
+		/** Number of periods with values, including the running period */
+		uint8_t count(void) const { return _closed + (_running.count != 0 ? 1 : 0); }
+
+		/** Maximum number of periods */
+		static constexpr uint8_t capacity(void) { return NUM; }
+
+		/**
+		 * @brief Get the rollup of a period
+		 *
+		 * @param idx 0 = oldest period
+		 * @return rollup_t min, max and mean, all 0 if idx is not filled
+		 */
+		rollup_t operator[](uint8_t idx) const
+		{
+			rollup_t result = {(T)0, (T)0, (T)0};
+			if (idx < _closed)
+			{
+				const stored_t &stored = _periods[(_head + (NUM - 1) - _closed + idx) % (NUM - 1)];
+				result.min = raw_t::from_fixed(stored.min);
+				result.max = raw_t::from_fixed(stored.max);
+				result.mean = raw_t::from_fixed(stored.mean);
+			}
+			else if ((idx == _closed) && (_running.count != 0))
+			{
+				result.min = raw_t::from_fixed(_running.min);
+				result.max = raw_t::from_fixed(_running.max);
+				result.mean = raw_t::from_fixed((int16_t)(_running.sum / _running.count));
+			}
+			return result;
+		}
+
+	private:
+		struct stored_t
+		{
+			int16_t min;
+			int16_t max;
+			int16_t mean;
+		};
+
+		struct running_t
+		{
+			int16_t min = 0;
+			int16_t max = 0;
+			int32_t sum = 0;
+			uint16_t count = 0;
+			uint32_t start_ms = 0;
+		};
+
+		stored_t _periods[NUM - 1] = {};
+		running_t _running;
+		uint8_t _head = 0;
+		uint8_t _closed = 0;
+	};
+
+	typedef Rollups<24, 3600000UL> hours_t;
+	typedef Rollups<7, 86400000UL> days_t;
+
+	/**
+	 * @brief Add a value with the current time
+	 *
+	 * @param value new value
+	 */
+	void push(T value)
+	{
+		push(value, millis());
+	}
+
+	/**
+	 * @brief Add a value
+	 *
+	 * @param value new value
+	 * @param now_ms time of the value in ms
+	 */
+	void push(T value, uint32_t now_ms)
+	{
+		push_fixed(raw_t::to_fixed(value), now_ms);
+	}
+
+	/**
+	 * @brief Add a value that is already in fixed point format
+	 *
+	 * @param value value * SCALE
+	 * @param now_ms time of the value in ms
+	 */
+	void push_fixed(int16_t value, uint32_t now_ms)
+	{
+		raw_t::push_fixed(value);
+		_hours.add(value, now_ms);
+		_days.add(value, now_ms);
+	}
+
+	const hours_t &hours(void) const { return _hours; }
+	const days_t &days(void) const { return _days; }
+
+private:
+	hours_t _hours;
+	days_t _days;
+};
+
+/**
+ * @brief Get the newest values of a history in fixed point format, oldest first
+ *
+ * @tparam H SensorHistory type
+ * @param h history
+ * @param range HISTORY_RAW for raw values, HISTORY_HOURS or HISTORY_DAYS for the means
+ * @param values buffer for the values
+ * @param max size of the buffer
+ * @return uint8_t number of values
+ */
+template <class H>
+uint8_t history_fixed_values(const H &h, uint8_t range, int16_t *values, uint8_t max)
+{
+	uint16_t count = range == HISTORY_HOURS ? h.hours().count() : (range == HISTORY_DAYS ? h.days().count() : h.count());
+	uint16_t first = count > max ? count - max : 0;
+	for (uint16_t idx = first; idx < count; idx++)
+	{
+		switch (range)
+		{
+		case HISTORY_HOURS:
+			values[idx - first] = h.to_fixed(h.hours()[idx].mean);
+			break;
+		case HISTORY_DAYS:
+			values[idx - first] = h.to_fixed(h.days()[idx].mean);
+			break;
+		default:
+			values[idx - first] = h.to_fixed(h[idx]);
+			break;
+		}
+	}
+	return count - first;
+}
+
+/**
+ * @brief Entry of the history log table
+ *        Each display variant lists its histories in history_channels[],
+ *        the index in the table is the channel number in the log
+ *
+ */
+typedef struct history_channel_s
+{
+	void *history;									 // SensorHistory object, saved as snapshot
+	uint16_t size;									 // Size of the object
+	void (*push_fixed)(int16_t value, uint32_t time_ms); // Add a value to the object
+	uint8_t (*fixed_values)(uint8_t range, int16_t *values, uint8_t max, int16_t *scale); // Read the newest values
+} history_channel_t;
+
+/** Table entry for a SensorHistory object */
+#define HISTORY_CHANNEL(h) {(void *)&h, sizeof(h), [](int16_t value, uint32_t time_ms) { h.push_fixed(value, time_ms); }, \
+	[](uint8_t range, int16_t *values, uint8_t max, int16_t *scale) -> uint8_t { *scale = h.to_fixed(1); return history_fixed_values(h, range, values, max); }}
+
+extern history_channel_t history_channels[];
+extern const uint8_t num_history_channels;
+
+// History log functions
+uint32_t history_time(void);
+void history_add(uint8_t channel, int16_t value);
+void history_log_restore(void);
+void history_log_flush(void);
+void history_log_compact(void);
+uint8_t history_values(uint8_t channel, uint8_t range, int16_t *values, uint8_t max, int16_t *scale);
+
+#endif // SENSOR_HISTORY_H
@@ -0,0 +1,192 @@
+/**
+ * @file uplink_batch.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Collect several sensor samples and send them in one uplink
+ *        Frame format:
+ *        1 byte format ID 0xB1
+ *        1 byte flags, bit 0 set if the time is from the RTC (seconds since 1970), otherwise uptime in seconds
+ *        1 byte number of records
+ *        4 bytes time of the first record, MSB first
+ *        records:
+ *        2 bytes seconds since the previous record, MSB first, 0 for the first record
+ *        1 byte size of the sample
+ *        sample as Cayenne LPP or compact payload
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+
+/** Size of the frame header */
+#define BATCH_HEADER_SIZE 7
+
+/** Size of the record header */
+#define BATCH_RECORD_HEADER 3
+
+/** Flag for time from the RTC */
+#define BATCH_FLAG_RTC 0x01
+
+/** Number of samples per uplink, 1 = send every sample */
+uint8_t g_batch_samples = 1;
+
+/** Frame buffer */
+static uint8_t batch_buffer[BATCH_MAX_SIZE];
+
+/** Used size of the frame buffer */
+static uint8_t batch_size = 0;
+
+/** Time of the last record in the frame */
+static uint32_t last_time = 0;
+
+/** Sample that did not fit into the frame, it is the first record of the next frame */
+static uint8_t carry_buffer[BATCH_MAX_SIZE - BATCH_HEADER_SIZE - BATCH_RECORD_HEADER];
+static uint8_t carry_size = 0;
+static uint32_t carry_time = 0;
+
+/**
+ * @brief Get the time of a sample
+ *
+ * @param from_rtc set to true if the time is from the RTC
+ * @return uint32_t seconds since 1970 or seconds since power up
+ */
+static uint32_t sample_time(bool *from_rtc)
+{
+	*from_rtc = found_sensors[RTC_ID].found_sensor;
+	if (*from_rtc)
+	{
+		return get_rak12002_epoch();
+	}
+	return millis() / 1000;
+}
+
+/**
+ * @brief Append a record to the frame, start a new frame if it is empty
+ *
+ * @param packet sample
+ * @param size size of the sample
+ * @param time time of the sample
+ * @param from_rtc true if the time is from the RTC
+ */
+static void append_record(const uint8_t *packet, uint8_t size, uint32_t time, bool from_rtc)
+{
+	uint32_t delta = 0;
+	if (batch_size == 0)
+	{
+		batch_buffer[0] = BATCH_FORMAT_ID;
+		batch_buffer[1] = from_rtc ? BATCH_FLAG_RTC : 0;
+		batch_buffer[2] = 0;
+		batch_buffer[3] = (uint8_t)(time >> 24);
+		batch_buffer[4] = (uint8_t)(time >> 16);
+		batch_buffer[5] = (uint8_t)(time >> 8);
+		batch_buffer[6] = (uint8_t)(time);
+		batch_size = BATCH_HEADER_SIZE;
+	}
+	else
+	{
+		delta = time - last_time;
+		delta = delta > 0xFFFF ? 0xFFFF : delta;
+	}
+	last_time = time;
+
+	batch_buffer[batch_size++] = (uint8_t)(delta >> 8);
+	batch_buffer[batch_size++] = (uint8_t)(delta);
+	batch_buffer[batch_size++] = size;
+	memcpy(&batch_buffer[batch_size], packet, size);
+	batch_size += size;
+	batch_buffer[2]++;
+}
+
+/**
+ * @brief Maximum sample size that fits into a frame
+ *
+ * @param max_size maximum size of the uplink
+ * @return uint8_t maximum size of a sample
+ */
+uint8_t batch_max_sample(uint8_t max_size)
+{
+	max_size = max_size > BATCH_MAX_SIZE ? BATCH_MAX_SIZE : max_size;
+	return max_size > BATCH_HEADER_SIZE + BATCH_RECORD_HEADER ? max_size - BATCH_HEADER_SIZE - BATCH_RECORD_HEADER : 0;
+}
+
+/**
+ * @brief Add a sample to the frame
+ *        If the sample does not fit, it is kept for the next frame
+ *        and the current frame has to be sent first.
+ *        A frame that could not be sent stays complete, the next sample
+ *        is added to it or kept for the next frame.
+ *
+ * @param packet sample
+ * @param size size of the sample
+ * @param max_size maximum size of the uplink with the current data rate
+ * @return true if the frame is complete and has to be sent
+ * @return false if more samples are needed or the sample is too large for a frame
+ */
+bool batch_add(const uint8_t *packet, uint8_t size, uint8_t max_size)
+{
+	max_size = max_size > BATCH_MAX_SIZE ? BATCH_MAX_SIZE : max_size;
+	bool from_rtc;
+	uint32_t time = sample_time(&from_rtc);
+
+	if (size > sizeof(carry_buffer))
+	{
+		// A cut sample could not be decoded
+		MYLOG("BATCH", "Sample too large for a batch, dropped");
+		return false;
+	}
+
+	if ((batch_size != 0) && (batch_size + BATCH_RECORD_HEADER + size > max_size))
+	{
+		if (carry_size != 0)
+		{
+			MYLOG("BATCH", "Frame was not sent, kept sample replaced");
+		}
+		memcpy(carry_buffer, packet, size);
+		carry_size = size;
+		carry_time = time;
+		MYLOG("BATCH", "Frame full after %d samples", batch_buffer[2]);
+		return true;
+	}
+
+	append_record(packet, size, time, from_rtc);
+	MYLOG("BATCH", "Sample %d of %d, frame size %d", batch_buffer[2], g_batch_samples, batch_size);
+	return batch_buffer[2] >= g_batch_samples;
+}
+
+/**
+ * @brief Get the frame
+ *
+ * @param frame set to the frame buffer
+ * @return uint8_t size of the frame, 0 if it is empty
+ */
+uint8_t batch_frame(uint8_t **frame)
+{
+	*frame = batch_buffer;
+	return batch_size;
+}
+
+/**
+ * @brief Start a new frame after the frame was sent
+ *        A sample that did not fit into the last frame becomes the first record
+ *
+ */
+void batch_clear(void)
+{
+	batch_size = 0;
+	if (carry_size != 0)
+	{
+		append_record(carry_buffer, carry_size, carry_time, found_sensors[RTC_ID].found_sensor);
+		carry_size = 0;
+	}
+}
+
+/**
+ * @brief Number of samples in the frame
+ *
+ * @return uint8_t number of samples
+ */
+uint8_t batch_count(void)
+{
+	return batch_size == 0 ? 0 : batch_buffer[2];
+}
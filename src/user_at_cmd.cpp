@@ -26,6 +26,48 @@ static const char ui_name[] = "UI";
 
 /** File to save UI status */
 File ui_check(InternalFS);
+
+/** Filename to save the graph range */
+static const char graph_name[] = "GRAPH";
+
+/** File to save the graph range */
+File graph_check(InternalFS);
+
+/** Filename to save payload format setting */
+static const char payload_name[] = "PFMT";
+
+/** File to save payload format */
+File payload_check(InternalFS);
+
+/** Filename to save the number of samples per uplink */
+static const char batch_name[] = "BATCH";
+
+/** File to save the number of samples per uplink */
+File batch_check(InternalFS);
+
+/** Filename to save the channel priorities */
+static const char priority_name[] = "PRIO";
+
+/** File to save the channel priorities */
+File priority_check(InternalFS);
+
+/** Filename to save the heartbeat and the channel deltas */
+static const char report_name[] = "REPORT";
+
+/** File to save the heartbeat and the channel deltas */
+File report_check(InternalFS);
+
+/** Filename to save the P2P short address */
+static const char p2p_name[] = "P2PADR";
+
+/** File to save the P2P short address */
+File p2p_check(InternalFS);
+
+/** Filename to save the disabled sensors */
+static const char sensor_name[] = "SENSOFF";
+
+/** File to save the disabled sensors */
+File sensor_check(InternalFS);
 #endif
 #ifdef ESP32
 #include <Preferences.h>
@@ -67,6 +109,36 @@ int at_query_ui(void)
 	return AT_SUCCESS;
 }
 
+/**
+ * @brief Set the time range of the graphs
+ *
+ * @param str 0 = last values, 1 = 24 hours, 2 = 7 days
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value
+ */
+static int at_set_graph(char *str)
+{
+	long new_range = strtol(str, NULL, 0);
+
+	if ((new_range < 0) || (new_range > 2))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_graph_range = new_range;
+	save_ui_settings(g_ui_selected);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the time range of the graphs
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_graph(void)
+{
+	AT_PRINTF("%d", g_graph_range);
+	return AT_SUCCESS;
+}
+
 /**
  * @brief List of all available commands with short help and pointer to functions
  *
@@ -75,14 +147,16 @@ atcmd_t g_user_at_cmd_list_ui[] = {
 	/*|    CMD    |     AT+CMD?      |    AT+CMD=?    |  AT+CMD=value |  AT+CMD  | Permissions |*/
 	// Module commands
 	{"+UI", "Switch display UI", at_query_ui, at_set_ui, NULL, "RW"},
+	{"+GRAPH", "Graph range, 0 = last values, 1 = 24 hours, 2 = 7 days", at_query_graph, at_set_graph, NULL, "RW"},
 };
 
 /**
- * @brief Read saved setting UI selection
+ * @brief Read saved setting UI selection and graph range
  *
  */
 void read_ui_settings(void)
 {
+	g_graph_range = 0;
 #ifdef NRF52_SERIES
 	if (InternalFS.exists(ui_name))
 	{
@@ -94,10 +168,21 @@ void read_ui_settings(void)
 		g_ui_selected = 1;
 		MYLOG("USR_AT", "File not found, set UI 1 (iconized)");
 	}
+	if (graph_check.open(graph_name, FILE_O_READ))
+	{
+		uint8_t range;
+		if ((graph_check.read(&range, 1) == 1) && (range <= 2))
+		{
+			g_graph_range = range;
+		}
+		graph_check.close();
+		MYLOG("USR_AT", "File found, set graph range %d", g_graph_range);
+	}
 #endif
 #ifdef ESP32
 	esp32_prefs.begin("ui", false);
 	g_ui_selected = esp32_prefs.getInt8("ui", 0);
+	g_graph_range = esp32_prefs.getUChar("graph", 0);
 	esp32_prefs.end();
 #endif
 
@@ -105,7 +190,7 @@ void read_ui_settings(void)
 }
 
 /**
- * @brief Save the UI settings
+ * @brief Save the UI settings and the graph range
  *
  */
 void save_ui_settings(uint8_t ui_selected)
@@ -123,10 +208,19 @@ void save_ui_settings(uint8_t ui_selected)
 		InternalFS.remove(ui_name);
 		MYLOG("USR_AT", "Remove File for UI selection 1");
 	}
+	InternalFS.remove(graph_name);
+	if (g_graph_range != 0)
+	{
+		graph_check.open(graph_name, FILE_O_WRITE);
+		graph_check.write(&g_graph_range, 1);
+		graph_check.close();
+		MYLOG("USR_AT", "Saved graph range %d", g_graph_range);
+	}
 #endif
 #ifdef ESP32
 	esp32_prefs.begin("ui", false);
 	esp32_prefs.putBool("ui", ui_selected);
+	esp32_prefs.putUChar("graph", g_graph_range);
 	esp32_prefs.end();
 #endif
 }
@@ -146,6 +240,56 @@ int at_query_modules(void)
 	return AT_SUCCESS;
 }
 
+/**
+ * @brief Delete the saved I2C bus map, all modules are searched on next boot
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_exec_rescan(void)
+{
+	clear_bus_map();
+	AT_PRINTF("Full module search on next boot");
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query I2C clock and access times of the found modules
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_i2c(void)
+{
+	i2c_bus_report();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query I2C transaction counters of the found modules
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_i2c_stats(void)
+{
+	i2c_bus_stats_report();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Reset the I2C counters
+ *
+ * @param str 0 to reset all counters
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value
+ */
+static int at_set_i2c_stats(char *str)
+{
+	if (str[0] != '0')
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	i2c_bus_stats_clear();
+	return AT_SUCCESS;
+}
+
 /**
  * @brief List of all available commands with short help and pointer to functions
  *
@@ -154,6 +298,9 @@ atcmd_t g_user_at_cmd_list_modules[] = {
 	/*|    CMD    |     AT+CMD?      |    AT+CMD=?    |  AT+CMD=value |  AT+CMD  | Permissions |*/
 	// Module commands
 	{"+MOD", "List all connected I2C devices", at_query_modules, NULL, at_query_modules, "RW"},
+	{"+RESCAN", "Search all modules on next boot", NULL, NULL, at_exec_rescan, "RW"},
+	{"+I2C", "I2C clock and access time per module", at_query_i2c, NULL, at_query_i2c, "R"},
+	{"+I2CSTAT", "I2C bytes, NACKs, retries and worst latency per module, =0 to reset", at_query_i2c_stats, at_set_i2c_stats, at_query_i2c_stats, "RW"},
 };
 
 /*****************************************
@@ -367,6 +514,637 @@ atcmd_t g_user_at_cmd_list_batt[] = {
 	{"+BATCHK", "Enable/Disable the battery charge check", at_query_batt_check, at_set_batt_check, at_query_batt_check, "RW"},
 };
 
+/*****************************************
+ * Payload format AT commands
+ *****************************************/
+
+/**
+ * @brief Select the payload format
+ *
+ * @param str 0 = Cayenne LPP, 1 = compact
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value
+ */
+static int at_set_payload(char *str)
+{
+	long new_format = strtol(str, NULL, 0);
+
+	if ((new_format != PAYLOAD_LPP) && (new_format != PAYLOAD_COMPACT))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_payload_format = new_format;
+	save_payload_settings(g_payload_format);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the payload format
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_payload(void)
+{
+	AT_PRINTF("%d", g_payload_format);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved payload format
+ *
+ */
+void read_payload_settings(void)
+{
+#ifdef NRF52_SERIES
+	if (InternalFS.exists(payload_name))
+	{
+		g_payload_format = PAYLOAD_COMPACT;
+		MYLOG("USR_AT", "File found, use compact payload");
+	}
+	else
+	{
+		g_payload_format = PAYLOAD_LPP;
+		MYLOG("USR_AT", "File not found, use Cayenne LPP payload");
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("pfmt", false);
+	g_payload_format = esp32_prefs.getUChar("pfmt", PAYLOAD_LPP);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Save the payload format
+ *
+ */
+void save_payload_settings(uint8_t payload_format)
+{
+#ifdef NRF52_SERIES
+	if (payload_format == PAYLOAD_COMPACT)
+	{
+		payload_check.open(payload_name, FILE_O_WRITE);
+		payload_check.write("1");
+		payload_check.close();
+		MYLOG("USR_AT", "Created File for compact payload");
+	}
+	else
+	{
+		InternalFS.remove(payload_name);
+		MYLOG("USR_AT", "Remove File for compact payload");
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("pfmt", false);
+	esp32_prefs.putUChar("pfmt", payload_format);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Set the number of samples per uplink
+ *
+ * @param str 1 = send every sample, 2 to BATCH_MAX_SAMPLES = collect samples
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value
+ */
+static int at_set_batch(char *str)
+{
+	long new_samples = strtol(str, NULL, 0);
+
+	if ((new_samples < 1) || (new_samples > BATCH_MAX_SAMPLES))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_batch_samples = new_samples;
+	save_batch_settings(g_batch_samples);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the number of samples per uplink
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_batch(void)
+{
+	AT_PRINTF("%d", g_batch_samples);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved number of samples per uplink
+ *
+ */
+void read_batch_settings(void)
+{
+#ifdef NRF52_SERIES
+	g_batch_samples = 1;
+	if (batch_check.open(batch_name, FILE_O_READ))
+	{
+		uint8_t samples = 1;
+		batch_check.read(&samples, 1);
+		batch_check.close();
+		if ((samples >= 1) && (samples <= BATCH_MAX_SAMPLES))
+		{
+			g_batch_samples = samples;
+		}
+		MYLOG("USR_AT", "File found, send %d samples per uplink", g_batch_samples);
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("batch", false);
+	g_batch_samples = esp32_prefs.getUChar("batch", 1);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Save the number of samples per uplink
+ *
+ */
+void save_batch_settings(uint8_t batch_samples)
+{
+#ifdef NRF52_SERIES
+	InternalFS.remove(batch_name);
+	if (batch_samples > 1)
+	{
+		batch_check.open(batch_name, FILE_O_WRITE);
+		batch_check.write(batch_samples);
+		batch_check.close();
+		MYLOG("USR_AT", "Saved %d samples per uplink", batch_samples);
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("batch", false);
+	esp32_prefs.putUChar("batch", batch_samples);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Set the priority of a channel for the payload planner
+ *
+ * @param str <channel>:<priority>, priority 0 to PLAN_MAX_PRIO
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM or AT_ERRNO_PARA_VAL if invalid
+ */
+static int at_set_priority(char *str)
+{
+	char *param = strtok(str, ":");
+	if (param == NULL)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	long channel = strtol(param, NULL, 0);
+	param = strtok(NULL, ":");
+	if (param == NULL)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	long priority = strtol(param, NULL, 0);
+
+	if ((channel < 1) || (channel >= PLAN_NUM_CHANNELS) || (priority < 0) || (priority > PLAN_MAX_PRIO))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_channel_priority[channel] = priority;
+	save_priority_settings();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the channel priorities
+ *        Lists the channels that do not have the default priority as <channel>:<priority>
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_priority(void)
+{
+	char prio_txt[PLAN_NUM_CHANNELS * 6] = {0};
+	uint16_t len = 0;
+	for (uint8_t channel = 1; channel < PLAN_NUM_CHANNELS; channel++)
+	{
+		if (g_channel_priority[channel] != PLAN_DEFAULT_PRIO)
+		{
+			len += snprintf(&prio_txt[len], sizeof(prio_txt) - len, "%s%d:%d", len == 0 ? "" : " ", channel, g_channel_priority[channel]);
+		}
+	}
+	AT_PRINTF("%s", prio_txt);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved channel priorities
+ *
+ */
+void read_priority_settings(void)
+{
+	plan_default_priorities();
+#ifdef NRF52_SERIES
+	if (priority_check.open(priority_name, FILE_O_READ))
+	{
+		uint8_t priorities[PLAN_NUM_CHANNELS];
+		if (priority_check.read(priorities, PLAN_NUM_CHANNELS) == PLAN_NUM_CHANNELS)
+		{
+			memcpy(g_channel_priority, priorities, PLAN_NUM_CHANNELS);
+			MYLOG("USR_AT", "File found, use saved channel priorities");
+		}
+		priority_check.close();
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("prio", false);
+	if (esp32_prefs.getBytesLength("prio") == PLAN_NUM_CHANNELS)
+	{
+		esp32_prefs.getBytes("prio", g_channel_priority, PLAN_NUM_CHANNELS);
+	}
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Save the channel priorities
+ *
+ */
+void save_priority_settings(void)
+{
+#ifdef NRF52_SERIES
+	InternalFS.remove(priority_name);
+	priority_check.open(priority_name, FILE_O_WRITE);
+	priority_check.write(g_channel_priority, PLAN_NUM_CHANNELS);
+	priority_check.close();
+	MYLOG("USR_AT", "Saved channel priorities");
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("prio", false);
+	esp32_prefs.putBytes("prio", g_channel_priority, PLAN_NUM_CHANNELS);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Set the heartbeat of the change driven reporting
+ *
+ * @param str maximum time between two uplinks in seconds, 0 = send every sample
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value
+ */
+static int at_set_heartbeat(char *str)
+{
+	long new_heartbeat = strtol(str, NULL, 0);
+
+	if ((new_heartbeat < 0) || (new_heartbeat > 7 * 24 * 60 * 60))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_report_heartbeat = new_heartbeat;
+	save_report_settings();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the heartbeat
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_heartbeat(void)
+{
+	AT_PRINTF("%lu", (unsigned long)g_report_heartbeat);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Set the change of a channel that triggers an uplink
+ *
+ * @param str <channel>:<delta>, delta in the resolution of the Cayenne LPP value, 0 = channel does not trigger an uplink
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM or AT_ERRNO_PARA_VAL if invalid
+ */
+static int at_set_delta(char *str)
+{
+	char *param = strtok(str, ":");
+	if (param == NULL)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	long channel = strtol(param, NULL, 0);
+	param = strtok(NULL, ":");
+	if (param == NULL)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	long delta = strtol(param, NULL, 0);
+
+	if ((channel < 1) || (channel >= PLAN_NUM_CHANNELS) || (delta < 0) || (delta > 65535))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_report_delta[channel] = delta;
+	save_report_settings();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the channel deltas
+ *        Lists the channels that trigger an uplink as <channel>:<delta>
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_delta(void)
+{
+	char delta_txt[PLAN_NUM_CHANNELS * 9] = {0};
+	uint16_t len = 0;
+	for (uint8_t channel = 1; channel < PLAN_NUM_CHANNELS; channel++)
+	{
+		if (g_report_delta[channel] != 0)
+		{
+			len += snprintf(&delta_txt[len], sizeof(delta_txt) - len, "%s%d:%d", len == 0 ? "" : " ", channel, g_report_delta[channel]);
+		}
+	}
+	AT_PRINTF("%s", delta_txt);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved heartbeat and channel deltas
+ *
+ */
+void read_report_settings(void)
+{
+	g_report_heartbeat = 0;
+	report_default_deltas();
+#ifdef NRF52_SERIES
+	if (report_check.open(report_name, FILE_O_READ))
+	{
+		uint32_t heartbeat;
+		uint16_t deltas[PLAN_NUM_CHANNELS];
+		if ((report_check.read(&heartbeat, sizeof(heartbeat)) == sizeof(heartbeat)) && (report_check.read(deltas, sizeof(deltas)) == sizeof(deltas)))
+		{
+			g_report_heartbeat = heartbeat;
+			memcpy(g_report_delta, deltas, sizeof(deltas));
+			MYLOG("USR_AT", "File found, heartbeat %ld s", g_report_heartbeat);
+		}
+		report_check.close();
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("report", false);
+	g_report_heartbeat = esp32_prefs.getULong("heartbeat", 0);
+	if (esp32_prefs.getBytesLength("delta") == sizeof(uint16_t) * PLAN_NUM_CHANNELS)
+	{
+		esp32_prefs.getBytes("delta", g_report_delta, sizeof(uint16_t) * PLAN_NUM_CHANNELS);
+	}
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Save the heartbeat and the channel deltas
+ *
+ */
+void save_report_settings(void)
+{
+#ifdef NRF52_SERIES
+	InternalFS.remove(report_name);
+	report_check.open(report_name, FILE_O_WRITE);
+	report_check.write((uint8_t *)&g_report_heartbeat, sizeof(g_report_heartbeat));
+	report_check.write((uint8_t *)g_report_delta, sizeof(uint16_t) * PLAN_NUM_CHANNELS);
+	report_check.close();
+	MYLOG("USR_AT", "Saved heartbeat %ld s and channel deltas", g_report_heartbeat);
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("report", false);
+	esp32_prefs.putULong("heartbeat", g_report_heartbeat);
+	esp32_prefs.putBytes("delta", g_report_delta, sizeof(uint16_t) * PLAN_NUM_CHANNELS);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Set the P2P short address
+ *
+ * @param str 1 to 65535 = 2 byte short address as P2P header, 0 = 8 byte DevEUI as P2P header
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_VAL if invalid value
+ */
+static int at_set_p2p_addr(char *str)
+{
+	long new_addr = strtol(str, NULL, 0);
+
+	if ((new_addr < 0) || (new_addr > 0xFFFF))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	g_p2p_short_addr = new_addr;
+	save_p2p_settings();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the P2P short address
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_p2p_addr(void)
+{
+	AT_PRINTF("%d", g_p2p_short_addr);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved P2P short address
+ *
+ */
+void read_p2p_settings(void)
+{
+#ifdef NRF52_SERIES
+	g_p2p_short_addr = 0;
+	if (p2p_check.open(p2p_name, FILE_O_READ))
+	{
+		uint8_t addr[2];
+		if (p2p_check.read(addr, 2) == 2)
+		{
+			g_p2p_short_addr = (uint16_t)(addr[0]) << 8 | addr[1];
+		}
+		p2p_check.close();
+		MYLOG("USR_AT", "File found, P2P short address %04X", g_p2p_short_addr);
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("p2p", false);
+	g_p2p_short_addr = esp32_prefs.getUShort("addr", 0);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Save the P2P short address
+ *
+ */
+void save_p2p_settings(void)
+{
+#ifdef NRF52_SERIES
+	InternalFS.remove(p2p_name);
+	if (g_p2p_short_addr != 0)
+	{
+		uint8_t addr[2] = {(uint8_t)(g_p2p_short_addr >> 8), (uint8_t)(g_p2p_short_addr)};
+		p2p_check.open(p2p_name, FILE_O_WRITE);
+		p2p_check.write(addr, 2);
+		p2p_check.close();
+		MYLOG("USR_AT", "Saved P2P short address %04X", g_p2p_short_addr);
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("p2p", false);
+	esp32_prefs.putUShort("addr", g_p2p_short_addr);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Enable or disable a sensor
+ *
+ * @param str <sensor ID>:<1 = enable, 0 = disable>
+ * @return int AT_SUCCESS if ok, AT_ERRNO_PARA_NUM or AT_ERRNO_PARA_VAL if invalid
+ */
+static int at_set_sensor(char *str)
+{
+	char *param = strtok(str, ":");
+	if (param == NULL)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	long sensor_id = strtol(param, NULL, 0);
+	param = strtok(NULL, ":");
+	if (param == NULL)
+	{
+		return AT_ERRNO_PARA_NUM;
+	}
+	long enable = strtol(param, NULL, 0);
+
+	if ((sensor_id < 0) || (sensor_id >= NUM_SENSOR_ENTRIES) || (enable < 0) || (enable > 1))
+	{
+		return AT_ERRNO_PARA_VAL;
+	}
+	if (enable == 1)
+	{
+		g_sensors_disabled &= ~(1ULL << sensor_id);
+	}
+	else
+	{
+		g_sensors_disabled |= 1ULL << sensor_id;
+	}
+	save_sensor_settings();
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Query the disabled sensors
+ *        Lists the IDs of the disabled sensors
+ *
+ * @return int AT_SUCCESS
+ */
+static int at_query_sensor(void)
+{
+	char sensor_txt[NUM_SENSOR_ENTRIES * 3 + 1] = {0};
+	uint16_t len = 0;
+	for (uint8_t sensor_id = 0; sensor_id < NUM_SENSOR_ENTRIES; sensor_id++)
+	{
+		if (g_sensors_disabled & (1ULL << sensor_id))
+		{
+			len += snprintf(&sensor_txt[len], sizeof(sensor_txt) - len, "%s%d", len == 0 ? "" : " ", sensor_id);
+		}
+	}
+	AT_PRINTF("%s", sensor_txt);
+	return AT_SUCCESS;
+}
+
+/**
+ * @brief Read saved disabled sensors
+ *
+ */
+void read_sensor_settings(void)
+{
+	g_sensors_disabled = 0;
+#ifdef NRF52_SERIES
+	if (sensor_check.open(sensor_name, FILE_O_READ))
+	{
+		uint64_t disabled;
+		if (sensor_check.read(&disabled, sizeof(disabled)) == sizeof(disabled))
+		{
+			g_sensors_disabled = disabled;
+		}
+		sensor_check.close();
+		MYLOG("USR_AT", "File found, disabled sensors %08lX%08lX", (uint32_t)(g_sensors_disabled >> 32), (uint32_t)g_sensors_disabled);
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("sensoff", false);
+	g_sensors_disabled = esp32_prefs.getULong64("sensoff", 0);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Save the disabled sensors
+ *
+ */
+void save_sensor_settings(void)
+{
+#ifdef NRF52_SERIES
+	InternalFS.remove(sensor_name);
+	if (g_sensors_disabled != 0)
+	{
+		sensor_check.open(sensor_name, FILE_O_WRITE);
+		sensor_check.write((uint8_t *)&g_sensors_disabled, sizeof(g_sensors_disabled));
+		sensor_check.close();
+		MYLOG("USR_AT", "Saved disabled sensors");
+	}
+#endif
+#ifdef ESP32
+	esp32_prefs.begin("sensoff", false);
+	esp32_prefs.putULong64("sensoff", g_sensors_disabled);
+	esp32_prefs.end();
+#endif
+}
+
+/**
+ * @brief Print data as hex string to the AT output, followed by a line feed
+ *        The hex string is built in a small buffer and printed in chunks,
+ *        a 242 byte downlink needs 16 AT_PRINTF calls instead of a 512 byte buffer.
+ *
+ * @param data data to print
+ * @param len size of the data
+ */
+void at_print_hex(const uint8_t *data, uint16_t len)
+{
+	static const char hex_digits[] = "0123456789ABCDEF";
+	char chunk[AT_HEX_CHUNK + 2];
+	uint8_t pos = 0;
+	for (uint16_t idx = 0; idx < len; idx++)
+	{
+		chunk[pos++] = hex_digits[data[idx] >> 4];
+		chunk[pos++] = hex_digits[data[idx] & 0x0F];
+		if (pos == AT_HEX_CHUNK)
+		{
+			chunk[pos] = 0;
+			AT_PRINTF("%s", chunk);
+			pos = 0;
+		}
+	}
+	chunk[pos++] = '\n';
+	chunk[pos] = 0;
+	AT_PRINTF("%s", chunk);
+}
+
+/** Structure for AT commands */
+atcmd_t g_user_at_cmd_list_payload[] = {
+	/*|    CMD    |     AT+CMD?      |    AT+CMD=?    |  AT+CMD=value |  AT+CMD  | Permissions |*/
+	// Payload format commands
+	{"+PAYLOAD", "Payload format, 0 = Cayenne LPP, 1 = compact", at_query_payload, at_set_payload, at_query_payload, "RW"},
+	{"+BATCH", "Samples per uplink, 1 = send every sample", at_query_batch, at_set_batch, at_query_batch, "RW"},
+	{"+PRIO", "Channel priority <channel>:<0-15>, values that do not fit are sent later", at_query_priority, at_set_priority, at_query_priority, "RW"},
+	{"+HEARTBEAT", "Max. seconds between uplinks if no value changed, 0 = send every sample", at_query_heartbeat, at_set_heartbeat, at_query_heartbeat, "RW"},
+	{"+DELTA", "Change of a channel that triggers an uplink <channel>:<delta>", at_query_delta, at_set_delta, at_query_delta, "RW"},
+	{"+P2PADDR", "P2P short address 1-65535 instead of the DevEUI, 0 = DevEUI", at_query_p2p_addr, at_set_p2p_addr, at_query_p2p_addr, "RW"},
+	{"+SENSOR", "Enable/disable a sensor <sensor ID>:<1/0>, query lists disabled IDs", at_query_sensor, at_set_sensor, at_query_sensor, "RW"},
+};
+
 /** Number of user defined AT commands */
 uint8_t g_user_at_cmd_num = 0;
 
@@ -386,6 +1164,8 @@ void init_user_at(void)
 	MYLOG("USR_AT", "Structure size %d Modules", required_structure_size);
 	required_structure_size += sizeof(g_user_at_cmd_list_ui);
 	MYLOG("USR_AT", "Structure size %d UI", required_structure_size);
+	required_structure_size += sizeof(g_user_at_cmd_list_payload);
+	MYLOG("USR_AT", "Structure size %d Payload", required_structure_size);
 
 	// Get required size of structure
 	if (found_sensors[RTC_ID].found_sensor)
@@ -417,6 +1197,12 @@ void init_user_at(void)
 	index_next_cmds += sizeof(g_user_at_cmd_list_ui) / sizeof(atcmd_t);
 	MYLOG("USR_AT", "Index after adding UI commands %d", index_next_cmds);
 
+	MYLOG("USR_AT", "Adding payload AT commands");
+	g_user_at_cmd_num += sizeof(g_user_at_cmd_list_payload) / sizeof(atcmd_t);
+	memcpy((void *)&g_user_at_cmd_list[index_next_cmds], (void *)g_user_at_cmd_list_payload, sizeof(g_user_at_cmd_list_payload));
+	index_next_cmds += sizeof(g_user_at_cmd_list_payload) / sizeof(atcmd_t);
+	MYLOG("USR_AT", "Index after adding payload commands %d", index_next_cmds);
+
 	if (found_sensors[RTC_ID].found_sensor)
 	{
 		MYLOG("USR_AT", "Adding RTC user AT commands");
@@ -23,6 +23,39 @@ union latLong_s
 	int8_t val8[4];
 };
 
+/**
+ * @brief Reserve space for a header in front of the packet
+ *        The header can then be written without copying the packet.
+ *        Must be called before data is added.
+ *
+ * @param size size of the header
+ */
+void WisCayenne::reserveHeader(uint8_t size)
+{
+	_maxsize += _header_size;
+	_header_size = size > _maxsize ? _maxsize : size;
+	_buffer = _frame + _header_size;
+	_maxsize -= _header_size;
+	_cursor = 0;
+}
+
+/**
+ * @brief Write a header directly in front of the packet
+ *
+ * @param header header data
+ * @param size size of the header, not more than the reserved size
+ * @return uint8_t* start of the header, the packet follows the header, NULL if the header is too large
+ */
+uint8_t *WisCayenne::setHeader(const uint8_t *header, uint8_t size)
+{
+	if (size > _header_size)
+	{
+		return NULL;
+	}
+	memcpy(_buffer - size, header, size);
+	return _buffer - size;
+}
+
 /**
  * @brief Add GNSS data in Cayenne LPP standard format
  *
@@ -29,7 +29,12 @@
 class WisCayenne : public CayenneLPP
 {
 public:
-	WisCayenne(uint8_t size) : CayenneLPP(size) {}
+	WisCayenne(uint8_t size) : CayenneLPP(size) { _frame = _buffer; }
+	// The base class frees _buffer, give it back the start of the allocated buffer
+	~WisCayenne() { _buffer = _frame; }
+
+	void reserveHeader(uint8_t size);
+	uint8_t *setHeader(const uint8_t *header, uint8_t size);
 
 	uint8_t addGNSS_4(uint8_t channel, int32_t latitude, int32_t longitude, int32_t altitude);
 	uint8_t addGNSS_6(uint8_t channel, int32_t latitude, int32_t longitude, int32_t altitude);
@@ -38,5 +43,9 @@ public:
 	uint8_t addVoc_index(uint8_t channel, uint32_t voc_index);
 
 private:
+	/** Start of the allocated buffer, the packet starts after the reserved header */
+	uint8_t *_frame;
+	/** Size of the reserved header */
+	uint8_t _header_size = 0;
 };
 #endif
\ No newline at end of file
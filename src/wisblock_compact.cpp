@@ -0,0 +1,182 @@
+/**
+ * @file wisblock_compact.cpp
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Compact binary payload as alternative to Cayenne LPP
+ *        Packet format:
+ *        1 byte format ID 0xC1
+ *        3 bytes bitmap, MSB of the first byte is the first schema entry
+ *        bit fields of the values that are in the bitmap, MSB first, in schema order
+ *        The sensors still fill the Cayenne LPP packet, it is converted before sending.
+ *        The decoder is in decoders/Compact-Payload-Decoder.js, it has to use the same schema.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "app.h"
+#include "wisblock_compact.h"
+
+/**
+ * @brief Schema of the compact payload
+ *        Entries can only be added at the end, otherwise old packets are decoded wrong.
+ *
+ */
+constexpr compact_field_t compact_schema[] = {
+	// LPP channel, LPP type, bits, offset, divisor
+	{LPP_CHANNEL_BATT, LPP_VOLTAGE, 8, 0, 2},						 // 0 ... 5.10 V, 0.02 V
+	{LPP_CHANNEL_HUMID, LPP_RELATIVE_HUMIDITY, 7, 0, 2},			 // 0 ... 127 %, 1 %
+	{LPP_CHANNEL_TEMP, LPP_TEMPERATURE, 11, -400, 1},				 // -40 ... 164.7 °C, 0.1 °C
+	{LPP_CHANNEL_PRESS, LPP_BAROMETRIC_PRESSURE, 14, 3000, 1},		 // 300 ... 1938.3 hPa, 0.1 hPa
+	{LPP_CHANNEL_LIGHT, LPP_LUMINOSITY, 16, 0, 1},					 // 0 ... 65535 lux
+	{LPP_CHANNEL_HUMID_2, LPP_RELATIVE_HUMIDITY, 7, 0, 2},			 // 0 ... 127 %, 1 %
+	{LPP_CHANNEL_TEMP_2, LPP_TEMPERATURE, 11, -400, 1},				 // -40 ... 164.7 °C, 0.1 °C
+	{LPP_CHANNEL_PRESS_2, LPP_BAROMETRIC_PRESSURE, 14, 3000, 1},	 // 300 ... 1938.3 hPa, 0.1 hPa
+	{LPP_CHANNEL_GAS_2, LPP_ANALOG_INPUT, 9, 0, 100},				 // IAQ 0 ... 511
+	{LPP_CHANNEL_LIGHT2, LPP_LUMINOSITY, 16, 0, 1},					 // 0 ... 65535 lux
+	{LPP_CHANNEL_VOC, LPP_VOC, 9, 0, 1},							 // VOC index 0 ... 511
+	{LPP_CHANNEL_UVI, LPP_ANALOG_INPUT, 11, 0, 1},					 // UV index 0 ... 20.47
+	{LPP_CHANNEL_UVS, LPP_LUMINOSITY, 16, 0, 1},					 // UVS 0 ... 65535
+	{LPP_CHANNEL_CO2_2, LPP_CONCENTRATION, 14, 0, 1},				 // 0 ... 16383 ppm
+	{LPP_CHANNEL_CO2_Temp_2, LPP_TEMPERATURE, 11, -400, 1},			 // -40 ... 164.7 °C, 0.1 °C
+	{LPP_CHANNEL_CO2_HUMID_2, LPP_RELATIVE_HUMIDITY, 7, 0, 2},		 // 0 ... 127 %, 1 %
+	{LPP_CHANNEL_PM_1_0, LPP_VOC, 10, 0, 1},						 // 0 ... 1023 ug/m3
+	{LPP_CHANNEL_PM_2_5, LPP_VOC, 10, 0, 1},						 // 0 ... 1023 ug/m3
+	{LPP_CHANNEL_PM_10_0, LPP_VOC, 10, 0, 1},						 // 0 ... 1023 ug/m3
+};
+
+/** Number of entries in the schema */
+const uint8_t compact_num_fields = sizeof(compact_schema) / sizeof(compact_field_t);
+
+/**
+ * @brief Sum of the bit field sizes from a schema entry to the end
+ *
+ * @param idx first schema entry
+ * @return constexpr uint16_t number of bits
+ */
+static constexpr uint16_t schema_bits(uint8_t idx)
+{
+	return idx < sizeof(compact_schema) / sizeof(compact_field_t) ? compact_schema[idx].bits + schema_bits(idx + 1) : 0;
+}
+
+static_assert(sizeof(compact_schema) / sizeof(compact_field_t) <= COMPACT_BITMAP_SIZE * 8, "Schema has more entries than the bitmap");
+static_assert(1 + COMPACT_BITMAP_SIZE + (schema_bits(0) + 7) / 8 == COMPACT_MAX_SIZE, "COMPACT_MAX_SIZE does not match the schema");
+
+/**
+ * @brief Get size and sign of a Cayenne LPP data type
+ *
+ * @param type LPP data type
+ * @param is_signed set to true if the value is signed
+ * @return uint8_t data size, 0 if the type is not used by the application
+ */
+uint8_t lpp_type_size(uint8_t type, bool *is_signed)
+{
+	*is_signed = false;
+	switch (type)
+	{
+	case LPP_ANALOG_INPUT:
+		*is_signed = true;
+		return LPP_ANALOG_INPUT_SIZE;
+	case LPP_TEMPERATURE:
+		*is_signed = true;
+		return LPP_TEMPERATURE_SIZE;
+	case LPP_LUMINOSITY:
+		return LPP_LUMINOSITY_SIZE;
+	case LPP_RELATIVE_HUMIDITY:
+		return LPP_RELATIVE_HUMIDITY_SIZE;
+	case LPP_BAROMETRIC_PRESSURE:
+		return LPP_BAROMETRIC_PRESSURE_SIZE;
+	case LPP_VOLTAGE:
+		return LPP_VOLTAGE_SIZE;
+	case LPP_CONCENTRATION:
+		return LPP_CONCENTRATION_SIZE;
+	case LPP_VOC:
+		return LPP_VOC_SIZE;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Convert a Cayenne LPP packet into a compact packet
+ *        If a channel appears twice, the last value is used.
+ *
+ * @param lpp_buffer Cayenne LPP packet
+ * @param lpp_size size of the LPP packet
+ * @param buffer buffer for the compact packet
+ * @param max_size size of the buffer
+ * @return uint8_t size of the compact packet, 0 if the LPP packet has a value that is not in the schema
+ */
+uint8_t compact_encode(const uint8_t *lpp_buffer, uint8_t lpp_size, uint8_t *buffer, uint8_t max_size)
+{
+	uint16_t values[COMPACT_BITMAP_SIZE * 8];
+	uint32_t present = 0;
+
+	// Collect the values from the LPP packet
+	uint8_t pos = 0;
+	while (pos + 2 <= lpp_size)
+	{
+		uint8_t channel = lpp_buffer[pos++];
+		uint8_t type = lpp_buffer[pos++];
+		bool is_signed;
+		uint8_t size = lpp_type_size(type, &is_signed);
+		uint8_t field = 0;
+		while ((field < compact_num_fields) && ((compact_schema[field].lpp_channel != channel) || (compact_schema[field].lpp_type != type)))
+		{
+			field++;
+		}
+		if ((size == 0) || (field == compact_num_fields) || (pos + size > lpp_size))
+		{
+			MYLOG("COMP", "Channel %d type %d not in schema", channel, type);
+			return 0;
+		}
+
+		int32_t value = 0;
+		for (uint8_t idx = 0; idx < size; idx++)
+		{
+			value = (value << 8) | lpp_buffer[pos++];
+		}
+		if (is_signed && (value & (1L << (size * 8 - 1))))
+		{
+			value -= 1L << (size * 8);
+		}
+
+		// Scale to the resolution of the field and limit to the bit field size
+		const compact_field_t &schema = compact_schema[field];
+		int32_t max_value = (1L << schema.bits) - 1;
+		value = (value - schema.offset + schema.divisor / 2) / schema.divisor;
+		value = value < 0 ? 0 : (value > max_value ? max_value : value);
+		values[field] = (uint16_t)value;
+		present |= 1UL << field;
+	}
+
+	// Pack format ID, bitmap and bit fields
+	if (max_size < 1 + COMPACT_BITMAP_SIZE)
+	{
+		return 0;
+	}
+	memset(buffer, 0, max_size);
+	buffer[0] = COMPACT_FORMAT_ID;
+	uint16_t bit_pos = (1 + COMPACT_BITMAP_SIZE) * 8;
+	for (uint8_t field = 0; field < compact_num_fields; field++)
+	{
+		if ((present & (1UL << field)) == 0)
+		{
+			continue;
+		}
+		buffer[1 + field / 8] |= 0x80 >> (field % 8);
+		if ((bit_pos + compact_schema[field].bits + 7) / 8 > max_size)
+		{
+			return 0;
+		}
+		for (int8_t bit = compact_schema[field].bits - 1; bit >= 0; bit--)
+		{
+			if (values[field] & (1U << bit))
+			{
+				buffer[bit_pos / 8] |= 0x80 >> (bit_pos % 8);
+			}
+			bit_pos++;
+		}
+	}
+	return (bit_pos + 7) / 8;
+}
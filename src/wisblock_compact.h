@@ -0,0 +1,51 @@
+/**
+ * @file wisblock_compact.h
+ * @author Bernd Giesecke (bernd.giesecke@rakwireless.com)
+ * @brief Compact binary payload as alternative to Cayenne LPP
+ *        The values are packed as bit fields in the order of a fixed
+ *        schema, a bitmap marks which values are in the packet.
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef WISBLOCK_COMPACT_H
+#define WISBLOCK_COMPACT_H
+
+#include <Arduino.h>
+
+/** Payload formats */
+#define PAYLOAD_LPP 0	  // Cayenne LPP
+#define PAYLOAD_COMPACT 1 // Compact bit fields
+
+/** First byte of a compact packet, Cayenne LPP packets start with a channel number < 0x80 */
+#define COMPACT_FORMAT_ID 0xC1
+
+/** Size of the presence bitmap */
+#define COMPACT_BITMAP_SIZE 3
+
+/**
+ * @brief Schema entry of one value
+ *        compact value = (LPP value - offset) / divisor, limited to 0 ... 2^bits - 1
+ *
+ */
+struct compact_field_t
+{
+	uint8_t lpp_channel; // Cayenne LPP channel of the value
+	uint8_t lpp_type;	 // Cayenne LPP data type of the value
+	uint8_t bits;		 // Size of the bit field
+	int16_t offset;		 // LPP value that is sent as 0
+	uint8_t divisor;	 // LPP steps per compact step
+};
+
+extern const compact_field_t compact_schema[];
+extern const uint8_t compact_num_fields;
+
+/** Largest compact packet, format ID, bitmap and all values */
+#define COMPACT_MAX_SIZE 31
+
+uint8_t lpp_type_size(uint8_t type, bool *is_signed);
+uint8_t compact_encode(const uint8_t *lpp_buffer, uint8_t lpp_size, uint8_t *buffer, uint8_t max_size);
+
+#endif // WISBLOCK_COMPACT_H